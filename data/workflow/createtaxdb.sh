@@ -94,11 +94,15 @@ if notExists "${TAXDBNAME}_mapping"; then
 
     if [ "$MAPPINGMODE" = "0" ]; then
         awk 'NR == FNR { f[$1] = $2; next } $2 in f { print $1"\t"f[$2] }' \
-            "$MAPPINGFILE" "${TAXDBNAME}.lookup" > "${TAXDBNAME}_mapping"
+            "$MAPPINGFILE" "${TAXDBNAME}.lookup" > "${TMP_PATH}/mapping"
     else
         awk 'FNR == 1 { fidx++; } fidx == 1 { tax[$1] = $2; next; } fidx == 2 { source[$1] = tax[$2]; next; } fidx == 3 { print $1"\t"source[$3]; next; }' \
-            "$MAPPINGFILE" "${TAXDBNAME}.source" "${TAXDBNAME}.lookup" > "${TAXDBNAME}_mapping"
+            "$MAPPINGFILE" "${TAXDBNAME}.source" "${TAXDBNAME}.lookup" > "${TMP_PATH}/mapping"
     fi
+    # shellcheck disable=SC2086
+    "${MMSEQS}" createbintaxmapping "${TMP_PATH}/mapping" "${TAXDBNAME}_mapping" ${VERBOSITY_PAR} \
+        || fail "createbintaxmapping failed"
+    rm -f "${TMP_PATH}/mapping"
 fi
 
 if [ -n "$REMOVE_TMP" ]; then
@@ -476,9 +476,13 @@ if [ -n "${TAXONOMY}" ] && notExists "${OUTDB}_mapping"; then
        "${MMSEQS}" prefixid "${OUTDB}_h" "${TMP_PATH}/header_pref.tsv" --tsv ${THREADS_PAR} \
            || fail "prefixid died"
        awk '{ match($0, / OX=[0-9]+ /); if (RLENGTH != -1) { print $1"\t"substr($0, RSTART+4, RLENGTH-5); next; } match($0, / TaxID=[0-9]+ /); print $1"\t"substr($0, RSTART+7, RLENGTH-8); }' "${TMP_PATH}/header_pref.tsv" \
-           | LC_ALL=C sort -n > "${OUTDB}_mapping"
+           | LC_ALL=C sort -n > "${TMP_PATH}/mapping"
        rm -f "${TMP_PATH}/header_pref.tsv"
        # shellcheck disable=SC2086
+       "${MMSEQS}" createbintaxmapping "${TMP_PATH}/mapping" "${OUTDB}_mapping" ${VERB_PAR} \
+           || fail "createbintaxmapping died"
+       rm -f "${TMP_PATH}/mapping"
+       # shellcheck disable=SC2086
        "${MMSEQS}" createtaxdb "${OUTDB}" "${TMP_PATH}/taxonomy" ${THREADS_PAR} \
            || fail "createtaxdb died"
        ;;
@@ -18,22 +18,32 @@ INPUT="$1"
 TMP_PATH="$3"
 SOURCE="$INPUT"
 
-# 1. Finding exact $k$-mer matches.
-if notExists "${TMP_PATH}/pref.dbtype"; then
-    # shellcheck disable=SC2086
-    $RUNNER "$MMSEQS" kmermatcher "$INPUT" "${TMP_PATH}/pref" ${KMERMATCHER_PAR} \
-        || fail "kmermatcher died"
-fi
-# 2. Hamming distance pre-clustering
-if notExists "${TMP_PATH}/pref_rescore1.dbtype"; then
-    # shellcheck disable=SC2086
-    $RUNNER "$MMSEQS" rescorediagonal "$INPUT" "$INPUT" "${TMP_PATH}/pref" "${TMP_PATH}/pref_rescore1" ${HAMMING_PAR} \
-        || fail "Rescore with hamming distance step died"
-fi
-if notExists "${TMP_PATH}/pre_clust.dbtype"; then
-    # shellcheck disable=SC2086
-    "$MMSEQS" clust "$INPUT" "${TMP_PATH}/pref_rescore1" "${TMP_PATH}/pre_clust" ${CLUSTER_PAR} \
-        || fail "Pre-clustering step died"
+if [ -n "$FUSED_PRECLUST" ]; then
+    # 1. and 2. k-mer matching, hamming distance pre-clustering and filtering in one step
+    # pref_filter2 is written last
+    if notExists "${TMP_PATH}/pref_filter2.dbtype"; then
+        # shellcheck disable=SC2086
+        "$MMSEQS" kmerclust "$INPUT" "${TMP_PATH}/pre_clust" "${TMP_PATH}/pref_filter2" ${KMERCLUST_PAR} \
+            || fail "kmerclust died"
+    fi
+else
+    # 1. Finding exact $k$-mer matches.
+    if notExists "${TMP_PATH}/pref.dbtype"; then
+        # shellcheck disable=SC2086
+        $RUNNER "$MMSEQS" kmermatcher "$INPUT" "${TMP_PATH}/pref" ${KMERMATCHER_PAR} \
+            || fail "kmermatcher died"
+    fi
+    # 2. Hamming distance pre-clustering
+    if notExists "${TMP_PATH}/pref_rescore1.dbtype"; then
+        # shellcheck disable=SC2086
+        $RUNNER "$MMSEQS" rescorediagonal "$INPUT" "$INPUT" "${TMP_PATH}/pref" "${TMP_PATH}/pref_rescore1" ${HAMMING_PAR} \
+            || fail "Rescore with hamming distance step died"
+    fi
+    if notExists "${TMP_PATH}/pre_clust.dbtype"; then
+        # shellcheck disable=SC2086
+        "$MMSEQS" clust "$INPUT" "${TMP_PATH}/pref_rescore1" "${TMP_PATH}/pre_clust" ${CLUSTER_PAR} \
+            || fail "Pre-clustering step died"
+    fi
 fi
 
 awk '{ print $1 }' "${TMP_PATH}/pre_clust.index" > "${TMP_PATH}/order_redundancy"
@@ -43,13 +53,13 @@ if notExists "${TMP_PATH}/input_step_redundancy.dbtype"; then
         || fail "Createsubdb step died"
 fi
 
-if notExists "${TMP_PATH}/pref_filter1.dbtype"; then
-    # shellcheck disable=SC2086
-    "$MMSEQS" createsubdb "${TMP_PATH}/order_redundancy" "${TMP_PATH}/pref" "${TMP_PATH}/pref_filter1" ${VERBOSITY} --subdb-mode 1 \
-        || fail "Createsubdb step died"
-fi
-
 if notExists "${TMP_PATH}/pref_filter2.dbtype"; then
+    if notExists "${TMP_PATH}/pref_filter1.dbtype"; then
+        # shellcheck disable=SC2086
+        "$MMSEQS" createsubdb "${TMP_PATH}/order_redundancy" "${TMP_PATH}/pref" "${TMP_PATH}/pref_filter1" ${VERBOSITY} --subdb-mode 1 \
+            || fail "Createsubdb step died"
+    fi
+
     # shellcheck disable=SC2086
     "$MMSEQS" filterdb "${TMP_PATH}/pref_filter1" "${TMP_PATH}/pref_filter2" --filter-file "${TMP_PATH}/order_redundancy" ${VERBOSITYANDCOMPRESS} \
         || fail "Filterdb step died"
@@ -89,12 +99,14 @@ if notExists "${TMP_PATH}/clu.dbtype"; then
 fi
 
 if [ -n "$REMOVE_TMP" ]; then
-    # shellcheck disable=SC2086
-    "$MMSEQS" rmdb "${TMP_PATH}/pref_filter1" ${VERBOSITY}
-    # shellcheck disable=SC2086
-    "$MMSEQS" rmdb "${TMP_PATH}/pref" ${VERBOSITY}
-    # shellcheck disable=SC2086
-    "$MMSEQS" rmdb "${TMP_PATH}/pref_rescore1" ${VERBOSITY}
+    if [ -z "$FUSED_PRECLUST" ]; then
+        # shellcheck disable=SC2086
+        "$MMSEQS" rmdb "${TMP_PATH}/pref_filter1" ${VERBOSITY}
+        # shellcheck disable=SC2086
+        "$MMSEQS" rmdb "${TMP_PATH}/pref" ${VERBOSITY}
+        # shellcheck disable=SC2086
+        "$MMSEQS" rmdb "${TMP_PATH}/pref_rescore1" ${VERBOSITY}
+    fi
     # shellcheck disable=SC2086
     "$MMSEQS" rmdb "${TMP_PATH}/pre_clust" ${VERBOSITY}
     # shellcheck disable=SC2086
@@ -49,6 +49,28 @@ if notExists "${PROFILEDB}.dbtype"; then
     ln -s "${TARGET}.dbtype" "${PROFILEDB}.dbtype"
     cp -f "${TARGET}.index" "${PROFILEDB}.index"
 
+    # decode the profiles once for the alignments of all steps
+    if [ -f "${TARGET}.profilelookup" ]; then
+        ln -s "${TARGET}.profilelookup" "${PROFILEDB}.profilelookup"
+    elif [ -n "${PROFILELOOKUP_SIZE}" ]; then
+        if [ "${AVAIL_DISK}" -eq 0 ]; then
+            LOOKUP_DISK_SPACE=$(($("$MMSEQS" diskspaceavail "${TMP_PATH}")/2))
+        else
+            LOOKUP_DISK_SPACE="${AVAIL_DISK}"
+        fi
+        # the lookup may take at most half of the disk space, the rest is left for the results of the steps
+        # without it align decodes the profiles of every step
+        if [ "${PROFILELOOKUP_SIZE}" -le "$((LOOKUP_DISK_SPACE/2))" ]; then
+            # shellcheck disable=SC2086
+            "$MMSEQS" createprofilelookup "${PROFILEDB}" ${PROFILELOOKUP_PAR} \
+                || fail "createprofilelookup died"
+            # a computed disk space allowance sees the lookup as used space
+            if [ "${AVAIL_DISK}" -ne 0 ]; then
+                AVAIL_DISK="$((AVAIL_DISK-PROFILELOOKUP_SIZE))"
+            fi
+        fi
+    fi
+
     echo "${AVAIL_DISK}" > "${PROFILEDB}.meta"
 else
     read -r AVAIL_DISK < "${PROFILEDB}.meta"
@@ -177,8 +199,10 @@ done
 # swap alignment of current step chunk
 if notExists "${TMP_PATH}/aln.done"; then
     # keep only the top max-seqs hits according to the default alignment sorting criteria
+    # the profile DB with all entries aligns from the profile lookup
+    cp -f "${TARGET}.index" "${PROFILEDB}.index"
     # shellcheck disable=SC2086
-    "$MMSEQS" align "${TARGET}" "${INPUT}" "${TMP_PATH}/aln_merged" "${TMP_PATH}/aln" ${ALIGNMENT_PAR} \
+    "$MMSEQS" align "${PROFILEDB}" "${INPUT}" "${TMP_PATH}/aln_merged" "${TMP_PATH}/aln" ${ALIGNMENT_PAR} \
        || fail "sortresult died"
     # rmdb of aln_merged to avoid conflict with unmerged dbs: aln_merged.0, .1...
        # shellcheck disable=SC2086
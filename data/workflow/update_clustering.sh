@@ -10,9 +10,9 @@ notExists() {
 }
 
 log() {
-    if [ "${VERBOSITY}" = "-v 3" ]; then
-        echo "$@"
-    fi
+    case "${VERBOSITY}" in
+        *"-v 3"*) echo "$@" ;;
+    esac
 }
 
 abspath() {
@@ -29,6 +29,54 @@ abspath() {
     fi
 }
 
+formatTime() {
+    echo "$(($1 / 3600))h $(($1 % 3600 / 60))m $(($1 % 60))s"
+}
+
+# logs the time since the previous call
+timing() {
+    NOW="$(date +%s)"
+    log "Time for $1: $(formatTime $((NOW - STAGE_START)))"
+    STAGE_START="${NOW}"
+}
+
+# createsubdb links the headers and other ancillary files, but a segment has to outlive its input databases
+# createindex copies compressed entries into the index without the zstd dictionary of their database,
+# so the entries of a database compressed with a dictionary are decompressed
+# $1: DB written by createsubdb
+unlinkSegment() {
+    if [ -f "$1.zdict" ]; then
+        # shellcheck disable=SC2086
+        "$MMSEQS" decompress "$1" "$1.decompressed" ${THREADS_PAR} \
+            || fail "decompress died"
+        # shellcheck disable=SC2086
+        "$MMSEQS" rmdb "$1" ${VERBOSITY} || fail "rmdb died"
+        # shellcheck disable=SC2086
+        "$MMSEQS" mvdb "$1.decompressed" "$1" ${VERBOSITY} || fail "mvdb died"
+    fi
+    for f in "$1"_* "$1".*; do
+        if [ -L "$f" ]; then
+            rm -f "$f"
+        fi
+    done
+}
+
+# creates an indexed segment of the representative index
+# $1: DB with the representatives as keys, $2: sequence DB, $3: segment
+createSegment() {
+    # shellcheck disable=SC2086
+    "$MMSEQS" createsubdb "$1" "$2" "$3" ${VERBOSITY} \
+        || fail "createsubdb died"
+    unlinkSegment "$3"
+    # shellcheck disable=SC2086
+    "$MMSEQS" createsubdb "$1" "$2_h" "$3_h" ${VERBOSITY} \
+        || fail "createsubdb died"
+    unlinkSegment "$3_h"
+    # shellcheck disable=SC2086
+    "$MMSEQS" createindex "$3" "${TMP_PATH}/createindex" ${CREATEINDEX_PAR} \
+        || fail "createindex died"
+}
+
 # check number of input variables
 [ "$#" -ne 6 ] && echo "Please provide <i:oldSequenceDB> <i:newSequenceDB> <i:oldClusteringDB> <o:newMappedSequenceDB> <o:newClusteringDB> <o:tmpDir>" && exit 1
 # check if files exist
@@ -45,11 +93,23 @@ NEWMAPDB="$(abspath "$4")"
 NEWCLUST="$(abspath "$5")"
 TMP_PATH="$(abspath "$6")"
 
+# The representative index is a list of indexed sequence DBs (segments) next to the clustering.
+# Each update links the segments of the previous clustering and only indexes its new representatives.
+OLDREPINDEX="${OLDCLUST}_repindex"
+NEWREPINDEX="${NEWCLUST}_repindex"
+REPINDEX="${TMP_PATH}/repindex"
+# all representatives are indexed again once there are more segments
+MAX_SEGMENTS=8
+
+START="$(date +%s)"
+STAGE_START="${START}"
+
 if notExists "${TMP_PATH}/removedSeqs"; then
     # shellcheck disable=SC2086
     "$MMSEQS" diffseqdbs "$OLDDB" "$NEWDB" "${TMP_PATH}/removedSeqs" "${TMP_PATH}/mappingSeqs" "${TMP_PATH}/newSeqs" ${DIFF_PAR} \
         || fail "Diff died"
 fi
+timing "diff"
 
 if [ ! -s "${TMP_PATH}/mappingSeqs" ]; then
     cat <<WARN
@@ -124,6 +184,7 @@ if notExists "${NEWMAPDB}.dbtype"; then
         || fail "renamedbkeys died"
 fi
 NEWDB="${NEWMAPDB}"
+timing "mapping"
 
 if notExists "${TMP_PATH}/NEWDB.newSeqs.dbtype"; then
     log "=== Filter out new from old sequences"
@@ -132,19 +193,81 @@ if notExists "${TMP_PATH}/NEWDB.newSeqs.dbtype"; then
         || fail "createsubdb died"
 fi
 
-if notExists "${TMP_PATH}/OLDDB.repSeq.dbtype"; then
-    log "=== Extract representative sequences"
-    # shellcheck disable=SC2086
-    "$MMSEQS" result2repseq "$OLDDB" "$OLDCLUST" "${TMP_PATH}/OLDDB.repSeq" ${RESULT2REPSEQ_PAR} \
-        || fail "result2repseq died"
-fi
+if [ -n "${REP_INDEX}" ]; then
+    if notExists "${REPINDEX}/segments"; then
+        mkdir -p "${REPINDEX}"
+        if [ -f "${OLDREPINDEX}/segments" ]; then
+            log "=== Link representative index"
+            # segments are never changed, so hard links are enough
+            for f in "${OLDREPINDEX}"/*; do
+                ln -f "$f" "${REPINDEX}/" 2>/dev/null || cp -f "$f" "${REPINDEX}/" \
+                    || fail "copy of representative index died"
+            done
+            # the list of segments is appended to, a hard link would change the index of the old clustering
+            rm -f "${REPINDEX}/segments"
+            cp -f "${OLDREPINDEX}/segments" "${REPINDEX}/segments" \
+                || fail "copy of representative index died"
+        else
+            log "=== Create representative index"
+            createSegment "$OLDCLUST" "$OLDDB" "${REPINDEX}/segment_0"
+            echo "segment_0" > "${REPINDEX}/segments"
+        fi
+    fi
+    timing "representative index"
 
-if notExists "${TMP_PATH}/newSeqsHits.dbtype"; then
-    log "=== Search new sequences against representatives"
-    # shellcheck disable=SC2086
-    "$MMSEQS" search "${TMP_PATH}/NEWDB.newSeqs" "${TMP_PATH}/OLDDB.repSeq" "${TMP_PATH}/newSeqsHits" "${TMP_PATH}/search" ${SEARCH_PAR} \
-        || fail "search died"
+    if notExists "${TMP_PATH}/newSeqsHits.dbtype"; then
+        log "=== Search new sequences against representative index"
+        # E-values are computed for all representatives and not only for the segment that is searched
+        # segments still contain the representatives removed in this or earlier updates
+        awk '{ print $1 }' "${OLDCLUST}.index" > "${TMP_PATH}/repSeqs"
+        SEGMENT_INDICES=""
+        while read -r SEGMENT; do
+            SEGMENT_INDICES="${SEGMENT_INDICES} ${REPINDEX}/${SEGMENT}.index"
+        done < "${REPINDEX}/segments"
+        # shellcheck disable=SC2086
+        REP_DB_SIZE="$(awk 'NR == FNR { rep[$1] = 1; next } ($1 in rep) && !($1 in seen) { seen[$1] = 1; size += $3 - 2 } END { printf "%.0f\n", size }' \
+            "${TMP_PATH}/repSeqs" ${SEGMENT_INDICES})"
+        SEGMENT_HITS=""
+        while read -r SEGMENT; do
+            if notExists "${TMP_PATH}/newSeqsHits.${SEGMENT}.dbtype"; then
+                # shellcheck disable=SC2086
+                "$MMSEQS" search "${TMP_PATH}/NEWDB.newSeqs" "${REPINDEX}/${SEGMENT}" "${TMP_PATH}/newSeqsHits.${SEGMENT}" "${TMP_PATH}/search" ${SEARCH_PAR} --db-size "${REP_DB_SIZE}" \
+                    || fail "search died"
+            fi
+            SEGMENT_HITS="${SEGMENT_HITS} ${TMP_PATH}/newSeqsHits.${SEGMENT}"
+        done < "${REPINDEX}/segments"
+
+        # shellcheck disable=SC2086
+        "$MMSEQS" mergedbs "${TMP_PATH}/NEWDB.newSeqs" "${TMP_PATH}/newSeqsHits.merged" ${SEGMENT_HITS} ${VERBOSITY} \
+            || fail "mergedbs died"
+        # shellcheck disable=SC2086
+        "$MMSEQS" filterdb "${TMP_PATH}/newSeqsHits.merged" "${TMP_PATH}/newSeqsHits.existing" --filter-file "${TMP_PATH}/repSeqs" --positive-filter 1 ${THREADS_PAR} \
+            || fail "filterdb died"
+        # keep the best hit over all segments, ties go to the older segment
+        # shellcheck disable=SC2086
+        "$MMSEQS" filterdb "${TMP_PATH}/newSeqsHits.existing" "${TMP_PATH}/newSeqsHits.sorted" --sort-entries 2 --filter-column 2 ${THREADS_PAR} \
+            || fail "filterdb died"
+        # shellcheck disable=SC2086
+        "$MMSEQS" filterdb "${TMP_PATH}/newSeqsHits.sorted" "${TMP_PATH}/newSeqsHits" --extract-lines 1 ${THREADS_PAR} \
+            || fail "filterdb died"
+    fi
+else
+    if notExists "${TMP_PATH}/OLDDB.repSeq.dbtype"; then
+        log "=== Extract representative sequences"
+        # shellcheck disable=SC2086
+        "$MMSEQS" result2repseq "$OLDDB" "$OLDCLUST" "${TMP_PATH}/OLDDB.repSeq" ${RESULT2REPSEQ_PAR} \
+            || fail "result2repseq died"
+    fi
+    timing "representative extraction"
+
+    if notExists "${TMP_PATH}/newSeqsHits.dbtype"; then
+        log "=== Search new sequences against representatives"
+        # shellcheck disable=SC2086
+        "$MMSEQS" search "${TMP_PATH}/NEWDB.newSeqs" "${TMP_PATH}/OLDDB.repSeq" "${TMP_PATH}/newSeqsHits" "${TMP_PATH}/search" ${SEARCH_PAR} \
+            || fail "search died"
+    fi
 fi
+timing "search"
 
 if notExists "${TMP_PATH}/newSeqsHits.swapped.all.dbtype"; then
     # shellcheck disable=SC2086
@@ -154,9 +277,16 @@ if notExists "${TMP_PATH}/newSeqsHits.swapped.all.dbtype"; then
 fi
 
 if [ -s "${TMP_PATH}/newSeqsHits.swapped.hasHits" ] && notExists "${TMP_PATH}/newSeqsHits.swapped.dbtype"; then
+    # swapdb keeps the order of the result file, the new members are ordered by key so that
+    # the clustering does not depend on how the hits were written (search or segment merging)
+    # shellcheck disable=SC2086
+    "$MMSEQS" filterdb "${TMP_PATH}/newSeqsHits.swapped.all" "${TMP_PATH}/newSeqsHits.swapped.sorted" --sort-entries 1 --filter-column 1 ${THREADS_PAR} \
+        || fail "filterdb died"
     # shellcheck disable=SC2086
-    "$MMSEQS" filterdb "${TMP_PATH}/newSeqsHits.swapped.all" "${TMP_PATH}/newSeqsHits.swapped" --trim-to-one-column ${THREADS_PAR} \
+    "$MMSEQS" filterdb "${TMP_PATH}/newSeqsHits.swapped.sorted" "${TMP_PATH}/newSeqsHits.swapped" --trim-to-one-column ${THREADS_PAR} \
         || fail "filterdb died"
+    # shellcheck disable=SC2086
+    "$MMSEQS" rmdb "${TMP_PATH}/newSeqsHits.swapped.sorted" ${VERBOSITY}
 fi
 
 UPDATEDCLUST="${TMP_PATH}/updatedClust"
@@ -170,6 +300,7 @@ if [ -f "${TMP_PATH}/newSeqsHits.swapped.dbtype" ]; then
 else
     UPDATEDCLUST="$OLDCLUST"
 fi
+timing "merge of found sequences"
 
 if notExists "${TMP_PATH}/toBeClusteredSeparately.dbtype"; then
     log "=== Extract unmapped sequences"
@@ -185,6 +316,7 @@ if notExists "${TMP_PATH}/newClusters.dbtype" && [ -s "${TMP_PATH}/toBeClustered
     "$MMSEQS" cluster "${TMP_PATH}/toBeClusteredSeparately" "${TMP_PATH}/newClusters" "${TMP_PATH}/cluster" ${CLUST_PAR} \
         || fail "cluster of new seq. died"
 fi
+timing "clustering of new sequences"
 
 if [ -f "${TMP_PATH}/newClusters.dbtype" ]; then
     if notExists "$NEWCLUST"; then
@@ -198,10 +330,31 @@ else
     "$MMSEQS" mvdb "${UPDATEDCLUST}" "$NEWCLUST" ${VERBOSITY}
 fi
 
+if [ -n "${REP_INDEX}" ] && [ -d "${REPINDEX}" ]; then
+    SEGMENT_COUNT="$(wc -l < "${REPINDEX}/segments")"
+    SEGMENT="segment_$(awk -F_ '$2 >= max { max = $2 + 1 } END { print max }' "${REPINDEX}/segments")"
+    if [ "${SEGMENT_COUNT}" -ge "${MAX_SEGMENTS}" ]; then
+        log "=== Merge representative index"
+        createSegment "$NEWCLUST" "$NEWDB" "${TMP_PATH}/${SEGMENT}"
+        rm -rf "${REPINDEX}"
+        mkdir -p "${REPINDEX}"
+        mv -f "${TMP_PATH}/${SEGMENT}"* "${REPINDEX}/"
+        echo "${SEGMENT}" > "${REPINDEX}/segments"
+    elif [ -f "${TMP_PATH}/newClusters.dbtype" ]; then
+        log "=== Add new representatives to representative index"
+        createSegment "${TMP_PATH}/newClusters" "$NEWDB" "${REPINDEX}/${SEGMENT}"
+        echo "${SEGMENT}" >> "${REPINDEX}/segments"
+    fi
+    rm -rf "${NEWREPINDEX}"
+    mv -f "${REPINDEX}" "${NEWREPINDEX}"
+    timing "representative index update"
+fi
+log "Total time: $(formatTime $(($(date +%s) - START)))"
+
 if [ -n "$REMOVE_TMP" ]; then
     rm -f "${TMP_PATH}/newSeqs.mapped" "${TMP_PATH}/mappingSeqs.reverse" "${TMP_PATH}/newMappingSeqs"
     rm -f "${TMP_PATH}/noHitSeqList" "${TMP_PATH}/mappingSeqs" "${TMP_PATH}/newSeqs" "${TMP_PATH}/removedSeqs"
-    rm -f "${TMP_PATH}/newSeqsHits.swapped.hasHits"
+    rm -f "${TMP_PATH}/newSeqsHits.swapped.hasHits" "${TMP_PATH}/repSeqs"
 
     if [ -n "${RECOVER_DELETED}" ]; then
         # shellcheck disable=SC2086
@@ -231,7 +384,15 @@ if [ -n "$REMOVE_TMP" ]; then
     "$MMSEQS" rmdb "${TMP_PATH}/OLDDB.repSeq" ${VERBOSITY}
     # shellcheck disable=SC2086
     "$MMSEQS" rmdb "${TMP_PATH}/updatedClust" ${VERBOSITY}
+    if [ -n "${REP_INDEX}" ]; then
+        for f in "${TMP_PATH}"/newSeqsHits.*.dbtype; do
+            if [ -f "$f" ]; then
+                # shellcheck disable=SC2086
+                "$MMSEQS" rmdb "${f%.dbtype}" ${VERBOSITY}
+            fi
+        done
+    fi
 
-    rm -rf "${TMP_PATH}/search" "${TMP_PATH}/cluster"
+    rm -rf "${TMP_PATH}/search" "${TMP_PATH}/cluster" "${TMP_PATH}/createindex"
     rm -f "${TMP_PATH}/update_clustering.sh"
 fi
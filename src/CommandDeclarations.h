@@ -3,6 +3,7 @@
 #include "Command.h"
 
 extern int align(int argc, const char **argv, const Command& command);
+extern int prefilteralign(int argc, const char **argv, const Command& command);
 extern int alignall(int argc, const char **argv, const Command& command);
 extern int alignbykmer(int argc, const char **argv, const Command& command);
 extern int appenddbtoindex(int argc, const char **argv, const Command& command);
@@ -59,6 +60,7 @@ extern int gff2db(int argc, const char **argv, const Command& command);
 extern int masksequence(int argc, const char **argv, const Command& command);
 extern int indexdb(int argc, const char **argv, const Command& command);
 extern int kmermatcher(int argc, const char **argv, const Command &command);
+extern int kmerclust(int argc, const char **argv, const Command &command);
 extern int kmersearch(int argc, const char **argv, const Command &command);
 extern int kmerindexdb(int argc, const char **argv, const Command &command);
 extern int lca(int argc, const char **argv, const Command& command);
@@ -85,6 +87,7 @@ extern int prefilter(int argc, const char **argv, const Command& command);
 extern int prefixid(int argc, const char **argv, const Command& command);
 extern int profile2cs(int argc, const char **argv, const Command& command);
 extern int profile2pssm(int argc, const char **argv, const Command& command);
+extern int createprofilelookup(int argc, const char **argv, const Command& command);
 extern int profile2consensus(int argc, const char **argv, const Command& command);
 extern int profile2repseq(int argc, const char **argv, const Command& command);
 extern int proteinaln2nucl(int argc, const char **argv, const Command& command);
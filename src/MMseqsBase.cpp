@@ -3,7 +3,7 @@
 #include "CommandDeclarations.h"
 #include "DownloadDatabase.h"
 
-const char* MMSEQS_CURRENT_INDEX_VERSION = "16";
+const char* MMSEQS_CURRENT_INDEX_VERSION = "17";
 
 Parameters& par = Parameters::getInstance();
 std::vector<Command> baseCommands = {
@@ -338,7 +338,7 @@ std::vector<Command> baseCommands = {
                 "<i:queryDb> <i:targetDb> <i:alignmentDB> <o:alignmentFile>",
                 CITATION_MMSEQS2, {{"queryDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA|DbType::NEED_HEADER, &DbValidator::sequenceDb },
                                           {"targetDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA|DbType::NEED_HEADER, &DbValidator::sequenceDb },
-                                          {"alignmentDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA, &DbValidator::alignmentDb },
+                                          {"alignmentDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA|DbType::ALLOW_BINARY, &DbValidator::alignmentDb },
                                           {"alignmentFile", DbType::ACCESS_MODE_OUTPUT, DbType::NEED_DATA, &DbValidator::flatfile}}},
         {"createtsv",            createtsv,            &par.createtsv,            COMMAND_FORMAT_CONVERSION,
                 "Convert result DB to tab-separated flat file",
@@ -583,6 +583,15 @@ std::vector<Command> baseCommands = {
                 "<i:sequenceDB> <o:prefilterDB>",
                 CITATION_MMSEQS2,{{"sequenceDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA, &DbValidator::sequenceDb },
                                          {"prefilterDB", DbType::ACCESS_MODE_OUTPUT, DbType::NEED_DATA, &DbValidator::prefilterDb }}},
+        {"kmerclust",            kmerclust,            &par.kmerclust,            COMMAND_HIDDEN,
+                "Find k-mer matches, rescore them by hamming distance and pre-cluster within sequence DB",
+                "Runs kmermatcher, rescorediagonal --rescore-mode 0 and clust of the linclust workflow in one step.\n"
+                "Writes the pre-clustering and the k-mer matches between its representatives",
+                "Martin Steinegger <martin.steinegger@snu.ac.kr>",
+                "<i:sequenceDB> <o:clusterDB> <o:prefilterDB>",
+                CITATION_MMSEQS2,{{"sequenceDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA, &DbValidator::sequenceDb },
+                                         {"clusterDB", DbType::ACCESS_MODE_OUTPUT, DbType::NEED_DATA, &DbValidator::clusterDb },
+                                         {"prefilterDB", DbType::ACCESS_MODE_OUTPUT, DbType::NEED_DATA, &DbValidator::prefilterDb }}},
         {"kmersearch",           kmersearch,           &par.kmersearch,           COMMAND_PREFILTER,
                 "Find bottom-m-hashed k-mer matches between target and query DB",
                 NULL,
@@ -608,7 +617,15 @@ std::vector<Command> baseCommands = {
                 "<i:queryDB> <i:targetDB> <i:resultDB> <o:alignmentDB>",
                 CITATION_MMSEQS2, {{"queryDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA, &DbValidator::sequenceDb },
                                                            {"targetDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA, &DbValidator::sequenceDb },
-                                                           {"resultDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA, &DbValidator::resultDb },
+                                                           {"resultDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA|DbType::ALLOW_BINARY, &DbValidator::resultDb },
+                                                           {"alignmentDB", DbType::ACCESS_MODE_OUTPUT, DbType::NEED_DATA, &DbValidator::alignmentDb }}},
+        {"prefilteralign",       prefilteralign,       &par.prefilteralign,       COMMAND_HIDDEN,
+                "Prefilter and align with the results streamed between both stages",
+                NULL,
+                "Martin Steinegger <martin.steinegger@snu.ac.kr>",
+                "<i:queryDB> <i:targetDB> <o:alignmentDB>",
+                CITATION_MMSEQS2, {{"queryDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA, &DbValidator::sequenceDb },
+                                                           {"targetDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA, &DbValidator::sequenceDb },
                                                            {"alignmentDB", DbType::ACCESS_MODE_OUTPUT, DbType::NEED_DATA, &DbValidator::alignmentDb }}},
         {"alignall",             alignall,             &par.alignall,             COMMAND_ALIGNMENT,
                 "Within-result all-vs-all gapped local alignment",
@@ -654,7 +671,7 @@ std::vector<Command> baseCommands = {
                 "Martin Steinegger <martin.steinegger@snu.ac.kr> & Lars von den Driesch & Maria Hauser",
                 "<i:sequenceDB> <i:resultDB> <o:clusterDB>",
                 CITATION_MMSEQS2|CITATION_MMSEQS1,{{"sequenceDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA, &DbValidator::sequenceDb },
-                                                          {"resultDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA, &DbValidator::resultDb },
+                                                          {"resultDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA|DbType::ALLOW_BINARY, &DbValidator::resultDb },
                                                           {"clusterDB", DbType::ACCESS_MODE_OUTPUT, DbType::NEED_DATA, &DbValidator::clusterDb }}},
         {"clusthash",            clusthash,            &par.clusthash,            COMMAND_CLUSTER,
                 "Hash-based clustering of equal length sequences",
@@ -674,7 +691,7 @@ std::vector<Command> baseCommands = {
 
 
 
-        {"compress",             compress,             &par.onlythreads,          COMMAND_STORAGE,
+        {"compress",             compress,             &par.compress,             COMMAND_STORAGE,
                 "Compress DB entries",
                 NULL,
                 "Milot Mirdita <milot@mirdita.de>",
@@ -775,9 +792,9 @@ std::vector<Command> baseCommands = {
                 NULL,
                 "Martin Steinegger <martin.steinegger@snu.ac.kr>",
                 "<i:DB> <o:DB> <i:DB1> ... <i:DBn>",
-                CITATION_MMSEQS2, {{"DB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA, &DbValidator::allDb },
+                CITATION_MMSEQS2, {{"DB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA | DbType::ALLOW_BINARY, &DbValidator::allDb },
                                           {"DB", DbType::ACCESS_MODE_OUTPUT, DbType::NEED_DATA, &DbValidator::allDb },
-                                          {"DB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA | DbType::VARIADIC, &DbValidator::allDb }}},
+                                          {"DB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA | DbType::VARIADIC | DbType::ALLOW_BINARY, &DbValidator::allDb }}},
         {"subtractdbs",          subtractdbs,          &par.subtractdbs,          COMMAND_SET,
                 "Remove all entries from first DB occurring in second DB by key",
                 NULL,
@@ -795,7 +812,7 @@ std::vector<Command> baseCommands = {
                 "mmseqs view sequenecDB --id-list 1,2,3\n",
                 "Martin Steinegger <martin.steinegger@snu.ac.kr>",
                 "<i:DB>",
-                CITATION_MMSEQS2, {{"DB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA, &DbValidator::allDb }}},
+                CITATION_MMSEQS2, {{"DB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA|DbType::ALLOW_BINARY, &DbValidator::allDb }}},
         {"apply",                apply,                &par.threadsandcompression,
 #ifdef __CYGWIN__
                 COMMAND_HIDDEN,
@@ -936,7 +953,7 @@ std::vector<Command> baseCommands = {
                 "<i:queryDB> <i:targetDB> <i:resultDB> <o:resultDB>",
                 CITATION_MMSEQS2, {{"queryDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA, &DbValidator::sequenceDb },
                                                            {"targetDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA, &DbValidator::sequenceDb },
-                                                           {"resultDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA, &DbValidator::prefAlnResDb },
+                                                           {"resultDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA|DbType::ALLOW_BINARY, &DbValidator::prefAlnResDb },
                                                            {"resultDB", DbType::ACCESS_MODE_OUTPUT, DbType::NEED_DATA, &DbValidator::prefAlnResDb }}},
         {"result2rbh",           result2rbh,           &par.threadsandcompression,COMMAND_RESULT,
                 "Filter a merged result DB to retain only reciprocal best hits",
@@ -1080,6 +1097,13 @@ std::vector<Command> baseCommands = {
                 "<i:profileDB> <o:pssmFile>",
                 CITATION_MMSEQS2, {{"profileDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA, &DbValidator::profileDb },
                                                            {"pssmFile", DbType::ACCESS_MODE_OUTPUT, DbType::NEED_DATA, &DbValidator::genericDb }}},
+        {"createprofilelookup",  createprofilelookup,  &par.createprofilelookup,  COMMAND_PROFILE | COMMAND_EXPERT,
+                "Store decoded profiles of a profile DB to speed up their alignment",
+                "# Profiles are aligned from profileDB.profilelookup as long as profileDB is unchanged\n"
+                "mmseqs createprofilelookup profileDB\n",
+                "Martin Steinegger <martin.steinegger@snu.ac.kr>",
+                "<i:profileDB>",
+                CITATION_MMSEQS2, {{"profileDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA, &DbValidator::profileDb }}},
         {"profile2consensus",    profile2consensus,    &par.profile2seq,          COMMAND_PROFILE,
                 "Extract consensus sequence DB from a profile DB",
                 NULL,
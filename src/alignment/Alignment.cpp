@@ -12,20 +12,41 @@
 #include "Parameters.h"
 #include "FastSort.h"
 #include "Sequence.h"
+#include "BinaryResult.h"
+#include "DBReadahead.h"
+#include "ChunkScheduler.h"
+#include "ProfileLookup.h"
+#include "WorkflowExecutor.h"
+
+#include <utility>
 
 #ifdef OPENMP
 #include <omp.h>
 #endif
 
+// maps the entry id of dbr into seq, profiles in the lookup are copied instead of decoded
+// returns false if the entry has no data
+static bool mapEntry(Sequence &seq, DBReader<unsigned int> *dbr, const ProfileLookup *profiles, size_t id, unsigned int dbKey, int thread_idx) {
+    if (profiles != NULL && profiles->mapProfile(seq, id, dbKey, dbr->getSeqLen(id))) {
+        return true;
+    }
+    char *data = dbr->getData(id, thread_idx);
+    if (data == NULL) {
+        return false;
+    }
+    seq.mapSequence(id, dbKey, data, dbr->getSeqLen(id));
+    return true;
+}
+
 Alignment::Alignment(const std::string &querySeqDB, const std::string &targetSeqDB,
                      const std::string &prefDB, const std::string &prefDBIndex,
-                     const std::string &outDB, const std::string &outDBIndex, const Parameters &par, const bool lcaAlign) :
-        covThr(par.covThr), canCovThr(par.covThr), covMode(par.covMode), seqIdMode(par.seqIdMode), evalThr(par.evalThr), seqIdThr(par.seqIdThr),
+                     const std::string &outDB, const std::string &outDBIndex, const Parameters &par, const bool lcaAlign, DBReader<unsigned int> *targetReader) :
+        covThr(par.covThr), canCovThr(par.covThr), covMode(par.covMode), seqIdMode(par.seqIdMode), evalThr(par.evalThr), evalDbSize(par.evalDbSize), seqIdThr(par.seqIdThr),
         alnLenThr(par.alnLenThr), includeIdentity(par.includeIdentity), addBacktrace(par.addBacktrace), realign(par.realign), scoreBias(par.scoreBias), realignScoreBias(par.realignScoreBias), realignMaxSeqs(par.realignMaxSeqs),
-        threads(static_cast<unsigned int>(par.threads)), compressed(par.compressed), outDB(outDB), outDBIndex(outDBIndex),
+        threads(static_cast<unsigned int>(par.threads)), compressed(par.compressed), binaryResults(par.binaryResults == 1), readahead(par.readahead), workQueue(par.workQueue), outDB(outDB), outDBIndex(outDBIndex),
         maxSeqLen(par.maxSeqLen), compBiasCorrection(par.compBiasCorrection), compBiasCorrectionScale(par.compBiasCorrectionScale), altAlignment(par.altAlignment), alignmentOutputMode(par.alignmentOutputMode),
         maxAccept(static_cast<unsigned int>(par.maxAccept)), maxReject(static_cast<unsigned int>(par.maxRejected)), wrappedScoring(par.wrappedScoring),
-        lcaAlign(lcaAlign), qdbr(NULL), qDbrIdx(NULL), tdbr(NULL), tDbrIdx(NULL) {
+        lcaAlign(lcaAlign), qdbr(NULL), qDbrIdx(NULL), tdbr(NULL), tDbrIdx(NULL), sharedTargetReader(targetReader != NULL), queryProfiles(NULL), targetProfiles(NULL) {
     unsigned int alignmentMode = par.alignmentMode;
     if (alignmentMode == Parameters::ALIGNMENT_MODE_UNGAPPED) {
         Debug(Debug::ERROR) << "Use rescorediagonal for ungapped alignment mode.\n";
@@ -57,10 +78,19 @@ Alignment::Alignment(const std::string &querySeqDB, const std::string &targetSeq
 
     uint16_t extended = DBReader<unsigned int>::getExtendedDbtype(FileUtil::parseDbType(prefDB.c_str()));
     bool touch = (par.preloadMode != Parameters::PRELOAD_MODE_MMAP);
-    tDbrIdx = new IndexReader(targetSeqDB, par.threads,
-                              extended & Parameters::DBTYPE_EXTENDED_INDEX_NEED_SRC ? IndexReader::SRC_SEQUENCES : IndexReader::SEQUENCES,
-                              (touch) ? (IndexReader::PRELOAD_INDEX | IndexReader::PRELOAD_DATA) : 0);
-    tdbr = tDbrIdx->sequenceReader;
+    if (sharedTargetReader == false && (extended & Parameters::DBTYPE_EXTENDED_INDEX_NEED_SRC) == 0) {
+        // a workflow running in the same process keeps the target sequences open between its steps
+        targetReader = WorkflowExecutor::getSharedSequenceReader(targetSeqDB);
+        sharedTargetReader = (targetReader != NULL);
+    }
+    if (sharedTargetReader) {
+        tdbr = targetReader;
+    } else {
+        tDbrIdx = new IndexReader(targetSeqDB, par.threads,
+                                  extended & Parameters::DBTYPE_EXTENDED_INDEX_NEED_SRC ? IndexReader::SRC_SEQUENCES : IndexReader::SEQUENCES,
+                                  (touch) ? (IndexReader::PRELOAD_INDEX | IndexReader::PRELOAD_DATA) : 0);
+        tdbr = tDbrIdx->sequenceReader;
+    }
     targetSeqType = tdbr->getDbtype();
     sameQTDB = (targetSeqDB.compare(querySeqDB) == 0);
     if (sameQTDB == true) {
@@ -120,7 +150,7 @@ Alignment::Alignment(const std::string &querySeqDB, const std::string &targetSeq
     //qdbr->readMmapedDataInMemory();
     // make sure to touch target after query, so if there is not enough memory for the query, at least the targets
     // might have had enough space left to be residung in the page cache
-    if (sameQTDB == false && tDbrIdx == NULL && par.preloadMode != Parameters::PRELOAD_MODE_MMAP) {
+    if (sameQTDB == false && tDbrIdx == NULL && sharedTargetReader == false && par.preloadMode != Parameters::PRELOAD_MODE_MMAP) {
         tdbr->readMmapedDataInMemory();
     }
 
@@ -136,9 +166,15 @@ Alignment::Alignment(const std::string &querySeqDB, const std::string &targetSeq
     Debug(Debug::INFO) << "Query database size: "  << qdbr->getSize() << " type: " << Parameters::getDbTypeName(querySeqType) << "\n";
     Debug(Debug::INFO) << "Target database size: " << tdbr->getSize() << " type: " << Parameters::getDbTypeName(targetSeqType) << "\n";
 
-    prefdbr = new DBReader<unsigned int>(prefDB.c_str(), prefDBIndex.c_str(), threads, DBReader<unsigned int>::USE_DATA|DBReader<unsigned int>::USE_INDEX);
-    prefdbr->open(DBReader<unsigned int>::LINEAR_ACCCESS);
-    reversePrefilterResult = Parameters::isEqualDbtype(prefdbr->getDbtype(), Parameters::DBTYPE_PREFILTER_REV_RES);
+    prefdbr = NULL;
+    prefilterDbtype = Parameters::DBTYPE_PREFILTER_RES;
+    resultQueue = NULL;
+    if (prefDB.empty() == false) {
+        prefdbr = new DBReader<unsigned int>(prefDB.c_str(), prefDBIndex.c_str(), threads, DBReader<unsigned int>::USE_DATA|DBReader<unsigned int>::USE_INDEX);
+        prefdbr->open(DBReader<unsigned int>::LINEAR_ACCCESS);
+        prefilterDbtype = prefdbr->getDbtype();
+    }
+    reversePrefilterResult = Parameters::isEqualDbtype(prefilterDbtype, Parameters::DBTYPE_PREFILTER_REV_RES);
 
     correlationScoreWeight = par.correlationScoreWeight;
     if (Parameters::isEqualDbtype(querySeqType, Parameters::DBTYPE_NUCLEOTIDES)) {
@@ -154,6 +190,24 @@ Alignment::Alignment(const std::string &querySeqDB, const std::string &targetSeq
         gapExtend = par.gapExtend.values.aminoacid();
     }
 
+    // decoded profiles, see createprofilelookup
+    if (Parameters::isEqualDbtype(targetSeqType, Parameters::DBTYPE_HMM_PROFILE)) {
+        targetProfiles = new ProfileLookup();
+        if (targetProfiles->open(targetSeqDB, m->alphabetSize) == false) {
+            delete targetProfiles;
+            targetProfiles = NULL;
+        }
+    }
+    if (sameQTDB == true) {
+        queryProfiles = targetProfiles;
+    } else if (Parameters::isEqualDbtype(querySeqType, Parameters::DBTYPE_HMM_PROFILE)) {
+        queryProfiles = new ProfileLookup();
+        if (queryProfiles->open(querySeqDB, m->alphabetSize) == false) {
+            delete queryProfiles;
+            queryProfiles = NULL;
+        }
+    }
+
     realign_m = NULL;
     if (realign == true && realignScoreBias != 0.0f) {
         if (Parameters::isEqualDbtype(querySeqType, Parameters::DBTYPE_NUCLEOTIDES)) {
@@ -196,9 +250,16 @@ Alignment::~Alignment() {
     }
     delete m;
 
+    if (targetProfiles != NULL) {
+        delete targetProfiles;
+    }
+    if (sameQTDB == false && queryProfiles != NULL) {
+        delete queryProfiles;
+    }
+
     if (tDbrIdx != NULL) {
         delete tDbrIdx;
-    }else{
+    } else if (sharedTargetReader == false) {
         tdbr->close();
         delete tdbr;
     }
@@ -212,28 +273,23 @@ Alignment::~Alignment() {
         }
     }
 
-    prefdbr->close();
-    delete prefdbr;
+    if (prefdbr != NULL) {
+        prefdbr->close();
+        delete prefdbr;
+    }
 }
 
-void Alignment::run(const unsigned int mpiRank, const unsigned int mpiNumProc) {
-
-    size_t dbFrom = 0;
-    size_t dbSize = 0;
-    prefdbr->decomposeDomainByAminoAcid(mpiRank, mpiNumProc, &dbFrom, &dbSize);
-
-    Debug(Debug::INFO) << "Compute split from " << dbFrom << " to " << (dbFrom + dbSize) << "\n";
-    std::pair<std::string, std::string> tmpOutput = Util::createTmpFileNames(outDB, outDBIndex, mpiRank);
-    run(tmpOutput.first, tmpOutput.second, dbFrom, dbSize, true);
-
-#ifdef HAVE_MPI
-    MPI_Barrier(MPI_COMM_WORLD);
-#endif
+void Alignment::runDistributed(ChunkScheduler::Mode mode) {
+    const size_t dbSize = prefdbr->getSize();
+    ChunkScheduler chunks(mode, dbSize, getFlushSize(dbSize), workQueue);
+    Debug(Debug::INFO) << "Compute chunks of " << chunks.getChunkSize() << " queries as worker " << chunks.getWorkerId() << "\n";
+    std::pair<std::string, std::string> tmpOutput = Util::createTmpFileNames(outDB, outDBIndex, chunks.getWorkerId());
+    run(tmpOutput.first, tmpOutput.second, chunks, true);
 
-    if (MMseqsMPI::isMaster()) {
+    if (chunks.finish()) {
         std::vector<std::pair<std::string, std::string> > splitFiles;
-        for (unsigned int proc = 0; proc < mpiNumProc; proc++) {
-            splitFiles.push_back(Util::createTmpFileNames(outDB, outDBIndex, proc));
+        for (size_t worker = 0; worker < chunks.getWorkerCount(); worker++) {
+            splitFiles.push_back(Util::createTmpFileNames(outDB, outDBIndex, worker));
         }
 
         // merge output databases
@@ -242,39 +298,64 @@ void Alignment::run(const unsigned int mpiRank, const unsigned int mpiNumProc) {
 }
 
 void Alignment::run() {
-    run(outDB, outDBIndex, 0, prefdbr->getSize(), false);
+    if (workQueue.empty() == false) {
+        runDistributed(ChunkScheduler::SHARED_FILE);
+        return;
+    }
+    const size_t dbSize = prefdbr->getSize();
+    ChunkScheduler chunks(ChunkScheduler::LOCAL, dbSize, getFlushSize(dbSize));
+    run(outDB, outDBIndex, chunks, false);
+}
+
+void Alignment::runStreaming(ResultQueue *queue, size_t queryCount, int prefilterDbtype) {
+    this->prefilterDbtype = prefilterDbtype;
+    reversePrefilterResult = Parameters::isEqualDbtype(prefilterDbtype, Parameters::DBTYPE_PREFILTER_REV_RES);
+    resultQueue = queue;
+    ChunkScheduler chunks(ChunkScheduler::LOCAL, queryCount, getFlushSize(queryCount));
+    run(outDB, outDBIndex, chunks, false);
+    resultQueue = NULL;
 }
 
-void Alignment::run(const std::string &outDB, const std::string &outDBIndex, const size_t dbFrom, const size_t dbSize, bool merge) {
+size_t Alignment::getFlushSize(size_t dbSize) {
+    // results that do not fit into memory are aligned in blocks and released from the page cache in between
+    if (resultQueue != NULL || Util::getTotalSystemMemory() > prefdbr->getTotalDataSize()) {
+        return dbSize;
+    }
+    return 1000000;
+}
+
+void Alignment::run(const std::string &outDB, const std::string &outDBIndex, ChunkScheduler &chunks, bool merge) {
     int dbtype = Parameters::DBTYPE_ALIGNMENT_RES;
     if (alignmentOutputMode == Parameters::ALIGNMENT_OUTPUT_CLUSTER) {
         dbtype = Parameters::DBTYPE_CLUSTER_RES;
     }
-    dbtype = DBReader<unsigned int>::setExtendedDbtype(dbtype, DBReader<unsigned int>::getExtendedDbtype(prefdbr->getDbtype()));
+    dbtype = DBReader<unsigned int>::setExtendedDbtype(dbtype, DBReader<unsigned int>::getExtendedDbtype(prefilterDbtype));
+    const bool binaryInput = BinaryResult::isBinaryDbtype(prefilterDbtype);
+    const bool binaryOutput = binaryResults && alignmentOutputMode != Parameters::ALIGNMENT_OUTPUT_CLUSTER;
+    dbtype = BinaryResult::setBinaryDbtype(dbtype, binaryOutput);
     DBWriter dbw(outDB.c_str(), outDBIndex.c_str(), threads, compressed, dbtype);
     dbw.open();
 
-    // handle no alignment case early, below would divide by 0 otherwise
-    if (dbSize == 0) {
-        dbw.close(merge);
-        return;
-    }
-
-    EvalueComputation evaluer(tdbr->getAminoAcidDBSize(), this->m, gapOpen, gapExtend);
+    EvalueComputation evaluer((evalDbSize > 0) ? evalDbSize : tdbr->getAminoAcidDBSize(), this->m, gapOpen, gapExtend);
+    // only release the prefilter results between chunks if they do not fit into memory
+    const bool remapChunks = getFlushSize(chunks.getTotal()) < chunks.getTotal();
 
-    size_t totalMemory = Util::getTotalSystemMemory();
-    size_t flushSize = 1000000;
-    if (totalMemory > prefdbr->getTotalDataSize()) {
-        flushSize = dbSize;
-    }
-    size_t iterations = static_cast<size_t>(ceil(static_cast<double>(dbSize) / static_cast<double>(flushSize)));
+    // sequence-sequence alignments first compute the scores of a block of hits at once,
+    // this bound is only exact without correlation score and on the unwrapped query
+    const bool batchScoring = Parameters::isEqualDbtype(querySeqType, Parameters::DBTYPE_AMINO_ACIDS)
+                              && Parameters::isEqualDbtype(targetSeqType, Parameters::DBTYPE_AMINO_ACIDS)
+                              && wrappedScoring == false && correlationScoreWeight == 0.0f;
 
     size_t alignmentsNum = 0;
     size_t totalPassedNum = 0;
-    for (size_t i = 0; i < iterations; i++) {
-        size_t start = dbFrom + (i * flushSize);
-        size_t bucketSize = std::min(dbSize - (i * flushSize), flushSize);
+    size_t dbSize = 0;
+    size_t start = 0;
+    size_t bucketSize = 0;
+    while (chunks.next(start, bucketSize)) {
+        dbSize += bucketSize;
         Debug::Progress progress(bucketSize);
+        // prefetch the prefilter results together with their query sequences
+        DBReadahead prefilterReadahead(prefdbr, start, start + bucketSize, (resultQueue != NULL) ? 0 : readahead, qdbr);
 
 #pragma omp parallel num_threads(threads)
         {
@@ -309,62 +390,152 @@ void Alignment::run(const std::string &outDB, const std::string &outDBIndex, con
 
             const char* words[10];
 
+            std::vector<PrefilterHit> hits;
+            hits.reserve(300);
+            // length and hit index of the targets of the current score only window
+            typedef std::pair<int32_t, size_t> WindowTarget;
+            std::vector<WindowTarget> windowTargets;
+            std::vector<unsigned char> windowResidues;
+            const int batchSize = VECSIZE_INT * 4;
+            const size_t batchWindowSize = batchSize * 8;
+            const unsigned char *batchTargets[VECSIZE_INT * 4];
+            int32_t batchLengths[VECSIZE_INT * 4];
+            int batchScores[VECSIZE_INT * 4];
+            ResultQueue::Entry streamEntry;
+
 #pragma omp for schedule(dynamic, 5) reduction(+: alignmentsNum, totalPassedNum)
             for (size_t id = start; id < (start + bucketSize); id++) {
                 progress.updateProgress();
+                prefilterReadahead.advance(id);
 
                 // get the prefiltering list
                 char *data, *origData;
-                data = origData = prefdbr->getData(id, thread_idx);
-                unsigned int queryDbKey = prefdbr->getDbKey(id);
+                unsigned int queryDbKey;
+                size_t entryLength;
+                if (resultQueue != NULL) {
+                    // the entries arrive in the order in which the prefilter finished them
+                    if (resultQueue->pop(streamEntry) == false) {
+                        Debug(Debug::ERROR) << "Prefilter result stream ended before all queries were aligned\n";
+                        EXIT(EXIT_FAILURE);
+                    }
+                    data = origData = &streamEntry.data[0];
+                    queryDbKey = streamEntry.key;
+                    entryLength = streamEntry.data.size();
+                } else {
+                    data = origData = prefdbr->getData(id, thread_idx);
+                    queryDbKey = prefdbr->getDbKey(id);
+                    entryLength = prefdbr->getEntryLen(id);
+                }
                 size_t origQueryLen = 0;
                 // only load query data if data != \0
                 if (*data != '\0') {
                     size_t qId = qdbr->getId(queryDbKey);
-                    char *querySeqData = qdbr->getData(qId, thread_idx);
-                    if (querySeqData == NULL) {
-                        Debug(Debug::ERROR) << "Query sequence " << queryDbKey
-                                            << " is required in the prefiltering, but is not contained in the query sequence database.\nPlease check your database.\n";
-                        EXIT(EXIT_FAILURE);
-                    }
                     size_t queryLen = qdbr->getSeqLen(qId);
                     origQueryLen = queryLen;
-                    if (wrappedScoring) {
-                        queryToWrap = std::string(querySeqData, queryLen);
-                        queryToWrap = queryToWrap + queryToWrap;
-                        querySeqData = (char*)(queryToWrap).c_str();
-                        queryLen = origQueryLen*2;
+                    if (queryProfiles == NULL || queryProfiles->mapProfile(qSeq, qId, queryDbKey, queryLen) == false) {
+                        char *querySeqData = qdbr->getData(qId, thread_idx);
+                        if (querySeqData == NULL) {
+                            Debug(Debug::ERROR) << "Query sequence " << queryDbKey
+                                                << " is required in the prefiltering, but is not contained in the query sequence database.\nPlease check your database.\n";
+                            EXIT(EXIT_FAILURE);
+                        }
+                        if (wrappedScoring) {
+                            queryToWrap = std::string(querySeqData, queryLen);
+                            queryToWrap = queryToWrap + queryToWrap;
+                            querySeqData = (char*)(queryToWrap).c_str();
+                            queryLen = origQueryLen*2;
+                        }
+                        qSeq.mapSequence(qId, queryDbKey, querySeqData, queryLen);
                     }
-
-                    qSeq.mapSequence(qId, queryDbKey, querySeqData, queryLen);
                     matcher.initQuery(&qSeq);
                 }
 
                 // parse the prefiltering list and calculate a Smith-Waterman alignment for each sequence in the list
+                hits.clear();
+                BinaryResult::EntryReader binaryHits(origData, binaryInput ? entryLength : 0);
+                bool hasHit = binaryInput ? binaryHits.next() : (*data != '\0');
+                while (hasHit) {
+                    PrefilterHit hit;
+                    if (binaryInput) {
+                        hit.dbKey = binaryHits.getDbKey();
+                        if (binaryHits.isAlignment() == false) {
+                            hit_t prefHit = binaryHits.getHit();
+                            hit.isReverse = reversePrefilterResult && (prefHit.prefScore < 0);
+                            hit.diagonal = static_cast<short>(prefHit.diagonal);
+                        }
+                        hasHit = binaryHits.next();
+                    } else {
+                        Util::parseKey(data, buffer);
+                        hit.dbKey = (unsigned int) strtoul(buffer, NULL, 10);
+                        size_t elements = Util::getWordsOfLine(data, words, 10);
+
+                        // Prefilter result (need to make this better)
+                        if (elements == 3) {
+                            hit_t prefHit = QueryMatcher::parsePrefilterHit(data);
+                            hit.isReverse = reversePrefilterResult && (prefHit.prefScore < 0);
+                            hit.diagonal = static_cast<short>(prefHit.diagonal);
+                        }
+                        data = Util::skipLine(data);
+                        hasHit = (*data != '\0');
+                    }
+                    hits.emplace_back(hit);
+                }
+
                 size_t passedNum = 0;
                 unsigned int rejected = 0;
-                while (*data != '\0' && passedNum < maxAccept && rejected < maxReject) {
-                    Util::parseKey(data, buffer);
-                    const unsigned int dbKey = (unsigned int) strtoul(buffer, NULL, 10);
-                    size_t elements = Util::getWordsOfLine(data, words, 10);
-
-                    short diagonal = 0;
-                    bool isReverse = false;
-                    // Prefilter result (need to make this better)
-                    if (elements == 3) {
-                        hit_t hit = QueryMatcher::parsePrefilterHit(data);
-                        isReverse = reversePrefilterResult && (hit.prefScore < 0);
-                        diagonal = static_cast<short>(hit.diagonal);
+                size_t scoredEnd = 0;
+                for (size_t hitIdx = 0; hitIdx < hits.size() && passedNum < maxAccept && rejected < maxReject; hitIdx++) {
+                    const unsigned int dbKey = hits[hitIdx].dbKey;
+                    const bool isIdentity = (queryDbKey == dbKey && (includeIdentity || sameQTDB)) ? true : false;
+                    if (batchScoring && qSeq.L <= SmithWaterman::BATCH_MAX_QUERY_LENGTH && hitIdx >= scoredEnd) {
+                        // compute only the scores of a window of upcoming hits to skip hopeless alignments,
+                        // hits are scored ordered by length so that the lanes of a batch have similar lengths
+                        windowTargets.clear();
+                        windowResidues.clear();
+                        for (size_t i = hitIdx; i < hits.size() && windowTargets.size() < batchWindowSize; i++) {
+                            scoredEnd = i + 1;
+                            hits[i].batchScore = -1;
+                            hits[i].windowLength = -1;
+                            size_t batchDbId = tdbr->getId(hits[i].dbKey);
+                            char *batchSeqData = tdbr->getData(batchDbId, thread_idx);
+                            if (batchSeqData == NULL || (queryDbKey == hits[i].dbKey && (includeIdentity || sameQTDB))) {
+                                continue;
+                            }
+                            // the residues are kept for the alignment of the hit, targets are only mapped once
+                            dbSeq.mapSequence(batchDbId, hits[i].dbKey, batchSeqData, tdbr->getSeqLen(batchDbId));
+                            hits[i].windowLength = dbSeq.L;
+                            hits[i].windowOffset = windowResidues.size();
+                            windowResidues.insert(windowResidues.end(), dbSeq.numSequence, dbSeq.numSequence + dbSeq.L);
+                            if (Util::canBeCovered(canCovThr, covMode, static_cast<float>(origQueryLen), static_cast<float>(dbSeq.L)) == false) {
+                                continue;
+                            }
+                            windowTargets.emplace_back(dbSeq.L, i);
+                        }
+                        std::sort(windowTargets.begin(), windowTargets.end());
+                        // only full batches pay off, the longest left over targets are aligned directly
+                        const size_t fullBatches = windowTargets.size() / batchSize;
+                        for (size_t batchStart = 0; batchStart < fullBatches * batchSize; batchStart += batchSize) {
+                            const int batchCount = batchSize;
+                            for (int k = 0; k < batchCount; k++) {
+                                const PrefilterHit &target = hits[windowTargets[batchStart + k].second];
+                                batchTargets[k] = windowResidues.data() + target.windowOffset;
+                                batchLengths[k] = target.windowLength;
+                            }
+                            matcher.getSWScoreBatch(batchTargets, batchLengths, batchCount, batchScores);
+                            for (int k = 0; k < batchCount; k++) {
+                                hits[windowTargets[batchStart + k].second].batchScore = batchScores[k];
+                            }
+                        }
                     }
-                    data = Util::skipLine(data);
 
                     size_t dbId = tdbr->getId(dbKey);
-                    char *dbSeqData = tdbr->getData(dbId, thread_idx);
-                    if (dbSeqData == NULL) {
+                    if (batchScoring && hitIdx < scoredEnd && hits[hitIdx].windowLength >= 0) {
+                        const std::pair<const unsigned char *, const unsigned int> residues(windowResidues.data() + hits[hitIdx].windowOffset, hits[hitIdx].windowLength);
+                        dbSeq.mapSequence(dbId, dbKey, residues);
+                    } else if (mapEntry(dbSeq, tdbr, targetProfiles, dbId, dbKey, thread_idx) == false) {
                         Debug(Debug::ERROR) << "Sequence " << dbKey << " is required in the prefiltering, but is not contained in the target sequence database!\nPlease check your database.\n";
                         EXIT(EXIT_FAILURE);
                     }
-                    dbSeq.mapSequence(dbId, dbKey, dbSeqData, tdbr->getSeqLen(dbId));
 
                     // check if the sequences could pass the coverage threshold
                     if (Util::canBeCovered(canCovThr, covMode, static_cast<float>(origQueryLen), static_cast<float>(dbSeq.L)) == false) {
@@ -372,11 +543,17 @@ void Alignment::run(const std::string &outDB, const std::string &outDBIndex, con
                         continue;
                     }
 
-                    const bool isIdentity = (queryDbKey == dbKey && (includeIdentity || sameQTDB)) ? true : false;
+                    // the batch score is an upper bound of the alignment score, skip hits that cannot reach the e-value threshold
+                    const int batchScore = (batchScoring && hitIdx < scoredEnd) ? hits[hitIdx].batchScore : -1;
+                    if (batchScore > 0 && batchScore < 255 && evaluer.computeEvalue(batchScore, qSeq.L) > evalThr) {
+                        alignmentsNum++;
+                        rejected++;
+                        continue;
+                    }
 
                     // calculate Smith-Waterman alignment
 
-                    Matcher::result_t res = matcher.getSWResult(&dbSeq, static_cast<int>(diagonal), isReverse, covMode, covThr, evalThr, swMode, seqIdMode, isIdentity, wrappedScoring);
+                    Matcher::result_t res = matcher.getSWResult(&dbSeq, static_cast<int>(hits[hitIdx].diagonal), hits[hitIdx].isReverse, covMode, covThr, evalThr, swMode, seqIdMode, isIdentity, wrappedScoring);
                     alignmentsNum++;
 
                     if (isIdentity) {
@@ -410,12 +587,10 @@ void Alignment::run(const std::string &outDB, const std::string &outDBIndex, con
                     int realignAccepted = 0;
                     for (size_t result = 0; result < swResults.size() && realignAccepted < realignMaxSeqs; result++) {
                         size_t dbId = tdbr->getId(swResults[result].dbKey);
-                        char *dbSeqData = tdbr->getData(dbId, thread_idx);
-                        if (dbSeqData == NULL) {
+                        if (mapEntry(dbSeq, tdbr, targetProfiles, dbId, swResults[result].dbKey, thread_idx) == false) {
                             Debug(Debug::ERROR) << "Sequence " << swResults[result].dbKey <<" is required in the prefiltering, but is not contained in the target sequence database!\nPlease check your database.\n";
                             EXIT(EXIT_FAILURE);
                         }
-                        dbSeq.mapSequence(dbId, swResults[result].dbKey, dbSeqData, tdbr->getSeqLen(dbId));
 
                         // recompute alignment boundaries (without changing evalue)
                         const bool isIdentity = (queryDbKey == swResults[result].dbKey && (includeIdentity || sameQTDB)) ? true : false;
@@ -458,9 +633,19 @@ void Alignment::run(const std::string &outDB, const std::string &outDBIndex, con
 
                     data = origData;
                     unsigned int rejected = 0;
-                    while (*data != '\0' && rejected < maxReject) {
-                        Util::parseKey(data, buffer);
-                        const unsigned int dbKey = (unsigned int) strtoul(buffer, NULL, 10);
+                    BinaryResult::EntryReader lcaHits(origData, binaryInput ? entryLength : 0);
+                    bool hasLcaHit = binaryInput ? lcaHits.next() : (*data != '\0');
+                    while (hasLcaHit && rejected < maxReject) {
+                        unsigned int dbKey;
+                        if (binaryInput) {
+                            dbKey = lcaHits.getDbKey();
+                            hasLcaHit = lcaHits.next();
+                        } else {
+                            Util::parseKey(data, buffer);
+                            dbKey = (unsigned int) strtoul(buffer, NULL, 10);
+                            data = Util::skipLine(data);
+                            hasLcaHit = (*data != '\0');
+                        }
 //                        size_t elements = Util::getWordsOfLine(data, words, 10);
 //                        short diagonal = 0;
 //                        bool isReverse = false;
@@ -470,15 +655,12 @@ void Alignment::run(const std::string &outDB, const std::string &outDBIndex, con
 //                            isReverse = reversePrefilterResult && (hit.prefScore < 0);
 //                            diagonal = static_cast<short>(hit.diagonal);
 //                        }
-                        data = Util::skipLine(data);
 
                         dbId = tdbr->getId(dbKey);
-                        char* dbSeqData = tdbr->getData(dbId, thread_idx);
-                        if (dbSeqData == NULL) {
+                        if (mapEntry(dbSeq, tdbr, targetProfiles, dbId, dbKey, thread_idx) == false) {
                             Debug(Debug::ERROR) << "Sequence " << dbKey << " is required in the prefiltering, but is not contained in the target sequence database!\nPlease check your database.\n";
                             EXIT(EXIT_FAILURE);
                         }
-                        dbSeq.mapSequence(dbId, dbKey, dbSeqData, tdbr->getSeqLen(dbId));
 
                         Matcher::result_t res = realigner->getSWResult(&dbSeq, INT_MAX, false, covMode, realignCov, topHitEval, lcaSwMode, seqIdMode, false);
 
@@ -501,6 +683,8 @@ void Alignment::run(const std::string &outDB, const std::string &outDBIndex, con
                         alnResultsOutString.append(SSTR((*returnRes)[result].dbKey));
                         alnResultsOutString.push_back('\n');
                     }
+                } else if (binaryOutput) {
+                    BinaryResult::appendAlignmentResults(alnResultsOutString, returnRes->data(), returnRes->size(), addBacktrace);
                 }else{
                     for (size_t result = 0; result < returnRes->size(); result++) {
                         size_t len = Matcher::resultToBuffer(buffer, (*returnRes)[result], addBacktrace);
@@ -515,10 +699,10 @@ void Alignment::run(const std::string &outDB, const std::string &outDBIndex, con
             if (realigner != NULL && realigner != &matcher) {
                 delete realigner;
             }
-            // only remap if we have more than one iteration and we are not at the last iteration
-            if (i != (iterations - 1)) {
+            if (remapChunks) {
 #pragma omp barrier
                 if (thread_idx == 0) {
+                    prefilterReadahead.stop();
                     prefdbr->remapData();
                 }
 #pragma omp barrier
@@ -576,13 +760,10 @@ void Alignment::computeAlternativeAlignment(unsigned int queryDbKey, Sequence &d
             continue;
         }
         size_t dbId = tdbr->getId(swResults[i].dbKey);
-        char *dbSeqData = tdbr->getData(dbId, thread_idx);
-        if (dbSeqData == NULL) {
+        if (mapEntry(dbSeq, tdbr, targetProfiles, dbId, swResults[i].dbKey, thread_idx) == false) {
             Debug(Debug::ERROR) << "Sequence " << swResults[i].dbKey << " is required in the prefiltering, but is not contained in the target sequence database!\nPlease check your database.\n";
             EXIT(EXIT_FAILURE);
         }
-
-        dbSeq.mapSequence(dbId, swResults[i].dbKey, dbSeqData, tdbr->getSeqLen(dbId));
         for (int pos = swResults[i].dbStartPos; pos < swResults[i].dbEndPos; ++pos) {
             dbSeq.numSequence[pos] = xIndex;
         }
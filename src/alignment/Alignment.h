@@ -6,6 +6,10 @@
 #include "Parameters.h"
 #include "BaseMatrix.h"
 #include "Matcher.h"
+#include "ResultQueue.h"
+#include "ChunkScheduler.h"
+
+class ProfileLookup;
 
 class Alignment {
 public:
@@ -13,17 +17,21 @@ public:
               const std::string &targetSeqDB,
               const std::string &prefDB, const std::string &prefDBIndex,
               const std::string &outDB, const std::string &outDBIndex,
-              const Parameters &par, const bool lcaAlign);
+              const Parameters &par, const bool lcaAlign, DBReader<unsigned int> *targetReader = NULL);
     ~Alignment();
 
-    //Non-MPI
+    //Non-MPI, uses the work queue if one is given
     void run();
 
-    //MPI function
-    void run(const unsigned int mpiRank, const unsigned int mpiNumProc);
+    //MPI or work queue, all workers pull chunks of queries until none are left
+    void runDistributed(ChunkScheduler::Mode mode);
+
+    //Run parallel on the chunks handed out by the scheduler
+    void run(const std::string &outDB, const std::string &outDBIndex, ChunkScheduler &chunks, bool merge);
 
-    //Run parallel
-    void run(const std::string &outDB, const std::string &outDBIndex, const size_t dbFrom, const size_t dbSize, bool merge);
+    // aligns queryCount prefilter results taken from queue instead of the prefilter database
+    // the alignment has to be constructed with an empty prefDB then
+    void runStreaming(ResultQueue *queue, size_t queryCount, int prefilterDbtype);
 
     static bool checkCriteria(Matcher::result_t &res, bool isIdentity, double evalThr, double seqIdThr, int alnLenThr, int covMode, float covThr);
 
@@ -45,6 +53,9 @@ private:
     // e value threshold
     const double evalThr;
 
+    // residues of the database the e values are computed for, 0 for the target database
+    const size_t evalDbSize;
+
     // sequence identity threshold
     const double seqIdThr;
 
@@ -76,6 +87,9 @@ private:
 
     unsigned int threads;
     unsigned int compressed;
+    bool binaryResults;
+    size_t readahead;
+    const std::string workQueue;
 
     const std::string outDB;
     const std::string outDBIndex;
@@ -115,13 +129,36 @@ private:
 
     DBReader<unsigned int> *tdbr;
     IndexReader * tDbrIdx;
+    // the target reader is owned by another stage, e.g. the prefilter of a result stream or a workflow
+    bool sharedTargetReader;
+
+    // decoded profiles of profile databases, NULL if there is no lookup
+    ProfileLookup *queryProfiles;
+    ProfileLookup *targetProfiles;
 
     DBReader<unsigned int> *prefdbr;
+    int prefilterDbtype;
+    // source of the prefilter results if set
+    ResultQueue *resultQueue;
 
     bool reversePrefilterResult;
 
+    struct PrefilterHit {
+        PrefilterHit() : dbKey(0), diagonal(0), isReverse(false), batchScore(-1), windowLength(-1), windowOffset(0) {}
+        unsigned int dbKey;
+        short diagonal;
+        bool isReverse;
+        // score only result of the batched alignment, -1 if it was not computed
+        int batchScore;
+        // residues of the target that were mapped for the batched alignment, -1 if it was not mapped
+        int32_t windowLength;
+        size_t windowOffset;
+    };
+
     static size_t estimateHDDMemoryConsumption(int dbSize, int maxSeqs);
 
+    size_t getFlushSize(size_t dbSize);
+
     void computeAlternativeAlignment(unsigned int queryDbKey, Sequence &dbSeq,
                                      std::vector<Matcher::result_t> &vector, Matcher &matcher,
                                      float covThr, float evalThr, int swMode, int thread_idx);
@@ -1,9 +1,16 @@
 #include "Alignment.h"
+#include "Prefiltering.h"
+#include "ResultQueue.h"
 #include "Parameters.h"
 #include "Debug.h"
 #include "Util.h"
+#include "FileUtil.h"
 #include "MMseqsMPI.h"
 
+#ifdef HAVE_PTHREADS
+#include <pthread.h>
+#endif
+
 #ifdef OPENMP
 #include <omp.h>
 #endif
@@ -23,7 +30,7 @@ int align(int argc, const char **argv, const Command& command) {
     Debug(Debug::INFO) << "Calculation of alignments\n";
 
 #ifdef HAVE_MPI
-    aln.run(MMseqsMPI::rank, MMseqsMPI::numProc);
+    aln.runDistributed(ChunkScheduler::MPI);
 #else
     aln.run();
 #endif
@@ -43,7 +50,7 @@ int lcaalign(int argc, const char **argv, const Command& command) {
                   par.db4, par.db4Index, par, true);
 
 #ifdef HAVE_MPI
-    aln.run(MMseqsMPI::rank, MMseqsMPI::numProc);
+    aln.runDistributed(ChunkScheduler::MPI);
 #else
     aln.run();
 #endif
@@ -51,4 +58,81 @@ int lcaalign(int argc, const char **argv, const Command& command) {
     return EXIT_SUCCESS;
 }
 
+#ifdef HAVE_PTHREADS
+struct PrefilterStream {
+    Prefiltering *prefilter;
+    ResultQueue *queue;
+    unsigned int threads;
+};
+
+static void *runPrefilterStream(void *arg) {
+    PrefilterStream *stream = static_cast<PrefilterStream *>(arg);
+    stream->prefilter->runStreaming(stream->queue, stream->threads);
+    stream->queue->close();
+    return NULL;
+}
+#endif
+
+int prefilteralign(int argc, const char **argv, const Command& command) {
+    MMseqsMPI::init(argc, argv);
 
+    Parameters& par = Parameters::getInstance();
+    par.overrideParameterDescription(par.PARAM_ALIGNMENT_MODE, "How to compute the alignment:\n0: automatic\n1: only score and end_pos\n2: also start_pos and cov\n3: also seq.id", NULL, 0);
+    par.parseParameters(argc, argv, command, true, 0, MMseqsParameter::COMMAND_PREFILTER | MMseqsParameter::COMMAND_ALIGN);
+
+    int queryDbType = FileUtil::parseDbType(par.db1.c_str());
+    int targetDbType = FileUtil::parseDbType(par.db2.c_str());
+    if (Parameters::isEqualDbtype(targetDbType, Parameters::DBTYPE_INDEX_DB) == true) {
+        DBReader<unsigned int> dbr(par.db2.c_str(), par.db2Index.c_str(), par.threads, DBReader<unsigned int>::USE_INDEX | DBReader<unsigned int>::USE_DATA);
+        dbr.open(DBReader<unsigned int>::NOSORT);
+        PrefilteringIndexData data = PrefilteringIndexReader::getMetadata(&dbr);
+        targetDbType = data.seqType;
+        dbr.close();
+    }
+    if (queryDbType == -1 || targetDbType == -1) {
+        Debug(Debug::ERROR) << "Please recreate your database or add a .dbtype file to your sequence/profile database.\n";
+        return EXIT_FAILURE;
+    }
+    if (Parameters::isEqualDbtype(queryDbType, Parameters::DBTYPE_HMM_PROFILE) && Parameters::isEqualDbtype(targetDbType, Parameters::DBTYPE_HMM_PROFILE)) {
+        Debug(Debug::ERROR) << "Only the query OR the target database can be a profile database.\n";
+        return EXIT_FAILURE;
+    }
+    if (Parameters::isEqualDbtype(queryDbType, Parameters::DBTYPE_NUCLEOTIDES) != Parameters::isEqualDbtype(targetDbType, Parameters::DBTYPE_NUCLEOTIDES)) {
+        Debug(Debug::ERROR) << "The prefilter can not search amino acids against nucleotides.\n";
+        return EXIT_FAILURE;
+    }
+
+    Prefiltering pref(par.db1, par.db1Index, par.db2, par.db2Index, queryDbType, targetDbType, par);
+#ifdef HAVE_PTHREADS
+    if (pref.canStream()) {
+        // both stages run at the same time, they split the threads instead of each using all of them
+        const int threads = par.threads;
+        const unsigned int prefilterThreads = static_cast<unsigned int>(std::max((threads + 1) / 2, 1));
+        par.threads = std::max(threads - static_cast<int>(prefilterThreads), 1);
+        // the alignment reads the target sequences through the reader of the prefilter
+        Alignment aln(par.db1, par.db2, "", "", par.db3, par.db3Index, par, false, pref.getTargetReader());
+        par.threads = threads;
+        // a few results per worker are enough to keep both stages busy
+        ResultQueue queue(static_cast<size_t>(threads) * 16);
+        PrefilterStream stream = { &pref, &queue, prefilterThreads };
+        pthread_t thread;
+        if (pthread_create(&thread, NULL, runPrefilterStream, &stream) != 0) {
+            Debug(Debug::ERROR) << "Could not start prefilter thread\n";
+            return EXIT_FAILURE;
+        }
+        aln.runStreaming(&queue, pref.getQueryCount(), pref.getResultDbtype());
+        pthread_join(thread, NULL);
+        return EXIT_SUCCESS;
+    }
+#endif
+
+    // target splits have to be merged before the alignment, go through a result database
+    std::pair<std::string, std::string> prefDb = Util::databaseNames(par.db3 + "_pref");
+    pref.runAllSplits(prefDb.first, prefDb.second);
+    {
+        Alignment aln(par.db1, par.db2, prefDb.first, prefDb.second, par.db3, par.db3Index, par, false);
+        aln.run();
+    }
+    DBReader<unsigned int>::removeDb(prefDb.first);
+    return EXIT_SUCCESS;
+}
@@ -3,6 +3,7 @@
 #include "Matcher.h"
 #include "Util.h"
 #include "Parameters.h"
+#include "Instrumentation.h"
 #include "StripedSmithWaterman.h"
 
 
@@ -59,6 +60,8 @@ void Matcher::initQuery(Sequence* query){
 Matcher::result_t Matcher::getSWResult(Sequence* dbSeq, const int diagonal, bool isReverse, const int covMode, const float covThr,
                                        const double evalThr, unsigned int alignmentMode, unsigned int seqIdMode, bool isIdentity,
                                        bool wrappedScoring){
+    INSTRUMENT_SCOPE(ALIGNMENT);
+    INSTRUMENT_COUNT(ALIGNMENT, static_cast<size_t>(currentQuery->L) * dbSeq->L);
 
     // calculation of the score and traceback of the alignment
     int32_t maskLen = currentQuery->L / 2;
@@ -141,6 +144,10 @@ Matcher::result_t Matcher::getSWResult(Sequence* dbSeq, const int diagonal, bool
 }
 
 
+void Matcher::getSWScoreBatch(const unsigned char **dbSequences, const int32_t *dbLengths, int count, int *scores) {
+    aligner->ssw_score_batch(dbSequences, dbLengths, count, gapOpen, gapExtend, scores);
+}
+
 void Matcher::readAlignmentResults(std::vector<result_t> &result, char *data, bool readCompressed) {
     if(data == NULL) {
         return;
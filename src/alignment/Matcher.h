@@ -153,6 +153,10 @@ public:
     result_t getSWResult(Sequence* dbSeq, const int diagonal, bool isReverse, const int covMode, const float covThr, const double evalThr,
                          unsigned int alignmentMode, unsigned int seqIdMode, bool isIdentical, bool wrappedScoring=false);
 
+    // compute only the gapped scores of up to VECSIZE_INT * 4 sequence targets at once (sequence query only)
+    // scores are never below the getSWResult score, 255 means the score was too large to compute
+    void getSWScoreBatch(const unsigned char **dbSequences, const int32_t *dbLengths, int count, int *scores);
+
     // need for sorting the results
     static bool compareHits(const result_t &first, const result_t &second) {
         if (first.eval != second.eval) {
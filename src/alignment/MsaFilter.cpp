@@ -9,6 +9,98 @@
 #include "MathUtil.h"
 #include "MultipleAlignment.h"
 
+#include <climits>
+
+// The rows of the MSA are aligned and padded with GAPs (see MultipleAlignment::initX).
+// The scans below load whole vectors of a row and mask out the positions outside of the scanned range.
+#define ROW_VECSIZE (VECSIZE_INT * 4)
+
+// bit i is set if position vecStart + i is in [from, to), the vector has to overlap the range
+static inline unsigned int rangeMask(int vecStart, int from, int to) {
+    unsigned int mask = (ROW_VECSIZE == 32) ? UINT_MAX : ((1u << ROW_VECSIZE) - 1);
+    if (from > vecStart) {
+        mask &= mask << (from - vecStart);
+    }
+    if (to < vecStart + ROW_VECSIZE) {
+        mask &= (1u << (to - vecStart)) - 1;
+    }
+    return mask;
+}
+
+// bit i is set if position i holds an amino acid (residues == true) or anything but a GAP
+static inline unsigned int positionMask(const simd_int x, bool residues) {
+    if (residues) {
+        return ~simdi8_movemask(simdi8_gt(x, simdi8_set(MultipleAlignment::NAA - 1)));
+    }
+    return ~simdi8_movemask(simdi8_eq(x, simdi8_set(MultipleAlignment::GAP)));
+}
+
+static inline simd_int loadRow(const char *seq, int vecStart) {
+    return simdi_load((const simd_int *) (seq + vecStart));
+}
+
+// first position in [from, to) with an amino acid or no GAP, to if there is none
+static int findFirst(const char *seq, int from, int to, bool residues) {
+    for (int vecStart = (from / ROW_VECSIZE) * ROW_VECSIZE; vecStart < to; vecStart += ROW_VECSIZE) {
+        const unsigned int mask = positionMask(loadRow(seq, vecStart), residues) & rangeMask(vecStart, from, to);
+        if (mask != 0) {
+            return vecStart + __builtin_ctz(mask);
+        }
+    }
+    return to;
+}
+
+// last position in [from, to) with an amino acid or no GAP, from - 1 if there is none
+static int findLast(const char *seq, int from, int to, bool residues) {
+    for (int vecStart = ((to - 1) / ROW_VECSIZE) * ROW_VECSIZE; vecStart >= 0 && vecStart + ROW_VECSIZE > from; vecStart -= ROW_VECSIZE) {
+        const unsigned int mask = positionMask(loadRow(seq, vecStart), residues) & rangeMask(vecStart, from, to);
+        if (mask != 0) {
+            return vecStart + 31 - __builtin_clz(mask);
+        }
+    }
+    return from - 1;
+}
+
+// number of amino acids of seq in [from, to), differences counts those that are not identical to query
+static int countResidues(const char *seq, const char *query, int from, int to, int *differences) {
+    int residues = 0;
+    int diff = 0;
+    for (int vecStart = (from / ROW_VECSIZE) * ROW_VECSIZE; vecStart < to; vecStart += ROW_VECSIZE) {
+        const simd_int x = loadRow(seq, vecStart);
+        const unsigned int mask = positionMask(x, true) & rangeMask(vecStart, from, to);
+        residues += __builtin_popcount(mask);
+        if (query != NULL) {
+            const unsigned int identical = simdi8_movemask(simdi8_eq(x, loadRow(query, vecStart)));
+            diff += __builtin_popcount(mask & ~identical);
+        }
+    }
+    if (differences != NULL) {
+        *differences = diff;
+    }
+    return residues;
+}
+
+// maximum of values in [from, to), INT_MIN if the range is empty
+static int maxInRange(const int *values, int from, int to) {
+    int max = INT_MIN;
+    int i = from;
+    if (to - from >= VECSIZE_INT) {
+        simd_int vmax = simdi32_set(INT_MIN);
+        for (; i + VECSIZE_INT <= to; i += VECSIZE_INT) {
+            vmax = simdi32_max(vmax, simdi_loadu((const simd_int *) (values + i)));
+        }
+        int tmp[VECSIZE_INT];
+        simdi_storeu((simd_int *) tmp, vmax);
+        for (int j = 0; j < VECSIZE_INT; j++) {
+            max = std::max(max, tmp[j]);
+        }
+    }
+    for (; i < to; i++) {
+        max = std::max(max, values[i]);
+    }
+    return max;
+}
+
 MsaFilter::MsaFilter(int maxSeqLen, int maxSetSize, SubstitutionMatrix *m, int gapOpen, int gapExtend) :
     // TODO allow changing these?
     PLTY_GAPOPEN(6.0f), PLTY_GAPEXTD(1.0f), gapOpen(gapOpen), gapExtend(gapExtend) {
@@ -117,12 +209,9 @@ size_t MsaFilter::filter(const int N_in_total, const int L, const int coverage,
             const char * query = X_in[0];
             N_in_bucket++;
             for (int k = 1; k < N_in_total; k++) {
-                int nr = 0;
-                int nid = 0;
-                for (int i = 0; i < L; ++i) {
-                    nr += (X_in[k][i] < MultipleAlignment::NAA);
-                    nid += (X_in[k][i] == query[i] && X_in[k][i] < MultipleAlignment::NAA);
-                }
+                int ndiff;
+                const int nr = countResidues(X_in[k], query, 0, L, &ndiff);
+                const int nid = nr - ndiff;
                 int seqid = static_cast<int>(100.0f * (static_cast<float>(nid) / static_cast<float>(nr)));
                 if (seqid > qid_vec[qid_idx] && seqid <= qid_vec[qid_idx + 1]) {
                     X[N_in_bucket] = X_in[k];
@@ -185,24 +274,15 @@ size_t MsaFilter::filter(const int N_in_total, const int L, const int coverage,
         // Determine first[k], last[k]?
         for (k = 0; k < N_in; ++k)  // do this for ALL sequences, not only those with in[k]==1 (since in[k] may be display[k])
         {
-            for (i = 0; i < L; ++i)
-                if (X[k][i] < MultipleAlignment::NAA)
-                    break;
-            first[k] = i;
-            for (i = (L - 1); i > 0; i--)
-                if (X[k][i] < MultipleAlignment::NAA)
-                    break;
-            last[k] = i;
+            first[k] = findFirst(X[k], 0, L, true);
+            last[k] = std::max(findLast(X[k], 0, L, true), 0);
         }
 
         // Determine number of residues nres[k]?
         for (k = 0;
              k < N_in; ++k)  // do this for ALL sequences, not only those with in[k]==1 (since in[k] may be display[k])
         {
-            int nr = 0;
-            for (i = first[k]; i <= last[k]; ++i)
-                if (X[k][i] < MultipleAlignment::NAA)
-                    nr++;
+            const int nr = countResidues(X[k], NULL, first[k], last[k] + 1, NULL);
             this->nres[k] = nr;
 //        printf("%d nres=%3i  first=%3i  last=%3i\n",k,nr,first[k],last[k]);
             if (nr == 0)
@@ -302,12 +382,7 @@ size_t MsaFilter::filter(const int N_in_total, const int L, const int coverage,
 
                 qdiff_max = int(qdiff_max_frac * nres[k] + 0.9999);
 //                  printf("k=%-4i  nres=%-4i  qdiff_max=%-4i first=%-4i last=%-4i",k,nres[k],qdiff_max,first[k],last[k]);
-                diff = 0;
-                for (int i = first[k]; i <= last[k]; ++i)
-                    // enough different residues to reject based on minimum qid with query? => break
-                    if (X[k][i] < MultipleAlignment::NAA
-                        && X[k][i] != X[kfirst][i] && ++diff >= qdiff_max)
-                        break;
+                countResidues(X[k], X[kfirst], first[k], last[k] + 1, &diff);
 //                  printf("  diff=%4i\n",diff);
                 if (diff >= qdiff_max) {
                     *keep_local[k] = 0;
@@ -413,10 +488,7 @@ size_t MsaFilter::filter(const int N_in_total, const int L, const int coverage,
                     continue;
                 }
 
-                float seqidk = seqid1;
-                for (i = first[k]; i <= last[k]; ++i)
-                    if (idmaxwin[i] > seqidk)
-                        seqidk = idmaxwin[i];
+                float seqidk = std::max(seqid1, maxInRange(idmaxwin, first[k], last[k] + 1));
                 if (seqid == seqid_prev[k])
                     continue;  // sequence has already been rejected at this seqid threshold => reject this time
                 seqid_prev[k] = seqid;
@@ -578,22 +650,8 @@ void MsaFilter::pruneAlignment(char ** msaSequence, int N_in, int L) {
     float bl = 0.0;   // minimum per-residue bit score with query at ends of HSP for loose end pruning
     float bs = 0.8;   // minimum per-residue bit score with query at ends of HSP for strict end pruning
     for(int seqIdx = 1; seqIdx < N_in; seqIdx++ ){
-        int qfirst = 0;             // index of first query residue in pairwise alignment
-        for(int i = 0; i < L; i++){
-            if(msaSequence[seqIdx][i]==MultipleAlignment::GAP){
-                qfirst++;
-            }else{
-                break;
-            }
-        }
-        int qlast  = L - 1;         // index of last  query residue in pairwise alignment
-        for(int i = qlast; i >= 0; i--){
-            if(msaSequence[seqIdx][i]==MultipleAlignment::GAP){
-                qlast--;
-            }else{
-                break;
-            }
-        }
+        int qfirst = findFirst(msaSequence[seqIdx], 0, L, false);  // index of first query residue in pairwise alignment
+        int qlast  = findLast(msaSequence[seqIdx], 0, L, false);   // index of last  query residue in pairwise alignment
         // Count gaps in template that are aligned with match residues to the left of HSP
         int gapsleft= qfirst;
         int gapsright= L - qlast;
@@ -637,7 +695,17 @@ int MsaFilter::prune(int start, int end, float b, char * query, char *target) {
         end = tmp;
         rev = true;
     }
-    for(int i = start; i < end; i++) {
+    // each GAP in the target lowers the score below smin, the scan starts after the end gaps of the target
+    int skip = 0;
+    if (gapOpen > 0 && gapExtend > 0 && b >= 0) {
+        skip = rev ? pos - findLast(target, start + 1, pos + 1, false) : findFirst(target, pos, end, false) - pos;
+        if (skip > 0) {
+            pos += rev ? -skip : skip;
+            i_ret = rev ? pos + 1 : pos - 1;
+            gap = true;
+        }
+    }
+    for(int i = start + skip; i < end; i++) {
         if(rev == true){
             if( pos < i_ret - 20.0)
                 break;
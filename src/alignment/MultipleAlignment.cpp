@@ -31,6 +31,28 @@ void MultipleAlignment::deleteMSA(MultipleAlignment::MSAResult *res) {
     delete[] res->msaSequence;
 }
 
+size_t MultipleAlignment::getColumnStride(size_t setSize) {
+    return ((setSize + (VECSIZE_INT * 4) - 1) / (VECSIZE_INT * 4)) * (VECSIZE_INT * 4);
+}
+
+void MultipleAlignment::transposeMSA(char *columns, const char **msaSequence, size_t setSize, size_t len) {
+    const size_t stride = getColumnStride(setSize);
+    // blocks of sequences keep the rows that are read in cache
+    const size_t blockSize = VECSIZE_INT * 4;
+    for (size_t kStart = 0; kStart < setSize; kStart += blockSize) {
+        const size_t kEnd = std::min(kStart + blockSize, setSize);
+        for (size_t pos = 0; pos < len; pos++) {
+            char *column = columns + pos * stride;
+            for (size_t k = kStart; k < kEnd; k++) {
+                column[k] = msaSequence[k][pos];
+            }
+        }
+    }
+    for (size_t pos = 0; pos < len; pos++) {
+        memset(columns + pos * stride + setSize, GAP, stride - setSize);
+    }
+}
+
 void MultipleAlignment::print(MSAResult msaResult, SubstitutionMatrix * subMat){
     for(size_t i = 0; i < msaResult.setSize; i++) {
         for(size_t pos = 0; pos < msaResult.msaSequenceLength; pos++){
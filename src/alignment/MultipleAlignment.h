@@ -41,6 +41,13 @@ public:
     // clean memory for MSA
     static void deleteMSA(MultipleAlignment::MSAResult * res);
 
+    // distance between two columns of the column-major MSA layout, a multiple of the SIMD width
+    static size_t getColumnStride(size_t setSize);
+
+    // copy the first len columns of the MSA to the column-major layout, column i starts at columns + i * getColumnStride(setSize)
+    // the columns are padded with GAP, columns has to be aligned and hold len * getColumnStride(setSize) bytes
+    static void transposeMSA(char *columns, const char **msaSequence, size_t setSize, size_t len);
+
 private:
     BaseMatrix* subMat;
     size_t maxSeqLen;
@@ -10,6 +10,8 @@
 #include "Debug.h"
 #include "MultipleAlignment.h"
 
+#include <climits>
+
 
 PSSMCalculator::PSSMCalculator(SubstitutionMatrix *subMat, size_t maxSeqLength, size_t maxSetSize, int pcmode,
                                MultiParam<PseudoCounts> pca, MultiParam<PseudoCounts> pcb, int gapOpen, int gapPseudoCount)
@@ -22,7 +24,7 @@ PSSMCalculator::PSSMCalculator(SubstitutionMatrix *subMat, size_t maxSeqLength,
     this->maxSetSize = maxSetSize;
     this->profile            = new float[(maxSeqLength + 1) * Sequence::PROFILE_AA_SIZE];
     this->Neff_M             = new float[(maxSeqLength + 1)];
-    this->seqWeight          = (float*)malloc(maxSetSize * sizeof(float));
+    this->seqWeight          = (float*)malloc_simd_float(MultipleAlignment::getColumnStride(maxSetSize) * sizeof(float));
     this->pssm               = new char[(maxSeqLength + 1) * Sequence::PROFILE_AA_SIZE];
     this->consensusSequence  = new unsigned char[maxSeqLength + 1];
     this->matchWeight        = (float *) malloc_simd_float(Sequence::PROFILE_AA_SIZE * (maxSeqLength + 1) * sizeof(float));
@@ -37,7 +39,9 @@ PSSMCalculator::PSSMCalculator(SubstitutionMatrix *subMat, size_t maxSeqLength,
     for (size_t j = 0; j < (maxSeqLength + 1); j++) {
         w_contrib[j] = (float*)(w_contrib_backing + (NAA_ALIGNSIZE * j));
     }
-    wi = (float*)malloc(maxSetSize * sizeof(float));
+    wi = (float*)malloc_simd_float(MultipleAlignment::getColumnStride(maxSetSize) * sizeof(float));
+    msaColumns = NULL;
+    msaColumnsSize = 0;
     naa = new int[maxSeqLength + 1];
     f = malloc_matrix<float>(maxSeqLength + 1, MultipleAlignment::NAA + 3);
     n = new int*[maxSeqLength + 2];
@@ -69,6 +73,7 @@ PSSMCalculator::~PSSMCalculator() {
     free(w_contrib_backing);
     delete[] w_contrib;
     free(wi);
+    free(msaColumns);
     delete[] naa;
     free(n_backing);
     delete[] n;
@@ -131,8 +136,16 @@ PSSMCalculator::Profile PSSMCalculator::computePSSMFromMSA(size_t setSize, size_
 PSSMCalculator::Profile PSSMCalculator::computePSSMFromMSA(size_t setSize, size_t queryLength, const char **msaSeqs,
                                                            const std::vector<Matcher::result_t> &alnResults, bool wg) {
     increaseSetSize(setSize);
+    // the weights iterate over the sequences of a column, the column-major copy makes these loops contiguous
+    const size_t stride = MultipleAlignment::getColumnStride(setSize);
+    if (stride * queryLength > msaColumnsSize) {
+        free(msaColumns);
+        msaColumnsSize = stride * queryLength * 1.5;
+        msaColumns = (char*)mem_align(ALIGN_INT, msaColumnsSize);
+    }
+    MultipleAlignment::transposeMSA(msaColumns, msaSeqs, setSize, queryLength);
     // Quick and dirty calculation of the weight per sequence wg[k]
-    computeSequenceWeights(seqWeight, queryLength, setSize, msaSeqs);
+    computeSequenceWeights(seqWeight, queryLength, setSize, msaColumns, stride);
     seqWeightTotal = 0.0; // TODO: MathUtil::NormalizeTo1 computes the same sum again, could be optimized?
     for (size_t i = 0; i < setSize; ++i) {
         seqWeightTotal += seqWeight[i];
@@ -140,12 +153,12 @@ PSSMCalculator::Profile PSSMCalculator::computePSSMFromMSA(size_t setSize, size_
     MathUtil::NormalizeTo1(seqWeight, setSize);
     if (wg == false) {
         // compute context specific counts and Neff
-        computeContextSpecificWeights(matchWeight, seqWeight, Neff_M, queryLength, setSize, msaSeqs);
+        computeContextSpecificWeights(matchWeight, seqWeight, Neff_M, queryLength, setSize, msaSeqs, msaColumns, stride);
     } else {
         // compute matchWeight based on sequence weight
-        computeMatchWeights(matchWeight, seqWeight, setSize, queryLength, msaSeqs);
+        computeMatchWeights(matchWeight, seqWeight, setSize, queryLength, msaColumns, stride);
         // compute NEFF_M
-        computeNeff_M(matchWeight, seqWeight, Neff_M, queryLength, setSize, msaSeqs);
+        computeNeff_M(matchWeight, seqWeight, Neff_M, queryLength, setSize, msaColumns, stride);
     }
     // compute consensus sequence
     computeConsensusSequence(consensusSequence, matchWeight, queryLength, subMat->pBack, subMat->num2aa);
@@ -175,7 +188,7 @@ PSSMCalculator::Profile PSSMCalculator::computePSSMFromMSA(size_t setSize, size_
 
     // create final Matrix
     computeLogPSSM(subMat, pssm, profile, 8.0, queryLength, 0.0);
-    computeGapPenalties(queryLength, setSize, msaSeqs, alnResults);
+    computeGapPenalties(queryLength, setSize, msaColumns, stride, alnResults);
 //    PSSMCalculator::printProfile(queryLength);
 
 //    PSSMCalculator::printPSSM(queryLength);
@@ -240,7 +253,7 @@ void PSSMCalculator::preparePseudoCounts(float *frequency, float *frequency_with
     }
 }
 void PSSMCalculator::computeNeff_M(float *frequency, float *seqWeight, float *Neff_M,
-                                   size_t queryLength, size_t setSize, char const **msaSeqs) {
+                                   size_t queryLength, size_t setSize, const char *columns, size_t stride) {
     float Neff_HMM = 0.0f;
     for (size_t pos = 0; pos < queryLength; pos++) {
         float sum = 0.0f;
@@ -257,8 +270,9 @@ void PSSMCalculator::computeNeff_M(float *frequency, float *seqWeight, float *Ne
     float scale = MathUtil::flog2((Nlim - Neff_HMM) / (Nlim - 1.0));  // for calculating Neff for those seqs with inserts at specific pos
     for (size_t pos = 0; pos < queryLength; pos++) {
         float w_M = -1.0 / setSize;
+        const char *column = columns + pos * stride;
         for (size_t k = 0; k < setSize; ++k){
-            if ( msaSeqs[k][pos] != MultipleAlignment::GAP) {
+            if (column[k] != MultipleAlignment::GAP) {
                 w_M += seqWeight[k];
             }
         }
@@ -269,30 +283,47 @@ void PSSMCalculator::computeNeff_M(float *frequency, float *seqWeight, float *Ne
 
 void PSSMCalculator::computeSequenceWeights(float *seqWeight, size_t queryLength,
                                             size_t setSize, const char **msaSeqs) {
-    unsigned int *number_res = new unsigned int[setSize];
+    const size_t stride = MultipleAlignment::getColumnStride(setSize);
+    char *columns = (char*)mem_align(ALIGN_INT, std::max(stride * queryLength, (size_t) 1));
+    float *weights = (float*)malloc_simd_float(stride * sizeof(float));
+    MultipleAlignment::transposeMSA(columns, msaSeqs, setSize, queryLength);
+    computeSequenceWeights(weights, queryLength, setSize, columns, stride);
+    memcpy(seqWeight, weights, setSize * sizeof(float));
+    free(weights);
+    free(columns);
+}
+
+void PSSMCalculator::computeSequenceWeights(float *seqWeight, size_t queryLength, size_t setSize,
+                                            const char *columns, size_t stride) {
+    unsigned int *number_res = new unsigned int[stride];
+    float *lengthTerm = (float*)malloc_simd_float(stride * sizeof(float));
     // initialized wg[k] with tiny pseudo counts
-    std::fill(seqWeight, seqWeight + setSize,  1e-6);
+    std::fill(seqWeight, seqWeight + stride,  1e-6);
     // count number of residues per sequence
-    for (size_t k = 0; k < setSize; ++k)
-    {
-        unsigned int nr = 0;
-        for (size_t pos = 0; pos < queryLength; pos++) {
-            if (msaSeqs[k][pos] != MultipleAlignment::GAP) {
-                nr++;
-            }
+    std::fill(number_res, number_res + stride, 0);
+    for (size_t pos = 0; pos < queryLength; pos++) {
+        const char *column = columns + pos * stride;
+        for (size_t k = 0; k < setSize; ++k) {
+            number_res[k] += (column[k] != MultipleAlignment::GAP);
         }
-        number_res[k] = nr;
     }
+    // ensure that each residue of a short sequence contributes as much as a residue of a long sequence:
+    // contribution is proportional to one over sequence length nres[k] plus 30.
+    for (size_t k = 0; k < stride; ++k) {
+        lengthTerm[k] = float(number_res[k]) + 30.0f;
+    }
+    // nl[a] * distinct_aa_count per residue, infinite for GAP and X so that they add nothing to the weight
+    float residueTerm[UCHAR_MAX + 1];
+    std::fill(residueTerm, residueTerm + UCHAR_MAX + 1, std::numeric_limits<float>::infinity());
     for (size_t pos = 0; pos < queryLength; pos++) {
+        const char *column = columns + pos * stride;
         int nl[ Sequence::PROFILE_AA_SIZE ];  //nl[a] = number of seq's with amino acid a at position l
         //number of different amino acids (ignore X)
         std::fill(nl, nl + Sequence::PROFILE_AA_SIZE,  0);
         for (size_t k = 0; k < setSize; ++k) {
-            if (msaSeqs[k][pos] != MultipleAlignment::GAP) {
-                const unsigned int aa_pos = msaSeqs[k][pos];
-                if(aa_pos < Sequence::PROFILE_AA_SIZE){
-                    nl[aa_pos]++;
-                }
+            const unsigned int aa_pos = column[k];
+            if (aa_pos < Sequence::PROFILE_AA_SIZE) {
+                nl[aa_pos]++;
             }
         }
         //count distinct amino acids (ignore X)
@@ -302,32 +333,28 @@ void PSSMCalculator::computeSequenceWeights(float *seqWeight, size_t queryLength
                 ++distinct_aa_count;
             }
         }
-//        if(distinct_aa_count == 0){
-//            Debug(Debug::ERROR) << "Error in computeSequenceWeights. Distinct amino acid count is 0.\n";
-//            EXIT(EXIT_FAILURE);
-//        }
+        if (distinct_aa_count == 0) {
+            continue;
+        }
+        for (size_t aa = 0; aa < Sequence::PROFILE_AA_SIZE; ++aa) {
+            residueTerm[aa] = float(nl[aa]) * float(distinct_aa_count);
+        }
         // Compute sequence Weight
         // "Position-based Sequence Weights", Henikoff (1994)
+        // Treat score of X with other amino acid as 0.0
+#ifdef AVX2
+        for (size_t k = 0; k < stride; k += VECSIZE_FLOAT) {
+            __m256i aa = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *) (column + k)));
+            simd_float term = simdf32_mul(_mm256_i32gather_ps(residueTerm, aa, sizeof(float)), simdf32_load(lengthTerm + k));
+            simdf32_store(seqWeight + k, simdf32_add(simdf32_load(seqWeight + k), simdf32_div(simdf32_set(1.0f), term)));
+        }
+#else
         for (size_t k = 0; k < setSize; ++k) {
-            if (msaSeqs[k][pos] != MultipleAlignment::GAP) {
-                if (distinct_aa_count != 0) {
-                    const unsigned int aa_pos = msaSeqs[k][pos];
-//                    std::cout << "k="<< k << "\t";
-                    if(aa_pos < Sequence::PROFILE_AA_SIZE){ // Treat score of X with other amino acid as 0.0
-                        seqWeight[k] += 1.0f / (float(nl[aa_pos]) * float(distinct_aa_count) * (float(number_res[k]) + 30.0f));
-//                        std::cout << number_res[k] << "\t" << distinct_aa_count << "\t" <<  nl[aa_pos] << "\t";
-                    }
-                }
-                // ensure that each residue of a short sequence contributes as much as a residue of a long sequence:
-                // contribution is proportional to one over sequence length nres[k] plus 30.
-            }
+            seqWeight[k] += 1.0f / (residueTerm[(unsigned char) column[k]] * lengthTerm[k]);
         }
+#endif
     }
-//    std::cout << setSize << std::endl;
-//    std::cout << " Seq. Weight: " << std::endl;
-//    for (size_t k = 0; k < setSize; ++k) {
-//        std::cout << " k="<< k << "\t" << seqWeight[k] << std::endl;
-//    }
+    free(lengthTerm);
     delete [] number_res;
 }
 
@@ -352,13 +379,14 @@ void PSSMCalculator::computePseudoCounts(float *profile, float *frequency,
     }
 }
 
-void PSSMCalculator::computeMatchWeights(float * matchWeight, float * seqWeight, size_t setSize, size_t queryLength, const char **msaSeqs) {
+void PSSMCalculator::computeMatchWeights(float * matchWeight, float * seqWeight, size_t setSize, size_t queryLength, const char *columns, size_t stride) {
     for (size_t pos = 0; pos < queryLength; pos++) {
         memset(matchWeight + pos * Sequence::PROFILE_AA_SIZE, 0,
                Sequence::PROFILE_AA_SIZE * sizeof(float));
+        const char *column = columns + pos * stride;
         for (size_t k = 0; k < setSize; ++k){
-            if(msaSeqs[k][pos] != MultipleAlignment::GAP){
-                unsigned int aa_pos = msaSeqs[k][pos];
+            if(column[k] != MultipleAlignment::GAP){
+                unsigned int aa_pos = column[k];
                 if(aa_pos < Sequence::PROFILE_AA_SIZE) { // Treat score of X with other amino acid as 0.0
                     matchWeight[pos * Sequence::PROFILE_AA_SIZE + aa_pos] += seqWeight[k];
                 }
@@ -369,7 +397,7 @@ void PSSMCalculator::computeMatchWeights(float * matchWeight, float * seqWeight,
 }
 
 void PSSMCalculator::computeContextSpecificWeights(float * matchWeight, float *wg, float * Neff_M, size_t queryLength, size_t setSize,
-                                                   const char **X) {
+                                                   const char **X, const char *columns, size_t stride) {
     //For weighting: include only columns into subalignment i that have a max fraction of seqs with endgap
     const float MAXENDGAPFRAC=0.1;
     const int NCOLMIN=20;   //min number of cols in subalignment for calculating pos-specific weights w[k][i]
@@ -394,21 +422,24 @@ void PSSMCalculator::computeContextSpecificWeights(float * matchWeight, float *w
     }
     //////////////////////////////////////////////////////////////////////////////////////////////
     // Main loop through alignment columns
+    // the columns are not updated with the end gaps, GAP and ENDGAP are treated the same in the column loops
     for (size_t i = 0; i < queryLength; i++)  // Calculate wi[k] at position i as well as Neff[i]
     {
         bool change = false;
+        const char *column = columns + i * stride;
+        const char *prevColumn = (i == 0) ? column : columns + (i - 1) * stride;
         // Check all sequences k and update n[j][a] and ri[j] if necessary
         for (size_t k = 0; k < setSize; ++k) {
             // Update amino acid and GAP / ENDGAP counts for sequences with AA in i-1 and GAP/ENDGAP in i or vice versa
 //            printf("%d %d %d\n", k, i, (int) X[k][i - 1]);
-            if ((i == 0  && X[k][i] < MultipleAlignment::ANY) ||
-                (i != 0  && X[k][i - 1] >= MultipleAlignment::ANY && X[k][i] < MultipleAlignment::ANY)) {  // ... if sequence k was NOT included in i-1 and has to be included for column i
+            if ((i == 0  && column[k] < MultipleAlignment::ANY) ||
+                (i != 0  && prevColumn[k] >= MultipleAlignment::ANY && column[k] < MultipleAlignment::ANY)) {  // ... if sequence k was NOT included in i-1 and has to be included for column i
                 change = true;
                 nseqi++;
                 for (size_t j = 0; j < queryLength; ++j){
                     n[j][(int) X[k][j]]++;
                 }
-            } else if ( i != 0 && X[k][i - 1] < MultipleAlignment::ANY && X[k][i] >= MultipleAlignment::ANY) {  // ... if sequence k WAS included in i-1 and has to be thrown out for column i
+            } else if ( i != 0 && prevColumn[k] < MultipleAlignment::ANY && column[k] >= MultipleAlignment::ANY) {  // ... if sequence k WAS included in i-1 and has to be thrown out for column i
                 change = true;
                 nseqi--;
                 for (size_t j = 0; j < queryLength; ++j)
@@ -429,7 +460,7 @@ void PSSMCalculator::computeContextSpecificWeights(float * matchWeight, float *w
 
             // Initialize weights and numbers of residues for subalignment i
             int ncol = 0;
-            for (size_t k = 0; k < setSize; ++k)
+            for (size_t k = 0; k < stride; ++k)
                 wi[k] = 1E-8;  // for pathological alignments all wi[k] can get 0;
 
             // Find min and max borders between which > fraction MAXENDGAPFRAC of sequences in subalignment contain an aa
@@ -449,7 +480,7 @@ void PSSMCalculator::computeContextSpecificWeights(float * matchWeight, float *w
             if (ncol < NCOLMIN) {
                 // Take global weights
                 for (size_t k = 0; k < setSize; ++k){
-                    wi[k] = (X[k][i] < MultipleAlignment::ANY)? wg[k] : 0.0f;
+                    wi[k] = (column[k] < MultipleAlignment::ANY)? wg[k] : 0.0f;
                 }
             } else {
                 // Count number of different amino acids in column j
@@ -480,12 +511,39 @@ void PSSMCalculator::computeContextSpecificWeights(float * matchWeight, float *w
                 }
 
                 // Compute pos-specific weights wi[k]
+                // innermost, time-critical loop; O(L*setSize*L)
+#ifdef AVX2
+                // The column-major layout sums up VECSIZE_FLOAT sequences in parallel, each one in the order of j.
+                // w_contrib[j] holds the 23 possible values in three vectors, these are looked up with permutes.
+                // Sequences outside of the subalignment are summed up too and reset afterwards.
+                const simd_int one = simdi32_set(1);
+                const simd_int two = simdi32_set(2);
+                for (size_t k = 0; k < setSize; k += VECSIZE_FLOAT) {
+                    simd_float sum = simdf32_load(wi + k);
+                    for (int j = jmin; j <= jmax; ++j) {
+                        const simd_int aa = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *) (columns + j * stride + k)));
+                        const simd_int block = simdi32_srli(aa, 3);
+                        const simd_float w0 = _mm256_permutevar8x32_ps(simdf32_load(w_contrib[j]), aa);
+                        const simd_float w1 = _mm256_permutevar8x32_ps(simdf32_load(w_contrib[j] + VECSIZE_FLOAT), aa);
+                        const simd_float w2 = _mm256_permutevar8x32_ps(simdf32_load(w_contrib[j] + 2 * VECSIZE_FLOAT), aa);
+                        simd_float w = _mm256_blendv_ps(w0, w1, simdi_i2fcast(simdi32_eq(block, one)));
+                        w = _mm256_blendv_ps(w, w2, simdi_i2fcast(simdi32_eq(block, two)));
+                        sum = simdf32_add(sum, w);
+                    }
+                    simdf32_store(wi + k, sum);
+                }
+                for (size_t k = 0; k < setSize; ++k) {
+                    if (column[k] >= MultipleAlignment::ANY)
+                        wi[k] = 1E-8;
+                }
+#else
                 for (size_t k = 0; k < setSize; ++k) {
-                    if (X[k][i] >= MultipleAlignment::ANY)
+                    if (column[k] >= MultipleAlignment::ANY)
                         continue;
-                    for (int j = jmin; j <= jmax; ++j)  // innermost, time-critical loop; O(L*setSize*L)
+                    for (int j = jmin; j <= jmax; ++j)
                         wi[k] += w_contrib[j][(int) X[k][j]];
                 }
+#endif
             }
 
 
@@ -497,8 +555,9 @@ void PSSMCalculator::computeContextSpecificWeights(float * matchWeight, float *w
                 memset(f[j], 0, MultipleAlignment::ANY * sizeof(float));
 
             // Update f[j][a]
+            // the rows are faster here, consecutive sequences of a column often add to the same f[j][a]
             for (size_t k = 0; k < setSize; ++k) {
-                if (X[k][i] >= MultipleAlignment::ANY)
+                if (column[k] >= MultipleAlignment::ANY)
                     continue;
                 for (int j = jmin; j <= jmax; ++j)  // innermost loop; O(L*setSize*L)
                     f[j][(int) X[k][j]] += wi[k];
@@ -534,7 +593,7 @@ void PSSMCalculator::computeContextSpecificWeights(float * matchWeight, float *w
         for (int a = 0; a < 20; ++a)
             matchWeight[i * Sequence::PROFILE_AA_SIZE + a] = 0.0;
         for (size_t k = 0; k < setSize; ++k)
-            matchWeight[i * Sequence::PROFILE_AA_SIZE + (int) X[k][i]] += wi[k];
+            matchWeight[i * Sequence::PROFILE_AA_SIZE + (int) column[k]] += wi[k];
         MathUtil::NormalizeTo1((matchWeight+ i * Sequence::PROFILE_AA_SIZE), MultipleAlignment::NAA, subMat->pBack);
     }
     // remove end gaps
@@ -546,7 +605,7 @@ void PSSMCalculator::computeContextSpecificWeights(float * matchWeight, float *w
     }
 }
 
-void PSSMCalculator::computeGapPenalties(size_t queryLength, size_t setSize, const char **msaSeqs, const std::vector<Matcher::result_t> &alnResults) {
+void PSSMCalculator::computeGapPenalties(size_t queryLength, size_t setSize, const char *columns, size_t stride, const std::vector<Matcher::result_t> &alnResults) {
     gapWeightsIns.clear();
     const float pseudoCounts = gapPseudoCount / seqWeightTotal;
     const float gapWeightStart = pseudoCounts * MathUtil::fpow2(-gapOpen);
@@ -571,7 +630,7 @@ void PSSMCalculator::computeGapPenalties(size_t queryLength, size_t setSize, con
     // we need the seqWeigthSum of two consecutive columns, precalculate for the first column
     float seqWeightSumPrev = 0.0;
     for (size_t i = 0; i < setSize; ++i) {
-        if (msaSeqs[i][0] != MultipleAlignment::GAP) {
+        if (columns[i] != MultipleAlignment::GAP) {
             seqWeightSumPrev += seqWeight[i];
         }
     }
@@ -582,14 +641,16 @@ void PSSMCalculator::computeGapPenalties(size_t queryLength, size_t setSize, con
         float gapWeightDelOpen = gapWeightStart;
         float gapWeightDelClose = gapWeightStart;
         float seqWeightSum = 0.0;
+        const char *column = columns + pos * stride;
+        const char *prevColumn = columns + (pos - 1) * stride;
         for (size_t i = 0; i < setSize; ++i) {
-            if (msaSeqs[i][pos] == MultipleAlignment::GAP) {
-                if (msaSeqs[i][pos - 1] != MultipleAlignment::GAP) {
+            if (column[i] == MultipleAlignment::GAP) {
+                if (prevColumn[i] != MultipleAlignment::GAP) {
                     gapWeightDelOpen += seqWeight[i];
                 }
             } else {
                 seqWeightSum += seqWeight[i];
-                if (msaSeqs[i][pos - 1] == MultipleAlignment::GAP) {
+                if (prevColumn[i] == MultipleAlignment::GAP) {
                     gapWeightDelClose += seqWeight[i];
                 }
             }
@@ -641,8 +702,11 @@ void PSSMCalculator::Profile::toBuffer(const unsigned char* centerSequence, size
 void PSSMCalculator::increaseSetSize(size_t newSetSize) {
     if (newSetSize > maxSetSize) {
         maxSetSize = newSetSize * 1.5;
-        seqWeight = (float*)realloc(seqWeight, maxSetSize * sizeof(float));
-        wi = (float*)realloc(wi, maxSetSize * sizeof(float));
+        // the weights are recomputed for every MSA and do not have to be copied
+        free(seqWeight);
+        seqWeight = (float*)malloc_simd_float(MultipleAlignment::getColumnStride(maxSetSize) * sizeof(float));
+        free(wi);
+        wi = (float*)malloc_simd_float(MultipleAlignment::getColumnStride(maxSetSize) * sizeof(float));
     }
 }
 
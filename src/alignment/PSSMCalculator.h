@@ -133,12 +133,21 @@ private:
     // pseudo count for calculation of gap opening penalties
     int gapPseudoCount;
 
+    // column-major copy of the MSA (see MultipleAlignment::transposeMSA)
+    char *msaColumns;
+    size_t msaColumnsSize;
+
+    // same as the public computeSequenceWeights on the column-major MSA, seqWeight has to be aligned and hold stride entries
+    static void computeSequenceWeights(float *seqWeight, size_t queryLength, size_t setSize, const char *columns, size_t stride);
+
     // compute the Neff_M per column -p log(p)
-    void computeNeff_M(float *frequency, float *seqWeight, float *Neff_M, size_t queryLength, size_t setSize, char const **msaSeqs);
+    void computeNeff_M(float *frequency, float *seqWeight, float *Neff_M, size_t queryLength, size_t setSize, const char *columns, size_t stride);
 
-    void computeMatchWeights(float * matchWeight, float * seqWeight, size_t setSize, size_t queryLength, const char **msaSeqs);
+    void computeMatchWeights(float * matchWeight, float * seqWeight, size_t setSize, size_t queryLength, const char *columns, size_t stride);
 
-    void computeContextSpecificWeights(float * matchWeight, float *seqWeight, float * Neff_M, size_t queryLength, size_t setSize, const char **msaSeqs);
+    // msaSeqs and the column-major columns are both used, the rows for the subalignment counts and the columns for the weights
+    void computeContextSpecificWeights(float * matchWeight, float *seqWeight, float * Neff_M, size_t queryLength, size_t setSize,
+                                       const char **msaSeqs, const char *columns, size_t stride);
 
     int pcmode;
     MultiParam<PseudoCounts> pca;
@@ -149,7 +158,7 @@ private:
     void increaseSetSize(size_t newSetSize);
 
     // compute position-specific gap penalties for both deletions and insertions
-    void computeGapPenalties(size_t queryLength, size_t setSize, const char **msaSeqs, const std::vector<Matcher::result_t> &alnResults);
+    void computeGapPenalties(size_t queryLength, size_t setSize, const char *columns, size_t stride, const std::vector<Matcher::result_t> &alnResults);
 
     void fillCounteProfile(float *counts, float *matchWeight, float *Neff_M, size_t queryLength);
 };
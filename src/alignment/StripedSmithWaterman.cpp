@@ -35,6 +35,7 @@
 SmithWaterman::SmithWaterman(size_t maxSequenceLength, int aaSize, bool aaBiasCorrection,
                              float aaBiasCorrectionScale, int targetSeqType) {
 	maxSequenceLength += 1;
+    this->maxQueryLength = maxSequenceLength;
     this->aaBiasCorrectionScale = aaBiasCorrectionScale;
 	this->aaBiasCorrection = aaBiasCorrection;
 
@@ -44,6 +45,12 @@ SmithWaterman::SmithWaterman(size_t maxSequenceLength, int aaSize, bool aaBiasCo
 	vHLoad  = (simd_int*) mem_align(ALIGN_INT, segSize * sizeof(simd_int));
 	vE      = (simd_int*) mem_align(ALIGN_INT, segSize * sizeof(simd_int));
 	vHmax   = (simd_int*) mem_align(ALIGN_INT, segSize * sizeof(simd_int));
+    batchProfile = NULL;
+    batchH = NULL;
+    batchE = NULL;
+    batchTargets = NULL;
+    batchTargetsLength = 0;
+    batchProfileValid = false;
 
 	// setting up target
 	target_profile_byte = (simd_int*) mem_align(ALIGN_INT, aaSize * segSize * sizeof(simd_int));
@@ -111,6 +118,10 @@ SmithWaterman::~SmithWaterman(){
 	free(vHLoad);
 	free(vE);
 	free(vHmax);
+	free(batchProfile);
+	free(batchH);
+	free(batchE);
+	free(batchTargets);
 	free(target_profile_byte);
 	free(profile->profile_byte);
 	free(profile->profile_word);
@@ -1161,6 +1172,7 @@ void SmithWaterman::ssw_init(const Sequence* q,
 							 const BaseMatrix *m) {
 
     query_id = q->getId();
+    batchProfileValid = false;
 	profile->bias = 0;
     profile->query_length = q->L;
 	profile->sequence_type = q->getSequenceType();
@@ -1701,3 +1713,247 @@ int SmithWaterman::ungapped_alignment(const unsigned char *db_sequence, int32_t
     return score;
 #undef SWAP
 }
+
+int32_t SmithWaterman::initBatch(const unsigned char **db_sequences, const int32_t *db_lengths, int count,
+                                 int32_t blockSize) {
+    const int lanes = VECSIZE_INT * 4;
+    const int32_t query_length = profile->query_length;
+    const int32_t alphabetSize = profile->alphabetSize;
+
+    if (batchProfile == NULL) {
+        batchProfile = (simd_int*) mem_align(ALIGN_INT, (2 * maxQueryLength + 2 * 32) * sizeof(simd_int));
+        batchH = (simd_int*) mem_align(ALIGN_INT, std::max(maxQueryLength, (size_t) 32) * sizeof(simd_int));
+        batchE = (simd_int*) mem_align(ALIGN_INT, std::max(maxQueryLength, (size_t) 32) * sizeof(simd_int));
+    }
+    if (batchProfileValid == false) {
+        // a sequence query only needs one score row per substitution matrix row (+ the per position composition bias),
+        // a profile query needs one score row per query position
+        simd_int *rows = batchProfile;
+        simd_int *compositionBias = batchProfile + 2 * 32;
+        // the low (residues 0-15) and high (16-31) half of each 32 byte score row are replicated over a whole vector
+        uint8_t row[32];
+        if (isQueryProfile) {
+            const int32_t W = (query_length + (lanes - 1)) / lanes;
+            const uint8_t *striped = (const uint8_t *) profile->profile_byte;
+            for (int32_t pos = 0; pos < query_length; pos++) {
+                const int32_t segment = pos % W;
+                const int32_t lane = pos / W;
+                for (int32_t aa = 0; aa < 32; aa++) {
+                    row[aa] = (aa < alphabetSize) ? striped[(aa * W + segment) * lanes + lane] : 0;
+                }
+                uint8_t *lo = (uint8_t *) (rows + 2 * pos);
+                uint8_t *hi = (uint8_t *) (rows + 2 * pos + 1);
+                for (int i = 0; i < lanes; i += 16) {
+                    memcpy(lo + i, row, 16);
+                    memcpy(hi + i, row + 16, 16);
+                }
+            }
+        } else {
+            int8_t compositionBiasMin = 0;
+            for (int32_t i = 0; i < query_length; i++) {
+                compositionBiasMin = std::min(compositionBiasMin, profile->composition_bias[i]);
+            }
+            // bias = |min(mat)| + |min(composition bias)|, split it so that both halves stay non-negative
+            const int32_t matrixBias = profile->bias + compositionBiasMin;
+            for (int32_t q = 0; q < alphabetSize; q++) {
+                for (int32_t aa = 0; aa < 32; aa++) {
+                    row[aa] = (aa < alphabetSize) ? profile->mat[aa * alphabetSize + q] + matrixBias : 0;
+                }
+                uint8_t *lo = (uint8_t *) (rows + 2 * q);
+                uint8_t *hi = (uint8_t *) (rows + 2 * q + 1);
+                for (int i = 0; i < lanes; i += 16) {
+                    memcpy(lo + i, row, 16);
+                    memcpy(hi + i, row + 16, 16);
+                }
+            }
+            for (int32_t pos = 0; pos < query_length; pos++) {
+                compositionBias[pos] = simdi8_set(profile->composition_bias[pos] - compositionBiasMin);
+            }
+        }
+        batchProfileValid = true;
+    }
+
+    int32_t maxLength = 0;
+    for (int i = 0; i < count; i++) {
+        maxLength = std::max(maxLength, db_lengths[i]);
+    }
+    const int32_t paddedLength = ((maxLength + blockSize - 1) / blockSize) * blockSize;
+    if (static_cast<size_t>(paddedLength) > batchTargetsLength) {
+        free(batchTargets);
+        batchTargetsLength = paddedLength;
+        batchTargets = (unsigned char *) mem_align(ALIGN_INT, batchTargetsLength * lanes);
+    }
+    // interleave the targets, position j of target k is at j * lanes + k
+    memset(batchTargets, BATCH_PAD_RESIDUE, static_cast<size_t>(paddedLength) * lanes);
+    for (int k = 0; k < count; k++) {
+        for (int32_t j = 0; j < db_lengths[k]; j++) {
+            batchTargets[j * lanes + k] = db_sequences[k][j];
+        }
+    }
+    return paddedLength;
+}
+
+void SmithWaterman::ungapped_alignment_batch(const unsigned char **db_sequences, const int32_t *db_lengths,
+                                             int count, int *scores) {
+    const int lanes = VECSIZE_INT * 4;
+    const int32_t query_length = profile->query_length;
+    const int32_t alphabetSize = profile->alphabetSize;
+    // columns are processed in blocks so that batchH is only touched once per block and query position
+    const int32_t blockSize = 4;
+    const int32_t paddedLength = initBatch(db_sequences, db_lengths, count, blockSize);
+    const simd_int *rows = batchProfile;
+    const simd_int *compositionBias = batchProfile + 2 * 32;
+
+    const simd_int vBias = simdi8_set(profile->bias);
+    const simd_int vFifteen = simdi8_set(15);
+    const simd_int vPad = simdi8_set(BATCH_PAD_RESIDUE);
+    simd_int vMax = simdi_setzero();
+    memset(batchH, 0, query_length * sizeof(simd_int));
+    if (isQueryProfile) {
+        for (int32_t j = 0; j < paddedLength; j++) {
+            const simd_int residues = simdi_load((simd_int *) (batchTargets + j * lanes));
+            const simd_int highMask = simdi8_gt(residues, vFifteen);
+            // S(i-1,j-1), zero at the query start
+            simd_int diag = simdi_setzero();
+            simd_int vColumnMax = simdi_setzero();
+            for (int32_t i = 0; i < query_length; i++) {
+                const simd_int lo = simdi8_shuffle(simdi_load(rows + 2 * i), residues);
+                const simd_int hi = simdi8_shuffle(simdi_load(rows + 2 * i + 1), residues);
+                simd_int S = simdui8_adds(diag, simdi8_blend(lo, hi, highMask));
+                S = simdui8_subs(S, vBias);
+                diag = simdi_load(batchH + i);
+                simdi_store(batchH + i, S);
+                vColumnMax = simdui8_max(vColumnMax, S);
+            }
+            // lanes past the end of their target do not contribute
+            vMax = simdui8_max(vMax, simdi_andnot(simdi8_eq(residues, vPad), vColumnMax));
+        }
+    } else {
+        const int8_t *querySequence = profile->query_sequence;
+        // scores of each block column for each query residue
+        simd_int columnScores[blockSize][32];
+        for (int32_t j = 0; j < paddedLength; j += blockSize) {
+            simd_int residues[blockSize];
+            for (int32_t b = 0; b < blockSize; b++) {
+                residues[b] = simdi_load((simd_int *) (batchTargets + (j + b) * lanes));
+                const simd_int highMask = simdi8_gt(residues[b], vFifteen);
+                for (int32_t q = 0; q < alphabetSize; q++) {
+                    const simd_int lo = simdi8_shuffle(simdi_load(rows + 2 * q), residues[b]);
+                    const simd_int hi = simdi8_shuffle(simdi_load(rows + 2 * q + 1), residues[b]);
+                    columnScores[b][q] = simdi8_blend(lo, hi, highMask);
+                }
+            }
+            // S(i-1,j-1) of the column left of the block, and S(i-1,j+b) of each block column
+            simd_int diag = simdi_setzero();
+            simd_int prev[blockSize];
+            simd_int vColumnMax[blockSize];
+            for (int32_t b = 0; b < blockSize; b++) {
+                prev[b] = simdi_setzero();
+                vColumnMax[b] = simdi_setzero();
+            }
+            for (int32_t i = 0; i < query_length; i++) {
+                const simd_int bias = compositionBias[i];
+                const int8_t q = querySequence[i];
+                simd_int left = diag;
+                diag = simdi_load(batchH + i);
+                for (int32_t b = 0; b < blockSize; b++) {
+                    const simd_int score = simdui8_adds(columnScores[b][q], bias);
+                    const simd_int S = simdui8_subs(simdui8_adds(left, score), vBias);
+                    left = prev[b];
+                    prev[b] = S;
+                    vColumnMax[b] = simdui8_max(vColumnMax[b], S);
+                }
+                simdi_store(batchH + i, prev[blockSize - 1]);
+            }
+            for (int32_t b = 0; b < blockSize; b++) {
+                vMax = simdui8_max(vMax, simdi_andnot(simdi8_eq(residues[b], vPad), vColumnMax[b]));
+            }
+        }
+    }
+
+    uint8_t laneMax[VECSIZE_INT * 4] __attribute__((aligned(ALIGN_INT)));
+    simdi_store((simd_int *) laneMax, vMax);
+    for (int k = 0; k < count; k++) {
+        scores[k] = laneMax[k];
+    }
+}
+
+void SmithWaterman::ssw_score_batch(const unsigned char **db_sequences, const int32_t *db_lengths, int count,
+                                    const uint8_t gap_open, const uint8_t gap_extend, int *scores) {
+    const int lanes = VECSIZE_INT * 4;
+    const int32_t query_length = profile->query_length;
+    const int32_t alphabetSize = profile->alphabetSize;
+    // columns are processed in blocks so that H and E are only touched once per block and query position
+    const int32_t blockSize = 4;
+    const int32_t paddedLength = initBatch(db_sequences, db_lengths, count, blockSize);
+    const simd_int *rows = batchProfile;
+    const simd_int *compositionBias = batchProfile + 2 * 32;
+    const int8_t *querySequence = profile->query_sequence;
+    simd_int *pvH = batchH;
+    simd_int *pvE = batchE;
+
+    const simd_int vBias = simdi8_set(profile->bias);
+    const simd_int vGapO = simdi8_set(gap_open);
+    const simd_int vGapE = simdi8_set(gap_extend);
+    const simd_int vFifteen = simdi8_set(15);
+    const simd_int vPad = simdi8_set(BATCH_PAD_RESIDUE);
+    simd_int vMax = simdi_setzero();
+    memset(pvH, 0, query_length * sizeof(simd_int));
+    memset(pvE, 0, query_length * sizeof(simd_int));
+    // scores of each block column for each query residue
+    simd_int columnScores[blockSize][32];
+    for (int32_t j = 0; j < paddedLength; j += blockSize) {
+        simd_int residues[blockSize];
+        for (int32_t b = 0; b < blockSize; b++) {
+            residues[b] = simdi_load((simd_int *) (batchTargets + (j + b) * lanes));
+            const simd_int highMask = simdi8_gt(residues[b], vFifteen);
+            for (int32_t q = 0; q < alphabetSize; q++) {
+                const simd_int lo = simdi8_shuffle(simdi_load(rows + 2 * q), residues[b]);
+                const simd_int hi = simdi8_shuffle(simdi_load(rows + 2 * q + 1), residues[b]);
+                columnScores[b][q] = simdi8_blend(lo, hi, highMask);
+            }
+        }
+        // H(i-1,j-1) of the column left of the block, and H(i-1,j+b) and F(i-1,j+b) of each block column
+        simd_int diag = simdi_setzero();
+        simd_int prev[blockSize];
+        simd_int vF[blockSize];
+        simd_int vColumnMax[blockSize];
+        for (int32_t b = 0; b < blockSize; b++) {
+            prev[b] = simdi_setzero();
+            vF[b] = simdi_setzero();
+            vColumnMax[b] = simdi_setzero();
+        }
+        for (int32_t i = 0; i < query_length; i++) {
+            const simd_int bias = compositionBias[i];
+            const int8_t q = querySequence[i];
+            simd_int left = diag;
+            diag = simdi_load(pvH + i);
+            simd_int e = simdi_load(pvE + i);
+            for (int32_t b = 0; b < blockSize; b++) {
+                const simd_int score = simdui8_adds(columnScores[b][q], bias);
+                simd_int vH = simdui8_subs(simdui8_adds(left, score), vBias);
+                vH = simdui8_max(vH, e);
+                vH = simdui8_max(vH, vF[b]);
+                vColumnMax[b] = simdui8_max(vColumnMax[b], vH);
+                left = prev[b];
+                prev[b] = vH;
+                // unlike the striped kernel, E is updated from the final H, so the score is never below sw_sse2_byte
+                const simd_int vHOpen = simdui8_subs(vH, vGapO);
+                e = simdui8_max(simdui8_subs(e, vGapE), vHOpen);
+                vF[b] = simdui8_max(simdui8_subs(vF[b], vGapE), vHOpen);
+            }
+            simdi_store(pvH + i, prev[blockSize - 1]);
+            simdi_store(pvE + i, e);
+        }
+        for (int32_t b = 0; b < blockSize; b++) {
+            // lanes past the end of their target do not contribute
+            vMax = simdui8_max(vMax, simdi_andnot(simdi8_eq(residues[b], vPad), vColumnMax[b]));
+        }
+    }
+
+    uint8_t laneMax[VECSIZE_INT * 4] __attribute__((aligned(ALIGN_INT)));
+    simdi_store((simd_int *) laneMax, vMax);
+    for (int k = 0; k < count; k++) {
+        scores[k] = (laneMax[k] + profile->bias >= 255) ? 255 : laneMax[k];
+    }
+}
@@ -215,6 +215,34 @@ public:
    int ungapped_alignment(const unsigned char *db_sequence,
                           int32_t db_length);
 
+    /*!	@function computes ungapped alignment scores for a batch of target sequences at once
+
+   Each target occupies one byte lane (inter-sequence vectorization), targets of similar length should
+   be batched together since every lane runs for the length of the longest target.
+
+   @param	db_sequences	pointers to up to VECSIZE_INT * 4 target sequences, encoded like for ungapped_alignment
+   @param	db_lengths	lengths of the target sequences
+   @param	count	number of target sequences
+   @param	scores	receives the max diagonal score of each target, identical to ungapped_alignment
+   */
+    void ungapped_alignment_batch(const unsigned char **db_sequences, const int32_t *db_lengths,
+                                  int count, int *scores);
+
+    /*!	@function computes gapped local alignment scores for a batch of target sequences at once
+
+   Only supports sequence queries against sequence targets. Scores are exact full dynamic programming
+   scores and therefore never below the score1 of ssw_align. Use them to discard targets before ssw_align.
+
+   @param	db_sequences	pointers to up to VECSIZE_INT * 4 target sequences
+   @param	db_lengths	lengths of the target sequences
+   @param	count	number of target sequences
+   @param	gap_open	the absolute value of gap open penalty
+   @param	gap_extend	the absolute value of gap extension penalty
+   @param	scores	receives the score of each target, 255 if the score did not fit in a byte
+   */
+    void ssw_score_batch(const unsigned char **db_sequences, const int32_t *db_lengths, int count,
+                         const uint8_t gap_open, const uint8_t gap_extend, int *scores);
+
   /*!	@function	Create the query profile using the query sequence.
    @param	read	pointer to the query sequence; the query sequence needs to be numbers
    @param	readLen	length of the query sequence
@@ -273,10 +301,23 @@ public:
     const static unsigned int PROFILE_SEQ = 5;
     const static unsigned int PROFILE_PROFILE = 6;
 
+    // above this query length the striped single target kernels are faster than the batch kernels
+    const static int32_t BATCH_MAX_QUERY_LENGTH = 256;
+
 private:
 
     simd_int* vHStore;
     simd_int* vHLoad;
+    // inter-sequence alignment, allocated on first use
+    // residue 31 is never used and marks columns past the end of a target
+    const static unsigned char BATCH_PAD_RESIDUE = 31;
+    simd_int* batchProfile;
+    simd_int* batchH;
+    simd_int* batchE;
+    unsigned char* batchTargets;
+    size_t batchTargetsLength;
+    size_t maxQueryLength;
+    bool batchProfileValid;
     simd_int* vE;
     simd_int* vHmax;
     uint8_t * maxColumn;
@@ -401,6 +442,10 @@ private:
 
     uint8_t computeBias(const int32_t target_length, const int8_t *mat, const int32_t aaSize);
 
+    // builds the batch score rows of the current query on first use and interleaves the targets into batchTargets,
+    // returns the longest target length rounded up to a multiple of blockSize
+    int32_t initBatch(const unsigned char **db_sequences, const int32_t *db_lengths, int count, int32_t blockSize);
+
     void reverseMat(int8_t *rev_mat, const int8_t *mat, const int32_t aaSize, const int32_t target_length);
 };
 #endif /* SMITH_WATERMAN_SSE2_H */
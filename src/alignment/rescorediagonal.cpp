@@ -12,6 +12,8 @@
 #include "NucleotideMatrix.h"
 #include "IndexReader.h"
 #include "FastSort.h"
+#include "MemoryDBWriter.h"
+#include "rescorediagonal.h"
 
 #ifdef OPENMP
 #include <omp.h>
@@ -42,8 +44,9 @@ float parsePrecisionLib(const std::string &scoreFile, double targetSeqid, double
     return 0;
 }
 
-int doRescorediagonal(Parameters &par,
-                      DBWriter &resultWriter,
+template <typename Writer>
+int doRescorediagonal(Parameters &par, const std::string &queryDb, const std::string &targetDb,
+                      Writer &resultWriter,
                       DBReader<unsigned int> &resultReader,
               const size_t dbFrom, const size_t dbSize) {
 
@@ -52,18 +55,18 @@ int doRescorediagonal(Parameters &par,
     DBReader<unsigned int> * qdbr = NULL;
     DBReader<unsigned int> * tdbr = NULL;
     bool touch = (par.preloadMode != Parameters::PRELOAD_MODE_MMAP);
-    IndexReader * tDbrIdx = new IndexReader(par.db2, par.threads, IndexReader::SEQUENCES,   (touch) ? (IndexReader::PRELOAD_INDEX | IndexReader::PRELOAD_DATA) : 0 );
+    IndexReader * tDbrIdx = new IndexReader(targetDb, par.threads, IndexReader::SEQUENCES,   (touch) ? (IndexReader::PRELOAD_INDEX | IndexReader::PRELOAD_DATA) : 0 );
     int querySeqType = 0;
     tdbr = tDbrIdx->sequenceReader;
     int targetSeqType = tDbrIdx->getDbtype();
-    bool sameQTDB = (par.db2.compare(par.db1) == 0);
+    bool sameQTDB = (targetDb.compare(queryDb) == 0);
     if (sameQTDB == true) {
         qDbrIdx = tDbrIdx;
         qdbr = tdbr;
         querySeqType = targetSeqType;
     } else {
         // open the sequence, prefiltering and output databases
-        qDbrIdx = new IndexReader(par.db1, par.threads,  IndexReader::SEQUENCES, (touch) ? IndexReader::PRELOAD_INDEX : 0);
+        qDbrIdx = new IndexReader(queryDb, par.threads,  IndexReader::SEQUENCES, (touch) ? IndexReader::PRELOAD_INDEX : 0);
         qdbr = qDbrIdx->sequenceReader;
         querySeqType = qdbr->getDbtype();
     }
@@ -104,7 +107,7 @@ int doRescorediagonal(Parameters &par,
         scorePerColThr = parsePrecisionLib(libraryString, par.seqIdThr, par.covThr, 0.99);
     }
     bool reversePrefilterResult = (Parameters::isEqualDbtype(resultReader.getDbtype(), Parameters::DBTYPE_PREFILTER_REV_RES));
-    EvalueComputation evaluer(tdbr->getAminoAcidDBSize(), subMat);
+    EvalueComputation evaluer((par.evalDbSize > 0) ? par.evalDbSize : tdbr->getAminoAcidDBSize(), subMat);
 
     size_t totalMemory = Util::getTotalSystemMemory();
     size_t flushSize = 100000000;
@@ -378,6 +381,11 @@ int doRescorediagonal(Parameters &par,
     return 0;
 }
 
+template int doRescorediagonal<DBWriter>(Parameters &par, const std::string &queryDb, const std::string &targetDb,
+                                         DBWriter &resultWriter, DBReader<unsigned int> &resultReader, const size_t dbFrom, const size_t dbSize);
+template int doRescorediagonal<MemoryDBWriter>(Parameters &par, const std::string &queryDb, const std::string &targetDb,
+                                               MemoryDBWriter &resultWriter, DBReader<unsigned int> &resultReader, const size_t dbFrom, const size_t dbSize);
+
 int rescorediagonal(int argc, const char **argv, const Command &command) {
     MMseqsMPI::init(argc, argv);
     Parameters &par = Parameters::getInstance();
@@ -402,7 +410,7 @@ int rescorediagonal(int argc, const char **argv, const Command &command) {
 
     DBWriter resultWriter(tmpOutput.first.c_str(), tmpOutput.second.c_str(), par.threads, par.compressed, dbtype);
     resultWriter.open();
-    int status = doRescorediagonal(par, resultWriter, resultReader, dbFrom, dbSize);
+    int status = doRescorediagonal(par, par.db1, par.db2, resultWriter, resultReader, dbFrom, dbSize);
     resultWriter.close(true);
 
     MPI_Barrier(MPI_COMM_WORLD);
@@ -417,7 +425,7 @@ int rescorediagonal(int argc, const char **argv, const Command &command) {
 #else
     DBWriter resultWriter(par.db4.c_str(), par.db4Index.c_str(), par.threads, par.compressed, dbtype);
     resultWriter.open();
-    int status = doRescorediagonal(par, resultWriter, resultReader, 0, resultReader.getSize());
+    int status = doRescorediagonal(par, par.db1, par.db2, resultWriter, resultReader, 0, resultReader.getSize());
     resultWriter.close();
 
 #endif
@@ -0,0 +1,15 @@
+#ifndef MMSEQS_RESCOREDIAGONAL_H
+#define MMSEQS_RESCOREDIAGONAL_H
+
+#include "DBReader.h"
+#include "Parameters.h"
+
+#include <string>
+
+// rescores the prefilter hits of resultReader on their diagonal, Writer is a DBWriter or a MemoryDBWriter
+template <typename Writer>
+int doRescorediagonal(Parameters &par, const std::string &queryDb, const std::string &targetDb,
+                      Writer &resultWriter, DBReader<unsigned int> &resultReader,
+                      const size_t dbFrom, const size_t dbSize);
+
+#endif
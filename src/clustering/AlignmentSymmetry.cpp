@@ -9,6 +9,7 @@
 #include "Util.h"
 #include "Debug.h"
 #include "FastSort.h"
+#include "BinaryResult.h"
 #include <cmath>
 
 #ifdef OPENMP
@@ -21,6 +22,7 @@ void AlignmentSymmetry::readInData(DBReader<unsigned int>*alnDbr, DBReader<unsig
                                    unsigned int **elementLookupTable, unsigned short **elementScoreTable,
                                    int scoretype, size_t *offsets) {
     const int alnType = alnDbr->getDbtype();
+    const bool binary = BinaryResult::isBinaryDbtype(alnType);
     const size_t dbSize = seqDbr->getSize();
     const size_t flushSize = 1000000;
     Debug::Progress progress(dbSize);
@@ -65,6 +67,40 @@ void AlignmentSymmetry::readInData(DBReader<unsigned int>*alnDbr, DBReader<unsig
                 }
                 size_t setSize = LEN(offsets, i);
                 size_t writePos = 0;
+                if (binary) {
+                    BinaryResult::EntryReader reader(data, alnDbr->getEntryLen(alnDbr->getId(clusterId)));
+                    while (reader.next()) {
+                        if (writePos >= setSize) {
+                            Debug(Debug::ERROR) << "Set " << i
+                                                << " has more elements than allocated (" << setSize
+                                                << ")!\n";
+                            EXIT(EXIT_FAILURE);
+                        }
+                        const unsigned int key = reader.getDbKey();
+                        const size_t currElement = seqDbr->getId(key);
+                        if (elementScoreTable != NULL) {
+                            if (reader.isAlignment()) {
+                                const BinaryResult::AlignmentRecord record = reader.getAlignmentRecord();
+                                if (scoretype == Parameters::APC_ALIGNMENTSCORE) {
+                                    elementScoreTable[i][writePos] = (unsigned short) (record.score);
+                                } else {
+                                    elementScoreTable[i][writePos] = (unsigned short) (record.seqId * 1000.0f);
+                                }
+                            } else {
+                                const int sim = reader.getPrefilterRecord().prefScore;
+                                elementScoreTable[i][writePos] = (unsigned short) (sim > 0 ? sim : -sim);
+                            }
+                        }
+                        if (currElement == UINT_MAX || currElement > seqDbr->getSize()) {
+                            Debug(Debug::ERROR) << "Element " << key
+                                                << " contained in some alignment list, but not contained in the sequence database!\n";
+                            EXIT(EXIT_FAILURE);
+                        }
+                        elementLookupTable[i][writePos] = currElement;
+                        writePos++;
+                    }
+                    continue;
+                }
                 while (*data != '\0') {
                     if (writePos >= setSize) {
                         Debug(Debug::ERROR) << "Set " << i
@@ -8,8 +8,13 @@
 Clustering::Clustering(const std::string &seqDB, const std::string &seqDBIndex,
                        const std::string &alnDB, const std::string &alnDBIndex,
                        const std::string &outDB, const std::string &outDBIndex,
-                       unsigned int maxIteration, int similarityScoreType, int threads, int compressed) : maxIteration(maxIteration),
+                       unsigned int maxIteration, int similarityScoreType, bool parallelSetCover, bool deterministicSetCover,
+                       bool unionFindComponents, const std::string &graphCache, int threads, int compressed) : maxIteration(maxIteration),
                                                                similarityScoreType(similarityScoreType),
+                                                               parallelSetCover(parallelSetCover),
+                                                               deterministicSetCover(deterministicSetCover),
+                                                               unionFindComponents(unionFindComponents),
+                                                               graphCache(graphCache),
                                                                threads(threads),
                                                                compressed(compressed),
                                                                outDB(outDB),
@@ -20,12 +25,34 @@ Clustering::Clustering(const std::string &seqDB, const std::string &seqDBIndex,
 
     alnDbr = new DBReader<unsigned int>(alnDB.c_str(), alnDBIndex.c_str(), threads, DBReader<unsigned int>::USE_DATA|DBReader<unsigned int>::USE_INDEX);
     alnDbr->open(DBReader<unsigned int>::NOSORT);
+    ownsAlnDbr = true;
+}
 
+Clustering::Clustering(const std::string &seqDB, const std::string &seqDBIndex,
+                       DBReader<unsigned int> *alnDbr,
+                       const std::string &outDB, const std::string &outDBIndex,
+                       unsigned int maxIteration, int similarityScoreType, bool parallelSetCover, bool deterministicSetCover,
+                       bool unionFindComponents, const std::string &graphCache, int threads, int compressed) : alnDbr(alnDbr),
+                                                               ownsAlnDbr(false),
+                                                               maxIteration(maxIteration),
+                                                               similarityScoreType(similarityScoreType),
+                                                               parallelSetCover(parallelSetCover),
+                                                               deterministicSetCover(deterministicSetCover),
+                                                               unionFindComponents(unionFindComponents),
+                                                               graphCache(graphCache),
+                                                               threads(threads),
+                                                               compressed(compressed),
+                                                               outDB(outDB),
+                                                               outDBIndex(outDBIndex) {
+    seqDbr = new DBReader<unsigned int>(seqDB.c_str(), seqDBIndex.c_str(), threads, DBReader<unsigned int>::USE_INDEX);
+    seqDbr->open(DBReader<unsigned int>::SORT_BY_LENGTH);
 }
 
 Clustering::~Clustering() {
     delete seqDbr;
-    delete alnDbr;
+    if (ownsAlnDbr) {
+        delete alnDbr;
+    }
 }
 
 
@@ -37,7 +64,8 @@ void Clustering::run(int mode) {
     std::pair<unsigned int, unsigned int> * ret;
     ClusteringAlgorithms *algorithm = new ClusteringAlgorithms(seqDbr, alnDbr,
                                                                threads, similarityScoreType,
-                                                               maxIteration);
+                                                               maxIteration, parallelSetCover,
+                                                               deterministicSetCover, graphCache);
 
     if (mode == Parameters::GREEDY) {
         Debug(Debug::INFO) << "Clustering mode: Greedy\n";
@@ -48,6 +76,9 @@ void Clustering::run(int mode) {
     } else if (mode == Parameters::SET_COVER) {
         Debug(Debug::INFO) << "Clustering mode: Set Cover\n";
         ret = algorithm->execute(1);
+    } else if (mode == Parameters::CONNECTED_COMPONENT && unionFindComponents) {
+        Debug(Debug::INFO) << "Clustering mode: Connected Component (union-find)\n";
+        ret = algorithm->execute(5);
     } else if (mode == Parameters::CONNECTED_COMPONENT) {
         Debug(Debug::INFO) << "Clustering mode: Connected Component\n";
         ret = algorithm->execute(3);
@@ -77,7 +108,9 @@ void Clustering::run(int mode) {
 
     dbw->close(false, false);
     seqDbr->close();
-    alnDbr->close();
+    if (ownsAlnDbr) {
+        alnDbr->close();
+    }
     delete dbw;
 
 }
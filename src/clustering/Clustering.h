@@ -11,7 +11,15 @@ public:
     Clustering(const std::string &seqDB, const std::string &seqDBIndex,
                const std::string &alnResultsDB, const std::string &alnResultsDBIndex,
                const std::string &outDB, const std::string &outDBIndex,
-               unsigned int maxIteration, int similarityScoreType, int threads, int compressed);
+               unsigned int maxIteration, int similarityScoreType, bool parallelSetCover, bool deterministicSetCover,
+               bool unionFindComponents, const std::string &graphCache, int threads, int compressed);
+
+    // clusters an already opened alignment result, which stays owned by the caller
+    Clustering(const std::string &seqDB, const std::string &seqDBIndex,
+               DBReader<unsigned int> *alnDbr,
+               const std::string &outDB, const std::string &outDBIndex,
+               unsigned int maxIteration, int similarityScoreType, bool parallelSetCover, bool deterministicSetCover,
+               bool unionFindComponents, const std::string &graphCache, int threads, int compressed);
 
     void run(int mode);
 
@@ -24,11 +32,17 @@ private:
 
     DBReader<unsigned int> *seqDbr;
     DBReader<unsigned int> *alnDbr;
+    bool ownsAlnDbr;
 
     //values for affinity clustering
     unsigned int maxIteration;
     int similarityScoreType;
 
+    bool parallelSetCover;
+    bool deterministicSetCover;
+    bool unionFindComponents;
+    std::string graphCache;
+
     int threads;
     int compressed;
     std::string outDB;
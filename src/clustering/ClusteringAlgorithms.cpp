@@ -2,7 +2,9 @@
 #include "Util.h"
 #include "Debug.h"
 #include "AlignmentSymmetry.h"
+#include "ClusteringGraph.h"
 #include "Timer.h"
+#include "BinaryResult.h"
 
 #include <queue>
 #include <algorithm>
@@ -15,17 +17,23 @@
 #endif
 
 ClusteringAlgorithms::ClusteringAlgorithms(DBReader<unsigned int>* seqDbr, DBReader<unsigned int>* alnDbr,
-                                           int threads, int scoretype, int maxiterations){
+                                           int threads, int scoretype, int maxiterations,
+                                           bool parallelSetCover, bool deterministicSetCover,
+                                           const std::string &graphCache){
     this->seqDbr=seqDbr;
     if(seqDbr->getSize() != alnDbr->getSize()){
         Debug(Debug::ERROR) << "Sequence db size != result db size\n";
         EXIT(EXIT_FAILURE);
     }
     this->alnDbr=alnDbr;
+    this->binary=BinaryResult::isBinaryDbtype(alnDbr->getDbtype());
     this->dbSize=alnDbr->getSize();
     this->threads=threads;
     this->scoretype=scoretype;
     this->maxiterations=maxiterations;
+    this->parallelSetCover=parallelSetCover;
+    this->deterministicSetCover=deterministicSetCover;
+    this->graphCache=graphCache;
     ///time
     this->clustersizes=new int[dbSize];
     std::fill_n(clustersizes, dbSize, 0);
@@ -45,38 +53,37 @@ std::pair<unsigned int, unsigned int> * ClusteringAlgorithms::execute(int mode)
     //time
     if (mode==4 || mode==2) {
         greedyIncrementalLowMem(assignedcluster);
-    }else {
-        size_t elementCount = 0;
-#pragma omp parallel reduction (+:elementCount)
-        {
-            int thread_idx = 0;
-#ifdef OPENMP
-            thread_idx = omp_get_thread_num();
-#endif
-#pragma omp for schedule(dynamic, 10)
-            for (size_t i = 0; i < alnDbr->getSize(); i++) {
-                const char *data = alnDbr->getData(i, thread_idx);
-                const size_t dataSize = alnDbr->getEntryLen(i);
-                elementCount += (*data == '\0') ? 1 : Util::countLines(data, dataSize);
+    } else if (mode == 5) {
+        connectedComponentsUnionFind(assignedcluster);
+    } else {
+        ClusteringGraph graph;
+        if (graphCache.empty() || graph.load(graphCache, seqDbr, alnDbr, scoretype) == false) {
+            graph.build(seqDbr, alnDbr, scoretype, threads);
+            if (graphCache.empty() == false) {
+                graph.save(graphCache, seqDbr, alnDbr, scoretype);
             }
         }
-        unsigned int * elements = new(std::nothrow) unsigned int[elementCount];
-        Util::checkAllocation(elements, "Can not allocate elements memory in ClusteringAlgorithms::execute");
         unsigned int ** elementLookupTable = new(std::nothrow) unsigned int*[dbSize];
         Util::checkAllocation(elementLookupTable, "Can not allocate elementLookupTable memory in ClusteringAlgorithms::execute");
         unsigned short **scoreLookupTable = new(std::nothrow) unsigned short *[dbSize];
         Util::checkAllocation(scoreLookupTable, "Can not allocate scoreLookupTable memory in ClusteringAlgorithms::execute");
-        unsigned short *score = NULL;
-        size_t *elementOffsets = new(std::nothrow) size_t[dbSize + 1];
-        Util::checkAllocation(elementOffsets, "Can not allocate elementOffsets memory in ClusteringAlgorithms::execute");
-        elementOffsets[dbSize] = 0;
+        size_t *elementOffsets = graph.offsets;
+        AlignmentSymmetry::setupPointers<unsigned int>(graph.elements, elementLookupTable, elementOffsets, dbSize, graph.edgeCount);
+        AlignmentSymmetry::setupPointers<unsigned short>(graph.scores, scoreLookupTable, elementOffsets, dbSize, graph.edgeCount);
+        maxClustersize = 0;
+        for (size_t i = 0; i < dbSize; i++) {
+            const size_t elementCount = elementOffsets[i + 1] - elementOffsets[i];
+            maxClustersize = std::max((unsigned int) elementCount, maxClustersize);
+            clustersizes[i] = elementCount;
+        }
         short *bestscore = new(std::nothrow) short[dbSize];
         Util::checkAllocation(bestscore, "Can not allocate bestscore memory in ClusteringAlgorithms::execute");
         std::fill_n(bestscore, dbSize, SHRT_MIN);
 
-        readInClusterData(elementLookupTable, elements, scoreLookupTable, score, elementOffsets, elementCount);
         ClusteringAlgorithms::initClustersizes();
-        if (mode == 1) {
+        if (mode == 1 && parallelSetCover) {
+            setCoverParallel(elementLookupTable, scoreLookupTable, assignedcluster, elementOffsets);
+        } else if (mode == 1) {
             setCover(elementLookupTable, scoreLookupTable, assignedcluster, bestscore, elementOffsets);
         } else if (mode == 3) {
             Debug(Debug::INFO) << "connected component mode" << "\n";
@@ -116,10 +123,7 @@ std::pair<unsigned int, unsigned int> * ClusteringAlgorithms::execute(int mode)
 
 
         delete [] elementLookupTable;
-        delete [] elements;
-        delete [] elementOffsets;
         delete [] scoreLookupTable;
-        delete [] score;
         delete [] bestscore;
     }
 
@@ -268,6 +272,157 @@ void ClusteringAlgorithms::setCover(unsigned int **elementLookupTable, unsigned
     }
 }
 
+// bijective mix of the sequence id, sets of equal size are ordered randomly but reproducibly,
+// otherwise a chain of equally large sets would only lose one set per round
+static inline unsigned int mixSetId(unsigned int id) {
+    id ^= id >> 16;
+    id *= 0x85ebca6bU;
+    id ^= id >> 13;
+    id *= 0xc2b2ae35U;
+    id ^= id >> 16;
+    return id;
+}
+
+// orders sets by the number of uncovered elements, a set with a larger key is chosen first
+static inline uint64_t setKey(const int *clustersizes, unsigned int id) {
+    return (static_cast<uint64_t>(clustersizes[id]) << 32) | mixSetId(id);
+}
+
+struct CompareSetKey {
+    const int *clustersizes;
+    explicit CompareSetKey(const int *clustersizes) : clustersizes(clustersizes) {}
+    bool operator()(unsigned int first, unsigned int second) const {
+        return setKey(clustersizes, first) > setKey(clustersizes, second);
+    }
+};
+
+void ClusteringAlgorithms::setCoverParallel(unsigned int **elementLookupTable, unsigned short **elementScoreLookupTable,
+                                            unsigned int *assignedcluster, size_t *newElementOffsets) {
+    // The greedy choices are made in rounds. A set is chosen if it is larger than every set it competes with
+    // for an uncovered element. In deterministic mode all sets up to two hops away are compared, so the chosen
+    // sets share no uncovered element. Otherwise only the direct neighbours are compared and shared elements
+    // go to the set that claims them first, which needs fewer rounds.
+    Timer timer;
+    unsigned char *covered = new(std::nothrow) unsigned char[dbSize];
+    Util::checkAllocation(covered, "Can not allocate covered memory in ClusteringAlgorithms::setCoverParallel");
+    std::fill_n(covered, dbSize, 0);
+    uint64_t *maxKey = new(std::nothrow) uint64_t[dbSize];
+    Util::checkAllocation(maxKey, "Can not allocate maxKey memory in ClusteringAlgorithms::setCoverParallel");
+
+    std::vector<unsigned int> candidates(dbSize);
+    for (size_t i = 0; i < dbSize; i++) {
+        candidates[i] = i;
+    }
+    std::vector<unsigned int> representatives;
+    std::vector<unsigned int> chosen;
+    size_t rounds = 0;
+    while (candidates.empty() == false) {
+        rounds++;
+        const size_t candidateCount = candidates.size();
+        // largest key among the uncovered sets sharing an element with the candidate
+#pragma omp parallel for schedule(dynamic, 1000)
+        for (size_t i = 0; i < candidateCount; i++) {
+            const unsigned int id = candidates[i];
+            uint64_t largest = setKey(clustersizes, id);
+            const size_t elementSize = newElementOffsets[id + 1] - newElementOffsets[id];
+            for (size_t elementId = 0; elementId < elementSize; elementId++) {
+                const unsigned int element = elementLookupTable[id][elementId];
+                if (covered[element] == 0) {
+                    largest = std::max(largest, setKey(clustersizes, element));
+                }
+            }
+            maxKey[id] = largest;
+        }
+
+        chosen.clear();
+#pragma omp parallel
+        {
+            std::vector<unsigned int> threadChosen;
+#pragma omp for schedule(dynamic, 1000) nowait
+            for (size_t i = 0; i < candidateCount; i++) {
+                const unsigned int id = candidates[i];
+                const uint64_t key = setKey(clustersizes, id);
+                bool isLargest = (maxKey[id] == key);
+                const size_t elementSize = newElementOffsets[id + 1] - newElementOffsets[id];
+                for (size_t elementId = 0; deterministicSetCover && isLargest && elementId < elementSize; elementId++) {
+                    const unsigned int element = elementLookupTable[id][elementId];
+                    if (covered[element] == 0 && maxKey[element] != key) {
+                        isLargest = false;
+                    }
+                }
+                if (isLargest) {
+                    threadChosen.push_back(id);
+                }
+            }
+#pragma omp critical
+            chosen.insert(chosen.end(), threadChosen.begin(), threadChosen.end());
+        }
+        // larger sets first, as in the serial set cover
+        std::sort(chosen.begin(), chosen.end(), CompareSetKey(clustersizes));
+
+        // chosen sets are never neighbours of each other, so only their elements have to be claimed
+        for (size_t i = 0; i < chosen.size(); i++) {
+            covered[chosen[i]] = 1;
+        }
+#pragma omp parallel for schedule(dynamic, 10)
+        for (size_t i = 0; i < chosen.size(); i++) {
+            const unsigned int representative = chosen[i];
+            const size_t elementSize = newElementOffsets[representative + 1] - newElementOffsets[representative];
+            for (size_t elementId = 0; elementId < elementSize; elementId++) {
+                const unsigned int elementtodelete = elementLookupTable[representative][elementId];
+                if (elementtodelete == representative || covered[elementtodelete] != 0
+                    || __sync_bool_compare_and_swap(&covered[elementtodelete], 0, 1) == false) {
+                    continue;
+                }
+                //decrease clustersize of sets that contain the element
+                const size_t currElementSize = newElementOffsets[elementtodelete + 1] - newElementOffsets[elementtodelete];
+                for (size_t elementId2 = 0; elementId2 < currElementSize; elementId2++) {
+                    __sync_fetch_and_sub(&clustersizes[elementLookupTable[elementtodelete][elementId2]], 1);
+                }
+            }
+        }
+        representatives.insert(representatives.end(), chosen.begin(), chosen.end());
+
+        size_t remaining = 0;
+        for (size_t i = 0; i < candidateCount; i++) {
+            if (covered[candidates[i]] == 0) {
+                candidates[remaining++] = candidates[i];
+            }
+        }
+        candidates.resize(remaining);
+    }
+    delete[] covered;
+
+    // members go to the representative with the best score, ties to the earlier representative
+    uint64_t *best = maxKey;
+    std::fill_n(best, dbSize, 0);
+#pragma omp parallel for schedule(dynamic, 100)
+    for (size_t i = 0; i < representatives.size(); i++) {
+        const unsigned int representative = representatives[i];
+        const size_t elementSize = newElementOffsets[representative + 1] - newElementOffsets[representative];
+        for (size_t elementId = 0; elementId < elementSize; elementId++) {
+            const unsigned int element = elementLookupTable[representative][elementId];
+            const short seqId = elementScoreLookupTable[representative][elementId];
+            const uint64_t value = (static_cast<uint64_t>(seqId - SHRT_MIN) << 32) | (UINT_MAX - i);
+            uint64_t current = __atomic_load_n(&best[element], __ATOMIC_RELAXED);
+            while (value > current
+                   && __atomic_compare_exchange_n(&best[element], &current, value, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED) == false);
+        }
+    }
+#pragma omp parallel for schedule(static)
+    for (size_t id = 0; id < dbSize; id++) {
+        if (best[id] != 0) {
+            assignedcluster[id] = representatives[UINT_MAX - static_cast<unsigned int>(best[id])];
+        }
+    }
+    for (size_t i = 0; i < representatives.size(); i++) {
+        assignedcluster[representatives[i]] = representatives[i];
+    }
+    delete[] maxKey;
+    Debug(Debug::INFO) << "Chose " << representatives.size() << " representatives in " << rounds << " rounds\n";
+    Debug(Debug::INFO) << "Time for parallel set cover: " << timer.lap() << "\n";
+}
+
 void ClusteringAlgorithms::greedyIncrementalLowMem( unsigned int *assignedcluster) {
     // two step clustering
     // 1.) we define the rep. sequences by minimizing the ids (smaller ID = longer sequence)
@@ -295,26 +450,31 @@ void ClusteringAlgorithms::greedyIncrementalLowMem( unsigned int *assignedcluste
 
             const size_t alnId = alnDbr->getId(clusterKey);
             char *data = alnDbr->getData(alnId, thread_idx);
-
-            while (*data != '\0') {
-                char dbKey[255 + 1];
-                Util::parseKey(data, dbKey);
-                const unsigned int key = (unsigned int) strtoul(dbKey, NULL, 10);
+            BinaryResult::EntryReader binaryHits(data, binary ? alnDbr->getEntryLen(alnId) : 0);
+
+            while (binary ? binaryHits.next() : (*data != '\0')) {
+                unsigned int key;
+                if (binary) {
+                    key = binaryHits.getDbKey();
+                } else {
+                    char dbKey[255 + 1];
+                    Util::parseKey(data, dbKey);
+                    key = (unsigned int) strtoul(dbKey, NULL, 10);
+                    data = Util::skipLine(data);
+                }
 
                 unsigned int currElement = seqDbr->getId(key);
-                unsigned int targetId;
+                if (currElement == UINT_MAX || currElement > seqDbr->getSize()) {
+                    Debug(Debug::ERROR) << "Element " << key
+                                        << " contained in some alignment list, but not contained in the sequence database!\n";
+                    EXIT(EXIT_FAILURE);
+                }
 
+                unsigned int targetId;
                 __atomic_load(&assignedcluster[currElement], &targetId ,__ATOMIC_RELAXED);
                 do {
                     if (targetId <= clusterId) break;
                 } while (!__atomic_compare_exchange(&assignedcluster[currElement],  &targetId,  &clusterId , false,  __ATOMIC_RELAXED, __ATOMIC_RELAXED));
-
-                if (currElement == UINT_MAX || currElement > seqDbr->getSize()) {
-                    Debug(Debug::ERROR) << "Element " << dbKey
-                                        << " contained in some alignment list, but not contained in the sequence database!\n";
-                    EXIT(EXIT_FAILURE);
-                }
-                data = Util::skipLine(data);
             }
         }
     }
@@ -331,71 +491,120 @@ void ClusteringAlgorithms::greedyIncrementalLowMem( unsigned int *assignedcluste
 
 }
 
-void ClusteringAlgorithms::readInClusterData(unsigned int **elementLookupTable, unsigned int *&elements,
-                                             unsigned short **scoreLookupTable, unsigned short *&scores,
-                                             size_t *elementOffsets, size_t totalElementCount) {
+// root of the union-find tree of id, halves the path on the way
+// a parent always has a smaller id than its child, so concurrent compressions and links cannot form cycles
+static inline unsigned int findRoot(unsigned int *parent, unsigned int id) {
+    unsigned int current = __atomic_load_n(&parent[id], __ATOMIC_RELAXED);
+    while (current != id) {
+        const unsigned int grandparent = __atomic_load_n(&parent[current], __ATOMIC_RELAXED);
+        if (grandparent != current) {
+            // fails if another thread already moved id closer to the root
+            __atomic_compare_exchange_n(&parent[id], &current, grandparent, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+        }
+        id = grandparent;
+        current = __atomic_load_n(&parent[id], __ATOMIC_RELAXED);
+    }
+    return id;
+}
+
+static inline void unite(unsigned int *parent, unsigned int first, unsigned int second) {
+    while (true) {
+        first = findRoot(parent, first);
+        second = findRoot(parent, second);
+        if (first == second) {
+            return;
+        }
+        if (first < second) {
+            std::swap(first, second);
+        }
+        // link the larger root below the smaller one, retry if it got a parent in the meantime
+        unsigned int expected = first;
+        if (__atomic_compare_exchange_n(&parent[first], &expected, second, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+            return;
+        }
+    }
+}
+
+void ClusteringAlgorithms::connectedComponentsUnionFind(unsigned int *assignedcluster) {
+    // Every alignment edge is merged into a union-find forest while the result is streamed, so neither
+    // the symmetric graph nor the element lookup is kept in memory. The entries are read in the order of
+    // the alignment result to read its data file front to back. The representative of a component is the
+    // member with the most alignment hits, ties go to the longer sequence.
     Timer timer;
-#pragma omp parallel
+    unsigned int *parent = new(std::nothrow) unsigned int[dbSize];
+    Util::checkAllocation(parent, "Can not allocate parent memory in ClusteringAlgorithms::connectedComponentsUnionFind");
+    unsigned int *hits = new(std::nothrow) unsigned int[dbSize];
+    Util::checkAllocation(hits, "Can not allocate hits memory in ClusteringAlgorithms::connectedComponentsUnionFind");
+    for (size_t id = 0; id < dbSize; id++) {
+        parent[id] = id;
+        hits[id] = 0;
+    }
+
+    size_t edgeCount = 0;
+#pragma omp parallel reduction(+:edgeCount)
     {
         int thread_idx = 0;
 #ifdef OPENMP
         thread_idx = omp_get_thread_num();
 #endif
 #pragma omp for schedule(dynamic, 1000)
-        for (size_t i = 0; i < dbSize; i++) {
-            const unsigned int clusterId = seqDbr->getDbKey(i);
-            const size_t alnId = alnDbr->getId(clusterId);
-            const char *data = alnDbr->getData(alnId, thread_idx);
-            const size_t dataSize = alnDbr->getEntryLen(alnId);
-            elementOffsets[i] = (*data == '\0') ? 1 : Util::countLines(data, dataSize);
+        for (size_t alnId = 0; alnId < alnDbr->getSize(); alnId++) {
+            const unsigned int queryKey = alnDbr->getDbKey(alnId);
+            const unsigned int queryId = seqDbr->getId(queryKey);
+            if (queryId == UINT_MAX) {
+                Debug(Debug::ERROR) << "Alignment result " << queryKey << " is not contained in the sequence database!\n";
+                EXIT(EXIT_FAILURE);
+            }
+            char *data = alnDbr->getData(alnId, thread_idx);
+            BinaryResult::EntryReader binaryHits(data, binary ? alnDbr->getEntryLen(alnId) : 0);
+            unsigned int hitCount = 0;
+            while (binary ? binaryHits.next() : (*data != '\0')) {
+                unsigned int key;
+                if (binary) {
+                    key = binaryHits.getDbKey();
+                } else {
+                    char dbKey[255 + 1];
+                    Util::parseKey(data, dbKey);
+                    key = (unsigned int) strtoul(dbKey, NULL, 10);
+                    data = Util::skipLine(data);
+                }
+                const unsigned int currElement = seqDbr->getId(key);
+                if (currElement == UINT_MAX || currElement > seqDbr->getSize()) {
+                    Debug(Debug::ERROR) << "Element " << key
+                                        << " contained in some alignment list, but not contained in the sequence database!\n";
+                    EXIT(EXIT_FAILURE);
+                }
+                unite(parent, queryId, currElement);
+                hitCount++;
+            }
+            hits[queryId] = hitCount;
+            edgeCount += hitCount;
         }
     }
-
-    // make offset table
-    AlignmentSymmetry::computeOffsetFromCounts(elementOffsets, dbSize);
-    // set element edge pointers by using the offset table
-    AlignmentSymmetry::setupPointers<unsigned int>(elements, elementLookupTable, elementOffsets, dbSize,
-                                                   totalElementCount);
-    // fill elements
-    AlignmentSymmetry::readInData(alnDbr, seqDbr, elementLookupTable, NULL, 0, elementOffsets);
-    Debug(Debug::INFO) << "Sort entries\n";
-    AlignmentSymmetry::sortElements(elementLookupTable, elementOffsets, dbSize);
-    Debug(Debug::INFO) << "Find missing connections\n";
-
-    size_t *newElementOffsets = new size_t[dbSize + 1];
-    memcpy(newElementOffsets, elementOffsets, sizeof(size_t) * (dbSize + 1));
-
-    // findMissingLinks detects new possible connections and updates the elementOffsets with new sizes
-    const size_t symmetricElementCount = AlignmentSymmetry::findMissingLinks(elementLookupTable,
-                                                                             newElementOffsets, dbSize,
-                                                                             threads);
-    // resize elements
-    delete[] elements;
-    elements = new(std::nothrow) unsigned int[symmetricElementCount];
-    Util::checkAllocation(elements, "Can not allocate elements memory in readInClusterData");
-    std::fill_n(elements, symmetricElementCount, UINT_MAX);
-    // init score vector
-    scores = new(std::nothrow) unsigned short[symmetricElementCount];
-    Util::checkAllocation(scores, "Can not allocate scores memory in readInClusterData");
-    std::fill_n(scores, symmetricElementCount, 0);
-    Debug(Debug::INFO) << "Found " << symmetricElementCount - totalElementCount << " new connections.\n";
-    AlignmentSymmetry::setupPointers<unsigned int>  (elements, elementLookupTable, newElementOffsets, dbSize, symmetricElementCount);
-    AlignmentSymmetry::setupPointers<unsigned short>(scores, scoreLookupTable, newElementOffsets, dbSize, symmetricElementCount);
-    //time
-    Debug(Debug::INFO) << "Reconstruct initial order\n";
-    alnDbr->remapData(); // need to free memory
-    AlignmentSymmetry::readInData(alnDbr, seqDbr, elementLookupTable, scoreLookupTable, scoretype, elementOffsets);
-    alnDbr->remapData(); // need to free memory
-    Debug(Debug::INFO) << "Add missing connections\n";
-    AlignmentSymmetry::addMissingLinks(elementLookupTable, elementOffsets, newElementOffsets, dbSize, scoreLookupTable);
-    maxClustersize = 0;
-    for (size_t i = 0; i < dbSize; i++) {
-        size_t elementCount = newElementOffsets[i + 1] - newElementOffsets[i];
-        maxClustersize = std::max((unsigned int) elementCount, maxClustersize);
-        clustersizes[i] = elementCount;
+    Debug(Debug::INFO) << "Merged " << edgeCount << " alignment edges\n";
+
+    // the largest key of each root decides the representative
+    uint64_t *best = new(std::nothrow) uint64_t[dbSize];
+    Util::checkAllocation(best, "Can not allocate best memory in ClusteringAlgorithms::connectedComponentsUnionFind");
+    std::fill_n(best, dbSize, 0);
+#pragma omp parallel for schedule(static)
+    for (size_t id = 0; id < dbSize; id++) {
+        const unsigned int root = findRoot(parent, id);
+        __atomic_store_n(&parent[id], root, __ATOMIC_RELAXED);
+        const uint64_t value = (static_cast<uint64_t>(hits[id]) << 32) | (UINT_MAX - id);
+        uint64_t current = __atomic_load_n(&best[root], __ATOMIC_RELAXED);
+        while (value > current
+               && __atomic_compare_exchange_n(&best[root], &current, value, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED) == false);
     }
-
-    memcpy(elementOffsets, newElementOffsets, sizeof(size_t) * (dbSize + 1));
-    delete[] newElementOffsets;
-    Debug(Debug::INFO) << "\nTime for read in: " << timer.lap() << "\n";
+    size_t components = 0;
+#pragma omp parallel for schedule(static) reduction(+:components)
+    for (size_t id = 0; id < dbSize; id++) {
+        assignedcluster[id] = UINT_MAX - static_cast<unsigned int>(best[parent[id]]);
+        components += (parent[id] == id);
+    }
+    delete[] best;
+    delete[] hits;
+    delete[] parent;
+    Debug(Debug::INFO) << "Found " << components << " connected components\n";
+    Debug(Debug::INFO) << "Time for union-find: " << timer.lap() << "\n";
 }
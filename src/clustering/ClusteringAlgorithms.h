@@ -14,17 +14,26 @@
 
 class ClusteringAlgorithms {
 public:
-    ClusteringAlgorithms(DBReader<unsigned int>* seqDbr, DBReader<unsigned int>* alnDbr, int threads,int scoretype, int maxiterations);
+    ClusteringAlgorithms(DBReader<unsigned int>* seqDbr, DBReader<unsigned int>* alnDbr, int threads,int scoretype, int maxiterations,
+                         bool parallelSetCover = false, bool deterministicSetCover = true,
+                         const std::string &graphCache = "");
     ~ClusteringAlgorithms();
     std::pair<unsigned int, unsigned int> * execute(int mode);
 private:
     DBReader<unsigned int>* seqDbr;
 
     DBReader<unsigned int>* alnDbr;
-
+    // alnDbr uses the BinaryResult layout
+    bool binary;
 
     int threads;
     int scoretype;
+    // select the set cover representatives in parallel rounds instead of one by one
+    bool parallelSetCover;
+    // the parallel set cover does not depend on the thread count
+    bool deterministicSetCover;
+    // file of the symmetric alignment graph, reused if it was built from the same input
+    std::string graphCache;
 //datastructures
     unsigned int maxClustersize;
     unsigned int dbSize;
@@ -47,16 +56,17 @@ private:
     void setCover(unsigned int **elementLookup, unsigned short ** elementScoreLookupTable,
                   unsigned int *assignedcluster, short *bestscore, size_t *offsets);
 
+    void setCoverParallel(unsigned int **elementLookupTable, unsigned short **elementScoreLookupTable,
+                          unsigned int *assignedcluster, size_t *offsets);
+
     void greedyIncremental(unsigned int **elementLookupTable, size_t *elementOffsets,
                            size_t n, unsigned int *assignedcluster) ;
 
 
     void greedyIncrementalLowMem(unsigned int *assignedcluster) ;
 
+    void connectedComponentsUnionFind(unsigned int *assignedcluster);
 
-    void readInClusterData(unsigned int **elementLookupTable, unsigned int *&elements,
-                           unsigned short **scoreLookupTable, unsigned short *&scores,
-                           size_t *elementOffsets, size_t totalElementCount)  ;
 
 };
 
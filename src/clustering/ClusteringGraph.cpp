@@ -0,0 +1,407 @@
+#include "ClusteringGraph.h"
+#include "BinaryResult.h"
+#include "Debug.h"
+#include "FastSort.h"
+#include "FileUtil.h"
+#include "Parameters.h"
+#include "Timer.h"
+#include "Util.h"
+
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <vector>
+#include <sys/stat.h>
+
+#ifdef OPENMP
+#include <omp.h>
+#endif
+
+static const char GRAPH_MAGIC[8] = {'M', 'M', 'S', 'G', 'R', 'A', 'P', 'H'};
+
+struct GraphHeader {
+    char magic[8];
+    size_t fingerprint;
+    size_t setCount;
+    size_t edgeCount;
+};
+
+// the scores are the same as in AlignmentSymmetry::readInData
+static unsigned short emptyEntryScore(int alnType, int scoretype) {
+    if (Parameters::isEqualDbtype(alnType, Parameters::DBTYPE_ALIGNMENT_RES)) {
+        if (scoretype == Parameters::APC_ALIGNMENTSCORE) {
+            return USHRT_MAX;
+        }
+        return (unsigned short) (1.0 * 1000.0f);
+    } else if (Parameters::isEqualDbtype(alnType, Parameters::DBTYPE_PREFILTER_RES) ||
+               Parameters::isEqualDbtype(alnType, Parameters::DBTYPE_PREFILTER_REV_RES) ||
+               Parameters::isEqualDbtype(alnType, Parameters::DBTYPE_CLUSTER_RES)) {
+        return USHRT_MAX;
+    }
+    return 0;
+}
+
+static unsigned short parseScore(char *data, int alnType, int scoretype) {
+    char similarity[255 + 1];
+    if (Parameters::isEqualDbtype(alnType, Parameters::DBTYPE_ALIGNMENT_RES)) {
+        if (scoretype == Parameters::APC_ALIGNMENTSCORE) {
+            //column 1 = alignment score
+            Util::parseByColumnNumber(data, similarity, 1);
+            return (unsigned short) (atof(similarity));
+        }
+        //column 2 = sequence identity [0-1]
+        Util::parseByColumnNumber(data, similarity, 2);
+        return (unsigned short) (atof(similarity) * 1000.0f);
+    } else if (Parameters::isEqualDbtype(alnType, Parameters::DBTYPE_PREFILTER_RES) ||
+               Parameters::isEqualDbtype(alnType, Parameters::DBTYPE_PREFILTER_REV_RES)) {
+        //column 1 = alignment score or sequence identity [0-100]
+        Util::parseByColumnNumber(data, similarity, 1);
+        short sim = atoi(similarity);
+        return (unsigned short) (sim > 0 ? sim : -sim);
+    } else if (Parameters::isEqualDbtype(alnType, Parameters::DBTYPE_CLUSTER_RES)) {
+        return USHRT_MAX;
+    }
+    Debug(Debug::ERROR) << "Alignment format is not supported!\n";
+    EXIT(EXIT_FAILURE);
+}
+
+static unsigned int getElementId(DBReader<unsigned int> *seqDbr, unsigned int key) {
+    const size_t id = seqDbr->getId(key);
+    if (id == UINT_MAX || id >= seqDbr->getSize()) {
+        Debug(Debug::ERROR) << "Element " << key
+                            << " contained in some alignment list, but not contained in the sequence database!\n";
+        EXIT(EXIT_FAILURE);
+    }
+    return static_cast<unsigned int>(id);
+}
+
+// turns the counts in values[0, n) into offsets in values[0, n]
+static size_t exclusiveScan(size_t *values, const std::vector<size_t> &chunkStart) {
+    const size_t chunks = chunkStart.size() - 1;
+    std::vector<size_t> chunkOffset(chunks + 1, 0);
+#pragma omp parallel for schedule(static, 1)
+    for (size_t chunk = 0; chunk < chunks; chunk++) {
+        size_t sum = 0;
+        for (size_t i = chunkStart[chunk]; i < chunkStart[chunk + 1]; i++) {
+            sum += values[i];
+        }
+        chunkOffset[chunk + 1] = sum;
+    }
+    for (size_t chunk = 0; chunk < chunks; chunk++) {
+        chunkOffset[chunk + 1] += chunkOffset[chunk];
+    }
+#pragma omp parallel for schedule(static, 1)
+    for (size_t chunk = 0; chunk < chunks; chunk++) {
+        size_t offset = chunkOffset[chunk];
+        for (size_t i = chunkStart[chunk]; i < chunkStart[chunk + 1]; i++) {
+            const size_t count = values[i];
+            values[i] = offset;
+            offset += count;
+        }
+    }
+    values[chunkStart[chunks]] = chunkOffset[chunks];
+    return chunkOffset[chunks];
+}
+
+static void writeOrDie(FILE *file, const void *data, size_t size, const std::string &fileName) {
+    if (size > 0 && fwrite(data, sizeof(char), size, file) != size) {
+        Debug(Debug::ERROR) << "Cannot write to file " << fileName << "\n";
+        EXIT(EXIT_FAILURE);
+    }
+}
+
+ClusteringGraph::ClusteringGraph() : setCount(0), edgeCount(0), offsets(NULL), elements(NULL), scores(NULL),
+                                     mappedData(NULL), mappedSize(0) {}
+
+ClusteringGraph::~ClusteringGraph() {
+    clear();
+}
+
+void ClusteringGraph::clear() {
+    if (mappedData != NULL) {
+        FileUtil::munmapData(mappedData, mappedSize);
+        mappedData = NULL;
+        mappedSize = 0;
+    } else {
+        delete[] offsets;
+        delete[] elements;
+        delete[] scores;
+    }
+    offsets = NULL;
+    elements = NULL;
+    scores = NULL;
+    setCount = 0;
+    edgeCount = 0;
+}
+
+void ClusteringGraph::build(DBReader<unsigned int> *seqDbr, DBReader<unsigned int> *alnDbr, int scoretype, int threads) {
+    clear();
+    Timer timer;
+    const size_t dbSize = seqDbr->getSize();
+    const int alnType = alnDbr->getDbtype();
+    const bool binary = BinaryResult::isBinaryDbtype(alnType);
+    const unsigned short emptyScore = emptyEntryScore(alnType, scoretype);
+
+    // every chunk is a contiguous range of sets, so its edges are in set order
+    const size_t chunks = static_cast<size_t>(std::max(1, threads));
+    std::vector<size_t> chunkStart(chunks + 1);
+    for (size_t chunk = 0; chunk <= chunks; chunk++) {
+        chunkStart[chunk] = (dbSize * chunk) / chunks;
+    }
+
+    // 1. read the hits of each set once into the edge buffer of its chunk
+    size_t *forwardOffsets = new(std::nothrow) size_t[dbSize + 1];
+    Util::checkAllocation(forwardOffsets, "Can not allocate forwardOffsets memory in ClusteringGraph::build");
+    std::vector<std::vector<unsigned int> > chunkElements(chunks);
+    std::vector<std::vector<unsigned short> > chunkScores(chunks);
+    Debug::Progress progress(dbSize);
+#pragma omp parallel
+    {
+        unsigned int thread_idx = 0;
+#ifdef OPENMP
+        thread_idx = static_cast<unsigned int>(omp_get_thread_num());
+#endif
+#pragma omp for schedule(static, 1)
+        for (size_t chunk = 0; chunk < chunks; chunk++) {
+            std::vector<unsigned int> &edges = chunkElements[chunk];
+            std::vector<unsigned short> &edgeScores = chunkScores[chunk];
+            for (size_t i = chunkStart[chunk]; i < chunkStart[chunk + 1]; i++) {
+                progress.updateProgress();
+                const size_t edgesBefore = edges.size();
+                // seqDbr is descending sorted by length
+                // the assumption is that clustering is B -> B (not A -> B)
+                const unsigned int clusterKey = seqDbr->getDbKey(i);
+                const size_t alnId = alnDbr->getId(clusterKey);
+                if (alnId == UINT_MAX) {
+                    Debug(Debug::ERROR) << "Sequence " << clusterKey << " is not contained in the result database!\n";
+                    EXIT(EXIT_FAILURE);
+                }
+                char *data = alnDbr->getData(alnId, thread_idx);
+                if (*data == '\0') {
+                    edges.push_back(static_cast<unsigned int>(i));
+                    edgeScores.push_back(emptyScore);
+                } else if (binary) {
+                    BinaryResult::EntryReader reader(data, alnDbr->getEntryLen(alnId));
+                    while (reader.next()) {
+                        edges.push_back(getElementId(seqDbr, reader.getDbKey()));
+                        if (reader.isAlignment()) {
+                            const BinaryResult::AlignmentRecord record = reader.getAlignmentRecord();
+                            if (scoretype == Parameters::APC_ALIGNMENTSCORE) {
+                                edgeScores.push_back((unsigned short) (record.score));
+                            } else {
+                                edgeScores.push_back((unsigned short) (record.seqId * 1000.0f));
+                            }
+                        } else {
+                            const int sim = reader.getPrefilterRecord().prefScore;
+                            edgeScores.push_back((unsigned short) (sim > 0 ? sim : -sim));
+                        }
+                    }
+                } else {
+                    while (*data != '\0') {
+                        char dbKey[255 + 1];
+                        Util::parseKey(data, dbKey);
+                        edges.push_back(getElementId(seqDbr, (unsigned int) strtoul(dbKey, NULL, 10)));
+                        edgeScores.push_back(parseScore(data, alnType, scoretype));
+                        data = Util::skipLine(data);
+                    }
+                }
+                forwardOffsets[i] = edges.size() - edgesBefore;
+            }
+        }
+    }
+    alnDbr->remapData(); // need to free memory
+    const size_t forwardCount = exclusiveScan(forwardOffsets, chunkStart);
+
+    // 2. find the hits whose reverse edge is missing, sorted copies of the sets allow a binary search
+    unsigned int *sorted = new(std::nothrow) unsigned int[forwardCount];
+    Util::checkAllocation(sorted, "Can not allocate sorted memory in ClusteringGraph::build");
+#pragma omp parallel for schedule(static, 1)
+    for (size_t chunk = 0; chunk < chunks; chunk++) {
+        if (chunkElements[chunk].empty() == false) {
+            memcpy(sorted + forwardOffsets[chunkStart[chunk]], chunkElements[chunk].data(),
+                   chunkElements[chunk].size() * sizeof(unsigned int));
+        }
+    }
+#pragma omp parallel for schedule(dynamic, 1000)
+    for (size_t i = 0; i < dbSize; i++) {
+        SORT_SERIAL(sorted + forwardOffsets[i], sorted + forwardOffsets[i + 1]);
+    }
+
+    // missing[set] counts the reverse edges that are added to the set
+    unsigned int *missing = new(std::nothrow) unsigned int[dbSize];
+    Util::checkAllocation(missing, "Can not allocate missing memory in ClusteringGraph::build");
+    memset(missing, 0, dbSize * sizeof(unsigned int));
+    std::vector<std::vector<bool> > isMissing(chunks);
+#pragma omp parallel for schedule(static, 1)
+    for (size_t chunk = 0; chunk < chunks; chunk++) {
+        const std::vector<unsigned int> &edges = chunkElements[chunk];
+        const size_t base = forwardOffsets[chunkStart[chunk]];
+        isMissing[chunk].resize(edges.size(), false);
+        for (size_t setId = chunkStart[chunk]; setId < chunkStart[chunk + 1]; setId++) {
+            for (size_t edge = forwardOffsets[setId]; edge < forwardOffsets[setId + 1]; edge++) {
+                const unsigned int currElm = edges[edge - base];
+                if (std::binary_search(sorted + forwardOffsets[currElm], sorted + forwardOffsets[currElm + 1], setId) == false) {
+                    isMissing[chunk][edge - base] = true;
+                    __sync_fetch_and_add(&(missing[currElm]), 1);
+                }
+            }
+        }
+    }
+    delete[] sorted;
+
+    // 3. the reverse edges follow the hits of a set, missing[set] becomes the write cursor of the reverse edges
+    offsets = new(std::nothrow) size_t[dbSize + 1];
+    Util::checkAllocation(offsets, "Can not allocate offsets memory in ClusteringGraph::build");
+#pragma omp parallel for schedule(static)
+    for (size_t setId = 0; setId < dbSize; setId++) {
+        const size_t forward = forwardOffsets[setId + 1] - forwardOffsets[setId];
+        offsets[setId] = forward + missing[setId];
+        missing[setId] = static_cast<unsigned int>(forward);
+    }
+    edgeCount = exclusiveScan(offsets, chunkStart);
+    setCount = dbSize;
+
+    elements = new(std::nothrow) unsigned int[edgeCount];
+    Util::checkAllocation(elements, "Can not allocate elements memory in ClusteringGraph::build");
+    scores = new(std::nothrow) unsigned short[edgeCount];
+    Util::checkAllocation(scores, "Can not allocate scores memory in ClusteringGraph::build");
+#pragma omp parallel for schedule(static, 1)
+    for (size_t chunk = 0; chunk < chunks; chunk++) {
+        const std::vector<unsigned int> &edges = chunkElements[chunk];
+        const std::vector<unsigned short> &edgeScores = chunkScores[chunk];
+        const size_t base = forwardOffsets[chunkStart[chunk]];
+        for (size_t setId = chunkStart[chunk]; setId < chunkStart[chunk + 1]; setId++) {
+            size_t writePos = offsets[setId];
+            for (size_t edge = forwardOffsets[setId]; edge < forwardOffsets[setId + 1]; edge++) {
+                const unsigned int currElm = edges[edge - base];
+                const unsigned short score = edgeScores[edge - base];
+                elements[writePos] = currElm;
+                scores[writePos] = score;
+                writePos++;
+                if (isMissing[chunk][edge - base]) {
+                    const size_t pos = offsets[currElm] + __sync_fetch_and_add(&(missing[currElm]), 1);
+                    elements[pos] = static_cast<unsigned int>(setId);
+                    scores[pos] = score;
+                }
+            }
+        }
+        std::vector<unsigned int>().swap(chunkElements[chunk]);
+        std::vector<unsigned short>().swap(chunkScores[chunk]);
+    }
+    delete[] missing;
+
+    // 4. the reverse edges were written in any order, ordering them by the set that found them
+    // keeps the graph independent of the number of threads
+#pragma omp parallel
+    {
+        std::vector<std::pair<unsigned int, unsigned short> > reverse;
+#pragma omp for schedule(dynamic, 1000)
+        for (size_t setId = 0; setId < dbSize; setId++) {
+            const size_t start = offsets[setId] + (forwardOffsets[setId + 1] - forwardOffsets[setId]);
+            const size_t end = offsets[setId + 1];
+            if (end - start < 2) {
+                continue;
+            }
+            reverse.clear();
+            for (size_t pos = start; pos < end; pos++) {
+                reverse.push_back(std::make_pair(elements[pos], scores[pos]));
+            }
+            SORT_SERIAL(reverse.begin(), reverse.end());
+            for (size_t pos = start; pos < end; pos++) {
+                elements[pos] = reverse[pos - start].first;
+                scores[pos] = reverse[pos - start].second;
+            }
+        }
+    }
+    delete[] forwardOffsets;
+
+    Debug(Debug::INFO) << "Found " << edgeCount - forwardCount << " new connections.\n";
+    Debug(Debug::INFO) << "Time for read in: " << timer.lap() << "\n";
+}
+
+// hash of everything the graph depends on: the sequence order, the size and modification time
+// of the result files and the position and length of every result entry
+size_t ClusteringGraph::fingerprint(DBReader<unsigned int> *seqDbr, DBReader<unsigned int> *alnDbr, int scoretype) {
+    size_t hash = 14695981039346656037ULL;
+    const size_t values[] = { static_cast<size_t>(scoretype), static_cast<size_t>(alnDbr->getDbtype()),
+                              seqDbr->getSize(), alnDbr->getSize(), alnDbr->getTotalDataSize() };
+    for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); i++) {
+        hash = (hash ^ values[i]) * 1099511628211ULL;
+    }
+    std::vector<std::string> files = alnDbr->getDataFileNames();
+    files.push_back(alnDbr->getIndexFileName());
+    for (size_t i = 0; i < files.size(); i++) {
+        struct stat st;
+        if (stat(files[i].c_str(), &st) != 0) {
+            Debug(Debug::ERROR) << "Cannot stat " << files[i] << "\n";
+            EXIT(EXIT_FAILURE);
+        }
+        hash = (hash ^ static_cast<size_t>(st.st_size)) * 1099511628211ULL;
+        hash = (hash ^ static_cast<size_t>(st.st_mtime)) * 1099511628211ULL;
+    }
+    for (size_t i = 0; i < seqDbr->getSize(); i++) {
+        const unsigned int key = seqDbr->getDbKey(i);
+        const size_t alnId = alnDbr->getId(key);
+        hash = (hash ^ key) * 1099511628211ULL;
+        if (alnId != UINT_MAX) {
+            hash = (hash ^ alnDbr->getOffset(alnId)) * 1099511628211ULL;
+            hash = (hash ^ alnDbr->getEntryLen(alnId)) * 1099511628211ULL;
+        }
+    }
+    return hash;
+}
+
+bool ClusteringGraph::load(const std::string &fileName, DBReader<unsigned int> *seqDbr, DBReader<unsigned int> *alnDbr, int scoretype) {
+    if (FileUtil::fileExists(fileName.c_str()) == false) {
+        return false;
+    }
+    FILE *file = FileUtil::openFileOrDie(fileName.c_str(), "rb", true);
+    GraphHeader header;
+    bool valid = fread(&header, sizeof(GraphHeader), 1, file) == 1
+                 && memcmp(header.magic, GRAPH_MAGIC, sizeof(GRAPH_MAGIC)) == 0
+                 && header.setCount == seqDbr->getSize()
+                 && header.fingerprint == fingerprint(seqDbr, alnDbr, scoretype);
+    valid = valid && FileUtil::getFileSize(fileName) == sizeof(GraphHeader) + (header.setCount + 1) * sizeof(size_t)
+                                                       + header.edgeCount * (sizeof(unsigned int) + sizeof(unsigned short));
+    if (valid) {
+        clear();
+        mappedData = FileUtil::mmapFile(file, &mappedSize);
+        char *pos = static_cast<char *>(mappedData) + sizeof(GraphHeader);
+        setCount = header.setCount;
+        edgeCount = header.edgeCount;
+        offsets = reinterpret_cast<size_t *>(pos);
+        pos += (setCount + 1) * sizeof(size_t);
+        elements = reinterpret_cast<unsigned int *>(pos);
+        pos += edgeCount * sizeof(unsigned int);
+        scores = reinterpret_cast<unsigned short *>(pos);
+    }
+    if (fclose(file) != 0) {
+        Debug(Debug::ERROR) << "Cannot close file " << fileName << "\n";
+        EXIT(EXIT_FAILURE);
+    }
+    if (valid) {
+        Debug(Debug::INFO) << "Use graph " << fileName << "\n";
+    } else {
+        Debug(Debug::INFO) << "Graph " << fileName << " was built from other input\n";
+    }
+    return valid;
+}
+
+void ClusteringGraph::save(const std::string &fileName, DBReader<unsigned int> *seqDbr, DBReader<unsigned int> *alnDbr, int scoretype) const {
+    const std::string tmpFileName = fileName + ".tmp";
+    FILE *file = FileUtil::openAndDelete(tmpFileName.c_str(), "wb");
+    GraphHeader header;
+    memcpy(header.magic, GRAPH_MAGIC, sizeof(GRAPH_MAGIC));
+    header.fingerprint = fingerprint(seqDbr, alnDbr, scoretype);
+    header.setCount = setCount;
+    header.edgeCount = edgeCount;
+    writeOrDie(file, &header, sizeof(GraphHeader), tmpFileName);
+    writeOrDie(file, offsets, (setCount + 1) * sizeof(size_t), tmpFileName);
+    writeOrDie(file, elements, edgeCount * sizeof(unsigned int), tmpFileName);
+    writeOrDie(file, scores, edgeCount * sizeof(unsigned short), tmpFileName);
+    if (fclose(file) != 0) {
+        Debug(Debug::ERROR) << "Cannot close file " << tmpFileName << "\n";
+        EXIT(EXIT_FAILURE);
+    }
+    FileUtil::move(tmpFileName.c_str(), fileName.c_str());
+}
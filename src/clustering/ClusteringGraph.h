@@ -0,0 +1,48 @@
+#ifndef CLUSTERING_GRAPH_H
+#define CLUSTERING_GRAPH_H
+
+// Symmetric alignment graph of the clustering in compressed sparse row layout.
+//
+// Set i (the i-th sequence of the length sorted sequence reader) holds the ids of its
+// alignment hits in result order, followed by the hits that only exist in the other direction,
+// ordered by the id of the set that found them. elements and scores are indexed by offsets[i].
+//
+// build reads each result entry once: contiguous chunks of sets are parsed into per chunk edge
+// buffers and the offsets are computed with a parallel prefix sum. The missing reverse edges are
+// placed with one atomic cursor per set and then ordered by the set that found them, so the graph
+// does not depend on the number of threads.
+// A graph can be saved and later mapped again to skip the read in, as long as the sequence
+// order, the result files and entries and the score type are the same.
+
+#include "DBReader.h"
+
+#include <string>
+
+class ClusteringGraph {
+public:
+    ClusteringGraph();
+    ~ClusteringGraph();
+
+    void build(DBReader<unsigned int> *seqDbr, DBReader<unsigned int> *alnDbr, int scoretype, int threads);
+
+    // returns false if the file does not exist or was built from other input
+    bool load(const std::string &fileName, DBReader<unsigned int> *seqDbr, DBReader<unsigned int> *alnDbr, int scoretype);
+
+    void save(const std::string &fileName, DBReader<unsigned int> *seqDbr, DBReader<unsigned int> *alnDbr, int scoretype) const;
+
+    size_t setCount;
+    size_t edgeCount;
+    size_t *offsets;
+    unsigned int *elements;
+    unsigned short *scores;
+
+private:
+    void *mappedData;
+    size_t mappedSize;
+
+    void clear();
+
+    static size_t fingerprint(DBReader<unsigned int> *seqDbr, DBReader<unsigned int> *alnDbr, int scoretype);
+};
+
+#endif
@@ -3,7 +3,6 @@
 #include "Command.h"
 #include "DistanceCalculator.h"
 #include "FileUtil.h"
-#include "Timer.h"
 
 #include <iomanip>
 
@@ -21,26 +20,6 @@ extern std::vector<Command> baseCommands;
 extern std::vector<Categories> categories;
 extern void (*validatorUpdate)(void);
 
-Command *getCommandByName(const char *s) {
-    for (size_t i = 0; i < commands.size(); i++) {
-        Command &p = commands[i];
-        if (!strcmp(s, p.cmd))
-            return &p;
-    }
-    for (size_t i = 0; i < baseCommands.size(); i++) {
-        Command &p = baseCommands[i];
-        if (!strcmp(s, p.cmd))
-            return &p;
-    }
-    return NULL;
-}
-
-int runCommand(Command *p, int argc, const char **argv) {
-    Timer timer;
-    int status = p->commandFunction(argc, argv, *p);
-    Debug(Debug::INFO) << "Time for processing: " << timer.lap() << "\n";
-    return status;
-}
 
 void printUsage(bool showExtended) {
     std::stringstream usage;
@@ -0,0 +1,227 @@
+#include "BinaryResult.h"
+#include "DBReader.h"
+#include "Parameters.h"
+#include "Debug.h"
+#include "Util.h"
+
+static_assert(sizeof(BinaryResult::BlockHeader) == 16, "BlockHeader must be 16 bytes");
+static_assert(sizeof(BinaryResult::PrefilterRecord) == 12, "PrefilterRecord must be 12 bytes");
+static_assert(sizeof(BinaryResult::AlignmentRecord) == 72, "AlignmentRecord must be 72 bytes");
+
+bool BinaryResult::EntryReader::readBlock() {
+    if (static_cast<size_t>(end - pos) < sizeof(BlockHeader) || static_cast<unsigned char>(*pos) != MAGIC) {
+        return false;
+    }
+    memcpy(&header, pos, sizeof(BlockHeader));
+    if (header.version != VERSION) {
+        Debug(Debug::ERROR) << "Binary result version " << static_cast<int>(header.version) << " is not supported. "
+                            << "Expected version " << static_cast<int>(VERSION) << "\n";
+        EXIT(EXIT_FAILURE);
+    }
+    if (header.recordSize != sizeof(PrefilterRecord) && header.recordSize != sizeof(AlignmentRecord)) {
+        Debug(Debug::ERROR) << "Invalid binary result record size " << header.recordSize << "\n";
+        EXIT(EXIT_FAILURE);
+    }
+    records = pos + sizeof(BlockHeader);
+    extra = records + static_cast<size_t>(header.count) * header.recordSize;
+    pos = extra + header.extraSize;
+    if (pos > end) {
+        Debug(Debug::ERROR) << "Binary result block exceeds the entry length\n";
+        EXIT(EXIT_FAILURE);
+    }
+    remaining = header.count;
+    return true;
+}
+
+size_t BinaryResult::EntryReader::copyRecordAsBlock(char *out, unsigned int dbKey) const {
+    BlockHeader block = header;
+    block.count = 1;
+    block.extraSize = 0;
+    const char *backtrace = NULL;
+    if (isAlignment()) {
+        AlignmentRecord record = getAlignmentRecord();
+        backtrace = getBacktrace(record);
+        block.extraSize = record.backtraceLength;
+        record.dbKey = dbKey;
+        record.backtraceOffset = 0;
+        memcpy(out + sizeof(BlockHeader), &record, sizeof(AlignmentRecord));
+    } else {
+        PrefilterRecord record = getPrefilterRecord();
+        record.dbKey = dbKey;
+        memcpy(out + sizeof(BlockHeader), &record, sizeof(PrefilterRecord));
+    }
+    memcpy(out, &block, sizeof(BlockHeader));
+    if (block.extraSize > 0) {
+        memcpy(out + sizeof(BlockHeader) + block.recordSize, backtrace, block.extraSize);
+    }
+    return sizeof(BlockHeader) + block.recordSize + block.extraSize;
+}
+
+hit_t BinaryResult::EntryReader::getHit() const {
+    hit_t hit;
+    if (isAlignment()) {
+        AlignmentRecord record = getAlignmentRecord();
+        hit.seqId = record.dbKey;
+        hit.prefScore = record.score;
+        hit.diagonal = 0;
+    } else {
+        PrefilterRecord record = getPrefilterRecord();
+        hit.seqId = record.dbKey;
+        hit.prefScore = record.prefScore;
+        hit.diagonal = static_cast<unsigned short>(record.diagonal);
+    }
+    return hit;
+}
+
+Matcher::result_t BinaryResult::EntryReader::getAlignmentResult(bool readCompressed) const {
+    const AlignmentRecord record = getAlignmentRecord();
+    // same derived values as Matcher::parseAlignmentRecord
+    int adjustQstart = (record.qStartPos == -1) ? 0 : record.qStartPos;
+    int adjustDBstart = (record.dbStartPos == -1) ? 0 : record.dbStartPos;
+    float qCov = SmithWaterman::computeCov(adjustQstart, record.qEndPos, record.qLen);
+    float dbCov = SmithWaterman::computeCov(adjustDBstart, record.dbEndPos, record.dbLen);
+    unsigned int alnLength = Matcher::computeAlnLength(adjustQstart, record.qEndPos, adjustDBstart, record.dbEndPos);
+
+    std::string backtrace;
+    if (record.backtraceLength > 0) {
+        backtrace.assign(getBacktrace(record), record.backtraceLength);
+        if (readCompressed == false) {
+            backtrace = Matcher::uncompressAlignment(backtrace);
+        }
+    }
+    return Matcher::result_t(record.dbKey, record.score, qCov, dbCov, record.seqId, record.eval, alnLength,
+                             record.qStartPos, record.qEndPos, record.qLen,
+                             record.dbStartPos, record.dbEndPos, record.dbLen,
+                             record.queryOrfStartPos, record.queryOrfEndPos,
+                             record.dbOrfStartPos, record.dbOrfEndPos, backtrace);
+}
+
+bool BinaryResult::isBinaryDbtype(int dbtype) {
+    return (DBReader<unsigned int>::getExtendedDbtype(dbtype) & Parameters::DBTYPE_EXTENDED_BINARY_RESULT) != 0;
+}
+
+int BinaryResult::setBinaryDbtype(int dbtype, bool binary) {
+    if (binary) {
+        return DBReader<unsigned int>::setExtendedDbtype(dbtype, Parameters::DBTYPE_EXTENDED_BINARY_RESULT);
+    }
+    return dbtype & ~(static_cast<int>(Parameters::DBTYPE_EXTENDED_BINARY_RESULT) << 16);
+}
+
+static void appendHeader(std::string &out, uint16_t recordSize, uint16_t flags, size_t count, size_t extraSize) {
+    BinaryResult::BlockHeader header;
+    header.magic = BinaryResult::MAGIC;
+    header.version = BinaryResult::VERSION;
+    header.recordSize = recordSize;
+    header.flags = flags;
+    header.reserved = 0;
+    header.count = static_cast<uint32_t>(count);
+    header.extraSize = static_cast<uint32_t>(extraSize);
+    out.append(reinterpret_cast<const char *>(&header), sizeof(BinaryResult::BlockHeader));
+}
+
+void BinaryResult::appendPrefilterHits(std::string &out, const hit_t *hits, size_t count) {
+    if (count == 0) {
+        return;
+    }
+    out.reserve(out.size() + sizeof(BlockHeader) + count * sizeof(PrefilterRecord));
+    appendHeader(out, sizeof(PrefilterRecord), 0, count, 0);
+    for (size_t i = 0; i < count; ++i) {
+        PrefilterRecord record;
+        record.dbKey = hits[i].seqId;
+        record.prefScore = hits[i].prefScore;
+        record.diagonal = static_cast<int16_t>(hits[i].diagonal);
+        record.reserved = 0;
+        out.append(reinterpret_cast<const char *>(&record), sizeof(PrefilterRecord));
+    }
+}
+
+void BinaryResult::appendAlignmentResults(std::string &out, const Matcher::result_t *results, size_t count,
+                                          bool addBacktrace, bool compress, bool addOrfPosition) {
+    if (count == 0) {
+        return;
+    }
+    std::string cigars;
+    const size_t headerPos = out.size();
+    uint16_t flags = (addBacktrace ? FLAG_BACKTRACE : 0) | (addOrfPosition ? FLAG_ORF_POSITION : 0);
+    appendHeader(out, sizeof(AlignmentRecord), flags, count, 0);
+    for (size_t i = 0; i < count; ++i) {
+        const Matcher::result_t &res = results[i];
+        AlignmentRecord record;
+        memset(&record, 0, sizeof(AlignmentRecord));
+        record.dbKey = res.dbKey;
+        record.score = res.score;
+        record.eval = res.eval;
+        record.seqId = res.seqId;
+        record.qStartPos = res.qStartPos;
+        record.qEndPos = res.qEndPos;
+        record.qLen = res.qLen;
+        record.dbStartPos = res.dbStartPos;
+        record.dbEndPos = res.dbEndPos;
+        record.dbLen = res.dbLen;
+        record.queryOrfStartPos = addOrfPosition ? res.queryOrfStartPos : -1;
+        record.queryOrfEndPos = addOrfPosition ? res.queryOrfEndPos : -1;
+        record.dbOrfStartPos = addOrfPosition ? res.dbOrfStartPos : -1;
+        record.dbOrfEndPos = addOrfPosition ? res.dbOrfEndPos : -1;
+        record.backtraceOffset = static_cast<uint32_t>(cigars.size());
+        if (addBacktrace) {
+            if (compress) {
+                cigars.append(Matcher::compressAlignment(res.backtrace));
+            } else {
+                cigars.append(res.backtrace);
+            }
+        }
+        record.backtraceLength = static_cast<uint32_t>(cigars.size() - record.backtraceOffset);
+        out.append(reinterpret_cast<const char *>(&record), sizeof(AlignmentRecord));
+    }
+    uint32_t extraSize = static_cast<uint32_t>(cigars.size());
+    memcpy(&out[headerPos + offsetof(BlockHeader, extraSize)], &extraSize, sizeof(uint32_t));
+    out.append(cigars);
+}
+
+size_t BinaryResult::countRecords(const char *data, size_t entryLength) {
+    size_t count = 0;
+    EntryReader reader(data, entryLength);
+    while (reader.next()) {
+        count++;
+    }
+    return count;
+}
+
+void BinaryResult::readPrefilterHits(const char *data, size_t entryLength, std::vector<hit_t> &hits) {
+    EntryReader reader(data, entryLength);
+    while (reader.next()) {
+        hits.emplace_back(reader.getHit());
+    }
+}
+
+void BinaryResult::readAlignmentResults(const char *data, size_t entryLength, std::vector<Matcher::result_t> &results,
+                                        bool readCompressed) {
+    EntryReader reader(data, entryLength);
+    while (reader.next()) {
+        if (reader.isAlignment() == false) {
+            Debug(Debug::ERROR) << "Expected alignment records but found prefilter records\n";
+            EXIT(EXIT_FAILURE);
+        }
+        results.emplace_back(reader.getAlignmentResult(readCompressed));
+    }
+}
+
+void BinaryResult::toText(const char *data, size_t entryLength, std::string &out) {
+    std::vector<char> buffer(1024);
+    EntryReader reader(data, entryLength);
+    while (reader.next()) {
+        if (reader.isAlignment()) {
+            Matcher::result_t res = reader.getAlignmentResult(true);
+            if (buffer.size() < 1024 + res.backtrace.size()) {
+                buffer.resize(1024 + res.backtrace.size());
+            }
+            size_t len = Matcher::resultToBuffer(buffer.data(), res, (reader.getFlags() & FLAG_BACKTRACE) != 0,
+                                                 false, (reader.getFlags() & FLAG_ORF_POSITION) != 0);
+            out.append(buffer.data(), len);
+        } else {
+            hit_t hit = reader.getHit();
+            size_t len = QueryMatcher::prefilterHitToBuffer(buffer.data(), hit);
+            out.append(buffer.data(), len);
+        }
+    }
+}
@@ -0,0 +1,176 @@
+#ifndef BINARY_RESULT_H
+#define BINARY_RESULT_H
+
+// Fixed-width binary layout for prefilter and alignment result databases.
+//
+// Databases in this layout carry Parameters::DBTYPE_EXTENDED_BINARY_RESULT in their
+// extended dbtype. A non-empty entry is a sequence of blocks. Every block starts with a
+// BlockHeader, followed by count records of recordSize bytes and extraSize bytes of
+// variable length data (the compressed CIGAR strings of alignment records).
+//
+// Entries without hits stay empty, exactly like in the text format, so checks like
+// *data == '\0' keep working. Concatenating entries (e.g. mergedbs without prefixes)
+// results in a valid entry with multiple blocks.
+//
+// Records are stored in native byte order and are read in place from the (mapped)
+// entry data. Readers must use the entry length from the index to find the end of an entry.
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+#include "Matcher.h"
+#include "QueryMatcher.h"
+
+class BinaryResult {
+public:
+    static const unsigned char MAGIC = 'B';
+    static const unsigned char VERSION = 1;
+
+    static const uint16_t FLAG_BACKTRACE = 1;
+    static const uint16_t FLAG_ORF_POSITION = 2;
+
+    struct BlockHeader {
+        unsigned char magic;
+        unsigned char version;
+        uint16_t recordSize;
+        uint16_t flags;
+        uint16_t reserved;
+        uint32_t count;
+        uint32_t extraSize;
+    };
+
+    struct PrefilterRecord {
+        uint32_t dbKey;
+        int32_t prefScore;
+        int16_t diagonal;
+        uint16_t reserved;
+    };
+
+    struct AlignmentRecord {
+        uint32_t dbKey;
+        int32_t score;
+        double eval;
+        float seqId;
+        int32_t qStartPos;
+        int32_t qEndPos;
+        uint32_t qLen;
+        int32_t dbStartPos;
+        int32_t dbEndPos;
+        uint32_t dbLen;
+        int32_t queryOrfStartPos;
+        int32_t queryOrfEndPos;
+        int32_t dbOrfStartPos;
+        int32_t dbOrfEndPos;
+        // position of the compressed CIGAR string in the extra data of the block
+        uint32_t backtraceOffset;
+        uint32_t backtraceLength;
+        uint32_t reserved;
+    };
+
+    // walks over all records of an entry without copying the entry
+    class EntryReader {
+    public:
+        EntryReader(const char *data, size_t entryLength)
+                : pos(data), end(data + entryLength), records(NULL), current(NULL), extra(NULL), remaining(0) {
+            memset(&header, 0, sizeof(BlockHeader));
+        }
+
+        // moves to the next record, returns false if all blocks are consumed
+        bool next() {
+            while (remaining == 0) {
+                if (readBlock() == false) {
+                    return false;
+                }
+            }
+            current = records;
+            records += header.recordSize;
+            remaining--;
+            return true;
+        }
+
+        bool isAlignment() const {
+            return header.recordSize == sizeof(AlignmentRecord);
+        }
+
+        uint16_t getFlags() const {
+            return header.flags;
+        }
+
+        // the target key is the first field of all record types
+        unsigned int getDbKey() const {
+            uint32_t key;
+            memcpy(&key, current, sizeof(uint32_t));
+            return key;
+        }
+
+        PrefilterRecord getPrefilterRecord() const {
+            PrefilterRecord record;
+            memcpy(&record, current, sizeof(PrefilterRecord));
+            return record;
+        }
+
+        AlignmentRecord getAlignmentRecord() const {
+            AlignmentRecord record;
+            memcpy(&record, current, sizeof(AlignmentRecord));
+            return record;
+        }
+
+        const char *getBacktrace(const AlignmentRecord &record) const {
+            return extra + record.backtraceOffset;
+        }
+
+        // size of the current record when it is stored as a block on its own
+        size_t getRecordBlockSize() const {
+            size_t size = sizeof(BlockHeader) + header.recordSize;
+            if (isAlignment()) {
+                size += getAlignmentRecord().backtraceLength;
+            }
+            return size;
+        }
+
+        // writes the current record as a block of its own and replaces its target key,
+        // out must provide getRecordBlockSize() bytes
+        size_t copyRecordAsBlock(char *out, unsigned int dbKey) const;
+
+        hit_t getHit() const;
+
+        Matcher::result_t getAlignmentResult(bool readCompressed) const;
+
+    private:
+        bool readBlock();
+
+        const char *pos;
+        const char *end;
+        const char *records;
+        const char *current;
+        const char *extra;
+        size_t remaining;
+        BlockHeader header;
+    };
+
+    static bool isBinaryDbtype(int dbtype);
+
+    static int setBinaryDbtype(int dbtype, bool binary);
+
+    // appends one block with all given hits to out, nothing is appended for zero hits
+    static void appendPrefilterHits(std::string &out, const hit_t *hits, size_t count);
+
+    // same arguments as Matcher::resultToBuffer, backtraces are stored as compressed CIGAR strings
+    static void appendAlignmentResults(std::string &out, const Matcher::result_t *results, size_t count,
+                                       bool addBacktrace, bool compress = true, bool addOrfPosition = false);
+
+    static size_t countRecords(const char *data, size_t entryLength);
+
+    static void readPrefilterHits(const char *data, size_t entryLength, std::vector<hit_t> &hits);
+
+    static void readAlignmentResults(const char *data, size_t entryLength, std::vector<Matcher::result_t> &results,
+                                     bool readCompressed = false);
+
+    // converts an entry back to the text layout of QueryMatcher::prefilterHitToBuffer and Matcher::resultToBuffer
+    static void toText(const char *data, size_t entryLength, std::string &out);
+};
+
+#endif
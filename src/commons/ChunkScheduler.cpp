@@ -0,0 +1,186 @@
+#include "ChunkScheduler.h"
+#include "MMseqsMPI.h"
+#include "Debug.h"
+#include "Util.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace {
+const char QUEUE_MAGIC[8] = {'M', 'M', 'S', 'Q', 'U', 'E', 'U', '1'};
+}
+
+ChunkScheduler::ChunkScheduler(Mode mode, size_t total, size_t maxChunkSize, const std::string &queueFile)
+        : mode(mode), total(total), workerId(0), workerCount(1), nextChunk(0), queueFile(queueFile), queueFd(-1) {
+    chunkSize = std::max(maxChunkSize, (size_t) 1);
+    if (mode != LOCAL) {
+        size_t fineChunkSize = std::max((total + TARGET_CHUNK_COUNT - 1) / TARGET_CHUNK_COUNT, MIN_CHUNK_SIZE);
+        chunkSize = std::min(chunkSize, fineChunkSize);
+    }
+
+    if (mode == MPI) {
+#ifdef HAVE_MPI
+        workerId = MMseqsMPI::rank;
+        workerCount = MMseqsMPI::numProc;
+        MPI_Aint windowSize = MMseqsMPI::isMaster() ? sizeof(unsigned long long) : 0;
+        MPI_Win_allocate(windowSize, sizeof(unsigned long long), MPI_INFO_NULL, MPI_COMM_WORLD, &counter, &window);
+        if (MMseqsMPI::isMaster()) {
+            MPI_Win_lock(MPI_LOCK_EXCLUSIVE, MMseqsMPI::MASTER, 0, window);
+            *counter = 0;
+            MPI_Win_unlock(MMseqsMPI::MASTER, window);
+        }
+        MPI_Barrier(MPI_COMM_WORLD);
+#else
+        Debug(Debug::ERROR) << "MMseqs2 was compiled without MPI support\n";
+        EXIT(EXIT_FAILURE);
+#endif
+    } else if (mode == SHARED_FILE) {
+        queueFd = open(queueFile.c_str(), O_RDWR | O_CREAT, 0666);
+        if (queueFd == -1) {
+            Debug(Debug::ERROR) << "Cannot open work queue " << queueFile << ": " << strerror(errno) << "\n";
+            EXIT(EXIT_FAILURE);
+        }
+        lockQueue();
+        QueueState state;
+        readQueue(state);
+        if (state.workers == 0) {
+            memcpy(state.magic, QUEUE_MAGIC, sizeof(QUEUE_MAGIC));
+            state.total = total;
+            state.chunkSize = chunkSize;
+            state.nextChunk = 0;
+            state.finished = 0;
+        } else if (state.total != total) {
+            Debug(Debug::ERROR) << "Work queue " << queueFile << " was created for " << state.total << " entries instead of " << total << "\n";
+            EXIT(EXIT_FAILURE);
+        } else if (state.finished == state.workers) {
+            // joined after the other workers were done, their results are already merged
+            unlockQueue();
+            Debug(Debug::ERROR) << "All chunks of work queue " << queueFile << " were processed and merged already. Remove it to start a new run\n";
+            EXIT(EXIT_FAILURE);
+        }
+        // all workers use the chunk size of the first worker
+        chunkSize = state.chunkSize;
+        workerId = state.workers;
+        state.workers++;
+        writeQueue(state);
+        unlockQueue();
+        Debug(Debug::INFO) << "Registered as worker " << workerId << " of work queue " << queueFile << "\n";
+    }
+}
+
+ChunkScheduler::~ChunkScheduler() {
+#ifdef HAVE_MPI
+    if (mode == MPI) {
+        MPI_Win_free(&window);
+    }
+#endif
+    if (queueFd != -1) {
+        close(queueFd);
+    }
+}
+
+bool ChunkScheduler::next(size_t &from, size_t &size) {
+    size_t chunk = 0;
+    if (mode == LOCAL) {
+        chunk = nextChunk++;
+    } else if (mode == MPI) {
+#ifdef HAVE_MPI
+        unsigned long long one = 1;
+        unsigned long long fetched = 0;
+        MPI_Win_lock(MPI_LOCK_SHARED, MMseqsMPI::MASTER, 0, window);
+        MPI_Fetch_and_op(&one, &fetched, MPI_UNSIGNED_LONG_LONG, MMseqsMPI::MASTER, 0, MPI_SUM, window);
+        MPI_Win_unlock(MMseqsMPI::MASTER, window);
+        chunk = fetched;
+#endif
+    } else {
+        lockQueue();
+        QueueState state;
+        readQueue(state);
+        chunk = state.nextChunk;
+        if (chunk * chunkSize < total) {
+            state.nextChunk++;
+            writeQueue(state);
+        }
+        unlockQueue();
+    }
+
+    from = chunk * chunkSize;
+    if (from >= total) {
+        from = total;
+        size = 0;
+        return false;
+    }
+    size = std::min(chunkSize, total - from);
+    return true;
+}
+
+bool ChunkScheduler::finish() {
+    if (mode == LOCAL) {
+        return true;
+    }
+    if (mode == MPI) {
+#ifdef HAVE_MPI
+        MPI_Barrier(MPI_COMM_WORLD);
+#endif
+        return MMseqsMPI::isMaster();
+    }
+    lockQueue();
+    QueueState state;
+    readQueue(state);
+    state.finished++;
+    writeQueue(state);
+    unlockQueue();
+    workerCount = state.workers;
+    if (state.finished != state.workers) {
+        Debug(Debug::INFO) << "Worker " << workerId << " is done, " << (state.workers - state.finished)
+                           << " other workers of work queue " << queueFile << " have to finish before the results are merged\n";
+    }
+    return state.finished == state.workers;
+}
+
+void ChunkScheduler::lockQueue() {
+    struct flock lock;
+    memset(&lock, 0, sizeof(struct flock));
+    lock.l_type = F_WRLCK;
+    lock.l_whence = SEEK_SET;
+    while (fcntl(queueFd, F_SETLKW, &lock) == -1) {
+        if (errno != EINTR) {
+            Debug(Debug::ERROR) << "Cannot lock work queue " << queueFile << ": " << strerror(errno) << "\n";
+            EXIT(EXIT_FAILURE);
+        }
+    }
+}
+
+void ChunkScheduler::unlockQueue() {
+    struct flock lock;
+    memset(&lock, 0, sizeof(struct flock));
+    lock.l_type = F_UNLCK;
+    lock.l_whence = SEEK_SET;
+    if (fcntl(queueFd, F_SETLK, &lock) == -1) {
+        Debug(Debug::ERROR) << "Cannot unlock work queue " << queueFile << ": " << strerror(errno) << "\n";
+        EXIT(EXIT_FAILURE);
+    }
+}
+
+void ChunkScheduler::readQueue(QueueState &state) {
+    memset(&state, 0, sizeof(QueueState));
+    ssize_t bytes = pread(queueFd, &state, sizeof(QueueState), 0);
+    if (bytes == 0) {
+        // new queue
+        return;
+    }
+    if (bytes != sizeof(QueueState) || memcmp(state.magic, QUEUE_MAGIC, sizeof(QUEUE_MAGIC)) != 0) {
+        Debug(Debug::ERROR) << "Invalid work queue " << queueFile << "\n";
+        EXIT(EXIT_FAILURE);
+    }
+}
+
+void ChunkScheduler::writeQueue(const QueueState &state) {
+    if (pwrite(queueFd, &state, sizeof(QueueState), 0) != sizeof(QueueState)) {
+        Debug(Debug::ERROR) << "Cannot write work queue " << queueFile << ": " << strerror(errno) << "\n";
+        EXIT(EXIT_FAILURE);
+    }
+}
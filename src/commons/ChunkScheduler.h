@@ -0,0 +1,100 @@
+#ifndef MMSEQS_CHUNKSCHEDULER_H
+#define MMSEQS_CHUNKSCHEDULER_H
+
+// Hands out the entries [0, total) of a database in chunks to the workers of a job.
+//
+// LOCAL: a single worker gets the chunks in order.
+// MPI: all ranks fetch the next chunk from a counter in an MPI window of the master rank.
+// SHARED_FILE: independent processes, e.g. on several nodes, take the next chunk from a queue file
+// on a shared file system. The file is locked with fcntl for every access. A process registers as
+// worker when it opens the queue and the last worker to finish merges the results of all workers.
+// A process that opens the queue after all workers finished fails, the queue file has to be
+// removed to start a new run. The queue does not notice a worker that crashed: its chunks are
+// lost and no worker merges. In that case remove the queue file and the worker results and
+// restart the job.
+//
+// A worker writes the results of its chunks to its own database, after finish() returned true,
+// the caller merges the databases of all getWorkerCount() workers.
+// In MPI mode the constructor, finish() and the destructor have to be called by all ranks.
+
+#include <cstddef>
+#include <string>
+
+#ifdef HAVE_MPI
+#include <mpi.h>
+#endif
+
+class ChunkScheduler {
+public:
+    enum Mode {
+        LOCAL,
+        MPI,
+        SHARED_FILE
+    };
+
+    // LOCAL mode uses maxChunkSize, the other modes split into about TARGET_CHUNK_COUNT chunks
+    ChunkScheduler(Mode mode, size_t total, size_t maxChunkSize, const std::string &queueFile = "");
+    ~ChunkScheduler();
+
+    // returns false if all chunks are handed out
+    bool next(size_t &from, size_t &size);
+
+    // blocks in MPI mode until all ranks are done,
+    // returns true for the one worker that has to merge the results of all workers
+    bool finish();
+
+    bool isDistributed() const {
+        return mode != LOCAL;
+    }
+
+    size_t getWorkerId() const {
+        return workerId;
+    }
+
+    size_t getWorkerCount() const {
+        return workerCount;
+    }
+
+    size_t getTotal() const {
+        return total;
+    }
+
+    size_t getChunkSize() const {
+        return chunkSize;
+    }
+
+    static const size_t TARGET_CHUNK_COUNT = 1024;
+    static const size_t MIN_CHUNK_SIZE = 64;
+
+private:
+    struct QueueState {
+        char magic[8];
+        size_t total;
+        size_t chunkSize;
+        size_t nextChunk;
+        size_t workers;
+        size_t finished;
+    };
+
+    void lockQueue();
+    void unlockQueue();
+    void readQueue(QueueState &state);
+    void writeQueue(const QueueState &state);
+
+    const Mode mode;
+    const size_t total;
+    size_t chunkSize;
+    size_t workerId;
+    size_t workerCount;
+    size_t nextChunk;
+
+    std::string queueFile;
+    int queueFd;
+
+#ifdef HAVE_MPI
+    MPI_Win window;
+    unsigned long long *counter;
+#endif
+};
+
+#endif
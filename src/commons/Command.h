@@ -82,6 +82,8 @@ struct DbType{
     static const int NEED_TAXONOMY = 4;
     static const int VARIADIC = 8;
     static const int ZERO_OR_ALL = 16;
+    // input may be a result database in BinaryResult layout
+    static const int ALLOW_BINARY = 32;
 
     const char *usageText;
     int accessMode;
@@ -103,6 +105,12 @@ struct Command {
     std::vector<DbType> databases;
 };
 
+// looks up a command of the binary by its name, NULL if there is none
+Command *getCommandByName(const char *s);
+
+// runs a command with its arguments (without the binary and command name), traced by MMSEQS_TRACE
+int runCommand(Command *p, int argc, const char **argv);
+
 struct Categories {
     const char* title;
     CommandMode mode;
@@ -0,0 +1,32 @@
+#include "Command.h"
+#include "Debug.h"
+#include "Timer.h"
+#include "Instrumentation.h"
+
+#include <cstring>
+
+extern std::vector<Command> commands;
+extern std::vector<Command> baseCommands;
+
+Command *getCommandByName(const char *s) {
+    for (size_t i = 0; i < commands.size(); i++) {
+        Command &p = commands[i];
+        if (!strcmp(s, p.cmd))
+            return &p;
+    }
+    for (size_t i = 0; i < baseCommands.size(); i++) {
+        Command &p = baseCommands[i];
+        if (!strcmp(s, p.cmd))
+            return &p;
+    }
+    return NULL;
+}
+
+int runCommand(Command *p, int argc, const char **argv) {
+    Timer timer;
+    Instrumentation::start(p->cmd);
+    int status = p->commandFunction(argc, argv, *p);
+    Instrumentation::finish();
+    Debug(Debug::INFO) << "Time for processing: " << timer.lap() << "\n";
+    return status;
+}
@@ -6,6 +6,7 @@
 #include "Debug.h"
 #include "FileUtil.h"
 #include "Parameters.h"
+#include "MappingReader.h"
 
 #include <algorithm>
 
@@ -13,6 +14,10 @@
 #include <omp.h>
 #endif
 
+static bool compareMappingByKey(const std::pair<unsigned int, unsigned int> &first, const std::pair<unsigned int, unsigned int> &second) {
+    return first.first < second.first;
+}
+
 DBConcat::DBConcat(const std::string &dataFileNameA, const std::string &indexFileNameA,
                    const std::string &dataFileNameB, const std::string &indexFileNameB,
                    const std::string &dataFileNameC, const std::string &indexFileNameC,
@@ -149,55 +154,19 @@ DBConcat::DBConcat(const std::string &dataFileNameA, const std::string &indexFil
 
     // handle mapping
     if (shouldConcatMapping) {
-        char buffer[1024];
-        std::vector<std::pair<unsigned int, unsigned int>> mappingA;
-        Util::readMapping((dataFileNameA + "_mapping"), mappingA);
-        std::vector<std::pair<unsigned int, unsigned int>> mappingB;
-        Util::readMapping((dataFileNameB + "_mapping"), mappingB);
-
-        FILE* mappingFilePtr = fopen((dataFileNameC + "_mapping").c_str(), "w");
-
-        for(size_t i = 0; i < mappingA.size(); ++i) {
-            unsigned int prevKeyA = mappingA[i].first;
-            unsigned int taxidA = mappingA[i].second;
-            unsigned int newKeyA = dbAKeyMap(prevKeyA);
-
-            char * basePos = buffer;
-            char * tmpBuff = Itoa::u32toa_sse2(static_cast<uint32_t>(newKeyA), buffer);
-            *(tmpBuff-1) = '\t';
-            tmpBuff = Itoa::u32toa_sse2(static_cast<uint64_t>(taxidA), tmpBuff);;
-            *(tmpBuff-1) = '\n';
-            size_t length = tmpBuff - basePos;
-
-            int written = fwrite(buffer, sizeof(char), length, mappingFilePtr);
-            if (written != (int) length) {
-                Debug(Debug::ERROR) << "Cannot write to data file " << dataFileNameC << "_mapping\n";
-                EXIT(EXIT_FAILURE);
-            }
+        std::vector<std::pair<unsigned int, unsigned int>> mapping;
+        MappingReader::readMapping((dataFileNameA + "_mapping"), mapping);
+        for (size_t i = 0; i < mapping.size(); ++i) {
+            mapping[i].first = dbAKeyMap(mapping[i].first);
         }
-
-        for(size_t i = 0; i < mappingB.size(); ++i) {
-            unsigned int prevKeyB = mappingB[i].first;
-            unsigned int taxidB = mappingB[i].second;
-            unsigned int newKeyB = dbBKeyMap(prevKeyB);
-
-            char * basePos = buffer;
-            char * tmpBuff = Itoa::u32toa_sse2(static_cast<uint32_t>(newKeyB), buffer);
-            *(tmpBuff-1) = '\t';
-            tmpBuff = Itoa::u32toa_sse2(static_cast<uint64_t>(taxidB), tmpBuff);;
-            *(tmpBuff-1) = '\n';
-            size_t length = tmpBuff - basePos;
-
-            int written = fwrite(buffer, sizeof(char), length, mappingFilePtr);
-            if (written != (int) length) {
-                Debug(Debug::ERROR) << "Cannot write to data file " << dataFileNameC << "_mapping\n";
-                EXIT(EXIT_FAILURE);
-            }
-        }
-        if (fclose(mappingFilePtr) != 0) {
-            Debug(Debug::ERROR) << "Cannot close data file " << dataFileNameC << "_mapping\n";
-            EXIT(EXIT_FAILURE);
+        const size_t sizeA = mapping.size();
+        MappingReader::readMapping((dataFileNameB + "_mapping"), mapping);
+        for (size_t i = sizeA; i < mapping.size(); ++i) {
+            mapping[i].first = dbBKeyMap(mapping[i].first);
         }
+        // the binary mapping has to be sorted by the new keys
+        std::stable_sort(mapping.begin(), mapping.end(), compareMappingByKey);
+        MappingReader::writeBinary(dataFileNameC + "_mapping", mapping);
     }
 
     unsigned int maxSetIdA = 0;
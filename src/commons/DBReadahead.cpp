@@ -0,0 +1,113 @@
+#include "DBReadahead.h"
+#include "Debug.h"
+#include "Util.h"
+
+#include <climits>
+#include <stdint.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+static bool isMapped(DBReader<unsigned int> *reader) {
+    const int mode = reader->getDataMode();
+    return (mode & DBReader<unsigned int>::USE_DATA) && (mode & DBReader<unsigned int>::USE_FREAD) == 0;
+}
+
+DBReadahead::DBReadahead(DBReader<unsigned int> *reader, size_t from, size_t to, size_t windowSize,
+                         DBReader<unsigned int> *keyReader)
+        : reader(reader), keyReader(keyReader), from(from), to(to), windowSize(windowSize),
+          pageSize(Util::getPageSize()), consumed(from), stopped(false), running(false), magicBytes(0) {
+    if (windowSize == 0 || from >= to) {
+        return;
+    }
+    if (isMapped(reader) == false || (keyReader != NULL && isMapped(keyReader) == false)) {
+        return;
+    }
+#ifdef HAVE_PTHREADS
+    if (pthread_create(&thread, NULL, run, this) != 0) {
+        Debug(Debug::WARNING) << "Could not start readahead thread for " << reader->getDataFileName() << "\n";
+        return;
+    }
+    running = true;
+#endif
+}
+
+DBReadahead::~DBReadahead() {
+    stop();
+}
+
+void DBReadahead::stop() {
+    if (running == false) {
+        return;
+    }
+    stopped = true;
+#ifdef HAVE_PTHREADS
+    pthread_join(thread, NULL);
+#endif
+    running = false;
+}
+
+void *DBReadahead::run(void *arg) {
+    DBReadahead *readahead = static_cast<DBReadahead *>(arg);
+    readahead->prefetchWindow();
+    return NULL;
+}
+
+void DBReadahead::prefetchWindow() {
+    // [tail, head) are the prefetched entries that were not yet reached by the workers
+    size_t head = from;
+    size_t tail = from;
+    size_t windowBytes = 0;
+    while (stopped == false && head < to) {
+        const size_t position = consumed;
+        while (tail < head && tail < position) {
+            windowBytes -= prefetchEntry(tail, false);
+            tail++;
+        }
+        if (head < position) {
+            // the workers overtook the readahead, skip the entries they already read
+            head = position;
+            tail = position;
+            continue;
+        }
+        if (windowBytes >= windowSize) {
+            usleep(100);
+            continue;
+        }
+        windowBytes += prefetchEntry(head, true);
+        head++;
+    }
+}
+
+size_t DBReadahead::prefetchEntry(size_t id, bool touchPages) {
+    size_t bytes = reader->getEntryLen(id);
+    if (touchPages) {
+        touch(reader->getDataUncompressed(id), bytes);
+    }
+    if (keyReader != NULL) {
+        size_t keyId = keyReader->getId(reader->getDbKey(id));
+        if (keyId != UINT_MAX) {
+            size_t keyBytes = keyReader->getEntryLen(keyId);
+            if (touchPages) {
+                touch(keyReader->getDataUncompressed(keyId), keyBytes);
+            }
+            bytes += keyBytes;
+        }
+    }
+    return bytes;
+}
+
+size_t DBReadahead::touch(const char *data, size_t size) {
+    if (size == 0) {
+        return 0;
+    }
+    // mappings are page aligned, so the page containing data is always part of the mapping
+    const uintptr_t start = reinterpret_cast<uintptr_t>(data) & ~(static_cast<uintptr_t>(pageSize) - 1);
+    const uintptr_t end = reinterpret_cast<uintptr_t>(data) + size;
+#ifdef HAVE_POSIX_MADVISE
+    posix_madvise(reinterpret_cast<void *>(start), end - start, POSIX_MADV_WILLNEED);
+#endif
+    for (uintptr_t page = start; page < end; page += pageSize) {
+        magicBytes += *reinterpret_cast<const volatile char *>(page);
+    }
+    return size;
+}
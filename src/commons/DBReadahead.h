@@ -0,0 +1,70 @@
+#ifndef DB_READAHEAD_H
+#define DB_READAHEAD_H
+
+// Keeps a sliding window of database entries resident ahead of the worker threads.
+//
+// A helper thread walks the entries [from, to) in the order in which the workers process them
+// and faults in their pages (posix_madvise WILLNEED followed by a touch of every page) until
+// windowSize bytes are prefetched ahead of the last entry reported with advance(id).
+// If keyReader is set, the entry with the same key in keyReader is prefetched as well
+// (e.g. the query sequence belonging to a prefilter result).
+//
+// A window size of zero disables the readahead, advance is a no-op then.
+// Readers that do not map their data (USE_FREAD) are never prefetched.
+
+#include <cstddef>
+
+#ifdef HAVE_PTHREADS
+#include <pthread.h>
+#endif
+
+#include "DBReader.h"
+
+class DBReadahead {
+public:
+    DBReadahead(DBReader<unsigned int> *reader, size_t from, size_t to, size_t windowSize,
+                DBReader<unsigned int> *keyReader = NULL);
+
+    ~DBReadahead();
+
+    // waits for the helper thread, must be called before the reader is remapped or closed
+    void stop();
+
+    // called by the workers with the id of the entry they start processing
+    void advance(size_t id) {
+        if (running == false) {
+            return;
+        }
+        size_t current = consumed;
+        while (id > current && __sync_bool_compare_and_swap(&consumed, current, id) == false) {
+            current = consumed;
+        }
+    }
+
+private:
+    DBReader<unsigned int> *reader;
+    DBReader<unsigned int> *keyReader;
+    size_t from;
+    size_t to;
+    size_t windowSize;
+    size_t pageSize;
+
+    volatile size_t consumed;
+    volatile bool stopped;
+    bool running;
+    char magicBytes;
+
+#ifdef HAVE_PTHREADS
+    pthread_t thread;
+#endif
+
+    static void *run(void *arg);
+
+    void prefetchWindow();
+
+    size_t prefetchEntry(size_t id, bool touchPages);
+
+    size_t touch(const char *data, size_t size);
+};
+
+#endif
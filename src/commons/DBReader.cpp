@@ -1,5 +1,6 @@
 #include "DBReader.h"
 #include "FastSort.h"
+#include "Instrumentation.h"
 #include <algorithm>
 #include <climits>
 #include <cstring>
@@ -26,7 +27,7 @@ DBReader<T>::DBReader(const char* dataFileName_, const char* indexFileName_, int
 threads(threads), dataMode(dataMode), dataFileName(strdup(dataFileName_)),
         indexFileName(strdup(indexFileName_)), size(0), dataFiles(NULL), dataSizeOffset(NULL), dataFileCnt(0),
         totalDataSize(0), dataSize(0), lastKey(T()), closed(1), dbtype(Parameters::DBTYPE_GENERIC_DB),
-        compressedBuffers(NULL), compressedBufferSizes(NULL), index(NULL), id2local(NULL), local2id(NULL),
+        compressedBuffers(NULL), compressedBufferSizes(NULL), ddict(NULL), index(NULL), id2local(NULL), local2id(NULL),
         dataMapped(false), accessType(0), externalData(false), didMlock(false)
 {}
 
@@ -35,7 +36,7 @@ DBReader<T>::DBReader(DBReader<T>::Index *index, size_t size, size_t dataSize, T
         int dbType, unsigned int maxSeqLen, int threads) :
         threads(threads), dataMode(USE_INDEX), dataFileName(NULL), indexFileName(NULL),
         size(size), dataFiles(NULL), dataSizeOffset(NULL), dataFileCnt(0), totalDataSize(0), dataSize(dataSize), lastKey(lastKey),
-        maxSeqLen(maxSeqLen), closed(1), dbtype(dbType), compressedBuffers(NULL), compressedBufferSizes(NULL), index(index), sortedByOffset(true),
+        maxSeqLen(maxSeqLen), closed(1), dbtype(dbType), compressedBuffers(NULL), compressedBufferSizes(NULL), ddict(NULL), index(index), sortedByOffset(true),
         id2local(NULL), local2id(NULL), dataMapped(false), accessType(NOSORT), externalData(true), didMlock(false)
 {}
 
@@ -204,6 +205,16 @@ template <typename T> bool DBReader<T>::open(int accessType){
                 EXIT(EXIT_FAILURE);
             }
         }
+        if (dataFileName != NULL) {
+            std::string dictionary;
+            if (readCompressionDictionary(dataFileName, dictionary)) {
+                ddict = ZSTD_createDDict(dictionary.c_str(), dictionary.size());
+                if (ddict == NULL) {
+                    Debug(Debug::ERROR) << "Cannot load compression dictionary of " << dataFileName << "\n";
+                    EXIT(EXIT_FAILURE);
+                }
+            }
+        }
     }
 
     closed = 0;
@@ -490,6 +501,10 @@ template <typename T> void DBReader<T>::close(){
         delete [] compressedBufferSizes;
         delete [] dstream;
     }
+    if (ddict != NULL) {
+        ZSTD_freeDDict(ddict);
+        ddict = NULL;
+    }
 
     if(externalData == false) {
         delete[] index;
@@ -506,6 +521,7 @@ template <typename T> size_t DBReader<T>::bsearch(const Index * index, size_t N,
 }
 
 template <typename T> char* DBReader<T>::getDataCompressed(size_t id, int thrIdx) {
+    INSTRUMENT_SCOPE(DB_READ);
     char *data = getDataUncompressed(id);
 
     unsigned int cSize = *(reinterpret_cast<unsigned int *>(data));
@@ -514,7 +530,18 @@ template <typename T> char* DBReader<T>::getDataCompressed(size_t id, int thrIdx
     const void *cBuff = static_cast<void *>(data + sizeof(unsigned int));
     const char *dataStart = data + sizeof(unsigned int);
     bool isCompressed = (dataStart[cSize] == 0) ? true : false;
-    if(isCompressed){
+    // entries compressed without dictionary carry no dictionary id, e.g. entries of a database
+    // that links the dictionary of the database it was derived from
+    if(isCompressed && ddict != NULL && ZSTD_getDictID_fromFrame(cBuff, cSize) != 0){
+        // one-shot decompression, the dictionary is already digested
+        // the last byte of the buffer is kept for the terminating null byte
+        totalSize = ZSTD_decompress_usingDDict(dstream[thrIdx], compressedBuffers[thrIdx], compressedBufferSizes[thrIdx] - 1, cBuff, cSize, ddict);
+        if (ZSTD_isError(totalSize)) {
+            Debug(Debug::ERROR) << id << " ZSTD_decompress_usingDDict " << ZSTD_getErrorName(totalSize) << "\n";
+            EXIT(EXIT_FAILURE);
+        }
+        compressedBuffers[thrIdx][totalSize] = '\0';
+    }else if(isCompressed){
         ZSTD_inBuffer input = {cBuff, cSize, 0};
         while (input.pos < input.size) {
             ZSTD_outBuffer output = {compressedBuffers[thrIdx], compressedBufferSizes[thrIdx], 0};
@@ -530,7 +557,9 @@ template <typename T> char* DBReader<T>::getDataCompressed(size_t id, int thrIdx
     }else{
         memcpy(compressedBuffers[thrIdx], cBuff, cSize);
         compressedBuffers[thrIdx][cSize] = '\0';
+        totalSize = cSize;
     }
+    INSTRUMENT_COUNT(DB_READ, totalSize);
     return compressedBuffers[thrIdx];
 }
 
@@ -991,6 +1020,26 @@ int DBReader<T>::isCompressed(int dbtype) {
     return (dbtype & (1 << 31)) ? COMPRESSED : UNCOMPRESSED;
 }
 
+template<typename T>
+bool DBReader<T>::readCompressionDictionary(const std::string &dataFileName, std::string &dictionary) {
+    std::string dictFile = dataFileName + ".zdict";
+    if (FileUtil::fileExists(dictFile.c_str()) == false) {
+        return false;
+    }
+    size_t dictSize = FileUtil::getFileSize(dictFile);
+    dictionary.resize(dictSize);
+    FILE *file = FileUtil::openFileOrDie(dictFile.c_str(), "rb", true);
+    if (dictSize > 0 && fread(&dictionary[0], sizeof(char), dictSize, file) != dictSize) {
+        Debug(Debug::ERROR) << "Cannot read compression dictionary " << dictFile << "\n";
+        EXIT(EXIT_FAILURE);
+    }
+    if (fclose(file) != 0) {
+        Debug(Debug::ERROR) << "Cannot close file " << dictFile << "\n";
+        EXIT(EXIT_FAILURE);
+    }
+    return true;
+}
+
 template<typename T>
 void DBReader<T>::setSequentialAdvice() {
 #ifdef HAVE_POSIX_MADVISE
@@ -1060,6 +1109,15 @@ void DBReader<T>::moveDb(const std::string &srcDbName, const std::string &dstDbN
     if (FileUtil::fileExists((srcDbName + ".lookup").c_str())) {
         FileUtil::move((srcDbName + ".lookup").c_str(), (dstDbName + ".lookup").c_str());
     }
+    if (FileUtil::fileExists((srcDbName + ".zdict").c_str())) {
+        FileUtil::move((srcDbName + ".zdict").c_str(), (dstDbName + ".zdict").c_str());
+    }
+    if (FileUtil::fileExists((srcDbName + ".memstats").c_str())) {
+        FileUtil::move((srcDbName + ".memstats").c_str(), (dstDbName + ".memstats").c_str());
+    }
+    if (FileUtil::fileExists((srcDbName + ".profilelookup").c_str())) {
+        FileUtil::move((srcDbName + ".profilelookup").c_str(), (dstDbName + ".profilelookup").c_str());
+    }
 }
 
 template<typename T>
@@ -1084,6 +1142,20 @@ void DBReader<T>::removeDb(const std::string &databaseName){
     if (FileUtil::fileExists(lookupFile.c_str())) {
         FileUtil::remove(lookupFile.c_str());
     }
+    std::string dictFile = databaseName + ".zdict";
+    if (FileUtil::fileExists(dictFile.c_str())) {
+        FileUtil::remove(dictFile.c_str());
+    }
+    // memory measured by prefilter runs against this database, see SplitPlanner
+    std::string memoryStatsFile = databaseName + ".memstats";
+    if (FileUtil::fileExists(memoryStatsFile.c_str())) {
+        FileUtil::remove(memoryStatsFile.c_str());
+    }
+    // decoded profiles, see ProfileLookup
+    std::string profileLookupFile = databaseName + ".profilelookup";
+    if (FileUtil::fileExists(profileLookupFile.c_str())) {
+        FileUtil::remove(profileLookupFile.c_str());
+    }
 }
 
 typedef void (*DbAction)(const std::string &, const std::string &);
@@ -1119,6 +1191,8 @@ void copyLinkDb(const std::string &databaseName, const std::string &outDb, DBFil
         { DBFiles::HEADER,        "_h"                },
         { DBFiles::HEADER_INDEX,  "_h.index"          },
         { DBFiles::HEADER_DBTYPE, "_h.dbtype"         },
+        { DBFiles::DATA_ZDICT,    ".zdict"            },
+        { DBFiles::HEADER_ZDICT,  "_h.zdict"          },
         { DBFiles::LOOKUP,        ".lookup"           },
         { DBFiles::SOURCE,        ".source"           },
         { DBFiles::TAX_MAPPING,   "_mapping"          },
@@ -39,13 +39,16 @@ struct DBFiles {
         CA3M_HDR          = (1ull << 16),
         CA3M_HDR_IDX      = (1ull << 17),
         TAX_BINARY        = (1ull << 18),
+        DATA_ZDICT        = (1ull << 19),
+        HEADER_ZDICT      = (1ull << 20),
 
 
-        GENERIC           = DATA | DATA_INDEX | DATA_DBTYPE,
-        HEADERS           = HEADER | HEADER_INDEX | HEADER_DBTYPE,
+        GENERIC           = DATA | DATA_INDEX | DATA_DBTYPE | DATA_ZDICT,
+        HEADERS           = HEADER | HEADER_INDEX | HEADER_DBTYPE | HEADER_ZDICT,
         TAXONOMY          = TAX_MAPPING | TAX_NAMES | TAX_NODES | TAX_MERGED | TAX_BINARY,
         SEQUENCE_DB       = GENERIC | HEADERS | TAXONOMY | LOOKUP | SOURCE,
-        SEQUENCE_ANCILLARY= SEQUENCE_DB & (~GENERIC),
+        // the data dictionary stays, it is needed by entries copied without recompression
+        SEQUENCE_ANCILLARY= SEQUENCE_DB & (~(DATA | DATA_INDEX | DATA_DBTYPE)),
         SEQUENCE_NO_DATA_INDEX = SEQUENCE_DB & (~DATA_INDEX),
 
         ALL               = (size_t) -1,
@@ -279,6 +282,10 @@ public:
         return dataFileCnt;
     }
 
+    int getDataMode(){
+        return dataMode;
+    }
+
     size_t getDataSizeForFile(size_t fileIdx){
         return dataSizeOffset[fileIdx+1]-dataSizeOffset[fileIdx];
     }
@@ -427,6 +434,9 @@ public:
 
     static int isCompressed(int dbtype);
 
+    // reads the zstd dictionary sidecar (<data>.zdict) of a compressed database, returns false if there is none
+    static bool readCompressionDictionary(const std::string &dataFileName, std::string &dictionary);
+
     void setSequentialAdvice();
 
     void decomposeDomainByAminoAcid(size_t worldRank, size_t worldSize, size_t *startEntry, size_t *numEntries);
@@ -466,6 +476,8 @@ private:
     char ** compressedBuffers;
     size_t * compressedBufferSizes;
     ZSTD_DStream ** dstream;
+    // digested dictionary of the .zdict sidecar file, shared by all threads
+    ZSTD_DDict * ddict;
 
     Index * index;
     size_t lookupSize;
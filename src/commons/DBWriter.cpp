@@ -6,6 +6,7 @@
 #include "Concat.h"
 #include "itoa.h"
 #include "Timer.h"
+#include "Instrumentation.h"
 #include "Parameters.h"
 
 #define SIMDE_ENABLE_NATIVE_ALIASES
@@ -15,6 +16,7 @@
 #include <cstdio>
 #include <sstream>
 #include <unistd.h>
+#include <zdict.h>
 
 #ifdef OPENMP
 #include <omp.h>
@@ -34,6 +36,7 @@ DBWriter::DBWriter(const char *dataFileName_, const char *indexFileName_, unsign
     indexFileNames = new char *[threads];
     compressedBuffers=NULL;
     compressedBufferSizes=NULL;
+    cdict=NULL;
     if((mode & Parameters::WRITER_COMPRESSED_MODE) != 0){
         compressedBuffers = new char*[threads];
         compressedBufferSizes = new size_t[threads];
@@ -93,6 +96,60 @@ DBWriter::~DBWriter() {
         delete [] cstream;
         delete [] state;
     }
+    if (cdict != NULL) {
+        ZSTD_freeCDict(cdict);
+    }
+}
+
+void DBWriter::setCompressionDictionary(const std::string &dictionary) {
+    if ((mode & Parameters::WRITER_COMPRESSED_MODE) == 0 || dictionary.empty()) {
+        return;
+    }
+    if (cdict != NULL) {
+        ZSTD_freeCDict(cdict);
+    }
+    compressionDictionary = dictionary;
+    cdict = ZSTD_createCDict(compressionDictionary.c_str(), compressionDictionary.size(), 3);
+    if (cdict == NULL) {
+        Debug(Debug::ERROR) << "Cannot create compression dictionary for " << dataFileName << "\n";
+        EXIT(EXIT_FAILURE);
+    }
+}
+
+std::string DBWriter::trainCompressionDictionary(DBReader<unsigned int> &reader, size_t dictSize) {
+    // zstd recommends around 100 times the dictionary size as training input
+    const size_t maxSamplesSize = dictSize * 100;
+    // long entries do not add much to a dictionary, only use their beginning
+    const size_t maxEntrySize = 128 * 1024;
+
+    size_t totalSize = 0;
+    for (size_t i = 0; i < reader.getSize(); ++i) {
+        totalSize += std::min(std::max(reader.getEntryLen(i), (size_t) 1) - 1, maxEntrySize);
+    }
+    const size_t step = std::max(totalSize / std::max(maxSamplesSize, (size_t) 1), (size_t) 1);
+
+    std::string samples;
+    samples.reserve(std::min(totalSize, maxSamplesSize));
+    std::vector<size_t> sampleSizes;
+    for (size_t i = 0; i < reader.getSize(); i += step) {
+        size_t length = std::min(std::max(reader.getEntryLen(i), (size_t) 1) - 1, maxEntrySize);
+        if (length == 0) {
+            continue;
+        }
+        samples.append(reader.getData(i, 0), length);
+        sampleSizes.push_back(length);
+    }
+
+    std::string dictionary(dictSize, '\0');
+    size_t result = ZDICT_trainFromBuffer(&dictionary[0], dictSize, samples.c_str(), sampleSizes.data(), static_cast<unsigned int>(sampleSizes.size()));
+    if (ZDICT_isError(result)) {
+        Debug(Debug::WARNING) << "Cannot train compression dictionary for " << reader.getDataFileName() << ": " << ZDICT_getErrorName(result) << "\n"
+                              << "Database will be compressed without dictionary\n";
+        return std::string();
+    }
+    dictionary.resize(result);
+    Debug(Debug::INFO) << "Trained compression dictionary of " << result << " bytes from " << sampleSizes.size() << " entries\n";
+    return dictionary;
 }
 
 void DBWriter::sortDatafileByIdOrder(DBReader<unsigned int> &dbr) {
@@ -214,8 +271,11 @@ void DBWriter::writeDbtypeFile(const char* path, int dbtype, bool isCompressed)
 
 
 void DBWriter::close(bool merge, bool needsSort) {
+    INSTRUMENT_SCOPE(DB_MERGE);
     // close all datafiles
     for (unsigned int i = 0; i < threads; i++) {
+        // the merge total is the number of bytes in the data files
+        INSTRUMENT_COUNT(DB_MERGE, offsets[i]);
         if (fclose(dataFiles[i]) != 0) {
             Debug(Debug::ERROR) << "Cannot close data file " << dataFileNames[i] << "\n";
             EXIT(EXIT_FAILURE);
@@ -242,6 +302,20 @@ void DBWriter::close(bool merge, bool needsSort) {
 
     writeDbtypeFile(dataFileName, dbtype, (mode & Parameters::WRITER_COMPRESSED_MODE) != 0);
 
+    std::string dictFile = std::string(dataFileName) + ".zdict";
+    if (cdict != NULL) {
+        FILE* file = FileUtil::openAndDelete(dictFile.c_str(), "wb");
+        size_t written = fwrite(compressionDictionary.c_str(), sizeof(char), compressionDictionary.size(), file);
+        if (written != compressionDictionary.size()) {
+            Debug(Debug::ERROR) << "Can not write to dictionary file " << dictFile << "\n";
+            EXIT(EXIT_FAILURE);
+        }
+        if (fclose(file) != 0) {
+            Debug(Debug::ERROR) << "Cannot close file " << dictFile << "\n";
+            EXIT(EXIT_FAILURE);
+        }
+    }
+
     for (unsigned int i = 0; i < threads; i++) {
         delete [] dataFilesBuffer[i];
         decrementMemory(bufferSize);
@@ -262,7 +336,8 @@ void DBWriter::writeStart(unsigned int thrIdx) {
         state[thrIdx] = INIT_STATE;
         threadBufferOffset[thrIdx]=0;
         int cLevel = 3;
-        size_t const initResult = ZSTD_initCStream(cstream[thrIdx], cLevel);
+        size_t const initResult = (cdict != NULL) ? ZSTD_initCStream_usingCDict(cstream[thrIdx], cdict)
+                                                  : ZSTD_initCStream(cstream[thrIdx], cLevel);
         if (ZSTD_isError(initResult)) {
             Debug(Debug::ERROR) << "ZSTD_initCStream() error in thread " << thrIdx << ". Error "
                                 << ZSTD_getErrorName(initResult) << "\n";
@@ -272,13 +347,17 @@ void DBWriter::writeStart(unsigned int thrIdx) {
 }
 
 size_t DBWriter::writeAdd(const char* data, size_t dataSize, unsigned int thrIdx) {
+    INSTRUMENT_SCOPE(DB_WRITE);
+    INSTRUMENT_COUNT(DB_WRITE, dataSize);
     checkClosed();
     if (thrIdx >= threads) {
         Debug(Debug::ERROR) << "Thread index " << thrIdx << " > maximum thread number " << threads << "\n";
         EXIT(EXIT_FAILURE);
     }
     bool isCompressedDB = (mode & Parameters::WRITER_COMPRESSED_MODE) != 0;
-    if(isCompressedDB && state[thrIdx] == INIT_STATE && dataSize < 60){
+    // with a dictionary even short entries (e.g. headers) compress well
+    const size_t minCompressSize = (cdict != NULL) ? 16 : 60;
+    if(isCompressedDB && state[thrIdx] == INIT_STATE && dataSize < minCompressSize){
         state[thrIdx] = NOTCOMPRESSED;
     }
     size_t totalWriten = 0;
@@ -320,6 +399,7 @@ size_t DBWriter::writeAdd(const char* data, size_t dataSize, unsigned int thrIdx
 }
 
 void DBWriter::writeEnd(unsigned int key, unsigned int thrIdx, bool addNullByte, bool addIndexEntry) {
+    INSTRUMENT_SCOPE(DB_WRITE);
     // close stream
     bool isCompressedDB = (mode & Parameters::WRITER_COMPRESSED_MODE) != 0;
     if(isCompressedDB) {
@@ -45,6 +45,13 @@ public:
 
     static void writeDbtypeFile(const char* path, int dbtype, bool isCompressed);
 
+    // compress entries with a shared zstd dictionary, needs to be called before open
+    // the dictionary is stored next to the data file (<data>.zdict) on close
+    void setCompressionDictionary(const std::string &dictionary);
+
+    // trains a zstd dictionary from evenly spaced entries, returns an empty dictionary if training failed
+    static std::string trainCompressionDictionary(DBReader<unsigned int> &reader, size_t dictSize);
+
     size_t getStart(unsigned int threadIdx){
         return starts[threadIdx];
     }
@@ -102,6 +109,8 @@ private:
     static const int NOTCOMPRESSED=1;
     static const int COMPRESSED=2;
     ZSTD_CStream** cstream;
+    ZSTD_CDict* cdict;
+    std::string compressionDictionary;
 
     const unsigned int threads;
     const size_t mode;
@@ -0,0 +1,147 @@
+#include "HugePageMemory.h"
+#include "Util.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <stdint.h>
+#include <sys/mman.h>
+
+#if !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+
+static size_t roundUp(size_t size, size_t alignment) {
+    return (size + alignment - 1) & ~(alignment - 1);
+}
+
+size_t HugePageMemory::mappingSize(size_t size) {
+    return roundUp(size, size >= HugePageMemory::HUGE_PAGE_SIZE ? HugePageMemory::HUGE_PAGE_SIZE : Util::getPageSize());
+}
+
+void *HugePageMemory::allocate(size_t size) {
+    if (size == 0) {
+        size = 1;
+    }
+    const size_t length = mappingSize(size);
+    void *memory = MAP_FAILED;
+#ifdef MAP_HUGETLB
+    if (size >= HUGE_PAGE_SIZE) {
+        // fails immediately if no huge pages are reserved
+        memory = mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    }
+#endif
+    if (memory == MAP_FAILED) {
+        memory = mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (memory == MAP_FAILED) {
+            return NULL;
+        }
+        if (size >= HUGE_PAGE_SIZE) {
+            advise(memory, length);
+        }
+    }
+    return memory;
+}
+
+void HugePageMemory::free(void *memory, size_t size) {
+    if (memory == NULL) {
+        return;
+    }
+    munmap(memory, mappingSize(size == 0 ? 1 : size));
+}
+
+void HugePageMemory::advise(const void *memory, size_t size) {
+#ifdef MADV_HUGEPAGE
+    // only ranges containing a whole huge page can be backed by one
+    const uintptr_t start = roundUp(reinterpret_cast<uintptr_t>(memory), HUGE_PAGE_SIZE);
+    const uintptr_t end = (reinterpret_cast<uintptr_t>(memory) + size) & ~(static_cast<uintptr_t>(HUGE_PAGE_SIZE) - 1);
+    if (end > start) {
+        // the kernel might not support huge pages for this mapping, regular pages are fine then
+        madvise(reinterpret_cast<void *>(start), end - start, MADV_HUGEPAGE);
+    }
+#else
+    (void) memory;
+    (void) size;
+#endif
+}
+
+size_t HugePageMemory::hugePageBytes(const void *memory, size_t size) {
+#ifdef __linux__
+    if (memory == NULL || size == 0) {
+        return 0;
+    }
+    FILE *file = fopen("/proc/self/smaps", "r");
+    if (file == NULL) {
+        return 0;
+    }
+    const uintptr_t rangeStart = reinterpret_cast<uintptr_t>(memory);
+    const uintptr_t rangeEnd = rangeStart + size;
+    uintptr_t mapStart = 0;
+    uintptr_t mapEnd = 0;
+    bool overlaps = false;
+    size_t total = 0;
+    char line[256];
+    while (fgets(line, sizeof(line), file) != NULL) {
+        unsigned long start, end;
+        if (sscanf(line, "%lx-%lx ", &start, &end) == 2) {
+            mapStart = start;
+            mapEnd = end;
+            overlaps = mapStart < rangeEnd && rangeStart < mapEnd;
+            continue;
+        }
+        if (overlaps == false) {
+            continue;
+        }
+        size_t kb;
+        if (sscanf(line, "AnonHugePages: %zu kB", &kb) == 1 || sscanf(line, "FilePmdMapped: %zu kB", &kb) == 1
+            || sscanf(line, "Private_Hugetlb: %zu kB", &kb) == 1 || sscanf(line, "Shared_Hugetlb: %zu kB", &kb) == 1) {
+            // smaps reports per mapping, count the share that overlaps the requested range
+            const uintptr_t overlapStart = std::max(mapStart, rangeStart);
+            const uintptr_t overlapEnd = std::min(mapEnd, rangeEnd);
+            const double fraction = static_cast<double>(overlapEnd - overlapStart) / static_cast<double>(mapEnd - mapStart);
+            total += static_cast<size_t>(kb * 1024 * fraction);
+        }
+    }
+    fclose(file);
+    return std::min(total, size);
+#else
+    (void) memory;
+    (void) size;
+    return 0;
+#endif
+}
+
+// reads "<key>: <count>" from /proc/meminfo and returns the count times the huge page size
+static size_t hugePagePoolBytes(const char *key) {
+#ifdef __linux__
+    FILE *file = fopen("/proc/meminfo", "r");
+    if (file == NULL) {
+        return 0;
+    }
+    const size_t keyLength = strlen(key);
+    size_t pages = 0;
+    size_t pageSizeKb = 0;
+    char line[256];
+    while (fgets(line, sizeof(line), file) != NULL) {
+        size_t value;
+        if (strncmp(line, key, keyLength) == 0 && line[keyLength] == ':' && sscanf(line + keyLength + 1, "%zu", &value) == 1) {
+            pages = value;
+        } else if (sscanf(line, "Hugepagesize: %zu kB", &value) == 1) {
+            pageSizeKb = value;
+        }
+    }
+    fclose(file);
+    return pages * pageSizeKb * 1024;
+#else
+    (void) key;
+    return 0;
+#endif
+}
+
+size_t HugePageMemory::reservedPoolBytes() {
+    return hugePagePoolBytes("HugePages_Total");
+}
+
+size_t HugePageMemory::freePoolBytes() {
+    return hugePagePoolBytes("HugePages_Free");
+}
@@ -0,0 +1,35 @@
+#ifndef HUGE_PAGE_MEMORY_H
+#define HUGE_PAGE_MEMORY_H
+
+// Allocation helpers for the large, randomly accessed prefilter arrays (index table, sequence lookup).
+//
+// allocate first tries explicit huge pages (MAP_HUGETLB) and falls back to an anonymous mapping
+// that is marked for transparent huge pages (MADV_HUGEPAGE). Small allocations are plain mappings.
+// advise marks an existing mapping (e.g. a precomputed index file) for transparent huge pages.
+// All calls degrade to regular pages on systems without huge page support.
+
+#include <cstddef>
+
+class HugePageMemory {
+public:
+    static void *allocate(size_t size);
+
+    static void free(void *memory, size_t size);
+
+    static void advise(const void *memory, size_t size);
+
+    // bytes of [memory, memory + size) currently backed by huge pages (Linux only, 0 elsewhere)
+    static size_t hugePageBytes(const void *memory, size_t size);
+
+    // length of the mapping allocate creates for size bytes
+    static size_t mappingSize(size_t size);
+
+    // bytes of the explicit huge page pool (HugePages_Total or HugePages_Free in /proc/meminfo),
+    // this memory cannot be used by regular allocations (Linux only, 0 elsewhere)
+    static size_t reservedPoolBytes();
+    static size_t freePoolBytes();
+
+    static const size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+};
+
+#endif
@@ -0,0 +1,206 @@
+#include "Instrumentation.h"
+#include "Debug.h"
+#include "FileUtil.h"
+#include "Util.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <time.h>
+#include <unistd.h>
+
+bool Instrumentation::enabled = false;
+
+namespace {
+const char *STAGE_NAMES[Instrumentation::STAGE_COUNT] = {
+    "kmer_generation", "diagonal_matching", "ungapped_scoring", "alignment", "db_read", "db_write", "db_merge"
+};
+
+struct TraceEvent {
+    uint64_t begin;
+    uint64_t end;
+    Instrumentation::Stage stage;
+};
+
+struct ThreadTrace {
+    unsigned int id;
+    uint64_t time[Instrumentation::STAGE_COUNT];
+    size_t calls[Instrumentation::STAGE_COUNT];
+    size_t items[Instrumentation::STAGE_COUNT];
+    std::vector<TraceEvent> events;
+};
+
+struct TraceRun {
+    std::string module;
+    std::string file;
+    uint64_t start;
+    unsigned int id;
+    std::vector<ThreadTrace *> traces;
+};
+
+TraceRun run;
+// runs of workflows that called the current module in the same process
+std::vector<TraceRun> outerRuns;
+unsigned int runCount = 0;
+thread_local ThreadTrace *localTrace = NULL;
+thread_local unsigned int localRun = 0;
+
+ThreadTrace *getLocalTrace() {
+    // the trace of a thread belongs to the run it was created in
+    if (localTrace == NULL || localRun != run.id) {
+        ThreadTrace *trace = new ThreadTrace();
+        std::fill_n(trace->time, (size_t) Instrumentation::STAGE_COUNT, 0);
+        std::fill_n(trace->calls, (size_t) Instrumentation::STAGE_COUNT, 0);
+        std::fill_n(trace->items, (size_t) Instrumentation::STAGE_COUNT, 0);
+#pragma omp critical(instrumentation)
+        {
+            trace->id = run.traces.size();
+            run.traces.push_back(trace);
+        }
+        localTrace = trace;
+        localRun = run.id;
+    }
+    return localTrace;
+}
+
+void appendUsec(std::string &out, uint64_t nsec) {
+    out.append(SSTR(nsec / 1000));
+    out.append(1, '.');
+    const unsigned int frac = (nsec % 1000);
+    out.append(1, '0' + frac / 100);
+    out.append(1, '0' + frac / 10 % 10);
+    out.append(1, '0' + frac % 10);
+}
+}
+
+uint64_t Instrumentation::now() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000ull + static_cast<uint64_t>(ts.tv_nsec);
+}
+
+void Instrumentation::start(const char *module) {
+    const char *traceDir = getenv("MMSEQS_TRACE");
+    if (traceDir == NULL || *traceDir == '\0') {
+        return;
+    }
+#ifdef HAVE_INSTRUMENTATION
+    if (FileUtil::directoryExists(traceDir) == false) {
+        Debug(Debug::WARNING) << "Trace directory " << traceDir << " does not exist, tracing is disabled\n";
+        return;
+    }
+    if (enabled) {
+        // a module run by a workflow in the same process gets its own trace file
+        outerRuns.push_back(run);
+        run.traces.clear();
+    }
+    runCount++;
+    run.module = module;
+    run.file = std::string(traceDir) + "/" + module + "_" + SSTR(getpid());
+    if (outerRuns.empty() == false) {
+        run.file += "_" + SSTR(runCount);
+    }
+    run.file += ".json";
+    run.start = now();
+    run.id = runCount;
+    enabled = true;
+#else
+    Debug(Debug::WARNING) << "MMSEQS_TRACE is set, but " << module << " was built without instrumentation\n";
+#endif
+}
+
+void Instrumentation::record(Stage stage, uint64_t begin, uint64_t end) {
+    ThreadTrace *trace = getLocalTrace();
+    trace->time[stage] += end - begin;
+    trace->calls[stage]++;
+    if (end - begin >= MIN_EVENT_USEC * 1000 && trace->events.size() < MAX_EVENTS_PER_THREAD) {
+        TraceEvent event;
+        event.begin = begin;
+        event.end = end;
+        event.stage = stage;
+        trace->events.push_back(event);
+    }
+}
+
+void Instrumentation::count(Stage stage, size_t items) {
+    getLocalTrace()->items[stage] += items;
+}
+
+void Instrumentation::finish() {
+    if (enabled == false) {
+        return;
+    }
+    enabled = false;
+    const uint64_t end = now();
+    const std::string pid = SSTR(getpid());
+
+    std::string out;
+    out.append("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    out.append("{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" + pid + ",\"tid\":0,\"args\":{\"name\":\"" + run.module + "\"}}");
+    out.append(",\n{\"name\":\"" + run.module + "\",\"cat\":\"module\",\"ph\":\"X\",\"pid\":" + pid + ",\"tid\":0,\"ts\":0,\"dur\":");
+    appendUsec(out, end - run.start);
+    out.append("}");
+
+    std::vector<uint64_t> time(STAGE_COUNT, 0);
+    std::vector<size_t> calls(STAGE_COUNT, 0);
+    std::vector<size_t> items(STAGE_COUNT, 0);
+    for (size_t i = 0; i < run.traces.size(); i++) {
+        const ThreadTrace *trace = run.traces[i];
+        const std::string tid = SSTR(trace->id);
+        out.append(",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" + pid + ",\"tid\":" + tid + ",\"args\":{\"name\":\"thread " + tid + "\"}}");
+        for (size_t j = 0; j < trace->events.size(); j++) {
+            const TraceEvent &event = trace->events[j];
+            out.append(",\n{\"name\":\"");
+            out.append(STAGE_NAMES[event.stage]);
+            out.append("\",\"cat\":\"stage\",\"ph\":\"X\",\"pid\":" + pid + ",\"tid\":" + tid + ",\"ts\":");
+            appendUsec(out, event.begin - run.start);
+            out.append(",\"dur\":");
+            appendUsec(out, event.end - event.begin);
+            out.append("}");
+        }
+        for (size_t s = 0; s < STAGE_COUNT; s++) {
+            time[s] += trace->time[s];
+            calls[s] += trace->calls[s];
+            items[s] += trace->items[s];
+        }
+    }
+    out.append("\n],\n\"stageTotals\":{");
+    bool first = true;
+    for (size_t s = 0; s < STAGE_COUNT; s++) {
+        if (calls[s] == 0 && items[s] == 0) {
+            continue;
+        }
+        out.append(first ? "\n" : ",\n");
+        first = false;
+        out.append("\"");
+        out.append(STAGE_NAMES[s]);
+        out.append("\":{\"calls\":" + SSTR(calls[s]) + ",\"items\":" + SSTR(items[s]) + ",\"threadTimeUs\":");
+        appendUsec(out, time[s]);
+        out.append("}");
+    }
+    out.append("\n}}\n");
+
+    FILE *handle = fopen(run.file.c_str(), "w");
+    if (handle == NULL) {
+        Debug(Debug::WARNING) << "Could not open trace file " << run.file << "\n";
+    } else {
+        const bool written = fwrite(out.c_str(), sizeof(char), out.size(), handle) == out.size();
+        if (fclose(handle) != 0 || written == false) {
+            Debug(Debug::WARNING) << "Could not write trace file " << run.file << "\n";
+        }
+    }
+
+    for (size_t i = 0; i < run.traces.size(); i++) {
+        delete run.traces[i];
+    }
+    run.traces.clear();
+
+    if (outerRuns.empty() == false) {
+        // the calling workflow continues its trace
+        run = outerRuns.back();
+        outerRuns.pop_back();
+        enabled = true;
+    }
+}
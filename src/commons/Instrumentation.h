@@ -0,0 +1,74 @@
+#ifndef MMSEQS_INSTRUMENTATION_H
+#define MMSEQS_INSTRUMENTATION_H
+
+// Per-thread stage timers and counters for the hot paths of the modules.
+//
+// A module run is traced if the environment variable MMSEQS_TRACE names a directory. The run then
+// writes <directory>/<module>_<pid>.json in the Chrome trace event format (chrome://tracing, Perfetto).
+// Modules that a workflow runs in its own process (WorkflowExecutor) write <module>_<pid>_<run>.json,
+// where run counts the traced module runs of the process, the workflow trace continues afterwards.
+// Each scope adds its duration and call count to the totals of its stage in its thread. Scopes that
+// take at least MIN_EVENT_USEC are also kept as single events, so the timeline shows the long
+// stages without growing with the number of alignments.
+// Without tracing a scope costs one branch, with HAVE_INSTRUMENTATION=0 the macros compile to nothing.
+
+#include <cstddef>
+#include <stdint.h>
+
+class Instrumentation {
+public:
+    enum Stage {
+        KMER_GENERATION,
+        DIAGONAL_MATCHING,
+        UNGAPPED_SCORING,
+        ALIGNMENT,
+        DB_READ,
+        DB_WRITE,
+        DB_MERGE,
+        STAGE_COUNT
+    };
+
+    // enables tracing for the given module if MMSEQS_TRACE is set
+    static void start(const char *module);
+
+    // writes the trace file of the module run
+    static void finish();
+
+    static uint64_t now();
+    static void record(Stage stage, uint64_t begin, uint64_t end);
+    static void count(Stage stage, size_t items);
+
+    static bool enabled;
+
+private:
+    static const uint64_t MIN_EVENT_USEC = 1000;
+    static const size_t MAX_EVENTS_PER_THREAD = 100000;
+};
+
+class ScopedStageTimer {
+public:
+    explicit ScopedStageTimer(Instrumentation::Stage stage)
+        : stage(stage), begin(Instrumentation::enabled ? Instrumentation::now() : 0) {}
+
+    ~ScopedStageTimer() {
+        if (Instrumentation::enabled) {
+            Instrumentation::record(stage, begin, Instrumentation::now());
+        }
+    }
+
+private:
+    Instrumentation::Stage stage;
+    uint64_t begin;
+};
+
+#ifdef HAVE_INSTRUMENTATION
+#define INSTRUMENT_CONCAT_(a, b) a##b
+#define INSTRUMENT_CONCAT(a, b) INSTRUMENT_CONCAT_(a, b)
+#define INSTRUMENT_SCOPE(stage) ScopedStageTimer INSTRUMENT_CONCAT(instrumentScope, __LINE__)(Instrumentation::stage)
+#define INSTRUMENT_COUNT(stage, items) do { if (Instrumentation::enabled) { Instrumentation::count(Instrumentation::stage, items); } } while (0)
+#else
+#define INSTRUMENT_SCOPE(stage) do { } while (0)
+#define INSTRUMENT_COUNT(stage, items) do { } while (0)
+#endif
+
+#endif
@@ -0,0 +1,79 @@
+#include "MemoryDBWriter.h"
+#include "Debug.h"
+#include "Util.h"
+#include "FastSort.h"
+
+#include <cstring>
+
+MemoryDBWriter::MemoryDBWriter(unsigned int threads, int dbtype) : threads(threads), dbtype(dbtype),
+                                                                    buffers(threads), indices(threads),
+                                                                    data(NULL), index(NULL), reader(NULL) {}
+
+MemoryDBWriter::~MemoryDBWriter() {
+    if (reader != NULL) {
+        reader->close();
+        delete reader;
+    }
+    delete[] index;
+    free(data);
+}
+
+void MemoryDBWriter::writeData(const char *entry, size_t dataSize, unsigned int key, unsigned int thrIdx) {
+    if (thrIdx >= threads) {
+        Debug(Debug::ERROR) << "Thread index " << thrIdx << " > maximum thread number " << threads << "\n";
+        EXIT(EXIT_FAILURE);
+    }
+    std::string &buffer = buffers[thrIdx];
+    DBReader<unsigned int>::Index idx;
+    idx.id = key;
+    idx.offset = buffer.size();
+    idx.length = static_cast<unsigned int>(dataSize + 1);
+    buffer.append(entry, dataSize);
+    buffer.push_back('\0');
+    indices[thrIdx].push_back(idx);
+}
+
+DBReader<unsigned int> *MemoryDBWriter::getReader() {
+    if (reader != NULL) {
+        return reader;
+    }
+
+    size_t dataSize = 0;
+    size_t size = 0;
+    for (unsigned int i = 0; i < threads; i++) {
+        dataSize += buffers[i].size();
+        size += indices[i].size();
+    }
+
+    // the reader needs a non-empty data block
+    data = static_cast<char *>(malloc(std::max(dataSize, static_cast<size_t>(1))));
+    Util::checkAllocation(data, "Can not allocate data memory in MemoryDBWriter");
+    index = new(std::nothrow) DBReader<unsigned int>::Index[size];
+    Util::checkAllocation(index, "Can not allocate index memory in MemoryDBWriter");
+
+    unsigned int lastKey = 0;
+    unsigned int maxLength = 0;
+    size_t dataOffset = 0;
+    size_t indexOffset = 0;
+    for (unsigned int i = 0; i < threads; i++) {
+        memcpy(data + dataOffset, buffers[i].data(), buffers[i].size());
+        for (size_t j = 0; j < indices[i].size(); j++) {
+            DBReader<unsigned int>::Index &idx = index[indexOffset++];
+            idx = indices[i][j];
+            idx.offset += dataOffset;
+            lastKey = std::max(lastKey, idx.id);
+            maxLength = std::max(maxLength, idx.length);
+        }
+        dataOffset += buffers[i].size();
+        // release each buffer right away to keep the peak memory low
+        std::string().swap(buffers[i]);
+        std::vector<DBReader<unsigned int>::Index>().swap(indices[i]);
+    }
+    SORT_PARALLEL(index, index + size, DBReader<unsigned int>::Index::compareById);
+
+    reader = new DBReader<unsigned int>(index, size, dataSize, lastKey, dbtype, maxLength, threads);
+    reader->open(DBReader<unsigned int>::NOSORT);
+    reader->setData(data, std::max(dataSize, static_cast<size_t>(1)));
+    reader->setMode(DBReader<unsigned int>::USE_INDEX | DBReader<unsigned int>::USE_DATA);
+    return reader;
+}
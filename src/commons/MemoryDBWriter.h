@@ -0,0 +1,38 @@
+#ifndef MEMORY_DB_WRITER_H
+#define MEMORY_DB_WRITER_H
+
+// Collects database entries in memory instead of writing them to disk.
+//
+// Has the same writeData interface as the DBWriter, so code that produces a result database
+// can pass its entries to the next step of a fused workflow without a temporary database.
+// Each thread appends to its own buffer, getReader concatenates them and returns a reader
+// with the entries sorted by key. The reader is owned by the writer.
+
+#include "DBReader.h"
+
+#include <string>
+#include <vector>
+
+class MemoryDBWriter {
+public:
+    MemoryDBWriter(unsigned int threads, int dbtype);
+    ~MemoryDBWriter();
+
+    void writeData(const char *data, size_t dataSize, unsigned int key, unsigned int thrIdx = 0);
+
+    // entries written afterwards are not visible in the reader
+    DBReader<unsigned int> *getReader();
+
+private:
+    const unsigned int threads;
+    const int dbtype;
+
+    std::vector<std::string> buffers;
+    std::vector<std::vector<DBReader<unsigned int>::Index> > indices;
+
+    char *data;
+    DBReader<unsigned int>::Index *index;
+    DBReader<unsigned int> *reader;
+};
+
+#endif
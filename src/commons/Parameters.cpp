@@ -5,6 +5,7 @@
 #include "CommandCaller.h"
 #include "ByteParser.h"
 #include "FileUtil.h"
+#include "BinaryResult.h"
 
 #include <map>
 #include <iomanip>
@@ -39,10 +40,14 @@ Parameters::Parameters():
         PARAM_K(PARAM_K_ID, "-k", "k-mer length", "k-mer length (0: automatically set to optimum)", typeid(int), (void *) &kmerSize, "^[0-9]{1}[0-9]*$", MMseqsParameter::COMMAND_PREFILTER | MMseqsParameter::COMMAND_CLUSTLINEAR | MMseqsParameter::COMMAND_EXPERT),
         PARAM_THREADS(PARAM_THREADS_ID, "--threads", "Threads", "Number of CPU-cores used (all by default)", typeid(int), (void *) &threads, "^[1-9]{1}[0-9]*$", MMseqsParameter::COMMAND_COMMON),
         PARAM_COMPRESSED(PARAM_COMPRESSED_ID, "--compressed", "Compressed", "Write compressed output", typeid(int), (void *) &compressed, "^[0-1]{1}$", MMseqsParameter::COMMAND_COMMON),
+        PARAM_BINARY_RESULTS(PARAM_BINARY_RESULTS_ID, "--binary-results", "Binary results", "Write results in fixed-width binary layout 0: text, 1: binary (readable by align, clust, swapresults, convertalis, view and createtsv)", typeid(int), (void *) &binaryResults, "^[0-1]{1}$", MMseqsParameter::COMMAND_COMMON | MMseqsParameter::COMMAND_EXPERT),
+        PARAM_WORK_QUEUE(PARAM_WORK_QUEUE_ID, "--work-queue", "Work queue", "Distribute the queries over all processes started with this queue file on a shared file system. The file must not exist before the first process starts. Ignored with MPI", typeid(std::string), (void *) &workQueue, "", MMseqsParameter::COMMAND_COMMON | MMseqsParameter::COMMAND_EXPERT),
+        PARAM_COMPRESSION_DICT_SIZE(PARAM_COMPRESSION_DICT_SIZE_ID, "--compression-dict-size", "Compression dictionary size", "Train a zstd dictionary of this size for compressed databases. E.g. 64K, 112K. Default (0) to compress without dictionary", typeid(ByteParser), (void *) &compressionDictSize, "^(0|[1-9]{1}[0-9]*(B|K|M|G|T)?)$", MMseqsParameter::COMMAND_COMMON | MMseqsParameter::COMMAND_EXPERT),
         PARAM_ALPH_SIZE(PARAM_ALPH_SIZE_ID, "--alph-size", "Alphabet size", "Alphabet size (range 2-21)", typeid(MultiParam<NuclAA<int>>), (void *) &alphabetSize, "", MMseqsParameter::COMMAND_PREFILTER | MMseqsParameter::COMMAND_CLUSTLINEAR | MMseqsParameter::COMMAND_EXPERT),
         PARAM_MAX_SEQ_LEN(PARAM_MAX_SEQ_LEN_ID, "--max-seq-len", "Max sequence length", "Maximum sequence length", typeid(size_t), (void *) &maxSeqLen, "^[0-9]{1}[0-9]*", MMseqsParameter::COMMAND_COMMON | MMseqsParameter::COMMAND_EXPERT),
         PARAM_DIAGONAL_SCORING(PARAM_DIAGONAL_SCORING_ID, "--diag-score", "Diagonal scoring", "Use ungapped diagonal scoring during prefilter", typeid(bool), (void *) &diagonalScoring, "", MMseqsParameter::COMMAND_PREFILTER | MMseqsParameter::COMMAND_EXPERT),
         PARAM_EXACT_KMER_MATCHING(PARAM_EXACT_KMER_MATCHING_ID, "--exact-kmer-matching", "Exact k-mer matching", "Extract only exact k-mers for matching (range 0-1)", typeid(int), (void *) &exactKmerMatching, "^[0-1]{1}$", MMseqsParameter::COMMAND_PREFILTER | MMseqsParameter::COMMAND_EXPERT),
+        PARAM_QUERY_BATCH_SIZE(PARAM_QUERY_BATCH_SIZE_ID, "--query-batch-size", "Query batch size", "Match this many queries together in one pass over the k-mer index. Trades memory for fewer random accesses to the index. Default (1) to match each query on its own", typeid(int), (void *) &queryBatchSize, "^[1-9]{1}[0-9]*$", MMseqsParameter::COMMAND_PREFILTER | MMseqsParameter::COMMAND_EXPERT),
         PARAM_MASK_RESIDUES(PARAM_MASK_RESIDUES_ID, "--mask", "Mask residues", "Mask sequences in k-mer stage: 0: w/o low complexity masking, 1: with low complexity masking", typeid(int), (void *) &maskMode, "^[0-1]{1}", MMseqsParameter::COMMAND_PREFILTER | MMseqsParameter::COMMAND_EXPERT),
         PARAM_MASK_PROBABILTY(PARAM_MASK_PROBABILTY_ID, "--mask-prob", "Mask residues probability", "Mask sequences is probablity is above threshold", typeid(float), (void *) &maskProb, "^0(\\.[0-9]+)?|^1(\\.0+)?$", MMseqsParameter::COMMAND_PREFILTER | MMseqsParameter::COMMAND_EXPERT),
         PARAM_MASK_LOWER_CASE(PARAM_MASK_LOWER_CASE_ID, "--mask-lower-case", "Mask lower case residues", "Lowercase letters will be excluded from k-mer search 0: include region, 1: exclude region", typeid(int), (void *) &maskLowerCaseMode, "^[0-1]{1}", MMseqsParameter::COMMAND_PREFILTER | MMseqsParameter::COMMAND_EXPERT),
@@ -52,6 +57,7 @@ Parameters::Parameters():
         PARAM_SPLIT(PARAM_SPLIT_ID, "--split", "Split database", "Split input into N equally distributed chunks. 0: set the best split automatically", typeid(int), (void *) &split, "^[0-9]{1}[0-9]*$", MMseqsParameter::COMMAND_PREFILTER | MMseqsParameter::COMMAND_EXPERT),
         PARAM_SPLIT_MODE(PARAM_SPLIT_MODE_ID, "--split-mode", "Split mode", "0: split target db; 1: split query db; 2: auto, depending on main memory", typeid(int), (void *) &splitMode, "^[0-2]{1}$", MMseqsParameter::COMMAND_PREFILTER | MMseqsParameter::COMMAND_EXPERT),
         PARAM_SPLIT_MEMORY_LIMIT(PARAM_SPLIT_MEMORY_LIMIT_ID, "--split-memory-limit", "Split memory limit", "Set max memory per split. E.g. 800B, 5K, 10M, 1G. Default (0) to all available system memory", typeid(ByteParser), (void *) &splitMemoryLimit, "^(0|[1-9]{1}[0-9]*(B|K|M|G|T)?)$", MMseqsParameter::COMMAND_COMMON | MMseqsParameter::COMMAND_PREFILTER | MMseqsParameter::COMMAND_EXPERT),
+        PARAM_MEMORY_STATS(PARAM_MEMORY_STATS_ID, "--memory-stats", "Record memory statistics", "Append the estimated and the measured memory of each split to <targetDB>.memstats, later runs scale their memory estimates by them", typeid(bool), (void *) &memoryStats, "", MMseqsParameter::COMMAND_PREFILTER | MMseqsParameter::COMMAND_EXPERT),
         PARAM_DISK_SPACE_LIMIT(PARAM_DISK_SPACE_LIMIT_ID, "--disk-space-limit", "Disk space limit", "Set max disk space to use for reverse profile searches. E.g. 800B, 5K, 10M, 1G. Default (0) to all available disk space in the temp folder", typeid(ByteParser), (void *) &diskSpaceLimit, "^(0|[1-9]{1}[0-9]*(B|K|M|G|T)?)$", MMseqsParameter::COMMAND_COMMON | MMseqsParameter::COMMAND_PREFILTER | MMseqsParameter::COMMAND_EXPERT),
         PARAM_SPLIT_AMINOACID(PARAM_SPLIT_AMINOACID_ID, "--split-aa", "Split by amino acid", "Try to find the best split boundaries by entry lengths", typeid(bool), (void *) &splitAA, "$", MMseqsParameter::COMMAND_EXPERT),
         PARAM_SUB_MAT(PARAM_SUB_MAT_ID, "--sub-mat", "Substitution matrix", "Substitution matrix file", typeid(MultiParam<NuclAA<std::string>>), (void *) &scoringMatrixFile, "", MMseqsParameter::COMMAND_COMMON | MMseqsParameter::COMMAND_EXPERT),
@@ -63,6 +69,7 @@ Parameters::Parameters():
         PARAM_REMOVE_TMP_FILES(PARAM_REMOVE_TMP_FILES_ID, "--remove-tmp-files", "Remove temporary files", "Delete temporary files", typeid(bool), (void *) &removeTmpFiles, "", MMseqsParameter::COMMAND_COMMON | MMseqsParameter::COMMAND_EXPERT),
         PARAM_INCLUDE_IDENTITY(PARAM_INCLUDE_IDENTITY_ID, "--add-self-matches", "Include identical seq. id.", "Artificially add entries of queries with themselves (for clustering)", typeid(bool), (void *) &includeIdentity, "", MMseqsParameter::COMMAND_PREFILTER | MMseqsParameter::COMMAND_ALIGN | MMseqsParameter::COMMAND_EXPERT),
         PARAM_PRELOAD_MODE(PARAM_PRELOAD_MODE_ID, "--db-load-mode", "Preload mode", "Database preload mode 0: auto, 1: fread, 2: mmap, 3: mmap+touch", typeid(int), (void *) &preloadMode, "[0-3]{1}", MMseqsParameter::COMMAND_COMMON | MMseqsParameter::COMMAND_EXPERT),
+        PARAM_READAHEAD(PARAM_READAHEAD_ID, "--readahead", "Readahead window", "Prefetch this many bytes of upcoming database entries ahead of the worker threads. E.g. 64M, 1G. Default (0) to disable readahead", typeid(ByteParser), (void *) &readahead, "^(0|[1-9]{1}[0-9]*(B|K|M|G|T)?)$", MMseqsParameter::COMMAND_COMMON | MMseqsParameter::COMMAND_EXPERT),
         PARAM_SPACED_KMER_PATTERN(PARAM_SPACED_KMER_PATTERN_ID, "--spaced-kmer-pattern", "Spaced k-mer pattern", "User-specified spaced k-mer pattern", typeid(std::string), (void *) &spacedKmerPattern, "^1[01]*1$", MMseqsParameter::COMMAND_PREFILTER | MMseqsParameter::COMMAND_EXPERT),
         PARAM_LOCAL_TMP(PARAM_LOCAL_TMP_ID, "--local-tmp", "Local temporary path", "Path where some of the temporary files will be created", typeid(std::string), (void *) &localTmp, "", MMseqsParameter::COMMAND_PREFILTER | MMseqsParameter::COMMAND_EXPERT),
         // alignment
@@ -83,6 +90,7 @@ Parameters::Parameters():
         PARAM_REALIGN_MAX_SEQS(PARAM_REALIGN_MAX_SEQS_ID, "--realign-max-seqs", "Realign max seqs", "Maximum number of results to return in realignment", typeid(int), (void *) &realignMaxSeqs, "^[0-9]{1}[0-9]*$", MMseqsParameter::COMMAND_ALIGN | MMseqsParameter::COMMAND_EXPERT),
         PARAM_CORR_SCORE_WEIGHT(PARAM_CORR_SCORE_WEIGHT_ID, "--corr-score-weight", "Correlation score weight", "Weight of backtrace correlation score that is added to the alignment score", typeid(float), (void *) &correlationScoreWeight, "^-?[0-9]*(\\.[0-9]+)?$", MMseqsParameter::COMMAND_ALIGN | MMseqsParameter::COMMAND_EXPERT),
         PARAM_ALT_ALIGNMENT(PARAM_ALT_ALIGNMENT_ID, "--alt-ali", "Alternative alignments", "Show up to this many alternative alignments", typeid(int), (void *) &altAlignment, "^[0-9]{1}[0-9]*$", MMseqsParameter::COMMAND_ALIGN),
+        PARAM_DB_SIZE(PARAM_DB_SIZE_ID, "--db-size", "Database size", "Number of residues of the database that E-values are computed for, e.g. if the database is searched in parts. 0: residues of the target database", typeid(size_t), (void *) &evalDbSize, "^[0-9]{1}[0-9]*$", MMseqsParameter::COMMAND_ALIGN | MMseqsParameter::COMMAND_EXPERT),
         PARAM_GAP_OPEN(PARAM_GAP_OPEN_ID, "--gap-open", "Gap open cost", "Gap open cost", typeid(MultiParam<NuclAA<int>>), (void *) &gapOpen, "^[0-9]{1}[0-9]*$", MMseqsParameter::COMMAND_ALIGN | MMseqsParameter::COMMAND_EXPERT),
         PARAM_GAP_EXTEND(PARAM_GAP_EXTEND_ID, "--gap-extend", "Gap extension cost", "Gap extension cost", typeid(MultiParam<NuclAA<int>>), (void *) &gapExtend, "^[0-9]{1}[0-9]*$", MMseqsParameter::COMMAND_ALIGN | MMseqsParameter::COMMAND_EXPERT),
         PARAM_GAP_PSEUDOCOUNT(PARAM_GAP_PSEUDOCOUNT_ID, "--gap-pc", "Gap pseudo count", "Pseudo count for calculating position-specific gap opening penalties", typeid(int), &gapPseudoCount, "^[0-9]+$", MMseqsParameter::COMMAND_ALIGN|MMseqsParameter::COMMAND_EXPERT),
@@ -95,6 +103,10 @@ Parameters::Parameters():
         // affinity clustering
         PARAM_MAXITERATIONS(PARAM_MAXITERATIONS_ID, "--max-iterations", "Max connected component depth", "Maximum depth of breadth first search in connected component clustering", typeid(int), (void *) &maxIteration, "^[1-9]{1}[0-9]*$", MMseqsParameter::COMMAND_CLUST | MMseqsParameter::COMMAND_EXPERT),
         PARAM_SIMILARITYSCORE(PARAM_SIMILARITYSCORE_ID, "--similarity-type", "Similarity type", "Type of score used for clustering. 1: alignment score 2: sequence identity", typeid(int), (void *) &similarityScoreType, "^[1-2]{1}$", MMseqsParameter::COMMAND_CLUST | MMseqsParameter::COMMAND_EXPERT),
+        PARAM_PARALLEL_SET_COVER(PARAM_PARALLEL_SET_COVER_ID, "--parallel-set-cover", "Parallel set cover", "Select the representatives of the set cover clustering in parallel rounds of locally largest sets", typeid(bool), (void *) &parallelSetCover, "", MMseqsParameter::COMMAND_CLUST | MMseqsParameter::COMMAND_EXPERT),
+        PARAM_SET_COVER_DETERMINISTIC(PARAM_SET_COVER_DETERMINISTIC_ID, "--set-cover-deterministic", "Deterministic parallel set cover", "Parallel set cover gives the same clustering for any number of threads, otherwise it needs fewer rounds", typeid(bool), (void *) &deterministicSetCover, "", MMseqsParameter::COMMAND_CLUST | MMseqsParameter::COMMAND_EXPERT),
+        PARAM_GRAPH_CACHE(PARAM_GRAPH_CACHE_ID, "--graph-cache", "Graph cache", "Store the symmetric alignment graph of clust in this file and map it again instead of reading the alignment result if the input is unchanged (e.g. to compare cluster modes)", typeid(std::string), (void *) &graphCache, "", MMseqsParameter::COMMAND_CLUST | MMseqsParameter::COMMAND_EXPERT),
+        PARAM_CC_UNION_FIND(PARAM_CC_UNION_FIND_ID, "--cc-union-find", "Union-find connected component", "Compute the connected component clustering with a parallel union-find while streaming the alignment result, needs no alignment graph in memory and ignores --max-iterations", typeid(bool), (void *) &unionFindComponents, "", MMseqsParameter::COMMAND_CLUST | MMseqsParameter::COMMAND_EXPERT),
         // logging
         PARAM_V(PARAM_V_ID, "-v", "Verbosity", "Verbosity level: 0: quiet, 1: +errors, 2: +warnings, 3: +info", typeid(int), (void *) &verbosity, "^[0-3]{1}$", MMseqsParameter::COMMAND_COMMON),
         // convertalignments
@@ -151,10 +163,12 @@ Parameters::Parameters():
         PARAM_PICK_N_SIMILAR(PARAM_PICK_N_SIMILAR_ID, "--pick-n-sim-kmer", "Add N similar to search", "Add N similar k-mers to search", typeid(int), (void *) &pickNbest, "^[1-9]{1}[0-9]*$", MMseqsParameter::COMMAND_CLUSTLINEAR | MMseqsParameter::COMMAND_EXPERT),
         PARAM_ADJUST_KMER_LEN(PARAM_ADJUST_KMER_LEN_ID, "--adjust-kmer-len", "Adjust k-mer length", "Adjust k-mer length based on specificity (only for nucleotides)", typeid(bool), (void *) &adjustKmerLength, "", MMseqsParameter::COMMAND_CLUSTLINEAR | MMseqsParameter::COMMAND_EXPERT),
         PARAM_RESULT_DIRECTION(PARAM_RESULT_DIRECTION_ID, "--result-direction", "Result direction", "result is 0: query, 1: target centric", typeid(int), (void *) &resultDirection, "^[0-1]{1}$", MMseqsParameter::COMMAND_CLUSTLINEAR | MMseqsParameter::COMMAND_EXPERT),
+        PARAM_FUSED_PRECLUST(PARAM_FUSED_PRECLUST_ID, "--fused-preclust", "Fused pre-clustering", "Find k-mer matches, rescore them and pre-cluster in one step keeping the intermediate results in memory (not with --mpi-runner)", typeid(bool), (void *) &fusedPreclust, "", MMseqsParameter::COMMAND_CLUSTLINEAR | MMseqsParameter::COMMAND_EXPERT),
 
         // workflow
         PARAM_RUNNER(PARAM_RUNNER_ID, "--mpi-runner", "MPI runner", "Use MPI on compute cluster with this MPI command (e.g. \"mpirun -np 42\")", typeid(std::string), (void *) &runner, "", MMseqsParameter::COMMAND_COMMON | MMseqsParameter::COMMAND_EXPERT),
         PARAM_REUSELATEST(PARAM_REUSELATEST_ID, "--force-reuse", "Force restart with latest tmp", "Reuse tmp filse in tmp/latest folder ignoring parameters and version changes", typeid(bool), (void *) &reuseLatest, "", MMseqsParameter::COMMAND_COMMON | MMseqsParameter::COMMAND_EXPERT),
+        PARAM_IN_PROCESS(PARAM_IN_PROCESS_ID, "--in-process", "Run workflow in process", "Run the workflow steps inside the workflow process instead of calling a workflow shell script (not with --mpi-runner)", typeid(bool), (void *) &inProcess, "", MMseqsParameter::COMMAND_COMMON | MMseqsParameter::COMMAND_EXPERT),
         // search workflow
         PARAM_NUM_ITERATIONS(PARAM_NUM_ITERATIONS_ID, "--num-iterations", "Search iterations", "Number of iterative profile search iterations", typeid(int), (void *) &numIterations, "^[1-9]{1}[0-9]*$", MMseqsParameter::COMMAND_PROFILE),
         PARAM_START_SENS(PARAM_START_SENS_ID, "--start-sens", "Start sensitivity", "Start sensitivity", typeid(float), (void *) &startSens, "^[0-9]*(\\.[0-9]+)?$"),
@@ -184,6 +198,7 @@ Parameters::Parameters():
         // indexdb
         PARAM_CHECK_COMPATIBLE(PARAM_CHECK_COMPATIBLE_ID, "--check-compatible", "Check compatible", "0: Always recreate index, 1: Check if recreating index is needed, 2: Fail if index is incompatible", typeid(int), (void *) &checkCompatible, "^[0-2]{1}$", MMseqsParameter::COMMAND_MISC),
         PARAM_SEARCH_TYPE(PARAM_SEARCH_TYPE_ID, "--search-type", "Search type", "Search type 0: auto 1: amino acid, 2: translated, 3: nucleotide, 4: translated nucleotide alignment", typeid(int), (void *) &searchType, "^[0-4]{1}"),
+        PARAM_INDEX_COMPRESSION(PARAM_INDEX_COMPRESSION_ID, "--index-compression", "Compress index k-mer lists", "Store the k-mer lists of the index delta and stream-vbyte encoded. Smaller index at the cost of slower k-mer matching", typeid(bool), (void *) &indexCompression, "", MMseqsParameter::COMMAND_EXPERT),
         // createdb
         PARAM_USE_HEADER(PARAM_USE_HEADER_ID, "--use-fasta-header", "Use fasta header", "Use the id parsed from the fasta header as the index key instead of using incrementing numeric identifiers", typeid(bool), (void *) &useHeader, ""),
         PARAM_ID_OFFSET(PARAM_ID_OFFSET_ID, "--id-offset", "Offset of numeric ids", "Numeric ids in index file are offset by this value", typeid(int), (void *) &identifierOffset, "^(0|[1-9]{1}[0-9]*)$"),
@@ -253,6 +268,7 @@ Parameters::Parameters():
         // convertkb
         PARAM_KB_COLUMNS(PARAM_KB_COLUMNS_ID, "--kb-columns", "UniprotKB columns", "list of indices of UniprotKB columns to be extracted", typeid(std::string), (void *) &kbColumns, ""),
         PARAM_RECOVER_DELETED(PARAM_RECOVER_DELETED_ID, "--recover-deleted", "Recover deleted", "Find and recover deleted sequences during updating of clustering", typeid(bool), (void *) &recoverDeleted, ""),
+        PARAM_REP_INDEX(PARAM_REP_INDEX_ID, "--rep-index", "Representative index", "Keep an indexed representative DB next to the clustering and only index new representatives in later updates", typeid(bool), (void *) &repIndex, ""),
         // filtertaxdb
         PARAM_TAXON_LIST(PARAM_TAXON_LIST_ID, "--taxon-list", "Selected taxa", "Taxonomy ID, possibly multiple values separated by ','", typeid(std::string), (void *) &taxonList, ""),
         // view
@@ -314,6 +330,11 @@ Parameters::Parameters():
     threadsandcompression.push_back(&PARAM_COMPRESSED);
     threadsandcompression.push_back(&PARAM_V);
 
+    // compress
+    compress.push_back(&PARAM_THREADS);
+    compress.push_back(&PARAM_COMPRESSION_DICT_SIZE);
+    compress.push_back(&PARAM_V);
+
     // alignall
     alignall.push_back(&PARAM_SUB_MAT);
     alignall.push_back(&PARAM_ADD_BACKTRACE);
@@ -352,6 +373,7 @@ Parameters::Parameters():
     align.push_back(&PARAM_ALIGNMENT_OUTPUT_MODE);
     align.push_back(&PARAM_WRAPPED_SCORING);
     align.push_back(&PARAM_E);
+    align.push_back(&PARAM_DB_SIZE);
     align.push_back(&PARAM_MIN_SEQ_ID);
     align.push_back(&PARAM_MIN_ALN_LEN);
     align.push_back(&PARAM_SEQ_ID_MODE);
@@ -366,6 +388,7 @@ Parameters::Parameters():
     align.push_back(&PARAM_MAX_ACCEPT);
     align.push_back(&PARAM_INCLUDE_IDENTITY);
     align.push_back(&PARAM_PRELOAD_MODE);
+    align.push_back(&PARAM_READAHEAD);
     align.push_back(&PARAM_PCA);
     align.push_back(&PARAM_PCB);
     align.push_back(&PARAM_SCORE_BIAS);
@@ -376,8 +399,10 @@ Parameters::Parameters():
     align.push_back(&PARAM_GAP_OPEN);
     align.push_back(&PARAM_GAP_EXTEND);
     align.push_back(&PARAM_ZDROP);
+    align.push_back(&PARAM_WORK_QUEUE);
     align.push_back(&PARAM_THREADS);
     align.push_back(&PARAM_COMPRESSED);
+    align.push_back(&PARAM_BINARY_RESULTS);
     align.push_back(&PARAM_V);
 
     // prefilter
@@ -392,12 +417,14 @@ Parameters::Parameters():
     prefilter.push_back(&PARAM_SPLIT);
     prefilter.push_back(&PARAM_SPLIT_MODE);
     prefilter.push_back(&PARAM_SPLIT_MEMORY_LIMIT);
+    prefilter.push_back(&PARAM_MEMORY_STATS);
     prefilter.push_back(&PARAM_C);
     prefilter.push_back(&PARAM_COV_MODE);
     prefilter.push_back(&PARAM_NO_COMP_BIAS_CORR);
     prefilter.push_back(&PARAM_NO_COMP_BIAS_CORR_SCALE);
     prefilter.push_back(&PARAM_DIAGONAL_SCORING);
     prefilter.push_back(&PARAM_EXACT_KMER_MATCHING);
+    prefilter.push_back(&PARAM_QUERY_BATCH_SIZE);
     prefilter.push_back(&PARAM_MASK_RESIDUES);
     prefilter.push_back(&PARAM_MASK_PROBABILTY);
     prefilter.push_back(&PARAM_MASK_LOWER_CASE);
@@ -406,12 +433,14 @@ Parameters::Parameters():
     prefilter.push_back(&PARAM_INCLUDE_IDENTITY);
     prefilter.push_back(&PARAM_SPACED_KMER_MODE);
     prefilter.push_back(&PARAM_PRELOAD_MODE);
+    prefilter.push_back(&PARAM_READAHEAD);
     prefilter.push_back(&PARAM_PCA);
     prefilter.push_back(&PARAM_PCB);
     prefilter.push_back(&PARAM_SPACED_KMER_PATTERN);
     prefilter.push_back(&PARAM_LOCAL_TMP);
     prefilter.push_back(&PARAM_THREADS);
     prefilter.push_back(&PARAM_COMPRESSED);
+    prefilter.push_back(&PARAM_BINARY_RESULTS);
     prefilter.push_back(&PARAM_V);
 
     // ungappedprefilter
@@ -431,6 +460,10 @@ Parameters::Parameters():
     clust.push_back(&PARAM_CLUSTER_MODE);
     clust.push_back(&PARAM_MAXITERATIONS);
     clust.push_back(&PARAM_SIMILARITYSCORE);
+    clust.push_back(&PARAM_PARALLEL_SET_COVER);
+    clust.push_back(&PARAM_SET_COVER_DETERMINISTIC);
+    clust.push_back(&PARAM_GRAPH_CACHE);
+    clust.push_back(&PARAM_CC_UNION_FIND);
     clust.push_back(&PARAM_THREADS);
     clust.push_back(&PARAM_COMPRESSED);
     clust.push_back(&PARAM_V);
@@ -441,6 +474,7 @@ Parameters::Parameters():
     rescorediagonal.push_back(&PARAM_WRAPPED_SCORING);
     rescorediagonal.push_back(&PARAM_FILTER_HITS);
     rescorediagonal.push_back(&PARAM_E);
+    rescorediagonal.push_back(&PARAM_DB_SIZE);
     rescorediagonal.push_back(&PARAM_C);
     rescorediagonal.push_back(&PARAM_ADD_BACKTRACE);
     rescorediagonal.push_back(&PARAM_COV_MODE);
@@ -516,6 +550,7 @@ Parameters::Parameters():
     result2profile.push_back(&PARAM_GAP_OPEN);
     result2profile.push_back(&PARAM_GAP_EXTEND);
     result2profile.push_back(&PARAM_GAP_PSEUDOCOUNT);
+    result2profile.push_back(&PARAM_WORK_QUEUE);
     result2profile.push_back(&PARAM_THREADS);
     result2profile.push_back(&PARAM_COMPRESSED);
     result2profile.push_back(&PARAM_V);
@@ -594,6 +629,7 @@ Parameters::Parameters():
     filterresult.push_back(&PARAM_FILTER_COV);
     filterresult.push_back(&PARAM_FILTER_NDIFF);
     filterresult.push_back(&PARAM_PRELOAD_MODE);
+    filterresult.push_back(&PARAM_WORK_QUEUE);
     filterresult.push_back(&PARAM_THREADS);
     filterresult.push_back(&PARAM_COMPRESSED);
     filterresult.push_back(&PARAM_INCLUDE_IDENTITY);
@@ -640,6 +676,11 @@ Parameters::Parameters():
     profile2pssm.push_back(&PARAM_COMPRESSED);
     profile2pssm.push_back(&PARAM_V);
 
+    // createprofilelookup
+    createprofilelookup.push_back(&PARAM_SUB_MAT);
+    createprofilelookup.push_back(&PARAM_THREADS);
+    createprofilelookup.push_back(&PARAM_V);
+
     // profile2seq (profile2consensus + profile2repseq)
     profile2seq.push_back(&PARAM_SUB_MAT);
     profile2seq.push_back(&PARAM_MAX_SEQ_LEN);
@@ -722,6 +763,7 @@ Parameters::Parameters():
     indexdb.push_back(&PARAM_S);
     indexdb.push_back(&PARAM_K_SCORE);
     indexdb.push_back(&PARAM_CHECK_COMPATIBLE);
+    indexdb.push_back(&PARAM_INDEX_COMPRESSION);
     indexdb.push_back(&PARAM_SEARCH_TYPE);
     indexdb.push_back(&PARAM_SPLIT);
     indexdb.push_back(&PARAM_SPLIT_MEMORY_LIMIT);
@@ -757,6 +799,7 @@ Parameters::Parameters():
     createdb.push_back(&PARAM_WRITE_LOOKUP);
     createdb.push_back(&PARAM_ID_OFFSET);
     createdb.push_back(&PARAM_COMPRESSED);
+    createdb.push_back(&PARAM_COMPRESSION_DICT_SIZE);
     createdb.push_back(&PARAM_V);
 
     // convert2fasta
@@ -913,6 +956,10 @@ Parameters::Parameters():
     kmermatcher.push_back(&PARAM_COMPRESSED);
     kmermatcher.push_back(&PARAM_V);
 
+    // kmerclust
+    kmerclust = combineList(kmermatcher, rescorediagonal);
+    kmerclust = combineList(kmerclust, clust);
+
     // kmermatcher
     kmersearch.push_back(&PARAM_SEED_SUB_MAT);
     kmersearch.push_back(&PARAM_KMER_PER_SEQ);
@@ -1170,6 +1217,10 @@ Parameters::Parameters():
     sortresult.push_back(&PARAM_THREADS);
     sortresult.push_back(&PARAM_V);
 
+    prefilteralign = combineList(prefilter, align);
+    // a work queue only distributes a single module call, workflows run all their steps on each worker
+    prefilteralign = removeParameter(prefilteralign, PARAM_WORK_QUEUE);
+
     // WORKFLOWS
     searchworkflow = combineList(align, prefilter);
     searchworkflow = combineList(searchworkflow, rescorediagonal);
@@ -1190,7 +1241,9 @@ Parameters::Parameters():
     searchworkflow.push_back(&PARAM_DISK_SPACE_LIMIT);
     searchworkflow.push_back(&PARAM_RUNNER);
     searchworkflow.push_back(&PARAM_REUSELATEST);
+    searchworkflow.push_back(&PARAM_IN_PROCESS);
     searchworkflow.push_back(&PARAM_REMOVE_TMP_FILES);
+    searchworkflow = removeParameter(searchworkflow, PARAM_WORK_QUEUE);
 
     linsearchworkflow = combineList(align, kmersearch);
     linsearchworkflow = combineList(linsearchworkflow, swapresult);
@@ -1200,6 +1253,7 @@ Parameters::Parameters():
     linsearchworkflow.push_back(&PARAM_RUNNER);
     linsearchworkflow.push_back(&PARAM_REUSELATEST);
     linsearchworkflow.push_back(&PARAM_REMOVE_TMP_FILES);
+    linsearchworkflow = removeParameter(linsearchworkflow, PARAM_WORK_QUEUE);
 
     // easyslinsearch
     easylinsearchworkflow = combineList(createlinindex, linsearchworkflow);
@@ -1230,6 +1284,8 @@ Parameters::Parameters():
     linclustworkflow.push_back(&PARAM_REMOVE_TMP_FILES);
     linclustworkflow.push_back(&PARAM_REUSELATEST);
     linclustworkflow.push_back(&PARAM_RUNNER);
+    linclustworkflow.push_back(&PARAM_FUSED_PRECLUST);
+    linclustworkflow = removeParameter(linclustworkflow, PARAM_WORK_QUEUE);
 
     // easylinclustworkflow
     easylinclustworkflow = combineList(linclustworkflow, createdb);
@@ -1245,6 +1301,7 @@ Parameters::Parameters():
     clusterworkflow.push_back(&PARAM_REUSELATEST);
     clusterworkflow.push_back(&PARAM_RUNNER);
     clusterworkflow = combineList(clusterworkflow, linclustworkflow);
+    clusterworkflow = removeParameter(clusterworkflow, PARAM_WORK_QUEUE);
 
     // easyclusterworkflow
     easyclusterworkflow = combineList(clusterworkflow, createdb);
@@ -1286,6 +1343,7 @@ Parameters::Parameters():
     clusterUpdate.push_back(&PARAM_REUSELATEST);
     clusterUpdate.push_back(&PARAM_USESEQID);
     clusterUpdate.push_back(&PARAM_RECOVER_DELETED);
+    clusterUpdate.push_back(&PARAM_REP_INDEX);
 
     mapworkflow = combineList(prefilter, rescorediagonal);
     mapworkflow = combineList(mapworkflow, extractorfs);
@@ -1301,6 +1359,7 @@ Parameters::Parameters():
     enrichworkflow = combineList(enrichworkflow, align);
     enrichworkflow = combineList(enrichworkflow, expandaln);
     enrichworkflow = combineList(enrichworkflow, result2profile);
+    enrichworkflow = removeParameter(enrichworkflow, PARAM_WORK_QUEUE);
 
     databases.push_back(&PARAM_HELP);
     databases.push_back(&PARAM_HELP_LONG);
@@ -2066,6 +2125,12 @@ void Parameters::checkIfDatabaseIsValid(const Command& command, int argc, const
                     }
                     EXIT(EXIT_FAILURE);
                 }
+                if ((db.specialType & DbType::ALLOW_BINARY) == 0 && BinaryResult::isBinaryDbtype(dbtype)) {
+                    printParameters(command.cmd, argc, argv, *command.params);
+                    Debug(Debug::ERROR) << "Input database \"" << filenames[fileIdx] << "\" uses the binary result layout, which is not supported by " << command.cmd << "\n"
+                                        << "Recompute it with --binary-results 0\n";
+                    EXIT(EXIT_FAILURE);
+                }
             }
         } else if (db.accessMode == db.ACCESS_MODE_OUTPUT) {
             if (db.validator == &DbValidator::directory) {
@@ -2185,6 +2250,7 @@ void Parameters::setDefaults() {
     split = AUTO_SPLIT_DETECTION;
     splitMode = DETECT_BEST_DB_SPLIT;
     splitMemoryLimit = 0;
+    memoryStats = true;
     diskSpaceLimit = 0;
     splitAA = false;
     spacedKmerPattern = "";
@@ -2206,6 +2272,9 @@ void Parameters::setDefaults() {
 
     threads = 1;
     compressed = WRITER_ASCII_MODE;
+    binaryResults = 0;
+    compressionDictSize = 0;
+    workQueue = "";
 #ifdef OPENMP
     char * threadEnv = getenv("MMSEQS_NUM_THREADS");
     if (threadEnv != NULL) {
@@ -2224,6 +2293,7 @@ void Parameters::setDefaults() {
     compBiasCorrectionScale = 1.0;
     diagonalScoring = true;
     exactKmerMatching = 0;
+    queryBatchSize = 1;
     maskMode = 1;
     maskProb = 0.9;
     maskLowerCaseMode = 0;
@@ -2241,6 +2311,7 @@ void Parameters::setDefaults() {
     seqIdThr = 0.0;
     alnLenThr = 0;
     altAlignment = 0;
+    evalDbSize = 0;
     gapOpen = MultiParam<NuclAA<int>>(NuclAA<int>(11, 5));
     gapExtend = MultiParam<NuclAA<int>>(NuclAA<int>(1, 2));
     gapPseudoCount = 10;
@@ -2252,6 +2323,7 @@ void Parameters::setDefaults() {
     clusterReassignment = 0;
     clusterSteps = 3;
     preloadMode = 0;
+    readahead = 0;
     scoreBias = 0.0;
     realignScoreBias = -0.2f;
     realignMaxSeqs = INT_MAX;
@@ -2260,6 +2332,10 @@ void Parameters::setDefaults() {
     // affinity clustering
     maxIteration=1000;
     similarityScoreType=APC_SEQID;
+    parallelSetCover = false;
+    deterministicSetCover = true;
+    graphCache = "";
+    unionFindComponents = false;
 
     // workflow
     const char *runnerEnv = getenv("RUNNER");
@@ -2269,12 +2345,14 @@ void Parameters::setDefaults() {
         runner = "";
     }
     reuseLatest = false;
+    inProcess = false;
     // Clustering workflow
     removeTmpFiles = false;
 
     // indexdb
     checkCompatible = 0;
     searchType = SEARCH_TYPE_AUTO;
+    indexCompression = false;
 
     // createdb
     createdbMode = SEQUENCE_SPLIT_MODE_HARD;
@@ -2419,6 +2497,10 @@ void Parameters::setDefaults() {
     // convertkb
     kbColumns = "";
 
+    // clusterupdate
+    recoverDeleted = false;
+    repIndex = false;
+
     // linearcluster
     kmersPerSequence = 21;
     kmersPerSequenceScale = MultiParam<NuclAA<float>>(NuclAA<float>(0.0, 0.2));
@@ -2428,6 +2510,7 @@ void Parameters::setDefaults() {
     pickNbest = 1;
     adjustKmerLength = false;
     resultDirection = Parameters::PARAM_RESULT_DIRECTION_TARGET;
+    fusedPreclust = false;
     // result2stats
     stat = "";
 
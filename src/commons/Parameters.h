@@ -87,6 +87,7 @@ public:
     static const unsigned int DBTYPE_EXTENDED_COMPRESSED = 1;
     static const unsigned int DBTYPE_EXTENDED_INDEX_NEED_SRC = 2;
     static const unsigned int DBTYPE_EXTENDED_CONTEXT_PSEUDO_COUNTS = 4;
+    static const unsigned int DBTYPE_EXTENDED_BINARY_RESULT = 8;
 
     // don't forget to add new database types to DBReader::getDbTypeName and Parameters::PARAM_OUTPUT_DBTYPE
 
@@ -368,6 +369,9 @@ public:
     int    verbosity;                    // log level
     int    threads;                      // Amounts of threads
     int    compressed;                   // compressed writer
+    int    binaryResults;                // write prefilter/alignment results in binary layout
+    size_t compressionDictSize;          // size of the trained zstd dictionary (0: off)
+    std::string workQueue;               // queue file shared by all workers of a job without MPI
     bool   removeTmpFiles;               // Do not delete temp files
     bool   includeIdentity;              // include identical ids as hit
 
@@ -381,6 +385,7 @@ public:
 
     bool   diagonalScoring;              // switch diagonal scoring
     int    exactKmerMatching;            // only exact k-mer matching
+    int    queryBatchSize;               // queries matched together in one pass over the index table
     int    maskMode;                     // mask low complex areas
     float  maskProb;                     // mask probability
     int    maskLowerCaseMode;            // mask lowercase letters in prefilter and kmermatchers
@@ -390,9 +395,11 @@ public:
     int    split;                        // Split database in n equal chunks
     int    splitMode;                    // Split by query or target DB
     size_t splitMemoryLimit;             // Maximum memory in bytes a split can use
+    bool memoryStats;                    // Record the memory of each split next to the target database
     size_t diskSpaceLimit;               // Maximum disk space in bytes for sliced reverse profile search
     bool   splitAA;                      // Split database by amino acid count instead
     int    preloadMode;                  // Preload mode of database
+    size_t readahead;                    // bytes prefetched ahead of the workers (0: off)
     float  scoreBias;                    // Add this bias to the score when computing the alignements
     float  realignScoreBias;             // Add this bias additionally when realigning
     int    realignMaxSeqs;               // Max alignments to realign
@@ -411,6 +418,7 @@ public:
     int    maxRejected;                  // after n sequences that are above eval stop
     int    maxAccept;                    // after n accepted sequences stop
     int    altAlignment;                 // show up to this many alternative alignments
+    size_t evalDbSize;                   // residues of the database for e-values, 0: target database
     float  seqIdThr;                     // sequence identity threshold for acceptance
     int    alnLenThr;                    // min. alignment length
     bool   addBacktrace;                 // store backtrace string (M=Match, D=deletion, I=insertion)
@@ -424,6 +432,7 @@ public:
     // workflow
     std::string runner;
     bool reuseLatest;
+    bool inProcess;
 
     // CLUSTERING
     int    clusteringMode;
@@ -449,6 +458,10 @@ public:
     //CLUSTERING
     int maxIteration;                   // Maximum depth of breadth first search in connected component
     int similarityScoreType;            // Type of score to use for reassignment 1=alignment score. 2=coverage 3=sequence identity 4=E-value 5= Score per Column
+    bool parallelSetCover;              // Select the set cover representatives in parallel rounds
+    bool deterministicSetCover;         // Parallel set cover result does not depend on the thread count
+    std::string graphCache;             // File of the symmetric clustering graph, reused for the same input
+    bool unionFindComponents;           // Connected components by union-find over the streamed alignment result
 
     //extractorfs
     int orfMinLength;
@@ -525,10 +538,12 @@ public:
     int pickNbest;
     int adjustKmerLength;
     int resultDirection;
+    bool fusedPreclust;
 
     // indexdb
     int checkCompatible;
     int searchType;
+    bool indexCompression;
 
     // createdb
     int identifierOffset;
@@ -616,6 +631,7 @@ public:
 
     // clusterUpdate;
     bool recoverDeleted;
+    bool repIndex;
 
     // summarize headers
     int headerType;
@@ -699,10 +715,14 @@ public:
     PARAMETER(PARAM_K)
     PARAMETER(PARAM_THREADS)
     PARAMETER(PARAM_COMPRESSED)
+    PARAMETER(PARAM_BINARY_RESULTS)
+    PARAMETER(PARAM_WORK_QUEUE)
+    PARAMETER(PARAM_COMPRESSION_DICT_SIZE)
     PARAMETER(PARAM_ALPH_SIZE)
     PARAMETER(PARAM_MAX_SEQ_LEN)
     PARAMETER(PARAM_DIAGONAL_SCORING)
     PARAMETER(PARAM_EXACT_KMER_MATCHING)
+    PARAMETER(PARAM_QUERY_BATCH_SIZE)
     PARAMETER(PARAM_MASK_RESIDUES)
     PARAMETER(PARAM_MASK_PROBABILTY)
     PARAMETER(PARAM_MASK_LOWER_CASE)
@@ -713,6 +733,7 @@ public:
     PARAMETER(PARAM_SPLIT)
     PARAMETER(PARAM_SPLIT_MODE)
     PARAMETER(PARAM_SPLIT_MEMORY_LIMIT)
+    PARAMETER(PARAM_MEMORY_STATS)
     PARAMETER(PARAM_DISK_SPACE_LIMIT)
     PARAMETER(PARAM_SPLIT_AMINOACID)
     PARAMETER(PARAM_SUB_MAT)
@@ -723,6 +744,7 @@ public:
     PARAMETER(PARAM_REMOVE_TMP_FILES)
     PARAMETER(PARAM_INCLUDE_IDENTITY)
     PARAMETER(PARAM_PRELOAD_MODE)
+    PARAMETER(PARAM_READAHEAD)
     PARAMETER(PARAM_SPACED_KMER_PATTERN)
     PARAMETER(PARAM_LOCAL_TMP)
     std::vector<MMseqsParameter*> prefilter;
@@ -746,6 +768,7 @@ public:
     PARAMETER(PARAM_REALIGN_MAX_SEQS)
     PARAMETER(PARAM_CORR_SCORE_WEIGHT)
     PARAMETER(PARAM_ALT_ALIGNMENT)
+    PARAMETER(PARAM_DB_SIZE)
     PARAMETER(PARAM_GAP_OPEN)
     PARAMETER(PARAM_GAP_EXTEND)
     PARAMETER(PARAM_GAP_PSEUDOCOUNT)
@@ -760,6 +783,10 @@ public:
     // affinity clustering
     PARAMETER(PARAM_MAXITERATIONS)
     PARAMETER(PARAM_SIMILARITYSCORE)
+    PARAMETER(PARAM_PARALLEL_SET_COVER)
+    PARAMETER(PARAM_SET_COVER_DETERMINISTIC)
+    PARAMETER(PARAM_GRAPH_CACHE)
+    PARAMETER(PARAM_CC_UNION_FIND)
 
     // logging
     PARAMETER(PARAM_V)
@@ -826,9 +853,11 @@ public:
     PARAMETER(PARAM_PICK_N_SIMILAR)
     PARAMETER(PARAM_ADJUST_KMER_LEN)
     PARAMETER(PARAM_RESULT_DIRECTION)
+    PARAMETER(PARAM_FUSED_PRECLUST)
     // workflow
     PARAMETER(PARAM_RUNNER)
     PARAMETER(PARAM_REUSELATEST)
+    PARAMETER(PARAM_IN_PROCESS)
 
     // search workflow
     PARAMETER(PARAM_NUM_ITERATIONS)
@@ -861,6 +890,7 @@ public:
     // indexdb
     PARAMETER(PARAM_CHECK_COMPATIBLE)
     PARAMETER(PARAM_SEARCH_TYPE)
+    PARAMETER(PARAM_INDEX_COMPRESSION)
 
     // createdb
     PARAMETER(PARAM_USE_HEADER) // also used by extractorfs
@@ -952,6 +982,7 @@ public:
 
     // clusterupdate
     PARAMETER(PARAM_RECOVER_DELETED)
+    PARAMETER(PARAM_REP_INDEX)
 
     // filtertaxdb, filtertaxseqdb
     PARAMETER(PARAM_TAXON_LIST)
@@ -1019,9 +1050,11 @@ public:
     std::vector<MMseqsParameter*> verbandcompression;
     std::vector<MMseqsParameter*> onlythreads;
     std::vector<MMseqsParameter*> threadsandcompression;
+    std::vector<MMseqsParameter*> compress;
 
     std::vector<MMseqsParameter*> alignall;
     std::vector<MMseqsParameter*> align;
+    std::vector<MMseqsParameter*> prefilteralign;
     std::vector<MMseqsParameter*> rescorediagonal;
     std::vector<MMseqsParameter*> alignbykmer;
     std::vector<MMseqsParameter*> createFasta;
@@ -1054,6 +1087,7 @@ public:
     std::vector<MMseqsParameter*> gff2db;
     std::vector<MMseqsParameter*> clusthash;
     std::vector<MMseqsParameter*> kmermatcher;
+    std::vector<MMseqsParameter*> kmerclust;
     std::vector<MMseqsParameter*> kmersearch;
     std::vector<MMseqsParameter*> countkmer;
     std::vector<MMseqsParameter*> easylinclustworkflow;
@@ -1102,6 +1136,7 @@ public:
     std::vector<MMseqsParameter*> renamedbkeys;
     std::vector<MMseqsParameter*> createtaxdb;
     std::vector<MMseqsParameter*> profile2pssm;
+    std::vector<MMseqsParameter*> createprofilelookup;
     std::vector<MMseqsParameter*> profile2seq;
     std::vector<MMseqsParameter*> besthitbyset;
     std::vector<MMseqsParameter*> combinepvalbyset;
@@ -0,0 +1,196 @@
+#include "ProfileLookup.h"
+#include "BaseMatrix.h"
+#include "Debug.h"
+#include "FileUtil.h"
+#include "Parameters.h"
+#include "Sequence.h"
+#include "Util.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+#include <vector>
+#include <sys/stat.h>
+
+#ifdef OPENMP
+#include <omp.h>
+#endif
+
+static const char PROFILE_LOOKUP_MAGIC[8] = {'M', 'M', 'S', 'P', 'R', 'O', 'F', 'L'};
+
+// followed by the offsets (entryCount + 1), the sorted keys (entryCount) and the decoded profiles
+struct ProfileLookupHeader {
+    char magic[8];
+    size_t fingerprint;
+    size_t entryCount;
+    size_t dataSize;
+    size_t alphabetSize;
+};
+
+static void writeOrDie(FILE *file, const void *data, size_t size, const std::string &fileName) {
+    if (size > 0 && fwrite(data, sizeof(char), size, file) != size) {
+        Debug(Debug::ERROR) << "Cannot write to file " << fileName << "\n";
+        EXIT(EXIT_FAILURE);
+    }
+}
+
+ProfileLookup::ProfileLookup() : mappedData(NULL), mappedSize(0), entryCount(0), alphabetSize(0),
+                                 offsets(NULL), keys(NULL), data(NULL) {}
+
+ProfileLookup::~ProfileLookup() {
+    if (mappedData != NULL) {
+        FileUtil::munmapData(mappedData, mappedSize);
+    }
+}
+
+// hash of the size and modification time of the data files
+size_t ProfileLookup::fingerprint(const std::string &profileDB) {
+    size_t hash = 14695981039346656037ULL;
+    std::vector<std::string> files = FileUtil::findDatafiles(profileDB.c_str());
+    hash = (hash ^ files.size()) * 1099511628211ULL;
+    for (size_t i = 0; i < files.size(); i++) {
+        struct stat st;
+        if (stat(files[i].c_str(), &st) != 0) {
+            Debug(Debug::ERROR) << "Cannot stat " << files[i] << "\n";
+            EXIT(EXIT_FAILURE);
+        }
+        hash = (hash ^ static_cast<size_t>(st.st_size)) * 1099511628211ULL;
+        hash = (hash ^ static_cast<size_t>(st.st_mtime)) * 1099511628211ULL;
+    }
+    return hash;
+}
+
+size_t ProfileLookup::fileSize(DBReader<unsigned int> &dbr, int alphabetSize) {
+    const size_t entryCount = dbr.getSize();
+    size_t size = sizeof(ProfileLookupHeader) + (entryCount + 1) * sizeof(size_t) + entryCount * sizeof(unsigned int);
+    for (size_t i = 0; i < entryCount; i++) {
+        size += Sequence::decodedProfileSize(alphabetSize, dbr.getSeqLen(i));
+    }
+    return size;
+}
+
+void ProfileLookup::write(const std::string &profileDB, DBReader<unsigned int> &dbr, BaseMatrix *subMat, int threads) {
+    const size_t entryCount = dbr.getSize();
+    std::vector<std::pair<unsigned int, size_t> > order(entryCount);
+    size_t maxSeqLen = 1;
+    for (size_t i = 0; i < entryCount; i++) {
+        order[i] = std::make_pair(dbr.getDbKey(i), i);
+        maxSeqLen = std::max(maxSeqLen, dbr.getSeqLen(i));
+    }
+    std::sort(order.begin(), order.end());
+
+    size_t *offsets = new size_t[entryCount + 1];
+    unsigned int *keys = new unsigned int[entryCount];
+    offsets[0] = 0;
+    for (size_t i = 0; i < entryCount; i++) {
+        keys[i] = order[i].first;
+        offsets[i + 1] = offsets[i] + Sequence::decodedProfileSize(subMat->alphabetSize, dbr.getSeqLen(order[i].second));
+    }
+    size_t maxBlockSize = 0;
+    for (size_t start = 0; start < entryCount; start += WRITE_BLOCK_SIZE) {
+        const size_t end = std::min(start + WRITE_BLOCK_SIZE, entryCount);
+        maxBlockSize = std::max(maxBlockSize, offsets[end] - offsets[start]);
+    }
+
+    const std::string lookupFile = fileName(profileDB);
+    const std::string tmpFileName = lookupFile + ".tmp";
+    FILE *file = FileUtil::openAndDelete(tmpFileName.c_str(), "wb");
+    ProfileLookupHeader header;
+    memcpy(header.magic, PROFILE_LOOKUP_MAGIC, sizeof(PROFILE_LOOKUP_MAGIC));
+    header.fingerprint = fingerprint(profileDB);
+    header.entryCount = entryCount;
+    header.dataSize = offsets[entryCount];
+    header.alphabetSize = subMat->alphabetSize;
+    writeOrDie(file, &header, sizeof(ProfileLookupHeader), tmpFileName);
+    writeOrDie(file, offsets, (entryCount + 1) * sizeof(size_t), tmpFileName);
+    writeOrDie(file, keys, entryCount * sizeof(unsigned int), tmpFileName);
+
+    // the profiles of a block are decoded in parallel and written in key order
+    char *buffer = static_cast<char *>(malloc(std::max(maxBlockSize, (size_t) 1)));
+    Util::checkAllocation(buffer, "Cannot allocate profile lookup buffer");
+    Debug::Progress progress(entryCount);
+#pragma omp parallel num_threads(threads)
+    {
+        unsigned int thread_idx = 0;
+#ifdef OPENMP
+        thread_idx = static_cast<unsigned int>(omp_get_thread_num());
+#endif
+        Sequence seq(maxSeqLen + 1, Parameters::DBTYPE_HMM_PROFILE, subMat, 0, false, false, false);
+        for (size_t start = 0; start < entryCount; start += WRITE_BLOCK_SIZE) {
+            const size_t end = std::min(start + WRITE_BLOCK_SIZE, entryCount);
+#pragma omp for schedule(dynamic, 64)
+            for (size_t i = start; i < end; i++) {
+                progress.updateProgress();
+                const size_t id = order[i].second;
+                seq.mapSequence(id, keys[i], dbr.getData(id, thread_idx), dbr.getSeqLen(id));
+                seq.writeDecodedProfile(buffer + (offsets[i] - offsets[start]));
+            }
+#pragma omp single
+            writeOrDie(file, buffer, offsets[end] - offsets[start], tmpFileName);
+        }
+    }
+    free(buffer);
+    delete[] offsets;
+    delete[] keys;
+
+    if (fclose(file) != 0) {
+        Debug(Debug::ERROR) << "Cannot close file " << tmpFileName << "\n";
+        EXIT(EXIT_FAILURE);
+    }
+    FileUtil::move(tmpFileName.c_str(), lookupFile.c_str());
+}
+
+bool ProfileLookup::open(const std::string &profileDB, int alphabetSize) {
+    const std::string lookupFile = fileName(profileDB);
+    if (FileUtil::fileExists(lookupFile.c_str()) == false) {
+        return false;
+    }
+    FILE *file = FileUtil::openFileOrDie(lookupFile.c_str(), "rb", true);
+    ProfileLookupHeader header;
+    bool valid = fread(&header, sizeof(ProfileLookupHeader), 1, file) == 1
+                 && memcmp(header.magic, PROFILE_LOOKUP_MAGIC, sizeof(PROFILE_LOOKUP_MAGIC)) == 0
+                 && header.alphabetSize == static_cast<size_t>(alphabetSize)
+                 && header.fingerprint == fingerprint(profileDB);
+    valid = valid && FileUtil::getFileSize(lookupFile) == sizeof(ProfileLookupHeader) + (header.entryCount + 1) * sizeof(size_t)
+                                                          + header.entryCount * sizeof(unsigned int) + header.dataSize;
+    if (valid) {
+        if (mappedData != NULL) {
+            FileUtil::munmapData(mappedData, mappedSize);
+        }
+        mappedData = FileUtil::mmapFile(file, &mappedSize);
+        const char *pos = static_cast<const char *>(mappedData) + sizeof(ProfileLookupHeader);
+        entryCount = header.entryCount;
+        this->alphabetSize = alphabetSize;
+        offsets = reinterpret_cast<const size_t *>(pos);
+        pos += (entryCount + 1) * sizeof(size_t);
+        keys = reinterpret_cast<const unsigned int *>(pos);
+        pos += entryCount * sizeof(unsigned int);
+        data = pos;
+    }
+    if (fclose(file) != 0) {
+        Debug(Debug::ERROR) << "Cannot close file " << lookupFile << "\n";
+        EXIT(EXIT_FAILURE);
+    }
+    if (valid) {
+        Debug(Debug::INFO) << "Use profile lookup " << lookupFile << "\n";
+    } else {
+        Debug(Debug::INFO) << "Profile lookup " << lookupFile << " was written for other data\n";
+    }
+    return valid;
+}
+
+bool ProfileLookup::mapProfile(Sequence &seq, size_t id, unsigned int dbKey, unsigned int seqLen) const {
+    if (mappedData == NULL) {
+        return false;
+    }
+    const unsigned int *key = std::lower_bound(keys, keys + entryCount, dbKey);
+    if (key == keys + entryCount || *key != dbKey) {
+        return false;
+    }
+    const size_t i = key - keys;
+    if (offsets[i + 1] - offsets[i] != Sequence::decodedProfileSize(alphabetSize, seqLen) || seqLen > seq.getMaxLen()) {
+        return false;
+    }
+    seq.mapDecodedProfile(id, dbKey, data + offsets[i], seqLen);
+    return true;
+}
@@ -0,0 +1,66 @@
+#ifndef MMSEQS_PROFILELOOKUP_H
+#define MMSEQS_PROFILELOOKUP_H
+
+// Decoded profiles of a profile database, stored in <profileDB>.profilelookup.
+//
+// Sequence::mapProfile converts the text columns of a profile every time it is read, in a
+// profile-profile search once per hit. The lookup holds every profile in the layout of
+// Sequence::writeDecodedProfile: the alignment profile that SmithWaterman::ssw_init and ssw_align
+// consume, the query and consensus (profile state) sequence, the gap penalties and Neff M.
+// The file is memory mapped, only the pages of the profiles that are aligned are read, so
+// a search over slices of the database reads each slice and not the whole database.
+//
+// Profiles are found by their key, so the lookup of a database also serves databases that
+// share its data file with a subset of its index. The lookup is only used if the data files
+// have the size and modification time they had when the lookup was written.
+
+#include "DBReader.h"
+
+#include <string>
+
+class BaseMatrix;
+class Sequence;
+
+class ProfileLookup {
+public:
+    ProfileLookup();
+    ~ProfileLookup();
+
+    // decodes all profiles of profileDB, the alignment profile depends on the alphabet size of subMat
+    static void write(const std::string &profileDB, DBReader<unsigned int> &dbr, BaseMatrix *subMat, int threads);
+
+    // size of the lookup file that write creates for dbr
+    static size_t fileSize(DBReader<unsigned int> &dbr, int alphabetSize);
+
+    // returns false if there is no lookup for profileDB or it was written for other data or another alphabet
+    bool open(const std::string &profileDB, int alphabetSize);
+
+    // maps the profile dbKey into seq and returns true if the lookup contains it with seqLen columns
+    // and it fits into seq, seq has to be created without k-mer size
+    bool mapProfile(Sequence &seq, size_t id, unsigned int dbKey, unsigned int seqLen) const;
+
+    size_t getSize() const {
+        return entryCount;
+    }
+
+    static std::string fileName(const std::string &profileDB) {
+        return profileDB + ".profilelookup";
+    }
+
+    // number of profiles that are decoded before they are written
+    static const size_t WRITE_BLOCK_SIZE = 16384;
+
+private:
+    void *mappedData;
+    size_t mappedSize;
+
+    size_t entryCount;
+    int alphabetSize;
+    const size_t *offsets;
+    const unsigned int *keys;
+    const char *data;
+
+    static size_t fingerprint(const std::string &profileDB);
+};
+
+#endif
@@ -0,0 +1,225 @@
+#ifndef RADIX_SORT_H
+#define RADIX_SORT_H
+
+// In-place MSD radix sort on a 64-bit key with a comparison sort for ties.
+//
+// key(x) must be consistent with comp: key(a) < key(b) implies comp(a, b) and
+// comp(a, b) implies key(a) <= key(b). The elements are partitioned byte by byte on the key,
+// starting at the highest byte in which the keys differ. Buckets that are small or share the
+// whole key are finished with std::sort and comp, so the result equals a sort by comp.
+//
+// The top level partition runs in parallel (speculative permutation and repair, as in PARADIS,
+// Cho et al. 2015), the buckets are then sorted independently by the threads.
+// No memory is allocated besides the histograms.
+
+#include <algorithm>
+#include <cstddef>
+#include <stdint.h>
+#include <vector>
+
+#ifdef OPENMP
+#include <omp.h>
+#endif
+
+namespace RadixSort {
+    const size_t BUCKETS = 256;
+    // below this size std::sort is faster than another radix pass
+    const size_t COMPARISON_SORT_THRESHOLD = 64;
+
+    template <typename T, typename Key>
+    struct DigitIsNot {
+        const Key &key;
+        const int shift;
+        const size_t bucket;
+        DigitIsNot(const Key &key, int shift, size_t bucket) : key(key), shift(shift), bucket(bucket) {}
+        bool operator()(const T &x) const {
+            return ((key(x) >> shift) & 0xFF) != bucket;
+        }
+    };
+
+    // American flag permutation of the elements in [heads[b], tails[b]) into their buckets
+    template <typename T, typename Key>
+    void permute(T *data, size_t *heads, const size_t *tails, int shift, const Key &key) {
+        for (size_t b = 0; b < BUCKETS; b++) {
+            while (heads[b] < tails[b]) {
+                T value = data[heads[b]];
+                size_t digit = (key(value) >> shift) & 0xFF;
+                while (digit != b) {
+                    std::swap(value, data[heads[digit]++]);
+                    digit = (key(value) >> shift) & 0xFF;
+                }
+                data[heads[b]++] = value;
+            }
+        }
+    }
+
+    template <typename T, typename Key, typename Compare>
+    void sortBucket(T *begin, T *end, int shift, const Key &key, const Compare &comp) {
+        size_t counts[BUCKETS];
+        size_t heads[BUCKETS];
+        size_t tails[BUCKETS];
+        while (true) {
+            const size_t n = end - begin;
+            if (n <= COMPARISON_SORT_THRESHOLD || shift < 0) {
+                std::sort(begin, end, comp);
+                return;
+            }
+            std::fill(counts, counts + BUCKETS, 0);
+            for (T *it = begin; it < end; ++it) {
+                counts[(key(*it) >> shift) & 0xFF]++;
+            }
+            // all elements share this byte
+            if (counts[(key(*begin) >> shift) & 0xFF] == n) {
+                shift -= 8;
+                continue;
+            }
+            size_t offset = 0;
+            for (size_t b = 0; b < BUCKETS; b++) {
+                heads[b] = offset;
+                offset += counts[b];
+                tails[b] = offset;
+            }
+            permute(begin, heads, tails, shift, key);
+            offset = 0;
+            for (size_t b = 0; b < BUCKETS; b++) {
+                if (counts[b] > 1) {
+                    sortBucket(begin + offset, begin + offset + counts[b], shift - 8, key, comp);
+                }
+                offset += counts[b];
+            }
+            return;
+        }
+    }
+
+    template <typename T, typename Key, typename Compare>
+    void sort(T *begin, T *end, Key key, Compare comp) {
+        const size_t n = end - begin;
+        if (n <= COMPARISON_SORT_THRESHOLD) {
+            std::sort(begin, end, comp);
+            return;
+        }
+
+        int threads = 1;
+#ifdef OPENMP
+        threads = std::max(1, std::min(omp_get_max_threads(), static_cast<int>(n / (COMPARISON_SORT_THRESHOLD * BUCKETS)) + 1));
+#endif
+
+        // the partition starts at the highest byte in which the keys differ
+        uint64_t minKey = UINT64_MAX;
+        uint64_t maxKey = 0;
+        std::vector<size_t> threadCounts(threads * BUCKETS, 0);
+#pragma omp parallel num_threads(threads)
+        {
+            uint64_t threadMin = UINT64_MAX;
+            uint64_t threadMax = 0;
+#pragma omp for schedule(static)
+            for (size_t i = 0; i < n; i++) {
+                const uint64_t k = key(begin[i]);
+                threadMin = std::min(threadMin, k);
+                threadMax = std::max(threadMax, k);
+            }
+#pragma omp critical
+            {
+                minKey = std::min(minKey, threadMin);
+                maxKey = std::max(maxKey, threadMax);
+            }
+        }
+        if (minKey == maxKey) {
+            std::sort(begin, end, comp);
+            return;
+        }
+        const int shift = ((63 - __builtin_clzll(minKey ^ maxKey)) / 8) * 8;
+
+#pragma omp parallel num_threads(threads)
+        {
+            int thread = 0;
+#ifdef OPENMP
+            thread = omp_get_thread_num();
+#endif
+            size_t *counts = &threadCounts[thread * BUCKETS];
+#pragma omp for schedule(static)
+            for (size_t i = 0; i < n; i++) {
+                counts[(key(begin[i]) >> shift) & 0xFF]++;
+            }
+        }
+
+        size_t bucketStart[BUCKETS + 1];
+        size_t heads[BUCKETS];
+        size_t tails[BUCKETS];
+        size_t offset = 0;
+        for (size_t b = 0; b < BUCKETS; b++) {
+            bucketStart[b] = offset;
+            heads[b] = offset;
+            for (int t = 0; t < threads; t++) {
+                offset += threadCounts[t * BUCKETS + b];
+            }
+            tails[b] = offset;
+        }
+        bucketStart[BUCKETS] = offset;
+
+        // each thread permutes within its stripe of every unfinished bucket range,
+        // the misplaced elements are then moved to the end of each range for the next round
+        size_t remaining = n;
+        while (threads > 1 && remaining > 0) {
+            std::vector<size_t> stripeHeads(threads * BUCKETS);
+            std::vector<size_t> stripeTails(threads * BUCKETS);
+            for (size_t b = 0; b < BUCKETS; b++) {
+                const size_t size = tails[b] - heads[b];
+                for (int t = 0; t < threads; t++) {
+                    stripeHeads[t * BUCKETS + b] = heads[b] + (size * t) / threads;
+                    stripeTails[t * BUCKETS + b] = heads[b] + (size * (t + 1)) / threads;
+                }
+            }
+#pragma omp parallel num_threads(threads)
+            {
+                int thread = 0;
+#ifdef OPENMP
+                thread = omp_get_thread_num();
+#endif
+                size_t *ph = &stripeHeads[thread * BUCKETS];
+                const size_t *pt = &stripeTails[thread * BUCKETS];
+                for (size_t b = 0; b < BUCKETS; b++) {
+                    size_t head = ph[b];
+                    while (head < pt[b]) {
+                        T value = begin[head];
+                        size_t digit = (key(value) >> shift) & 0xFF;
+                        while (digit != b && ph[digit] < pt[digit]) {
+                            std::swap(value, begin[ph[digit]++]);
+                            digit = (key(value) >> shift) & 0xFF;
+                        }
+                        if (digit == b) {
+                            begin[head++] = begin[ph[b]];
+                            begin[ph[b]++] = value;
+                        } else {
+                            begin[head++] = value;
+                        }
+                    }
+                }
+            }
+
+            size_t stillMisplaced = 0;
+#pragma omp parallel for schedule(dynamic, 1) num_threads(threads) reduction(+:stillMisplaced)
+            for (size_t b = 0; b < BUCKETS; b++) {
+                T *split = std::partition(begin + heads[b], begin + tails[b], DigitIsNot<T, Key>(key, shift, b));
+                // misplaced elements first, correct ones are done
+                tails[b] = split - begin;
+                stillMisplaced += tails[b] - heads[b];
+            }
+            if (stillMisplaced == remaining) {
+                // no progress, finish the partition serially
+                break;
+            }
+            remaining = stillMisplaced;
+        }
+        permute(begin, heads, tails, shift, key);
+
+#pragma omp parallel for schedule(dynamic, 1) num_threads(threads)
+        for (size_t b = 0; b < BUCKETS; b++) {
+            if (bucketStart[b + 1] - bucketStart[b] > 1) {
+                sortBucket(begin + bucketStart[b], begin + bucketStart[b + 1], shift - 8, key, comp);
+            }
+        }
+    }
+}
+
+#endif
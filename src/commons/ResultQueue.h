@@ -0,0 +1,140 @@
+#ifndef RESULT_QUEUE_H
+#define RESULT_QUEUE_H
+
+// Bounded lock-free multi-producer multi-consumer queue of per-query result entries.
+//
+// Passes the result of a query from the worker threads of one stage (e.g. the prefilter)
+// to the worker threads of the next stage (e.g. the alignment) without a database in between.
+// Each cell carries a sequence number that tells producers and consumers whose turn it is
+// (D. Vyukov's bounded queue), so push and pop only need one compare-and-swap each.
+// Entry strings are swapped in and out of the cells, their buffers circulate between the stages.
+//
+// push blocks while the queue is full, pop blocks while it is empty.
+// pop returns false once close was called and all entries are consumed.
+
+#include <cstddef>
+#include <string>
+#include <sched.h>
+
+class ResultQueue {
+public:
+    struct Entry {
+        unsigned int key;
+        std::string data;
+    };
+
+    explicit ResultQueue(size_t capacity) : enqueuePos(0), dequeuePos(0), closed(false) {
+        size_t size = 2;
+        while (size < capacity) {
+            size *= 2;
+        }
+        mask = size - 1;
+        cells = new Cell[size];
+        for (size_t i = 0; i < size; i++) {
+            cells[i].sequence = i;
+        }
+    }
+
+    ~ResultQueue() {
+        delete[] cells;
+    }
+
+    // data is swapped into the queue, it contains an unspecified recycled string afterwards
+    void push(unsigned int key, std::string &data) {
+        unsigned int spins = 0;
+        while (tryPush(key, data) == false) {
+            backoff(spins);
+        }
+    }
+
+    bool pop(Entry &entry) {
+        unsigned int spins = 0;
+        while (tryPop(entry) == false) {
+            if (__atomic_load_n(&closed, __ATOMIC_ACQUIRE)) {
+                // entries pushed before close are visible now
+                return tryPop(entry);
+            }
+            backoff(spins);
+        }
+        return true;
+    }
+
+    // called by the producer after its last push
+    void close() {
+        __atomic_store_n(&closed, true, __ATOMIC_RELEASE);
+    }
+
+private:
+    struct Cell {
+        size_t sequence;
+        Entry entry;
+    };
+
+    Cell *cells;
+    size_t mask;
+    // producer and consumer positions on separate cache lines
+    char pad0[64];
+    size_t enqueuePos;
+    char pad1[64];
+    size_t dequeuePos;
+    char pad2[64];
+    bool closed;
+
+    bool tryPush(unsigned int key, std::string &data) {
+        Cell *cell;
+        size_t pos = __atomic_load_n(&enqueuePos, __ATOMIC_RELAXED);
+        while (true) {
+            cell = &cells[pos & mask];
+            const size_t sequence = __atomic_load_n(&cell->sequence, __ATOMIC_ACQUIRE);
+            const ptrdiff_t diff = static_cast<ptrdiff_t>(sequence) - static_cast<ptrdiff_t>(pos);
+            if (diff == 0) {
+                if (__atomic_compare_exchange_n(&enqueuePos, &pos, pos + 1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                // full
+                return false;
+            } else {
+                pos = __atomic_load_n(&enqueuePos, __ATOMIC_RELAXED);
+            }
+        }
+        cell->entry.key = key;
+        cell->entry.data.swap(data);
+        __atomic_store_n(&cell->sequence, pos + 1, __ATOMIC_RELEASE);
+        return true;
+    }
+
+    bool tryPop(Entry &entry) {
+        Cell *cell;
+        size_t pos = __atomic_load_n(&dequeuePos, __ATOMIC_RELAXED);
+        while (true) {
+            cell = &cells[pos & mask];
+            const size_t sequence = __atomic_load_n(&cell->sequence, __ATOMIC_ACQUIRE);
+            const ptrdiff_t diff = static_cast<ptrdiff_t>(sequence) - static_cast<ptrdiff_t>(pos + 1);
+            if (diff == 0) {
+                if (__atomic_compare_exchange_n(&dequeuePos, &pos, pos + 1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                // empty
+                return false;
+            } else {
+                pos = __atomic_load_n(&dequeuePos, __ATOMIC_RELAXED);
+            }
+        }
+        entry.key = cell->entry.key;
+        entry.data.swap(cell->entry.data);
+        __atomic_store_n(&cell->sequence, pos + mask + 1, __ATOMIC_RELEASE);
+        return true;
+    }
+
+    static void backoff(unsigned int &spins) {
+        if (spins < 64) {
+            spins++;
+        } else {
+            sched_yield();
+        }
+    }
+};
+
+#endif
@@ -284,6 +284,49 @@ void Sequence::mapProfile(const char * profileData, unsigned int seqLen){
     }
 }
 
+void Sequence::mapDecodedProfile(size_t id, unsigned int dbKey, const char *data, unsigned int seqLen) {
+    if (this->kmerSize != 0) {
+        Debug(Debug::ERROR) << "Decoded profiles do not contain the k-mer data of the prefilter\n";
+        EXIT(EXIT_FAILURE);
+    }
+    if (seqLen > maxLen) {
+        Debug(Debug::ERROR) << "Decoded profile " << dbKey << " is longer than max seq. len " << maxLen << "\n";
+        EXIT(EXIT_FAILURE);
+    }
+    this->id = id;
+    this->dbKey = dbKey;
+    this->seqData = NULL;
+    this->L = seqLen;
+    const size_t alignmentProfileSize = static_cast<size_t>(subMat->alphabetSize) * this->L;
+    memcpy(profile_for_alignment, data, alignmentProfileSize);
+    data += alignmentProfileSize;
+    memcpy(numSequence, data, this->L);
+    data += this->L;
+    memcpy(numConsensusSequence, data, this->L);
+    data += this->L;
+    memcpy(gDel, data, this->L);
+    data += this->L;
+    memcpy(gIns, data, this->L);
+    data += this->L;
+    memcpy(neffM, data, this->L * sizeof(float));
+    currItPos = -1;
+}
+
+void Sequence::writeDecodedProfile(char *data) const {
+    const size_t alignmentProfileSize = static_cast<size_t>(subMat->alphabetSize) * this->L;
+    memcpy(data, profile_for_alignment, alignmentProfileSize);
+    data += alignmentProfileSize;
+    memcpy(data, numSequence, this->L);
+    data += this->L;
+    memcpy(data, numConsensusSequence, this->L);
+    data += this->L;
+    memcpy(data, gDel, this->L);
+    data += this->L;
+    memcpy(data, gIns, this->L);
+    data += this->L;
+    memcpy(data, neffM, this->L * sizeof(float));
+}
+
 void Sequence::nextProfileKmer() {
     int pos = 0;
     for (int i = 0; i < spacedPatternSize; i++) {
@@ -88,6 +88,17 @@ public:
     // map profile HMM, *data points to start position of Profile
     void mapProfile(const char *profileData, unsigned int seqLen);
 
+    // map a decoded profile (see ProfileLookup), only sets the data that is needed for the alignment
+    void mapDecodedProfile(size_t id, unsigned int dbKey, const char *data, unsigned int seqLen);
+
+    // writes the profile that was mapped last in the layout of mapDecodedProfile:
+    // alignment profile (alphabetSize * L), query and consensus sequence, gap penalties (L each) and Neff M (L floats)
+    void writeDecodedProfile(char *data) const;
+
+    static size_t decodedProfileSize(int alphabetSize, unsigned int seqLen) {
+        return static_cast<size_t>(seqLen) * (alphabetSize + 4 + sizeof(float));
+    }
+
     // checks if there is still a k-mer left
     bool hasNextKmer() {
         return (((currItPos + 1) + this->spacedPatternSize) <= this->L);
@@ -15,44 +15,18 @@
 #endif
 
 #include "simd.h"
-#include "MemoryMapped.h"
 #include "MemoryTracker.h"
+#include "HugePageMemory.h"
 #include <algorithm>
 #include <sys/mman.h>
+#include <cstdio>
+#include <stdint.h>
 #include <fstream>      // std::ifstream
 
 #ifdef OPENMP
 #include <omp.h>
 #endif
 
-int Util::readMapping(std::string mappingFilename, std::vector<std::pair<unsigned int, unsigned int>> & mapping){
-    MemoryMapped indexData(mappingFilename, MemoryMapped::WholeFile, MemoryMapped::SequentialScan);
-    if (!indexData.isValid()){
-        Debug(Debug::ERROR) << "Could not open index file " << mappingFilename << "\n";
-        EXIT(EXIT_FAILURE);
-    }
-
-    size_t currPos = 0;
-    char* indexDataChar = (char *) indexData.getData();
-    const char* cols[3];
-    size_t isSorted = true;
-    unsigned int prevId=0;
-    while (currPos < indexData.size()){
-        Util::getWordsOfLine(indexDataChar, cols, 2 );
-        unsigned int id = Util::fast_atoi<size_t>(cols[0]);
-        isSorted *= (id >= prevId);
-        unsigned int taxid = Util::fast_atoi<size_t>(cols[1]);
-        indexDataChar = Util::skipLine(indexDataChar);
-        mapping.push_back(std::make_pair(id, taxid));
-        currPos = indexDataChar - (char *) indexData.getData();
-
-        prevId = id;
-    }
-    indexData.close();
-
-    return isSorted;
-}
-
 size_t Util::countLines(const char *data, size_t length) {
     size_t newlines = 0;
     for (size_t i = 0; i < length; i++ ) {
@@ -299,18 +273,122 @@ size_t Util::getTotalMemoryPages() {
     return phys_pages;
 }
 
+#ifdef __linux__
+// smallest limit in the limit files of the cgroup at path and all of its ancestors,
+// a child can set a larger limit than its parent but cannot use more memory than the parent
+static size_t getCgroupHierarchyLimit(const std::string &mount, std::string path, const std::string &limitName) {
+    size_t minLimit = SIZE_MAX;
+    while (true) {
+        std::ifstream limitFile((mount + path + "/" + limitName).c_str());
+        std::string value;
+        if (limitFile >> value) {
+            // v2 reports an unset limit as "max", v1 as a huge page aligned LONG_MAX
+            char *end;
+            unsigned long long limit = strtoull(value.c_str(), &end, 10);
+            if (*end == '\0' && end != value.c_str()) {
+                minLimit = std::min(minLimit, static_cast<size_t>(limit));
+            }
+        }
+        if (path.empty() || path == "/") {
+            break;
+        }
+        path = path.substr(0, path.rfind('/'));
+    }
+    return minLimit;
+}
+#endif
+
+// memory limit of the cgroups (v2 or v1) of this process in bytes, SIZE_MAX if there is none
+static size_t getCgroupMemoryLimit() {
+    size_t minLimit = SIZE_MAX;
+#ifdef __linux__
+    std::ifstream cgroups("/proc/self/cgroup");
+    std::string line;
+    while (std::getline(cgroups, line)) {
+        // v2 entries look like "0::/path", v1 like "4:memory:/path"
+        size_t first = line.find(':');
+        size_t second = line.find(':', first + 1);
+        if (first == std::string::npos || second == std::string::npos) {
+            continue;
+        }
+        std::string controllers = line.substr(first + 1, second - first - 1);
+        std::string path = line.substr(second + 1);
+        if (controllers.empty()) {
+            minLimit = std::min(minLimit, getCgroupHierarchyLimit("/sys/fs/cgroup", path, "memory.max"));
+        } else if (controllers == "memory" || controllers.find("memory,") != std::string::npos
+                   || controllers.find(",memory") != std::string::npos) {
+            minLimit = std::min(minLimit, getCgroupHierarchyLimit("/sys/fs/cgroup/memory", path, "memory.limit_in_bytes"));
+        }
+    }
+    // inside of a cgroup namespace the own cgroup is mounted as root
+    minLimit = std::min(minLimit, getCgroupHierarchyLimit("/sys/fs/cgroup", "", "memory.max"));
+    minLimit = std::min(minLimit, getCgroupHierarchyLimit("/sys/fs/cgroup/memory", "", "memory.limit_in_bytes"));
+#endif
+    return minLimit;
+}
+
 // in bytes
 size_t Util::getTotalSystemMemory() {
     // check for real physical memory
     long pages = getTotalMemoryPages();
     long page_size = getPageSize();
     uint64_t sysMemory = pages * page_size;
-    // check for ulimit
-//    struct rlimit limit;
-//    getrlimit(RLIMIT_MEMLOCK, &limit);
+    // reserved huge pages can only be used by explicit huge page mappings
+    sysMemory -= std::min(static_cast<uint64_t>(HugePageMemory::reservedPoolBytes()), sysMemory);
+    // containers and batch systems restrict the memory through cgroups
+    static size_t cgroupLimit = getCgroupMemoryLimit();
+    sysMemory = std::min(sysMemory, static_cast<uint64_t>(cgroupLimit));
     return sysMemory;
 }
 
+void Util::resetPeakResidentMemory() {
+#ifdef __linux__
+    // writing 5 to clear_refs resets VmHWM (Linux 4.0+)
+    FILE *file = fopen("/proc/self/clear_refs", "w");
+    if (file != NULL) {
+        fputs("5", file);
+        fclose(file);
+    }
+#endif
+}
+
+size_t Util::getPeakResidentMemory() {
+#ifdef __linux__
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        size_t kb;
+        if (sscanf(line.c_str(), "VmHWM: %zu kB", &kb) == 1) {
+            return kb * 1024;
+        }
+    }
+#endif
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+#ifdef __APPLE__
+    return usage.ru_maxrss;
+#else
+    return usage.ru_maxrss * 1024;
+#endif
+}
+
+size_t Util::getResidentFileMemory() {
+    size_t total = 0;
+#ifdef __linux__
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        size_t kb;
+        if (sscanf(line.c_str(), "RssFile: %zu kB", &kb) == 1 || sscanf(line.c_str(), "RssShmem: %zu kB", &kb) == 1) {
+            total += kb * 1024;
+        }
+    }
+#endif
+    return total;
+}
+
 uint64_t Util::getL2CacheSize() {
 #if defined(__APPLE__)
     int64_t cachesize;
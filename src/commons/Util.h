@@ -81,19 +81,25 @@ public:
 
     static void rankedDescSort20(short *val, unsigned int *index);
 
+    // physical memory without the reserved huge page pool, restricted by the cgroup memory limit
     static size_t getTotalSystemMemory();
     static size_t getPageSize();
     static size_t getTotalMemoryPages();
     static uint64_t getL2CacheSize();
 
+    // peak resident set size of this process in bytes since the start or the last reset
+    static size_t getPeakResidentMemory();
+    // the reset is only supported on Linux, otherwise the peak of the whole process is reported
+    static void resetPeakResidentMemory();
+    // resident pages of mapped files and shared memory in bytes (RssFile + RssShmem), 0 if unknown
+    static size_t getResidentFileMemory();
+
     static char touchMemory(const char* memory, size_t size);
 
     static size_t countLines(const char *data, size_t length);
 
     static size_t ompCountLines(const char *data, size_t length, unsigned int threads);
 
-    static int readMapping(std::string mappingFilename, std::vector<std::pair<unsigned int, unsigned int> > & mapping);
-
     template<typename T>
     static inline T fast_atoi( const char * str )
     {
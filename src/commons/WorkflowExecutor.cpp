@@ -0,0 +1,262 @@
+#include "WorkflowExecutor.h"
+#include "Command.h"
+#include "Parameters.h"
+#include "PrefilteringIndexReader.h"
+#include "FileUtil.h"
+#include "Debug.h"
+#include "Util.h"
+
+#include <iostream>
+#include <set>
+#include <typeinfo>
+
+extern std::vector<Command> commands;
+extern std::vector<Command> baseCommands;
+
+std::vector<WorkflowExecutor::SharedDatabase> WorkflowExecutor::sharedDatabases;
+
+namespace {
+template <typename T>
+struct ValueCopy {
+    static void *save(const void *value) {
+        return new T(*static_cast<const T *>(value));
+    }
+    static void restore(void *value, const void *copy) {
+        *static_cast<T *>(value) = *static_cast<const T *>(copy);
+    }
+    static void destroy(void *copy) {
+        delete static_cast<T *>(copy);
+    }
+};
+
+struct SavedParameter {
+    MMseqsParameter *param;
+    bool wasSet;
+    void *copy;
+    void (*restore)(void *, const void *);
+    void (*destroy)(void *);
+};
+
+template <typename T>
+SavedParameter saveValue(MMseqsParameter *param) {
+    SavedParameter saved = { param, param->wasSet, ValueCopy<T>::save(param->value), &ValueCopy<T>::restore, &ValueCopy<T>::destroy };
+    return saved;
+}
+
+#define DATABASE_FIELDS(p) { \
+    &p.db1, &p.db1Index, &p.db1dbtype, &p.hdr1, &p.hdr1Index, &p.hdr1dbtype, \
+    &p.db2, &p.db2Index, &p.db2dbtype, &p.hdr2, &p.hdr2Index, &p.hdr2dbtype, \
+    &p.db3, &p.db3Index, &p.db3dbtype, &p.hdr3, &p.hdr3Index, &p.hdr3dbtype, \
+    &p.db4, &p.db4Index, &p.db4dbtype, &p.hdr4, &p.hdr4Index, &p.hdr4dbtype, \
+    &p.db5, &p.db5Index, &p.db5dbtype, &p.hdr5, &p.hdr5Index, &p.hdr5dbtype, \
+    &p.db6, &p.db6Index, &p.db6dbtype, &p.hdr6, &p.hdr6Index, &p.hdr6dbtype }
+const size_t DATABASE_FIELD_COUNT = 36;
+
+// values of all parameters of the binary and the database names of the caller
+// a module parses its arguments into the same Parameters singleton as its caller
+class SavedParameters {
+public:
+    explicit SavedParameters(Parameters &par) : par(par), restArgv(par.restArgv), restArgc(par.restArgc), filenames(par.filenames) {
+        addCommands(commands);
+        addCommands(baseCommands);
+        std::string *databases[] = DATABASE_FIELDS(par);
+        for (size_t i = 0; i < DATABASE_FIELD_COUNT; ++i) {
+            databaseNames.push_back(*databases[i]);
+        }
+    }
+
+    ~SavedParameters() {
+        for (size_t i = 0; i < saved.size(); ++i) {
+            saved[i].destroy(saved[i].copy);
+        }
+    }
+
+    void restore() {
+        for (size_t i = 0; i < saved.size(); ++i) {
+            saved[i].restore(saved[i].param->value, saved[i].copy);
+            saved[i].param->wasSet = saved[i].wasSet;
+        }
+        par.restArgv = restArgv;
+        par.restArgc = restArgc;
+        par.filenames = filenames;
+        std::string *databases[] = DATABASE_FIELDS(par);
+        for (size_t i = 0; i < DATABASE_FIELD_COUNT; ++i) {
+            *databases[i] = databaseNames[i];
+        }
+    }
+
+private:
+    void addCommands(const std::vector<Command> &list) {
+        for (size_t i = 0; i < list.size(); ++i) {
+            if (list[i].params == NULL) {
+                continue;
+            }
+            const std::vector<MMseqsParameter *> &params = *list[i].params;
+            for (size_t j = 0; j < params.size(); ++j) {
+                add(params[j]);
+            }
+        }
+    }
+
+    void add(MMseqsParameter *param) {
+        // parameters are shared between the parameter lists of the commands
+        if (seen.insert(param).second == false) {
+            return;
+        }
+        const std::type_info &type = param->type;
+        if (type == typeid(int)) {
+            saved.push_back(saveValue<int>(param));
+        } else if (type == typeid(size_t) || type == typeid(ByteParser)) {
+            saved.push_back(saveValue<size_t>(param));
+        } else if (type == typeid(float)) {
+            saved.push_back(saveValue<float>(param));
+        } else if (type == typeid(double)) {
+            saved.push_back(saveValue<double>(param));
+        } else if (type == typeid(bool)) {
+            saved.push_back(saveValue<bool>(param));
+        } else if (type == typeid(std::string)) {
+            saved.push_back(saveValue<std::string>(param));
+        } else if (type == typeid(MultiParam<NuclAA<std::string>>)) {
+            saved.push_back(saveValue<MultiParam<NuclAA<std::string>>>(param));
+        } else if (type == typeid(MultiParam<NuclAA<int>>)) {
+            saved.push_back(saveValue<MultiParam<NuclAA<int>>>(param));
+        } else if (type == typeid(MultiParam<NuclAA<float>>)) {
+            saved.push_back(saveValue<MultiParam<NuclAA<float>>>(param));
+        } else if (type == typeid(MultiParam<SeqProf<int>>)) {
+            saved.push_back(saveValue<MultiParam<SeqProf<int>>>(param));
+        } else if (type == typeid(MultiParam<PseudoCounts>)) {
+            saved.push_back(saveValue<MultiParam<PseudoCounts>>(param));
+        } else {
+            Debug(Debug::ERROR) << "Wrong parameter type. Please inform the developers!\n";
+            EXIT(EXIT_FAILURE);
+        }
+    }
+
+    Parameters &par;
+    std::vector<SavedParameter> saved;
+    std::set<MMseqsParameter *> seen;
+    const char **restArgv;
+    int restArgc;
+    std::vector<std::string> filenames;
+    std::vector<std::string> databaseNames;
+};
+#undef DATABASE_FIELDS
+}
+
+WorkflowExecutor::WorkflowExecutor() : executedSteps(0) {}
+
+WorkflowExecutor::~WorkflowExecutor() {
+    for (size_t i = 0; i < sharedDatabases.size(); ++i) {
+        SharedDatabase &shared = sharedDatabases[i];
+        if (shared.sequenceReader != shared.reader) {
+            shared.sequenceReader->close();
+            delete shared.sequenceReader;
+        }
+        shared.reader->close();
+        delete shared.reader;
+    }
+    sharedDatabases.clear();
+}
+
+bool WorkflowExecutor::dbExists(const std::string &db) {
+    return FileUtil::fileExists((db + ".dbtype").c_str());
+}
+
+std::vector<std::string> WorkflowExecutor::makeArguments(const std::vector<std::string> &files, const std::string &parameters) {
+    std::vector<std::string> args(files);
+    std::vector<std::string> words = Util::split(parameters, " ");
+    for (size_t i = 0; i < words.size(); ++i) {
+        if (words[i].empty() == false) {
+            args.push_back(words[i]);
+        }
+    }
+    return args;
+}
+
+void WorkflowExecutor::runModule(const char *module, const std::vector<std::string> &args) {
+    Command *command = getCommandByName(module);
+    if (command == NULL) {
+        Debug(Debug::ERROR) << "Workflow module " << module << " does not exist\n";
+        EXIT(EXIT_FAILURE);
+    }
+
+    // a fresh module starts from the defaults and sees none of the parameters as set
+    Parameters &par = Parameters::getInstance();
+    SavedParameters callerParameters(par);
+    par.setDefaults();
+    std::vector<MMseqsParameter*> &params = *command->params;
+    for (size_t i = 0; i < params.size(); ++i) {
+        params[i]->wasSet = false;
+    }
+
+    const char **argv = new const char*[args.size() + 1];
+    for (size_t i = 0; i < args.size(); ++i) {
+        argv[i] = args[i].c_str();
+    }
+    argv[args.size()] = NULL;
+
+    std::cerr.flush();
+    std::cout.flush();
+    const int status = runCommand(command, static_cast<int>(args.size()), argv);
+    delete[] argv;
+    if (status != EXIT_SUCCESS) {
+        Debug(Debug::ERROR) << "Workflow module " << module << " failed\n";
+        EXIT(EXIT_FAILURE);
+    }
+    callerParameters.restore();
+    executedSteps++;
+}
+
+void WorkflowExecutor::runStep(const char *module, const std::vector<std::string> &args, const std::string &outputDb) {
+    if (dbExists(outputDb)) {
+        return;
+    }
+    runModule(module, args);
+}
+
+void WorkflowExecutor::shareDatabase(const std::string &db, int threads) {
+    if (getSharedReader(db) != NULL) {
+        return;
+    }
+    SharedDatabase shared;
+    shared.name = db;
+    shared.reader = new DBReader<unsigned int>(db.c_str(), (db + ".index").c_str(), threads, DBReader<unsigned int>::USE_INDEX | DBReader<unsigned int>::USE_DATA);
+    if (Parameters::isEqualDbtype(FileUtil::parseDbType(db.c_str()), Parameters::DBTYPE_INDEX_DB)) {
+        shared.reader->open(DBReader<unsigned int>::NOSORT);
+        if (PrefilteringIndexReader::checkIfIndexFile(shared.reader) == false) {
+            // outdated indices are handled by each module
+            shared.reader->close();
+            delete shared.reader;
+            return;
+        }
+        shared.sequenceReader = PrefilteringIndexReader::openNewReader(shared.reader, PrefilteringIndexReader::DBR1DATA, PrefilteringIndexReader::DBR1INDEX, true, threads, false, false);
+        if (shared.sequenceReader == NULL) {
+            shared.reader->close();
+            delete shared.reader;
+            return;
+        }
+    } else {
+        // same access as the prefilter, which reads all target sequences in order
+        shared.reader->open(DBReader<unsigned int>::LINEAR_ACCCESS);
+        shared.sequenceReader = shared.reader;
+    }
+    sharedDatabases.push_back(shared);
+}
+
+DBReader<unsigned int> *WorkflowExecutor::getSharedReader(const std::string &db) {
+    for (size_t i = 0; i < sharedDatabases.size(); ++i) {
+        if (sharedDatabases[i].name == db) {
+            return sharedDatabases[i].reader;
+        }
+    }
+    return NULL;
+}
+
+DBReader<unsigned int> *WorkflowExecutor::getSharedSequenceReader(const std::string &db) {
+    for (size_t i = 0; i < sharedDatabases.size(); ++i) {
+        if (sharedDatabases[i].name == db) {
+            return sharedDatabases[i].sequenceReader;
+        }
+    }
+    return NULL;
+}
@@ -0,0 +1,66 @@
+#ifndef WORKFLOW_EXECUTOR_H
+#define WORKFLOW_EXECUTOR_H
+
+// Runs the steps of a workflow as module calls inside the calling process.
+//
+// The workflow shell scripts re-exec the binary for every step. The executor instead looks up
+// the registered command and calls it directly, avoiding the process start, the shell and the
+// environment round trip for every step. Parameters are reset to their defaults before each step,
+// so a step sees the same state as a freshly started module. The parameters of the caller are
+// restored once the step finished.
+//
+// Databases that every step reads (e.g. the target database or its index) can be shared: they
+// are opened once and stay mapped until the executor is destroyed. The prefilter and the alignment
+// take a shared database instead of opening it again.
+//
+// Steps keep the restart semantics of the scripts: a step is skipped if the .dbtype file of its
+// output database exists already.
+
+#include "DBReader.h"
+
+#include <string>
+#include <vector>
+
+class WorkflowExecutor {
+public:
+    WorkflowExecutor();
+    ~WorkflowExecutor();
+
+    // same check as notExists "$DB.dbtype" in the workflow scripts
+    static bool dbExists(const std::string &db);
+
+    // arguments are the positional arguments followed by a parameter string created
+    // with Parameters::createParameterString
+    static std::vector<std::string> makeArguments(const std::vector<std::string> &files, const std::string &parameters);
+
+    // runs a registered module, exits on failure like the scripts do
+    void runModule(const char *module, const std::vector<std::string> &args);
+
+    // runs the module only if outputDb does not exist yet
+    void runStep(const char *module, const std::vector<std::string> &args, const std::string &outputDb);
+
+    // opens db for all following steps, db is either a sequence database or a precomputed index
+    void shareDatabase(const std::string &db, int threads);
+
+    // reader of a shared database as it was passed to shareDatabase, NULL if db is not shared
+    static DBReader<unsigned int> *getSharedReader(const std::string &db);
+
+    // sequences of a shared database, for an index these are the sequences stored in the index
+    static DBReader<unsigned int> *getSharedSequenceReader(const std::string &db);
+
+    size_t getExecutedSteps() const {
+        return executedSteps;
+    }
+
+private:
+    struct SharedDatabase {
+        std::string name;
+        DBReader<unsigned int> *reader;
+        DBReader<unsigned int> *sequenceReader;
+    };
+    static std::vector<SharedDatabase> sharedDatabases;
+
+    size_t executedSteps;
+};
+
+#endif
@@ -0,0 +1,246 @@
+#include "KmerSplitFile.h"
+#include "FileUtil.h"
+#include "Debug.h"
+#include "Util.h"
+
+#include <climits>
+#include <sys/stat.h>
+#include <sys/mman.h>
+
+static inline void appendVarint(std::string &out, size_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<char>(value));
+}
+
+static inline size_t readVarint(const unsigned char *&in) {
+    size_t value = 0;
+    unsigned int shift = 0;
+    while (*in & 0x80) {
+        value |= static_cast<size_t>(*in & 0x7F) << shift;
+        shift += 7;
+        in++;
+    }
+    value |= static_cast<size_t>(*in) << shift;
+    in++;
+    return value;
+}
+
+KmerSplitWriter::KmerSplitWriter() : setEntries(0), setRepSeq(0), lastRepSeq(0), lastId(0), writing(false) {}
+
+KmerSplitWriter::~KmerSplitWriter() {
+    finish();
+}
+
+void KmerSplitWriter::startSet(unsigned int repSeq) {
+    endSet();
+    setRepSeq = repSeq;
+    lastId = 0;
+}
+
+void KmerSplitWriter::addEntry(unsigned int id, short diagonal, unsigned char score, bool reverse) {
+    appendVarint(setBuffer, id - lastId);
+    lastId = id;
+    const int diag = diagonal;
+    const unsigned int zigzag = (static_cast<unsigned int>(diag) << 1) ^ static_cast<unsigned int>(diag >> 31);
+    appendVarint(setBuffer, (static_cast<size_t>(zigzag) << 1) | (reverse ? 1 : 0));
+    setBuffer.push_back(static_cast<char>(score));
+    setEntries++;
+}
+
+void KmerSplitWriter::endSet() {
+    // sets without entries are dropped
+    if (setEntries == 0) {
+        return;
+    }
+    appendVarint(buffer, setRepSeq - lastRepSeq);
+    lastRepSeq = setRepSeq;
+    appendVarint(buffer, setEntries);
+    buffer.append(setBuffer);
+    setBuffer.clear();
+    setEntries = 0;
+}
+
+void KmerSplitWriter::write(const std::string &fileName) {
+    endSet();
+    finish();
+    writeBuffer.swap(buffer);
+    writeFileName = fileName;
+    buffer.clear();
+    lastRepSeq = 0;
+    lastId = 0;
+#ifdef HAVE_PTHREADS
+    if (pthread_create(&thread, NULL, run, this) == 0) {
+        writing = true;
+        return;
+    }
+    Debug(Debug::WARNING) << "Could not start writer thread for " << fileName << "\n";
+#endif
+    writeFile();
+}
+
+void KmerSplitWriter::finish() {
+    if (writing == false) {
+        return;
+    }
+#ifdef HAVE_PTHREADS
+    pthread_join(thread, NULL);
+#endif
+    writing = false;
+}
+
+void *KmerSplitWriter::run(void *arg) {
+    KmerSplitWriter *writer = static_cast<KmerSplitWriter *>(arg);
+    writer->writeFile();
+    return NULL;
+}
+
+void KmerSplitWriter::writeFile() {
+    FILE *file = FileUtil::openAndDelete(writeFileName.c_str(), "wb");
+    if (writeBuffer.empty() == false && fwrite(writeBuffer.data(), sizeof(char), writeBuffer.size(), file) != writeBuffer.size()) {
+        Debug(Debug::ERROR) << "Cannot write to file " << writeFileName << "\n";
+        EXIT(EXIT_FAILURE);
+    }
+    if (fclose(file) != 0) {
+        Debug(Debug::ERROR) << "Cannot close file " << writeFileName << "\n";
+        EXIT(EXIT_FAILURE);
+    }
+    std::string().swap(writeBuffer);
+
+    std::string doneFileName = writeFileName + ".done";
+    FILE *done = FileUtil::openFileOrDie(doneFileName.c_str(), "w", false);
+    if (fclose(done) != 0) {
+        Debug(Debug::ERROR) << "Cannot close file " << doneFileName << "\n";
+        EXIT(EXIT_FAILURE);
+    }
+}
+
+void KmerSplitMerger::Cursor::next() {
+    if (remaining == 0) {
+        if (inSet) {
+            // close the set of the rep. sequence
+            current = FileKmerPosition(repSeq, UINT_MAX, 0, 0, current.file);
+            inSet = false;
+            return;
+        }
+        if (pos >= end) {
+            done = true;
+            return;
+        }
+        repSeq += readVarint(pos);
+        remaining = readVarint(pos);
+        lastId = 0;
+        inSet = true;
+    }
+    lastId += static_cast<unsigned int>(readVarint(pos));
+    const size_t value = readVarint(pos);
+    const unsigned int zigzag = static_cast<unsigned int>(value >> 1);
+    const short diagonal = static_cast<short>((zigzag >> 1) ^ (0u - (zigzag & 1)));
+    const unsigned char score = *pos;
+    pos++;
+    current = FileKmerPosition(repSeq, lastId, diagonal, score, static_cast<char>(value & 1), current.file);
+    remaining--;
+}
+
+KmerSplitMerger::KmerSplitMerger(const std::vector<std::string> &files) {
+    const size_t fileCnt = files.size();
+    data.resize(fileCnt, NULL);
+    dataSizes.resize(fileCnt, 0);
+    cursors.resize(fileCnt);
+    for (size_t i = 0; i < fileCnt; i++) {
+        FILE *file = FileUtil::openFileOrDie(files[i].c_str(), "r", true);
+        struct stat sb;
+        fstat(fileno(file), &sb);
+        if (sb.st_size > 0) {
+            data[i] = FileUtil::mmapFile(file, &dataSizes[i]);
+#if HAVE_POSIX_MADVISE
+            if (posix_madvise(data[i], dataSizes[i], POSIX_MADV_SEQUENTIAL) != 0) {
+                Debug(Debug::ERROR) << "posix_madvise returned an error for file " << files[i] << "\n";
+            }
+#endif
+        }
+        if (fclose(file) != 0) {
+            Debug(Debug::ERROR) << "Cannot close file " << files[i] << "\n";
+            EXIT(EXIT_FAILURE);
+        }
+
+        Cursor &cursor = cursors[i];
+        cursor.pos = static_cast<const unsigned char *>(data[i]);
+        cursor.end = cursor.pos + dataSizes[i];
+        cursor.repSeq = 0;
+        cursor.remaining = 0;
+        cursor.lastId = 0;
+        cursor.inSet = false;
+        cursor.done = false;
+        cursor.current.file = static_cast<unsigned int>(i);
+        cursor.next();
+    }
+
+    // leaves are padded to a power of two with exhausted cursors
+    leaves = 1;
+    while (leaves < fileCnt) {
+        leaves *= 2;
+    }
+    tree.resize(leaves);
+    std::vector<size_t> winners(2 * leaves);
+    for (size_t i = 0; i < leaves; i++) {
+        winners[leaves + i] = i;
+    }
+    for (size_t node = leaves - 1; node >= 1; node--) {
+        const size_t left = winners[2 * node];
+        const size_t right = winners[2 * node + 1];
+        if (less(right, left)) {
+            winners[node] = right;
+            tree[node] = left;
+        } else {
+            winners[node] = left;
+            tree[node] = right;
+        }
+    }
+    tree[0] = winners[1];
+}
+
+KmerSplitMerger::~KmerSplitMerger() {
+    for (size_t i = 0; i < data.size(); i++) {
+        if (dataSizes[i] > 0 && munmap(data[i], dataSizes[i]) < 0) {
+            Debug(Debug::ERROR) << "Failed to munmap memory dataSize=" << dataSizes[i] << "\n";
+            EXIT(EXIT_FAILURE);
+        }
+    }
+}
+
+void KmerSplitMerger::pop() {
+    size_t winner = tree[0];
+    cursors[winner].next();
+    // replay the matches on the path from the leaf to the root
+    for (size_t node = (leaves + winner) / 2; node >= 1; node /= 2) {
+        if (less(tree[node], winner)) {
+            std::swap(tree[node], winner);
+        }
+    }
+    tree[0] = winner;
+}
+
+// orders by rep. sequence, target id and diagonal, ties are resolved by file
+bool KmerSplitMerger::less(size_t a, size_t b) const {
+    if (isDone(a)) {
+        return false;
+    }
+    if (isDone(b)) {
+        return true;
+    }
+    const FileKmerPosition &first = cursors[a].current;
+    const FileKmerPosition &second = cursors[b].current;
+    if (first.repSeq != second.repSeq) {
+        return first.repSeq < second.repSeq;
+    }
+    if (first.id != second.id) {
+        return first.id < second.id;
+    }
+    if (first.pos != second.pos) {
+        return first.pos < second.pos;
+    }
+    return a < b;
+}
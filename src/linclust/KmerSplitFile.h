@@ -0,0 +1,117 @@
+#ifndef KMER_SPLIT_FILE_H
+#define KMER_SPLIT_FILE_H
+
+// Split files of kmermatcher and kmersearch, used if the k-mer array does not fit into memory.
+//
+// A split file holds the k-mer match sets of one hash range sorted by rep. sequence. A set is stored as
+//   [rep. sequence delta][entry count] followed by [target id delta][diagonal][score] per entry
+// Ids are varints relative to the previous rep. sequence or target of the set, the diagonal is a zigzag
+// varint with the strand in the lowest bit and the score is a single byte.
+//
+// KmerSplitWriter writes an encoded split in a background thread while the next split is computed.
+// KmerSplitMerger merges the entries of all split files with a loser tree. Every set ends with an
+// entry with id UINT_MAX, so the merged stream tells when all files are done with a rep. sequence.
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#ifdef HAVE_PTHREADS
+#include <pthread.h>
+#endif
+
+struct FileKmerPosition {
+    size_t repSeq;
+    unsigned int id;
+    short pos;
+    unsigned char score;
+    unsigned int file;
+    char reverse;
+    FileKmerPosition(){}
+    FileKmerPosition(size_t repSeq, unsigned int id,short pos, unsigned char score, unsigned int file):
+            repSeq(repSeq), id(id), pos(pos), score(score), file(file), reverse(0) {}
+    FileKmerPosition(size_t repSeq, unsigned int id,short pos, unsigned char score, char reverse, unsigned int file):
+            repSeq(repSeq), id(id), pos(pos), score(score), file(file), reverse(reverse) {}
+};
+
+class KmerSplitWriter {
+public:
+    KmerSplitWriter();
+    ~KmerSplitWriter();
+
+    // sets have to be added in increasing rep. sequence order, their entries in increasing id order
+    void startSet(unsigned int repSeq);
+    void addEntry(unsigned int id, short diagonal, unsigned char score, bool reverse);
+
+    // hands the encoded split to the background thread, which writes the file and its .done marker
+    // the previous split is finished first
+    void write(const std::string &fileName);
+
+    // waits until the last split is written
+    void finish();
+
+private:
+    std::string buffer;
+    std::string setBuffer;
+    size_t setEntries;
+    unsigned int setRepSeq;
+    unsigned int lastRepSeq;
+    unsigned int lastId;
+
+    std::string writeBuffer;
+    std::string writeFileName;
+    bool writing;
+#ifdef HAVE_PTHREADS
+    pthread_t thread;
+#endif
+
+    void endSet();
+
+    static void *run(void *arg);
+    void writeFile();
+};
+
+class KmerSplitMerger {
+public:
+    explicit KmerSplitMerger(const std::vector<std::string> &files);
+    ~KmerSplitMerger();
+
+    bool empty() const {
+        return isDone(tree[0]);
+    }
+
+    const FileKmerPosition &top() const {
+        return cursors[tree[0]].current;
+    }
+
+    void pop();
+
+private:
+    struct Cursor {
+        const unsigned char *pos;
+        const unsigned char *end;
+        size_t repSeq;
+        size_t remaining;
+        unsigned int lastId;
+        bool inSet;
+        bool done;
+        FileKmerPosition current;
+
+        void next();
+    };
+
+    std::vector<void *> data;
+    std::vector<size_t> dataSizes;
+    std::vector<Cursor> cursors;
+    // tree[0] is the index of the smallest cursor, the inner nodes hold the loser of their match
+    std::vector<size_t> tree;
+    size_t leaves;
+
+    bool isDone(size_t cursor) const {
+        return cursor >= cursors.size() || cursors[cursor].done;
+    }
+
+    bool less(size_t a, size_t b) const;
+};
+
+#endif
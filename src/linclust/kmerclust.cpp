@@ -0,0 +1,132 @@
+#include "kmermatcher.h"
+#include "rescorediagonal.h"
+#include "Clustering.h"
+#include "MemoryDBWriter.h"
+#include "Debug.h"
+#include "Util.h"
+#include "Timer.h"
+#include "Parameters.h"
+#include "MMseqsMPI.h"
+
+#include <climits>
+
+#ifdef OPENMP
+#include <omp.h>
+#endif
+
+// Fused first part of the linclust workflow: kmermatcher, rescorediagonal (hamming) and clust.
+// The k-mer matches and the rescored pairs are kept in memory, only the pre-clustering and the
+// k-mer matches between representatives, which still need to be aligned, are written to disk.
+int kmerclust(int argc, const char **argv, const Command &command) {
+    MMseqsMPI::init(argc, argv);
+
+    Parameters &par = Parameters::getInstance();
+    setLinearFilterDefault(&par);
+    par.parseParameters(argc, argv, command, true, 0, MMseqsParameter::COMMAND_CLUSTLINEAR);
+
+#ifdef HAVE_MPI
+    if (MMseqsMPI::numProc > 1) {
+        Debug(Debug::ERROR) << "kmerclust runs in a single process. Use kmermatcher, rescorediagonal and clust with MPI.\n";
+        EXIT(EXIT_FAILURE);
+    }
+#endif
+
+    DBReader<unsigned int> seqDbr(par.db1.c_str(), par.db1Index.c_str(), par.threads,
+                                  DBReader<unsigned int>::USE_INDEX | DBReader<unsigned int>::USE_DATA);
+    seqDbr.open(DBReader<unsigned int>::NOSORT);
+    const int querySeqType = seqDbr.getDbtype();
+
+    setKmerLengthAndAlphabet(par, seqDbr.getAminoAcidDBSize(), querySeqType);
+    std::vector<MMseqsParameter *> *params = command.params;
+    par.printParameters(command.cmd, argc, argv, *params);
+    Debug(Debug::INFO) << "Database size: " << seqDbr.getSize() << " type: " << seqDbr.getDbTypeName() << "\n";
+
+    const int prefDbType = Parameters::isEqualDbtype(querySeqType, Parameters::DBTYPE_NUCLEOTIDES)
+                           ? Parameters::DBTYPE_PREFILTER_REV_RES : Parameters::DBTYPE_PREFILTER_RES;
+
+    // 1. Finding exact k-mer matches
+    Timer timer;
+    MemoryDBWriter prefWriter(1, prefDbType);
+    size_t totalKmersPerSplit = 0;
+    size_t splits = 0;
+    std::vector<std::string> splitFiles;
+    if (seqDbr.getMaxSeqLen() < SHRT_MAX) {
+        KmerPosition<short> *hashSeqPair = computeKmerMatches<short>(par, seqDbr, totalKmersPerSplit, splits, splitFiles);
+        writeKmerMatches<short>(prefWriter, seqDbr, hashSeqPair, totalKmersPerSplit, splits, splitFiles);
+        delete[] hashSeqPair;
+    } else {
+        KmerPosition<int> *hashSeqPair = computeKmerMatches<int>(par, seqDbr, totalKmersPerSplit, splits, splitFiles);
+        writeKmerMatches<int>(prefWriter, seqDbr, hashSeqPair, totalKmersPerSplit, splits, splitFiles);
+        delete[] hashSeqPair;
+    }
+    const unsigned int lastKey = seqDbr.getLastKey();
+    seqDbr.close();
+    DBReader<unsigned int> *prefReader = prefWriter.getReader();
+    Debug(Debug::INFO) << "Time for k-mer matching: " << timer.lap() << "\n";
+
+    {
+        // 2. Hamming distance pre-clustering, with the thresholds of the linclust workflow
+        const int rescoreMode = par.rescoreMode;
+        const bool filterHits = par.filterHits;
+        const float seqIdThr = par.seqIdThr;
+        const float covThr = par.covThr;
+        par.rescoreMode = Parameters::RESCORE_MODE_HAMMING;
+        par.filterHits = false;
+        // hamming distance does not work well with seq. id < 0.5 since it does not have an e-value criteria
+        par.seqIdThr = std::max(0.5f, par.seqIdThr);
+        // also coverage should not be under 0.5
+        par.covThr = std::max(0.5f, par.covThr);
+        MemoryDBWriter rescoreWriter(par.threads, prefDbType);
+        doRescorediagonal(par, par.db1, par.db1, rescoreWriter, *prefReader, 0, prefReader->getSize());
+        par.rescoreMode = rescoreMode;
+        par.filterHits = filterHits;
+        par.seqIdThr = seqIdThr;
+        par.covThr = covThr;
+        Debug(Debug::INFO) << "Time for rescoring: " << timer.lap() << "\n";
+
+        Clustering clu(par.db1, par.db1Index, rescoreWriter.getReader(), par.db2, par.db2Index,
+                       par.maxIteration, par.similarityScoreType, par.parallelSetCover, par.deterministicSetCover, par.unionFindComponents, par.graphCache,
+                       par.threads, par.compressed);
+        clu.run(par.clusteringMode);
+    }
+
+    // 3. Keep only the k-mer matches between representatives
+    DBReader<unsigned int> cluReader(par.db2.c_str(), par.db2Index.c_str(), par.threads, DBReader<unsigned int>::USE_INDEX);
+    cluReader.open(DBReader<unsigned int>::NOSORT);
+    std::vector<char> isRepresentative(lastKey + 1, false);
+    for (size_t i = 0; i < cluReader.getSize(); i++) {
+        isRepresentative[cluReader.getDbKey(i)] = true;
+    }
+
+    DBWriter resultWriter(par.db3.c_str(), par.db3Index.c_str(), par.threads, par.compressed, prefDbType);
+    resultWriter.open();
+#pragma omp parallel
+    {
+        unsigned int thread_idx = 0;
+#ifdef OPENMP
+        thread_idx = static_cast<unsigned int>(omp_get_thread_num());
+#endif
+        std::string result;
+        result.reserve(1024 * 1024);
+#pragma omp for schedule(dynamic, 100)
+        for (size_t i = 0; i < cluReader.getSize(); i++) {
+            const unsigned int key = cluReader.getDbKey(i);
+            char *data = prefReader->getDataByDBKey(key, thread_idx);
+            while (data != NULL && *data != '\0') {
+                char *next = Util::skipLine(data);
+                const unsigned int targetKey = Util::fast_atoi<unsigned int>(data);
+                if (isRepresentative[targetKey]) {
+                    result.append(data, next - data);
+                }
+                data = next;
+            }
+            resultWriter.writeData(result.c_str(), result.length(), key, thread_idx);
+            result.clear();
+        }
+    }
+    resultWriter.close();
+    cluReader.close();
+    Debug(Debug::INFO) << "Time for writing the remaining pairs: " << timer.lap() << "\n";
+
+    return EXIT_SUCCESS;
+}
@@ -15,6 +15,8 @@
 #include "MarkovKmerScore.h"
 #include "FileUtil.h"
 #include "FastSort.h"
+#include "RadixSort.h"
+#include "MemoryDBWriter.h"
 
 #include <sys/stat.h>
 #include <sys/mman.h>
@@ -386,7 +388,7 @@ std::pair<size_t, size_t> fillKmerPositionArray(KmerPosition<T> * kmerArray, siz
 
 template <typename T>
 KmerPosition<T> * doComputation(size_t totalKmers, size_t hashStartRange, size_t hashEndRange, std::string splitFile,
-                                DBReader<unsigned int> & seqDbr, Parameters & par, BaseMatrix  * subMat) {
+                                KmerSplitWriter &splitWriter, DBReader<unsigned int> & seqDbr, Parameters & par, BaseMatrix  * subMat) {
 
     KmerPosition<T> * hashSeqPair = initKmerPositionMemory<T>(totalKmers);
     size_t elementsToSort;
@@ -406,9 +408,9 @@ KmerPosition<T> * doComputation(size_t totalKmers, size_t hashStartRange, size_t
     Debug(Debug::INFO) << "Sort kmer ";
     Timer timer;
     if(Parameters::isEqualDbtype(seqDbr.getDbtype(), Parameters::DBTYPE_NUCLEOTIDES)) {
-        SORT_PARALLEL(hashSeqPair, hashSeqPair + elementsToSort, KmerPosition<T>::compareRepSequenceAndIdAndPosReverse);
+        RadixSort::sort(hashSeqPair, hashSeqPair + elementsToSort, typename KmerPosition<T>::KmerKeyReverse(), KmerPosition<T>::compareRepSequenceAndIdAndPosReverse);
     }else{
-        SORT_PARALLEL(hashSeqPair, hashSeqPair + elementsToSort, KmerPosition<T>::compareRepSequenceAndIdAndPos);
+        RadixSort::sort(hashSeqPair, hashSeqPair + elementsToSort, typename KmerPosition<T>::KmerKey(), KmerPosition<T>::compareRepSequenceAndIdAndPos);
     }
     Debug(Debug::INFO) << timer.lap() << "\n";
 
@@ -425,11 +427,10 @@ KmerPosition<T> * doComputation(size_t totalKmers, size_t hashStartRange, size_t
     Debug(Debug::INFO) << "Sort by rep. sequence ";
     timer.reset();
     if(Parameters::isEqualDbtype(seqDbr.getDbtype(), Parameters::DBTYPE_NUCLEOTIDES)){
-        SORT_PARALLEL(hashSeqPair, hashSeqPair + writePos, KmerPosition<T>::compareRepSequenceAndIdAndDiagReverse);
+        RadixSort::sort(hashSeqPair, hashSeqPair + writePos, typename KmerPosition<T>::RepSequenceAndIdKey(), KmerPosition<T>::compareRepSequenceAndIdAndDiagReverse);
     }else{
-        SORT_PARALLEL(hashSeqPair, hashSeqPair + writePos, KmerPosition<T>::compareRepSequenceAndIdAndDiag);
+        RadixSort::sort(hashSeqPair, hashSeqPair + writePos, typename KmerPosition<T>::RepSequenceAndIdKey(), KmerPosition<T>::compareRepSequenceAndIdAndDiag);
     }
-    //kx::radix_sort(hashSeqPair, hashSeqPair + elementsToSort, SequenceComparision());
 //    for(size_t i = 0; i < writePos; i++){
 //        std::cout << BIT_CLEAR(hashSeqPair[i].kmer, 63) << "\t" << hashSeqPair[i].id << "\t" << hashSeqPair[i].pos << std::endl;
 //    }
@@ -437,9 +438,9 @@ KmerPosition<T> * doComputation(size_t totalKmers, size_t hashStartRange, size_t
 
     if(hashEndRange != SIZE_T_MAX){
         if(Parameters::isEqualDbtype(seqDbr.getDbtype(), Parameters::DBTYPE_NUCLEOTIDES)){
-            writeKmersToDisk<Parameters::DBTYPE_NUCLEOTIDES, KmerEntryRev, T>(splitFile, hashSeqPair, writePos + 1);
+            writeKmersToDisk<Parameters::DBTYPE_NUCLEOTIDES, T>(splitWriter, splitFile, hashSeqPair, writePos + 1);
         }else{
-            writeKmersToDisk<Parameters::DBTYPE_AMINO_ACIDS, KmerEntry, T>(splitFile, hashSeqPair, writePos + 1);
+            writeKmersToDisk<Parameters::DBTYPE_AMINO_ACIDS, T>(splitWriter, splitFile, hashSeqPair, writePos + 1);
         }
         delete [] hashSeqPair;
         hashSeqPair = NULL;
@@ -590,9 +591,10 @@ size_t computeMemoryNeededLinearfilter(size_t totalKmer) {
 }
 
 
+// computes the sorted k-mer matches, either in memory (returned) or in split files if they do not fit into memory
 template <typename T>
-int kmermatcherInner(Parameters& par, DBReader<unsigned int>& seqDbr) {
-
+KmerPosition<T> *computeKmerMatches(Parameters &par, DBReader<unsigned int> &seqDbr, size_t &totalKmersPerSplit,
+                                    size_t &splits, std::vector<std::string> &splitFiles) {
     int querySeqType = seqDbr.getDbtype();
     BaseMatrix *subMat;
     if (Parameters::isEqualDbtype(querySeqType, Parameters::DBTYPE_NUCLEOTIDES)) {
@@ -606,8 +608,6 @@ int kmermatcherInner(Parameters& par, DBReader<unsigned int>& seqDbr) {
         }
     }
 
-    //seqDbr.readMmapedDataInMemory();
-
     // memoryLimit in bytes
     size_t memoryLimit=Util::computeMemory(par.splitMemoryLimit);
 
@@ -617,23 +617,23 @@ int kmermatcherInner(Parameters& par, DBReader<unsigned int>& seqDbr) {
     size_t totalKmers = computeKmerCount(seqDbr, par.kmerSize, par.kmersPerSequence, kmersPerSequenceScale);
     size_t totalSizeNeeded = computeMemoryNeededLinearfilter<T>(totalKmers);
     // compute splits
-    size_t splits = static_cast<size_t>(std::ceil(static_cast<float>(totalSizeNeeded) / memoryLimit));
-    size_t totalKmersPerSplit = std::max(static_cast<size_t>(1024+1),
+    splits = static_cast<size_t>(std::ceil(static_cast<float>(totalSizeNeeded) / memoryLimit));
+    totalKmersPerSplit = std::max(static_cast<size_t>(1024+1),
                                          static_cast<size_t>(std::min(totalSizeNeeded, memoryLimit)/sizeof(KmerPosition<T>))+1);
 
     std::vector<std::pair<size_t, size_t>> hashRanges = setupKmerSplits<T>(par, subMat, seqDbr, totalKmersPerSplit, splits);
     if(splits > 1){
         Debug(Debug::INFO) << "Process file into " << hashRanges.size() << " parts\n";
     }
-    std::vector<std::string> splitFiles;
     KmerPosition<T> *hashSeqPair = NULL;
+    // writes split N to disk while split N+1 is computed
+    KmerSplitWriter splitWriter;
 
-    size_t mpiRank = 0;
 #ifdef HAVE_MPI
     splits = hashRanges.size();
     size_t fromSplit = 0;
     size_t splitCount = 1;
-    mpiRank = MMseqsMPI::rank;
+    size_t mpiRank = MMseqsMPI::rank;
     // if split size is great than nodes than we have to
     // distribute all splits equally over all nodes
     unsigned int * splitCntPerProc = new unsigned int[MMseqsMPI::numProc];
@@ -649,8 +649,9 @@ int kmermatcherInner(Parameters& par, DBReader<unsigned int>& seqDbr) {
 
     for(size_t split = fromSplit; split < fromSplit+splitCount; split++) {
         std::string splitFileName = par.db2 + "_split_" +SSTR(split);
-        hashSeqPair = doComputation<T>(totalKmers, hashRanges[split].first, hashRanges[split].second, splitFileName, seqDbr, par, subMat);
+        hashSeqPair = doComputation<T>(totalKmers, hashRanges[split].first, hashRanges[split].second, splitFileName, splitWriter, seqDbr, par, subMat);
     }
+    splitWriter.finish();
     MPI_Barrier(MPI_COMM_WORLD);
     if(mpiRank == 0){
         for(size_t split = 0; split < splits; split++) {
@@ -665,67 +666,84 @@ int kmermatcherInner(Parameters& par, DBReader<unsigned int>& seqDbr) {
 
         std::string splitFileNameDone = splitFileName + ".done";
         if(FileUtil::fileExists(splitFileNameDone.c_str()) == false){
-            hashSeqPair = doComputation<T>(totalKmersPerSplit, hashRanges[split].first, hashRanges[split].second, splitFileName, seqDbr, par, subMat);
+            hashSeqPair = doComputation<T>(totalKmersPerSplit, hashRanges[split].first, hashRanges[split].second, splitFileName, splitWriter, seqDbr, par, subMat);
         }
 
         splitFiles.push_back(splitFileName);
     }
+    splitWriter.finish();
 #endif
-    if(mpiRank == 0){
-        std::vector<char> repSequence(seqDbr.getLastKey()+1);
-        std::fill(repSequence.begin(), repSequence.end(), false);
-        // write result
-        DBWriter dbw(par.db2.c_str(), par.db2Index.c_str(), 1, par.compressed,
-                     (Parameters::isEqualDbtype(seqDbr.getDbtype(), Parameters::DBTYPE_NUCLEOTIDES)) ? Parameters::DBTYPE_PREFILTER_REV_RES : Parameters::DBTYPE_PREFILTER_RES );
-        dbw.open();
+    delete subMat;
+    return hashSeqPair;
+}
 
-        Timer timer;
-        if(splits > 1) {
-            seqDbr.unmapData();
-            if(Parameters::isEqualDbtype(seqDbr.getDbtype(), Parameters::DBTYPE_NUCLEOTIDES)) {
-                mergeKmerFilesAndOutput<Parameters::DBTYPE_NUCLEOTIDES, KmerEntryRev>(dbw, splitFiles, repSequence);
-            }else{
-                mergeKmerFilesAndOutput<Parameters::DBTYPE_AMINO_ACIDS, KmerEntry>(dbw, splitFiles, repSequence);
-            }
-            for(size_t i = 0; i < splitFiles.size(); i++){
-                FileUtil::remove(splitFiles[i].c_str());
-                std::string splitFilesDone = splitFiles[i] + ".done";
-                FileUtil::remove(splitFilesDone.c_str());
-            }
-        } else {
-            if(Parameters::isEqualDbtype(seqDbr.getDbtype(), Parameters::DBTYPE_NUCLEOTIDES)) {
-                writeKmerMatcherResult<Parameters::DBTYPE_NUCLEOTIDES>(dbw, hashSeqPair, totalKmersPerSplit, repSequence, 1);
-            }else{
-                writeKmerMatcherResult<Parameters::DBTYPE_AMINO_ACIDS>(dbw, hashSeqPair, totalKmersPerSplit, repSequence, 1);
-            }
+// writes the k-mer matches of every representative sequence and a self hit for every other sequence
+template <typename T, typename Writer>
+void writeKmerMatches(Writer &dbw, DBReader<unsigned int> &seqDbr, KmerPosition<T> *hashSeqPair,
+                      size_t totalKmersPerSplit, size_t splits, std::vector<std::string> &splitFiles) {
+    std::vector<char> repSequence(seqDbr.getLastKey()+1);
+    std::fill(repSequence.begin(), repSequence.end(), false);
+
+    Timer timer;
+    if(splits > 1) {
+        seqDbr.unmapData();
+        mergeKmerFilesAndOutput(dbw, splitFiles, repSequence);
+        for(size_t i = 0; i < splitFiles.size(); i++){
+            FileUtil::remove(splitFiles[i].c_str());
+            std::string splitFilesDone = splitFiles[i] + ".done";
+            FileUtil::remove(splitFilesDone.c_str());
         }
-        Debug(Debug::INFO) << "Time for fill: " << timer.lap() << "\n";
-        // add missing entries to the result (needed for clustering)
+    } else {
+        if(Parameters::isEqualDbtype(seqDbr.getDbtype(), Parameters::DBTYPE_NUCLEOTIDES)) {
+            writeKmerMatcherResult<Parameters::DBTYPE_NUCLEOTIDES>(dbw, hashSeqPair, totalKmersPerSplit, repSequence, 1);
+        }else{
+            writeKmerMatcherResult<Parameters::DBTYPE_AMINO_ACIDS>(dbw, hashSeqPair, totalKmersPerSplit, repSequence, 1);
+        }
+    }
+    Debug(Debug::INFO) << "Time for fill: " << timer.lap() << "\n";
+    // add missing entries to the result (needed for clustering)
 
 #pragma omp parallel num_threads(1)
-        {
-            unsigned int thread_idx = 0;
+    {
+        unsigned int thread_idx = 0;
 #ifdef OPENMP
-            thread_idx = static_cast<unsigned int>(omp_get_thread_num());
+        thread_idx = static_cast<unsigned int>(omp_get_thread_num());
 #endif
 #pragma omp for
-            for (size_t id = 0; id < seqDbr.getSize(); id++) {
-                char buffer[100];
-                unsigned int dbKey = seqDbr.getDbKey(id);
-                if (repSequence[dbKey] == false) {
-                    hit_t h;
-                    h.prefScore = 0;
-                    h.diagonal = 0;
-                    h.seqId = dbKey;
-                    int len = QueryMatcher::prefilterHitToBuffer(buffer, h);
-                    dbw.writeData(buffer, len, dbKey, thread_idx);
-                }
+        for (size_t id = 0; id < seqDbr.getSize(); id++) {
+            char buffer[100];
+            unsigned int dbKey = seqDbr.getDbKey(id);
+            if (repSequence[dbKey] == false) {
+                hit_t h;
+                h.prefScore = 0;
+                h.diagonal = 0;
+                h.seqId = dbKey;
+                int len = QueryMatcher::prefilterHitToBuffer(buffer, h);
+                dbw.writeData(buffer, len, dbKey, thread_idx);
             }
         }
+    }
+}
+
+template <typename T>
+int kmermatcherInner(Parameters& par, DBReader<unsigned int>& seqDbr) {
+    size_t totalKmersPerSplit = 0;
+    size_t splits = 0;
+    std::vector<std::string> splitFiles;
+    KmerPosition<T> *hashSeqPair = computeKmerMatches<T>(par, seqDbr, totalKmersPerSplit, splits, splitFiles);
+
+    size_t mpiRank = 0;
+#ifdef HAVE_MPI
+    mpiRank = MMseqsMPI::rank;
+#endif
+    if(mpiRank == 0){
+        DBWriter dbw(par.db2.c_str(), par.db2Index.c_str(), 1, par.compressed,
+                     (Parameters::isEqualDbtype(seqDbr.getDbtype(), Parameters::DBTYPE_NUCLEOTIDES)) ? Parameters::DBTYPE_PREFILTER_REV_RES : Parameters::DBTYPE_PREFILTER_RES );
+        dbw.open();
+        writeKmerMatches<T>(dbw, seqDbr, hashSeqPair, totalKmersPerSplit, splits, splitFiles);
         dbw.close(false, false);
     }
     // free memory
-    delete subMat;
     if(hashSeqPair){
         delete [] hashSeqPair;
     }
@@ -806,8 +824,8 @@ int kmermatcher(int argc, const char **argv, const Command &command) {
     return EXIT_SUCCESS;
 }
 
-template <int TYPE, typename T>
-void writeKmerMatcherResult(DBWriter & dbw,
+template <int TYPE, typename T, typename Writer>
+void writeKmerMatcherResult(Writer & dbw,
                             KmerPosition<T> *hashSeqPair, size_t totalKmers,
                             std::vector<char> &repSequence, size_t threads) {
     std::vector<size_t> threadOffsets;
@@ -923,71 +941,21 @@ void writeKmerMatcherResult(DBWriter & dbw,
     }
 }
 
-template <int TYPE, typename T>
-size_t queueNextEntry(KmerPositionQueue &queue, int file, size_t offsetPos, T *entries, size_t entrySize) {
-    if(offsetPos + 1 >= entrySize){
-        return offsetPos;
-    }
-    unsigned int repSeqId = entries[offsetPos].seqId;
-    size_t pos = 0;
-    while(entries[offsetPos + pos].seqId != UINT_MAX){
-        if(TYPE == Parameters::DBTYPE_NUCLEOTIDES){
-            queue.push(FileKmerPosition(repSeqId, entries[offsetPos+pos].seqId, entries[offsetPos+pos].diagonal, entries[offsetPos+pos].score, entries[offsetPos+pos].getRev(), file));
-        }else{
-            queue.push(FileKmerPosition(repSeqId, entries[offsetPos+pos].seqId, entries[offsetPos+pos].diagonal, entries[offsetPos+pos].score, file));
-        }
-        pos++;
-    }
-    queue.push(FileKmerPosition(repSeqId, UINT_MAX, 0, 0, file));
-    pos++;
-    return offsetPos+pos;
-}
-
-template <int TYPE, typename T>
-void mergeKmerFilesAndOutput(DBWriter & dbw,
+template <typename Writer>
+void mergeKmerFilesAndOutput(Writer & dbw,
                              std::vector<std::string> tmpFiles,
                              std::vector<char> &repSequence) {
     Debug(Debug::INFO) << "Merge splits ... ";
 
-    const int fileCnt = tmpFiles.size();
-    FILE ** files       = new FILE*[fileCnt];
-    T **entries = new T*[fileCnt];
-    size_t * entrySizes = new size_t[fileCnt];
-    size_t * offsetPos  = new size_t[fileCnt];
-    size_t * dataSizes  = new size_t[fileCnt];
-    // init structures
-    for(size_t file = 0; file < tmpFiles.size(); file++){
-        files[file] = FileUtil::openFileOrDie(tmpFiles[file].c_str(),"r",true);
-        size_t dataSize;
-        struct stat sb;
-        fstat(fileno(files[file]) , &sb);
-        if(sb.st_size > 0){
-            entries[file]    = (T*)FileUtil::mmapFile(files[file], &dataSize);
-#if HAVE_POSIX_MADVISE
-            if (posix_madvise (entries[file], dataSize, POSIX_MADV_SEQUENTIAL) != 0){
-                Debug(Debug::ERROR) << "posix_madvise returned an error for file " << tmpFiles[file] << "\n";
-            }
-#endif
-        }else{
-            dataSize = 0;
-        }
-
-        dataSizes[file]  = dataSize;
-        entrySizes[file] = dataSize/sizeof(T);
-    }
-    KmerPositionQueue queue;
-    // read one entry for each file
-    for(int file = 0; file < fileCnt; file++ ){
-        offsetPos[file] = queueNextEntry<TYPE,T>(queue, file, 0, entries[file], entrySizes[file]);
-    }
+    KmerSplitMerger merger(tmpFiles);
     std::string prefResultsOutString;
     prefResultsOutString.reserve(100000000);
     char buffer[100];
     FileKmerPosition res;
     bool hasRepSeq =  repSequence.size()>0;
     unsigned int currRepSeq = UINT_MAX;
-    if(queue.empty() == false){
-        res = queue.top();
+    if(merger.empty() == false){
+        res = merger.top();
         currRepSeq = res.repSeq;
         if(hasRepSeq) {
             hit_t h;
@@ -999,43 +967,33 @@ void mergeKmerFilesAndOutput(DBWriter & dbw,
         }
     }
 
-//    while(queue.empty() == false) {
-//        res = queue.top();
-//        std::cout << (int)res.repSeq << "\t" << (int)res.id << "\t" <<(int) res.pos << "\t" << (int) res.reverse << std::endl;
-//        queue.pop();
-//        offsetPos[res.file] = queueNextEntry<TYPE,T>(queue, res.file, offsetPos[res.file],
-//                                                     entries[res.file], entrySizes[res.file]);
-//    }
-    while(queue.empty() == false) {
-        res = queue.top();
-        queue.pop();
+    while(merger.empty() == false) {
+        res = merger.top();
+        merger.pop();
         if(res.id == UINT_MAX) {
-            offsetPos[res.file] = queueNextEntry<TYPE,T>(queue, res.file, offsetPos[res.file],
-                                                         entries[res.file], entrySizes[res.file]);
+            // all entries of the rep. sequence are merged
             dbw.writeData(prefResultsOutString.c_str(), prefResultsOutString.length(), res.repSeq, 0);
             if(hasRepSeq){
                 repSequence[res.repSeq]=true;
             }
             prefResultsOutString.clear();
-            // skipe UINT MAX entries
-            while(queue.empty() == false && queue.top().id==UINT_MAX) {
-                res = queue.top();
-                queue.pop();
-                offsetPos[res.file] = queueNextEntry<TYPE,T>(queue, res.file, offsetPos[res.file],
-                                                             entries[res.file], entrySizes[res.file]);
+            // skip the end of the set in the other files
+            while(merger.empty() == false && merger.top().id==UINT_MAX) {
+                merger.pop();
             }
-            if(queue.empty() == false) {
-                res = queue.top();
-                currRepSeq = res.repSeq;
-                queue.pop();
-                if(hasRepSeq){
-                    hit_t h;
-                    h.seqId = res.repSeq;
-                    h.prefScore = 0;
-                    h.diagonal = 0;
-                    int len = QueryMatcher::prefilterHitToBuffer(buffer, h);
-                    prefResultsOutString.append(buffer, len);
-                }
+            if(merger.empty()) {
+                break;
+            }
+            res = merger.top();
+            currRepSeq = res.repSeq;
+            merger.pop();
+            if(hasRepSeq){
+                hit_t h;
+                h.seqId = res.repSeq;
+                h.prefScore = 0;
+                h.diagonal = 0;
+                int len = QueryMatcher::prefilterHitToBuffer(buffer, h);
+                prefResultsOutString.append(buffer, len);
             }
         }
 
@@ -1064,12 +1022,11 @@ void mergeKmerFilesAndOutput(DBWriter & dbw,
             }
             prevDiagonal = res.pos;
             topScore += res.score;
-            if(queue.empty() == false) {
-                res = queue.top();
-                queue.pop();
+            if(merger.empty() == false) {
+                res = merger.top();
                 hitId = res.id;
-                if(hitId != prevHitId){
-                    queue.push(res);
+                if(hitId == prevHitId && res.repSeq == currRepSeq){
+                    merger.pop();
                 }
             }else{
                 hitId = UINT_MAX;
@@ -1084,66 +1041,24 @@ void mergeKmerFilesAndOutput(DBWriter & dbw,
         int len = QueryMatcher::prefilterHitToBuffer(buffer, h);
         prefResultsOutString.append(buffer, len);
     }
-    for(size_t file = 0; file < tmpFiles.size(); file++) {
-        if (fclose(files[file]) != 0) {
-            Debug(Debug::ERROR) << "Cannot close file " << tmpFiles[file] << "\n";
-            EXIT(EXIT_FAILURE);
-        }
-        if(dataSizes[file] > 0 && munmap((void*)entries[file], dataSizes[file]) < 0){
-            Debug(Debug::ERROR) << "Failed to munmap memory dataSize=" << dataSizes[file] <<"\n";
-            EXIT(EXIT_FAILURE);
-        }
-    }
-
-
-    delete [] dataSizes;
-    delete [] offsetPos;
-    delete [] entries;
-    delete [] entrySizes;
-    delete [] files;
 }
 
 
-template <int TYPE, typename T, typename seqLenType>
-void writeKmersToDisk(std::string tmpFile, KmerPosition<seqLenType> *hashSeqPair, size_t totalKmers) {
+template <int TYPE, typename seqLenType>
+void writeKmersToDisk(KmerSplitWriter &splitWriter, std::string tmpFile, KmerPosition<seqLenType> *hashSeqPair, size_t totalKmers) {
     size_t repSeqId = SIZE_T_MAX;
     size_t lastTargetId = SIZE_T_MAX;
     seqLenType lastDiagonal=0;
     int diagonalScore=0;
-    FILE* filePtr = fopen(tmpFile.c_str(), "wb");
-    if(filePtr == NULL) { perror(tmpFile.c_str()); EXIT(EXIT_FAILURE); }
-    unsigned int writeSets = 0;
-    const size_t BUFFER_SIZE = 2048;
-    size_t bufferPos = 0;
-    size_t elemenetCnt = 0;
-    T writeBuffer[BUFFER_SIZE];
-    T nullEntry;
-    nullEntry.seqId=UINT_MAX;
-    nullEntry.diagonal=0;
     for(size_t kmerPos = 0; kmerPos < totalKmers && hashSeqPair[kmerPos].kmer != SIZE_T_MAX; kmerPos++){
         size_t currKmer=hashSeqPair[kmerPos].kmer;
         if(TYPE == Parameters::DBTYPE_NUCLEOTIDES){
             currKmer = BIT_CLEAR(currKmer, 63);
         }
         if(repSeqId != currKmer) {
-            if (writeSets > 0 && elemenetCnt > 0) {
-                if(bufferPos > 0){
-                    fwrite(writeBuffer, sizeof(T), bufferPos, filePtr);
-                }
-                fwrite(&nullEntry, sizeof(T), 1, filePtr);
-            }
             lastTargetId = SIZE_T_MAX;
-            bufferPos=0;
-            elemenetCnt=0;
             repSeqId = currKmer;
-            writeBuffer[bufferPos].seqId = repSeqId;
-            writeBuffer[bufferPos].score = 0;
-            writeBuffer[bufferPos].diagonal = 0;
-            if(TYPE == Parameters::DBTYPE_NUCLEOTIDES){
-                bool isReverse = BIT_CHECK(hashSeqPair[kmerPos].kmer, 63)==false;
-                writeBuffer[bufferPos].setReverse(isReverse);
-            }
-            bufferPos++;
+            splitWriter.startSet(static_cast<unsigned int>(repSeqId));
         }
 
         unsigned int targetId = hashSeqPair[kmerPos].id;
@@ -1164,37 +1079,12 @@ void writeKmersToDisk(std::string tmpFile, KmerPosition<seqLenType> *hashSeqPair
         }while(targetId == hashSeqPair[kmerPos].id && hashSeqPair[kmerPos].pos == diagonal && kmerPos < totalKmers && hashSeqPair[kmerPos].kmer != SIZE_T_MAX);
         kmerPos--;
 
-        elemenetCnt++;
-        writeBuffer[bufferPos].seqId = targetId;
-        writeBuffer[bufferPos].score = diagonalScore;
+        splitWriter.addEntry(targetId, static_cast<short>(diagonal), static_cast<unsigned char>(diagonalScore), reverse > forward);
         diagonalScore = 0;
-        writeBuffer[bufferPos].diagonal = diagonal;
-        if(TYPE == Parameters::DBTYPE_NUCLEOTIDES){
-            bool isReverse = (reverse>forward)? true : false;
-            writeBuffer[bufferPos].setReverse(isReverse);
-        }
-        bufferPos++;
-        if(bufferPos >= BUFFER_SIZE){
-            fwrite(writeBuffer, sizeof(T), bufferPos, filePtr);
-            bufferPos=0;
-        }
         lastTargetId = targetId;
-        writeSets++;
-    }
-    if (writeSets > 0 && elemenetCnt > 0 && bufferPos > 0) {
-        fwrite(writeBuffer, sizeof(T), bufferPos, filePtr);
-        fwrite(&nullEntry,  sizeof(T), 1, filePtr);
-    }
-    if (fclose(filePtr) != 0) {
-        Debug(Debug::ERROR) << "Cannot close file " << tmpFile << "\n";
-        EXIT(EXIT_FAILURE);
-    }
-    std::string fileName = tmpFile + ".done";
-    FILE* done = FileUtil::openFileOrDie(fileName.c_str(),"w", false);
-    if (fclose(done) != 0) {
-        Debug(Debug::ERROR) << "Cannot close file " << fileName << "\n";
-        EXIT(EXIT_FAILURE);
     }
+    // the file is written in the background
+    splitWriter.write(tmpFile);
 }
 
 void setKmerLengthAndAlphabet(Parameters &parameters, size_t aaDbSize, int seqTyp) {
@@ -1249,4 +1139,18 @@ template size_t computeMemoryNeededLinearfilter<int>(size_t totalKmer);
 template std::vector<std::pair<size_t, size_t>>  setupKmerSplits<short>(Parameters &par, BaseMatrix * subMat, DBReader<unsigned int> &seqDbr, size_t totalKmers, size_t splits);
 template std::vector<std::pair<size_t, size_t>>  setupKmerSplits<int>(Parameters &par, BaseMatrix * subMat, DBReader<unsigned int> &seqDbr, size_t totalKmers, size_t splits);
 
+template KmerPosition<short> *computeKmerMatches<short>(Parameters &par, DBReader<unsigned int> &seqDbr, size_t &totalKmersPerSplit, size_t &splits, std::vector<std::string> &splitFiles);
+template KmerPosition<int> *computeKmerMatches<int>(Parameters &par, DBReader<unsigned int> &seqDbr, size_t &totalKmersPerSplit, size_t &splits, std::vector<std::string> &splitFiles);
+
+template void mergeKmerFilesAndOutput<DBWriter>(DBWriter &dbw, std::vector<std::string> tmpFiles, std::vector<char> &repSequence);
+template void mergeKmerFilesAndOutput<MemoryDBWriter>(MemoryDBWriter &dbw, std::vector<std::string> tmpFiles, std::vector<char> &repSequence);
+
+template void writeKmersToDisk<Parameters::DBTYPE_AMINO_ACIDS, short>(KmerSplitWriter &splitWriter, std::string tmpFile, KmerPosition<short> *kmers, size_t totalKmers);
+template void writeKmersToDisk<Parameters::DBTYPE_NUCLEOTIDES, short>(KmerSplitWriter &splitWriter, std::string tmpFile, KmerPosition<short> *kmers, size_t totalKmers);
+
+template void writeKmerMatches<short, MemoryDBWriter>(MemoryDBWriter &dbw, DBReader<unsigned int> &seqDbr, KmerPosition<short> *hashSeqPair,
+                                                      size_t totalKmersPerSplit, size_t splits, std::vector<std::string> &splitFiles);
+template void writeKmerMatches<int, MemoryDBWriter>(MemoryDBWriter &dbw, DBReader<unsigned int> &seqDbr, KmerPosition<int> *hashSeqPair,
+                                                    size_t totalKmersPerSplit, size_t splits, std::vector<std::string> &splitFiles);
+
 #undef SIZE_T_MAX
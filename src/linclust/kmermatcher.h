@@ -4,6 +4,7 @@
 #include "DBWriter.h"
 #include "Parameters.h"
 #include "BaseMatrix.h"
+#include "KmerSplitFile.h"
 
 #include <queue>
 
@@ -128,95 +129,57 @@ struct __attribute__((__packed__))KmerPosition {
             return false;
         return false;
     }
-};
-
 
-
-struct __attribute__((__packed__)) KmerEntry {
-    unsigned int seqId;
-    short diagonal;
-    unsigned char score;
-    void setReverse(bool ){
-        ;
-    }
-    unsigned char getRev(){
-        return 0;
-    }
+    // RadixSort keys consistent with the comparators above
+    struct KmerKey {
+        uint64_t operator()(const KmerPosition<T> &x) const {
+            return x.kmer;
+        }
+    };
+
+    struct KmerKeyReverse {
+        uint64_t operator()(const KmerPosition<T> &x) const {
+            return BIT_SET(x.kmer, 63);
+        }
+    };
+
+    // the kmer field holds the rep. sequence id (and the strand in bit 63) after the grouping
+    struct RepSequenceAndIdKey {
+        uint64_t operator()(const KmerPosition<T> &x) const {
+            return (static_cast<uint64_t>(static_cast<unsigned int>(x.kmer)) << 32) | x.id;
+        }
+    };
 };
 
-struct __attribute__((__packed__)) KmerEntryRev {
-    unsigned int seqId;
-    short diagonal;
-    unsigned char score;
-    unsigned char rev;
-    void setReverse(bool rev){
-        this->rev = rev;
-    }
-    unsigned char getRev(){
-        return this->rev;
-    }
-};
-
-struct FileKmerPosition {
-    size_t repSeq;
-    unsigned int id;
-    short pos;
-    unsigned char score;
-    unsigned int file;
-    char reverse;
-    FileKmerPosition(){}
-    FileKmerPosition(size_t repSeq, unsigned int id,short pos, unsigned char score, unsigned int file):
-            repSeq(repSeq), id(id), pos(pos), score(score), file(file), reverse(0) {}
-    FileKmerPosition(size_t repSeq, unsigned int id,short pos, unsigned char score, char reverse, unsigned int file):
-            repSeq(repSeq), id(id), pos(pos), score(score), file(file), reverse(reverse) {}
-};
-
-class CompareResultBySeqId {
-public:
-    bool operator() (FileKmerPosition & first, FileKmerPosition & second) const {
-        //return (first.eval < second.eval);
-        if(first.repSeq > second.repSeq )
-            return true;
-        if(second.repSeq > first.repSeq )
-            return false;
-        if(first.id > second.id )
-            return true;
-        if(second.id > first.id )
-            return false;
-        if(first.pos > second.pos )
-            return true;
-        if(second.pos > first.pos )
-            return false;
-        return false;
-    }
-};
 
 
 template  <int TYPE, typename T>
 size_t assignGroup(KmerPosition<T> *kmers, size_t splitKmerCount, bool includeOnlyExtendable, int covMode, float covThr);
 
-template <int TYPE, typename T>
-void mergeKmerFilesAndOutput(DBWriter & dbw, std::vector<std::string> tmpFiles, std::vector<char> &repSequence);
-
-typedef std::priority_queue<FileKmerPosition, std::vector<FileKmerPosition>, CompareResultBySeqId> KmerPositionQueue;
-
-template <int TYPE, typename T>
-size_t queueNextEntry(KmerPositionQueue &queue, int file, size_t offsetPos, T *entries, size_t entrySize);
+template <typename Writer>
+void mergeKmerFilesAndOutput(Writer & dbw, std::vector<std::string> tmpFiles, std::vector<char> &repSequence);
 
 void setKmerLengthAndAlphabet(Parameters &parameters, size_t aaDbSize, int seqType);
 
-template <int TYPE, typename T, typename seqLenType>
-void writeKmersToDisk(std::string tmpFile, KmerPosition<seqLenType> *kmers, size_t totalKmers);
+template <int TYPE, typename seqLenType>
+void writeKmersToDisk(KmerSplitWriter &splitWriter, std::string tmpFile, KmerPosition<seqLenType> *kmers, size_t totalKmers);
 
-template <int TYPE, typename T>
-void writeKmerMatcherResult(DBWriter & dbw, KmerPosition<T> *hashSeqPair, size_t totalKmers,
+template <int TYPE, typename T, typename Writer>
+void writeKmerMatcherResult(Writer & dbw, KmerPosition<T> *hashSeqPair, size_t totalKmers,
                             std::vector<char> &repSequence, size_t threads);
 
+template <typename T>
+KmerPosition<T> *computeKmerMatches(Parameters &par, DBReader<unsigned int> &seqDbr, size_t &totalKmersPerSplit,
+                                    size_t &splits, std::vector<std::string> &splitFiles);
+
+template <typename T, typename Writer>
+void writeKmerMatches(Writer &dbw, DBReader<unsigned int> &seqDbr, KmerPosition<T> *hashSeqPair,
+                      size_t totalKmersPerSplit, size_t splits, std::vector<std::string> &splitFiles);
+
 
 template <typename T>
-KmerPosition<T> * doComputation(size_t totalKmers, size_t split, size_t splits, std::string splitFile,
-                                DBReader<unsigned int> & seqDbr, Parameters & par, BaseMatrix  * subMat,
-                                size_t KMER_SIZE, size_t chooseTopKmer, float chooseTopKmerScale = 0.0);
+KmerPosition<T> * doComputation(size_t totalKmers, size_t hashStartRange, size_t hashEndRange, std::string splitFile,
+                                KmerSplitWriter &splitWriter, DBReader<unsigned int> & seqDbr, Parameters & par, BaseMatrix  * subMat);
 template <typename T>
 KmerPosition<T> *initKmerPositionMemory(size_t size);
 
@@ -14,7 +14,7 @@
 #include "Timer.h"
 #include "KmerIndex.h"
 #include "FileUtil.h"
-#include "FastSort.h"
+#include "RadixSort.h"
 
 #ifndef SIZE_T_MAX
 #define SIZE_T_MAX ((size_t) -1)
@@ -47,9 +47,9 @@ KmerSearch::ExtractKmerAndSortResult KmerSearch::extractKmerAndSort(size_t total
     Debug(Debug::INFO) << "Sort kmer ... ";
     timer.reset();
     if(Parameters::isEqualDbtype(seqDbr.getDbtype(), Parameters::DBTYPE_NUCLEOTIDES)) {
-        SORT_PARALLEL(hashSeqPair, hashSeqPair + elementsToSort, KmerPosition<short>::compareRepSequenceAndIdAndPosReverse);
+        RadixSort::sort(hashSeqPair, hashSeqPair + elementsToSort, KmerPosition<short>::KmerKeyReverse(), KmerPosition<short>::compareRepSequenceAndIdAndPosReverse);
     }else{
-        SORT_PARALLEL(hashSeqPair, hashSeqPair + elementsToSort, KmerPosition<short>::compareRepSequenceAndIdAndPos);
+        RadixSort::sort(hashSeqPair, hashSeqPair + elementsToSort, KmerPosition<short>::KmerKey(), KmerPosition<short>::compareRepSequenceAndIdAndPos);
     }
 
 
@@ -219,6 +219,8 @@ int kmersearch(int argc, const char **argv, const Command &command) {
     Debug(Debug::INFO) << "Process file into " << hashRanges.size() << " parts\n";
 
     std::vector<std::string> splitFiles;
+    // writes split N to disk while split N+1 is computed
+    KmerSplitWriter splitWriter;
     for (size_t split = 0; split < hashRanges.size(); split++) {
         tidxdbr.remapData();
         char *entriesData = tidxdbr.getDataUncompressed(tidxdbr.getId(PrefilteringIndexReader::ENTRIES));
@@ -263,15 +265,15 @@ int kmersearch(int argc, const char **argv, const Command &command) {
                 dbw.close();
             } else {
                 if (Parameters::isEqualDbtype(queryDbr.getDbtype(), Parameters::DBTYPE_NUCLEOTIDES)) {
-                    writeKmersToDisk<Parameters::DBTYPE_NUCLEOTIDES, KmerEntryRev, short>(tmpFiles.first, kmers,
-                                                                                          kmerCount );
+                    writeKmersToDisk<Parameters::DBTYPE_NUCLEOTIDES, short>(splitWriter, tmpFiles.first, kmers, kmerCount);
                 } else {
-                    writeKmersToDisk<Parameters::DBTYPE_AMINO_ACIDS, KmerEntry, short>(tmpFiles.first, kmers, kmerCount );
+                    writeKmersToDisk<Parameters::DBTYPE_AMINO_ACIDS, short>(splitWriter, tmpFiles.first, kmers, kmerCount);
                 }
             }
             delete[] kmers;
         }
     }
+    splitWriter.finish();
     delete subMat;
     tidxdbr.close();
     queryDbr.close();
@@ -279,11 +281,7 @@ int kmersearch(int argc, const char **argv, const Command &command) {
         DBWriter writer(par.db3.c_str(), par.db3Index.c_str(), 1, par.compressed, outDbType);
         writer.open(); // 1 GB buffer
         std::vector<char> empty;
-        if(Parameters::isEqualDbtype(querySeqType, Parameters::DBTYPE_NUCLEOTIDES)) {
-            mergeKmerFilesAndOutput<Parameters::DBTYPE_NUCLEOTIDES, KmerEntryRev>(writer, splitFiles, empty);
-        }else{
-            mergeKmerFilesAndOutput<Parameters::DBTYPE_AMINO_ACIDS, KmerEntry>(writer, splitFiles, empty);
-        }
+        mergeKmerFilesAndOutput(writer, splitFiles, empty);
         for(size_t i = 0; i < splitFiles.size(); i++){
             FileUtil::remove(splitFiles[i].c_str());
             std::string splitFilesDone = splitFiles[i] + ".done";
@@ -420,9 +418,9 @@ std::pair<KmerPosition<short> *,size_t > KmerSearch::searchInIndex(KmerPosition<
     Debug(Debug::INFO) << "Time to find k-mers: " << timer.lap() << "\n";
     timer.reset();
     if(TYPE == Parameters::DBTYPE_NUCLEOTIDES) {
-        SORT_PARALLEL(kmers, kmers + writePos, KmerPosition<short>::compareRepSequenceAndIdAndDiagReverse);
+        RadixSort::sort(kmers, kmers + writePos, KmerPosition<short>::RepSequenceAndIdKey(), KmerPosition<short>::compareRepSequenceAndIdAndDiagReverse);
     }else{
-        SORT_PARALLEL(kmers, kmers + writePos, KmerPosition<short>::compareRepSequenceAndIdAndDiag);
+        RadixSort::sort(kmers, kmers + writePos, KmerPosition<short>::RepSequenceAndIdKey(), KmerPosition<short>::compareRepSequenceAndIdAndDiag);
     }
 
     Debug(Debug::INFO) << "Time to sort: " << timer.lap() << "\n";
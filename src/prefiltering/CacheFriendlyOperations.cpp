@@ -4,18 +4,35 @@
 #include <cmath>
 
 template<unsigned int BINSIZE>
-CacheFriendlyOperations<BINSIZE>::CacheFriendlyOperations(size_t maxElement, size_t initBinSize) {
+size_t CacheFriendlyOperations<BINSIZE>::computeDuplicateBitArraySize(size_t maxElement) {
     // find nearest upper power of 2^(x)
     size_t size = pow(2, ceil(log(maxElement)/log(2)));
-    size = std::max(size >> MASK_0_5_BIT, (size_t) 1); // space needed in bit array
-    duplicateBitArraySize = size;
-    duplicateBitArray = new(std::nothrow) unsigned char[size];
+    return std::max(size >> MASK_0_5_BIT, (size_t) 1); // space needed in bit array
+}
+
+template<unsigned int BINSIZE>
+size_t CacheFriendlyOperations<BINSIZE>::computeBinSize(size_t initBinSize) {
+    // find nearest upper power of 2^(x)
+    return pow(2, ceil(log(initBinSize)/log(2)));
+}
+
+template<unsigned int BINSIZE>
+size_t CacheFriendlyOperations<BINSIZE>::getMemoryConsumption(size_t maxElement, size_t initBinSize) {
+    const size_t binSize = computeBinSize(initBinSize);
+    return computeDuplicateBitArraySize(maxElement) * sizeof(unsigned char)
+           + binSize * sizeof(TmpResult)
+           + BINCOUNT * sizeof(CounterResult *)
+           + BINCOUNT * binSize * sizeof(CounterResult);
+}
+
+template<unsigned int BINSIZE>
+CacheFriendlyOperations<BINSIZE>::CacheFriendlyOperations(size_t maxElement, size_t initBinSize) {
+    duplicateBitArraySize = computeDuplicateBitArraySize(maxElement);
+    duplicateBitArray = new(std::nothrow) unsigned char[duplicateBitArraySize];
     Util::checkAllocation(duplicateBitArray, "Cannot allocate duplicateBitArray memory in CacheFriendlyOperations");
     memset(duplicateBitArray, 0, duplicateBitArraySize * sizeof(unsigned char));
 
-    // find nearest upper power of 2^(x)
-    initBinSize = pow(2, ceil(log(initBinSize)/log(2)));
-    binSize = initBinSize;
+    binSize = computeBinSize(initBinSize);
     tmpElementBuffer = new(std::nothrow) TmpResult[binSize];
     Util::checkAllocation(tmpElementBuffer, "Cannot allocate tmpElementBuffer memory in CacheFriendlyOperations");
 
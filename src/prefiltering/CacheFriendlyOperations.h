@@ -78,7 +78,13 @@ public:
 
     size_t keepMaxScoreElementOnly(CounterResult *inputOutputArray, const size_t N);
 
+    // bytes allocated by the constructor
+    static size_t getMemoryConsumption(size_t maxElement, size_t initBinSize);
+
 private:
+    static size_t computeDuplicateBitArraySize(size_t maxElement);
+    static size_t computeBinSize(size_t initBinSize);
+
     // this bit array should fit in L1/L2
     size_t duplicateBitArraySize;
     unsigned char *duplicateBitArray;
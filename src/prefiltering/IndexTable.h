@@ -17,6 +17,9 @@
 #include "KmerGenerator.h"
 #include "Parameters.h"
 #include "FastSort.h"
+#include "HugePageMemory.h"
+#include "PostingListCodec.h"
+#include "ByteParser.h"
 #include <stdlib.h>
 #include <algorithm>
 
@@ -67,11 +70,12 @@ public:
     IndexTable(int alphabetSize, int kmerSize, bool externalData)
             : tableSize(MathUtil::ipow<size_t>(alphabetSize, kmerSize)), alphabetSize(alphabetSize),
               kmerSize(kmerSize), externalData(externalData), tableEntriesNum(0), size(0),
-              indexer(new Indexer(alphabetSize, kmerSize)), entries(NULL), offsets(NULL) {
+              indexer(new Indexer(alphabetSize, kmerSize)), entries(NULL), offsets(NULL),
+              compressedEntries(NULL), compressedSize(0) {
         if (externalData == false) {
-            offsets = new(std::nothrow) size_t[tableSize + 1];
+            // anonymous mappings are zero initialized
+            offsets = static_cast<size_t *>(HugePageMemory::allocate((tableSize + 1) * sizeof(size_t)));
             Util::checkAllocation(offsets, "Can not allocate entries memory in IndexTable");
-            memset(offsets, 0, (tableSize + 1) * sizeof(size_t));
         }
     }
 
@@ -83,13 +87,17 @@ public:
     void deleteEntries() {
         if (externalData == false) {
             if (entries != NULL) {
-                delete[] entries;
+                HugePageMemory::free(entries, tableEntriesNum * sizeof(IndexEntryLocal));
                 entries = NULL;
             }
             if (offsets != NULL) {
-                delete[] offsets;
+                HugePageMemory::free(offsets, (tableSize + 1) * sizeof(size_t));
                 offsets = NULL;
             }
+            if (compressedEntries != NULL) {
+                HugePageMemory::free(compressedEntries, compressedSize + PostingListCodec::PADDING);
+                compressedEntries = NULL;
+            }
         }
     }
 
@@ -129,6 +137,13 @@ public:
     // count k-mers in the sequence, so enough memory for the sequence lists can be allocated in the end
     size_t addKmerCount(Sequence *s, Indexer *idxer, unsigned int *seqKmerPosBuffer,
                         int threshold, char *diagonalScore) {
+        return countKmers(s, idxer, seqKmerPosBuffer, threshold, diagonalScore, kmerSize, offsets);
+    }
+
+    // count the distinct k-mers of the sequence that go into an index table,
+    // the counts are added to offsets unless it is NULL
+    static size_t countKmers(Sequence *s, Indexer *idxer, unsigned int *seqKmerPosBuffer,
+                             int threshold, char *diagonalScore, int kmerSize, size_t *offsets) {
         s->resetCurrPos();
         size_t countKmer = 0;
         bool removeX = (Parameters::isEqualDbtype(s->getSequenceType(), Parameters::DBTYPE_NUCLEOTIDES) ||
@@ -161,7 +176,9 @@ public:
             if(prevKmerIdx != kmerIdx){
                 //table[kmerIdx] += 1;
                 // size increases by one
-                __sync_fetch_and_add(&(offsets[kmerIdx]), 1);
+                if (offsets != NULL) {
+                    __sync_fetch_and_add(&(offsets[kmerIdx]), 1);
+                }
                 countUniqKmer++;
             }
             prevKmerIdx = kmerIdx;
@@ -176,6 +193,53 @@ public:
         return (entries + offsets[kmer]);
     }
 
+    // get the encoded list of DB sequences containing this k-mer (only for compressed tables)
+    inline const unsigned char *getCompressedDBSeqList(size_t kmer, size_t *matchedListSize) {
+        if (offsets[kmer + 1] == offsets[kmer]) {
+            *matchedListSize = 0;
+            return NULL;
+        }
+        return PostingListCodec::decodeCount(compressedEntries + offsets[kmer], matchedListSize);
+    }
+
+    bool isCompressed() {
+        return compressedEntries != NULL;
+    }
+
+    // replaces the sorted sequence lists by their compressed representation
+    // offsets point to byte positions in the compressed entries afterwards
+    void compressEntries() {
+        size_t *byteOffsets = static_cast<size_t *>(HugePageMemory::allocate((tableSize + 1) * sizeof(size_t)));
+        Util::checkAllocation(byteOffsets, "Can not allocate offsets memory in IndexTable::compressEntries");
+        #pragma omp parallel for schedule(dynamic, 1024)
+        for (size_t i = 0; i < tableSize; i++) {
+            size_t entrySize;
+            IndexEntryLocal *list = getDBSeqList(i, &entrySize);
+            byteOffsets[i + 1] = PostingListCodec::encodedSize(list, entrySize);
+        }
+        byteOffsets[0] = 0;
+        for (size_t i = 0; i < tableSize; i++) {
+            byteOffsets[i + 1] += byteOffsets[i];
+        }
+
+        compressedSize = byteOffsets[tableSize];
+        compressedEntries = static_cast<unsigned char *>(HugePageMemory::allocate(compressedSize + PostingListCodec::PADDING));
+        Util::checkAllocation(compressedEntries, "Can not allocate " + SSTR(compressedSize) + " bytes for compressed entries in IndexTable::compressEntries");
+        #pragma omp parallel for schedule(dynamic, 1024)
+        for (size_t i = 0; i < tableSize; i++) {
+            size_t entrySize;
+            IndexEntryLocal *list = getDBSeqList(i, &entrySize);
+            PostingListCodec::encode(list, entrySize, compressedEntries + byteOffsets[i]);
+        }
+
+        HugePageMemory::free(entries, tableEntriesNum * sizeof(IndexEntryLocal));
+        entries = NULL;
+        HugePageMemory::free(offsets, (tableSize + 1) * sizeof(size_t));
+        offsets = byteOffsets;
+        Debug(Debug::INFO) << "Compressed entries from " << ByteParser::format(tableEntriesNum * sizeof(IndexEntryLocal))
+                           << " to " << ByteParser::format(compressedSize) << "\n";
+    }
+
     void sortDBSeqLists() {
         #pragma omp parallel for
         for (size_t i = 0; i < tableSize; i++) {
@@ -190,6 +254,14 @@ public:
         return entries;
     }
 
+    unsigned char *getCompressedEntries() {
+        return compressedEntries;
+    }
+
+    size_t getCompressedSize() {
+        return compressedSize;
+    }
+
     inline size_t getOffset(size_t kmer) {
         return offsets[kmer];
     }
@@ -209,7 +281,7 @@ public:
         this->size = dbSize; // amount of sequences added
 
         // allocate memory for the sequence id lists
-        entries = new(std::nothrow) IndexEntryLocal[tableEntriesNum];
+        entries = static_cast<IndexEntryLocal *>(HugePageMemory::allocate(tableEntriesNum * sizeof(IndexEntryLocal)));
         Util::checkAllocation(entries, "Can not allocate entries memory in IndexTable::initMemory");
     }
 
@@ -234,17 +306,49 @@ public:
         this->offsets = entryOffsets;
     }
 
+    // init compressed index table with external data, compressedData has to be padded by PostingListCodec::PADDING bytes
+    void initTableByExternalCompressedData(size_t sequenceCount, size_t tableEntriesNum, unsigned char *compressedData, size_t *byteOffsets) {
+        this->tableEntriesNum = tableEntriesNum;
+        this->size = sequenceCount;
+        this->compressedSize = byteOffsets[tableSize];
+
+        this->compressedEntries = compressedData;
+        this->offsets = byteOffsets;
+    }
+
+    void initTableByExternalCompressedDataCopy(size_t sequenceCount, size_t tableEntriesNum, unsigned char *compressedData, size_t *byteOffsets) {
+        this->tableEntriesNum = tableEntriesNum;
+        this->size = sequenceCount;
+        this->compressedSize = byteOffsets[tableSize];
+
+        this->compressedEntries = static_cast<unsigned char *>(HugePageMemory::allocate(compressedSize + PostingListCodec::PADDING));
+        Util::checkAllocation(compressedEntries, "Can not allocate " + SSTR(compressedSize) + " bytes for compressed entries in IndexTable::initMemory");
+        memcpy(this->compressedEntries, compressedData, compressedSize + PostingListCodec::PADDING);
+
+        memcpy(this->offsets, byteOffsets, (tableSize + 1) * sizeof(size_t));
+    }
+
     void initTableByExternalDataCopy(size_t sequenceCount, size_t tableEntriesNum, IndexEntryLocal *entries, size_t *entryOffsets) {
         this->tableEntriesNum = tableEntriesNum;
         this->size = sequenceCount;
 
-        this->entries = new(std::nothrow) IndexEntryLocal[tableEntriesNum];
+        this->entries = static_cast<IndexEntryLocal *>(HugePageMemory::allocate(tableEntriesNum * sizeof(IndexEntryLocal)));
         Util::checkAllocation(entries, "Can not allocate " + SSTR(tableEntriesNum * sizeof(IndexEntryLocal)) + " bytes for entries in IndexTable::initMemory");
         memcpy(this->entries, entries, tableEntriesNum * sizeof(IndexEntryLocal));
 
         memcpy(this->offsets, entryOffsets, (tableSize + 1) * sizeof(size_t));
     }
 
+    // fraction of the entries and offsets arrays backed by huge pages
+    double getHugePageCoverage() {
+        const void *entriesData = isCompressed() ? static_cast<void *>(compressedEntries) : static_cast<void *>(entries);
+        const size_t entriesBytes = isCompressed() ? compressedSize : tableEntriesNum * sizeof(IndexEntryLocal);
+        const size_t offsetsBytes = (tableSize + 1) * sizeof(size_t);
+        const size_t hugeBytes = HugePageMemory::hugePageBytes(entriesData, entriesBytes)
+                                 + HugePageMemory::hugePageBytes(offsets, offsetsBytes);
+        return static_cast<double>(hugeBytes) / static_cast<double>(entriesBytes + offsetsBytes);
+    }
+
     void revertPointer() {
         for (size_t i = tableSize; i > 0; i--) {
             offsets[i] = offsets[i - 1];
@@ -263,7 +367,11 @@ public:
         size_t minKmer = 0;
         size_t emptyKmer = 0;
         for (size_t i = 0; i < tableSize; i++) {
-            const ptrdiff_t size = offsets[i + 1] - offsets[i];
+            // offsets of a compressed table are byte positions, its lists store their entry count
+            size_t size = offsets[i + 1] - offsets[i];
+            if (isCompressed()) {
+                getCompressedDBSeqList(i, &size);
+            }
             minKmer = std::min(minKmer, (size_t) size);
             entrySize += size;
             if (size == 0) {
@@ -284,6 +392,9 @@ public:
         Debug(Debug::INFO) << "Index statistics\n";
         Debug(Debug::INFO) << "Entries:          " << entrySize << "\n";
         Debug(Debug::INFO) << "DB size:          " << (entrySize * sizeof(IndexEntryLocal) + tableSize * sizeof(size_t))/1024/1024 << " MB\n";
+        if (isCompressed()) {
+            Debug(Debug::INFO) << "Compressed size:  " << (compressedSize + tableSize * sizeof(size_t))/1024/1024 << " MB\n";
+        }
         Debug(Debug::INFO) << "Avg k-mer size:   " << avgKmer << "\n";
         Debug(Debug::INFO) << "Top " << top_N << " k-mers\n";
         for (size_t j = 0; j < top_N; j++) {
@@ -478,6 +589,10 @@ protected:
     IndexEntryLocal *entries;
     size_t *offsets;
 
+    // stream-vbyte encoded sequence lists, replaces entries if the table is compressed
+    unsigned char *compressedEntries;
+    size_t compressedSize;
+
     // sequence lookup
     SequenceLookup *sequenceLookup;
 };
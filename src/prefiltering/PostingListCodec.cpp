@@ -0,0 +1,137 @@
+#include "PostingListCodec.h"
+#include "IndexTable.h"
+#include "simd.h"
+
+#include <algorithm>
+#include <cstring>
+
+// shuffle masks and data lengths for each of the 256 possible control bytes
+struct StreamVByteTables {
+    uint8_t shuffle[256][16];
+    uint8_t length[256];
+
+    StreamVByteTables() {
+        for (unsigned int control = 0; control < 256; control++) {
+            unsigned int byte = 0;
+            for (unsigned int i = 0; i < 4; i++) {
+                const unsigned int len = ((control >> (2 * i)) & 0x3) + 1;
+                for (unsigned int j = 0; j < 4; j++) {
+                    // 0xFF makes the shuffle write zero bytes
+                    shuffle[control][4 * i + j] = (j < len) ? static_cast<uint8_t>(byte + j) : 0xFF;
+                }
+                byte += len;
+            }
+            length[control] = static_cast<uint8_t>(byte);
+        }
+    }
+};
+
+static const StreamVByteTables tables;
+
+size_t PostingListCodec::encodedSize(const IndexEntryLocal *entries, size_t n) {
+    if (n == 0) {
+        return 0;
+    }
+    size_t size = 1;
+    for (size_t value = n; value >= 0x80; value >>= 7) {
+        size++;
+    }
+    size += (n + 3) / 4 + n * sizeof(unsigned short);
+    uint32_t prev = 0;
+    for (size_t i = 0; i < n; i++) {
+        size += deltaLength(entries[i].seqId - prev);
+        prev = entries[i].seqId;
+    }
+    return size;
+}
+
+size_t PostingListCodec::estimateEncodedSize(size_t entries, size_t lists, size_t sequences) {
+    if (entries == 0) {
+        return 0;
+    }
+    lists = std::max(std::min(lists, entries), (size_t) 1);
+    const size_t listLength = entries / lists;
+    size_t countSize = 1;
+    for (size_t value = listLength; value >= 0x80; value >>= 7) {
+        countSize++;
+    }
+    const size_t gap = std::min(sequences / std::max(listLength, (size_t) 1), (size_t) UINT32_MAX);
+    // count, control bytes (rounded up per list), positions and deltas
+    return lists * countSize + entries / 4 + lists
+           + entries * (sizeof(unsigned short) + deltaLength(static_cast<uint32_t>(gap)));
+}
+
+size_t PostingListCodec::encode(const IndexEntryLocal *entries, size_t n, unsigned char *out) {
+    if (n == 0) {
+        return 0;
+    }
+    unsigned char *start = out;
+    size_t value = n;
+    while (value >= 0x80) {
+        *out++ = static_cast<unsigned char>(value | 0x80);
+        value >>= 7;
+    }
+    *out++ = static_cast<unsigned char>(value);
+
+    unsigned char *control = out;
+    const size_t controlBytes = (n + 3) / 4;
+    memset(control, 0, controlBytes);
+    unsigned char *positions = control + controlBytes;
+    for (size_t i = 0; i < n; i++) {
+        memcpy(positions + i * sizeof(unsigned short), &entries[i].position_j, sizeof(unsigned short));
+    }
+    unsigned char *data = positions + n * sizeof(unsigned short);
+
+    uint32_t prev = 0;
+    for (size_t i = 0; i < n; i++) {
+        const uint32_t delta = entries[i].seqId - prev;
+        prev = entries[i].seqId;
+        const unsigned int len = deltaLength(delta);
+        control[i / 4] |= static_cast<unsigned char>((len - 1) << (2 * (i % 4)));
+        // little endian byte order
+        for (unsigned int j = 0; j < len; j++) {
+            *data++ = static_cast<unsigned char>(delta >> (8 * j));
+        }
+    }
+    return static_cast<size_t>(data - start);
+}
+
+void PostingListCodec::decode(const unsigned char *payload, size_t n, IndexEntryLocal *out) {
+    const unsigned char *control = payload;
+    const size_t controlBytes = (n + 3) / 4;
+    const unsigned char *positions = control + controlBytes;
+    const unsigned char *data = positions + n * sizeof(unsigned short);
+
+    const size_t fullGroups = n / 4;
+    __m128i prev = _mm_setzero_si128();
+    uint32_t ids[4];
+    for (size_t group = 0; group < fullGroups; group++) {
+        const unsigned char c = control[group];
+        __m128i deltas = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(data)),
+                                          _mm_loadu_si128(reinterpret_cast<const __m128i *>(tables.shuffle[c])));
+        data += tables.length[c];
+        // prefix sum over the four deltas plus the last id of the previous group
+        deltas = _mm_add_epi32(deltas, _mm_slli_si128(deltas, 4));
+        deltas = _mm_add_epi32(deltas, _mm_slli_si128(deltas, 8));
+        deltas = _mm_add_epi32(deltas, prev);
+        prev = _mm_shuffle_epi32(deltas, 0xFF);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(ids), deltas);
+        for (size_t i = 0; i < 4; i++) {
+            out[4 * group + i].seqId = ids[i];
+            memcpy(&out[4 * group + i].position_j, positions + (4 * group + i) * sizeof(unsigned short), sizeof(unsigned short));
+        }
+    }
+
+    uint32_t id = static_cast<uint32_t>(_mm_cvtsi128_si32(prev));
+    for (size_t i = fullGroups * 4; i < n; i++) {
+        const unsigned int len = ((control[i / 4] >> (2 * (i % 4))) & 0x3) + 1;
+        uint32_t delta = 0;
+        for (unsigned int j = 0; j < len; j++) {
+            delta |= static_cast<uint32_t>(data[j]) << (8 * j);
+        }
+        data += len;
+        id += delta;
+        out[i].seqId = id;
+        memcpy(&out[i].position_j, positions + i * sizeof(unsigned short), sizeof(unsigned short));
+    }
+}
@@ -0,0 +1,54 @@
+#ifndef POSTING_LIST_CODEC_H
+#define POSTING_LIST_CODEC_H
+
+// Compressed representation of the k-mer sequence lists of the IndexTable.
+//
+// A list of n entries sorted by (seqId, position_j) is stored as
+//   [n as varint][(n + 3) / 4 control bytes][n 16-bit positions][stream-vbyte encoded seqId deltas]
+// Each control byte holds the byte length (1-4) of four deltas, which allows decoding
+// four seqIds at once with a byte shuffle followed by a prefix sum (stream-vbyte).
+// Decoding may read up to PADDING bytes past the end of a list, buffers holding encoded
+// lists have to be padded accordingly.
+
+#include <cstddef>
+#include <stdint.h>
+
+struct IndexEntryLocal;
+
+class PostingListCodec {
+public:
+    static const size_t PADDING = 16;
+
+    // size of the encoded list in bytes
+    static size_t encodedSize(const IndexEntryLocal *entries, size_t n);
+
+    // expected encoded size of entries spread over lists non-empty lists of a split with sequences sequences,
+    // the seqId deltas are estimated by the average gap between the sequences of a list
+    static size_t estimateEncodedSize(size_t entries, size_t lists, size_t sequences);
+
+    // encodes n sorted entries into out and returns the number of written bytes
+    static size_t encode(const IndexEntryLocal *entries, size_t n, unsigned char *out);
+
+    // reads the number of entries of a list and returns the pointer to its payload
+    static inline const unsigned char *decodeCount(const unsigned char *in, size_t *n) {
+        size_t value = 0;
+        unsigned int shift = 0;
+        while (*in & 0x80) {
+            value |= static_cast<size_t>(*in & 0x7F) << shift;
+            shift += 7;
+            in++;
+        }
+        *n = value | (static_cast<size_t>(*in) << shift);
+        return in + 1;
+    }
+
+    // decodes the n entries of the payload returned by decodeCount into out
+    static void decode(const unsigned char *payload, size_t n, IndexEntryLocal *out);
+
+private:
+    static inline unsigned int deltaLength(uint32_t delta) {
+        return (delta < (1u << 8)) ? 1 : (delta < (1u << 16)) ? 2 : (delta < (1u << 24)) ? 3 : 4;
+    }
+};
+
+#endif
@@ -14,6 +14,10 @@
 #include "Parameters.h"
 #include "MemoryMapped.h"
 #include "FastSort.h"
+#include "BinaryResult.h"
+#include "DBReadahead.h"
+#include "ChunkScheduler.h"
+#include "WorkflowExecutor.h"
 #include <sys/mman.h>
 
 #ifdef OPENMP
@@ -51,8 +55,9 @@ Prefiltering::Prefiltering(const std::string &queryDB,
         aaBiasCorrection(par.compBiasCorrection != 0),
         aaBiasCorrectionScale(par.compBiasCorrectionScale),
         covThr(par.covThr), covMode(par.covMode), includeIdentical(par.includeIdentity),
-        preloadMode(par.preloadMode),
-        threads(static_cast<unsigned int>(par.threads)), compressed(par.compressed) {
+        preloadMode(par.preloadMode), readahead(par.readahead), queryBatchSize(static_cast<size_t>(par.queryBatchSize)),
+        threads(static_cast<unsigned int>(par.threads)), compressed(par.compressed),
+        resultDbtype(BinaryResult::setBinaryDbtype(Parameters::DBTYPE_PREFILTER_RES, par.binaryResults == 1)) {
     sameQTDB = isSameQTDB();
 
     // init the substitution matrices
@@ -87,8 +92,13 @@ Prefiltering::Prefiltering(const std::string &queryDB,
             }
         }
 
-        tidxdbr = new DBReader<unsigned int>(targetDB.c_str(), targetDBIndex.c_str(), threads, DBReader<unsigned int>::USE_INDEX | DBReader<unsigned int>::USE_DATA);
-        tidxdbr->open(DBReader<unsigned int>::NOSORT);
+        // a workflow running in the same process keeps the index open between its steps
+        tidxdbr = WorkflowExecutor::getSharedReader(targetDB);
+        sharedTargetReader = (tidxdbr != NULL);
+        if (sharedTargetReader == false) {
+            tidxdbr = new DBReader<unsigned int>(targetDB.c_str(), targetDBIndex.c_str(), threads, DBReader<unsigned int>::USE_INDEX | DBReader<unsigned int>::USE_DATA);
+            tidxdbr->open(DBReader<unsigned int>::NOSORT);
+        }
 
         templateDBIsIndex = PrefilteringIndexReader::checkIfIndexFile(tidxdbr);
         if (templateDBIsIndex == true) {
@@ -157,14 +167,19 @@ Prefiltering::Prefiltering(const std::string &queryDB,
             EXIT(EXIT_FAILURE);
         }
     } else {
-        tdbr = new DBReader<unsigned int>(targetDB.c_str(), targetDBIndex.c_str(), threads, DBReader<unsigned int>::USE_INDEX|DBReader<unsigned int>::USE_DATA);
-        tdbr->open(DBReader<unsigned int>::LINEAR_ACCCESS);
+        tdbr = WorkflowExecutor::getSharedReader(targetDB);
+        sharedTargetReader = (tdbr != NULL);
+        if (sharedTargetReader == false) {
+            tdbr = new DBReader<unsigned int>(targetDB.c_str(), targetDBIndex.c_str(), threads, DBReader<unsigned int>::USE_INDEX|DBReader<unsigned int>::USE_DATA);
+            tdbr->open(DBReader<unsigned int>::LINEAR_ACCCESS);
+        }
         templateDBIsIndex = false;
     }
 
     // restrict amount of allocated memory if all results are requested
     // INT_MAX would allocate 72GB RAM per thread for no reason
     maxResListLen = std::min(tdbr->getSize(), maxResListLen);
+    mergedResListLen = maxResListLen;
 
     // investigate if it makes sense to mask the profile consensus sequence
     if (Parameters::isEqualDbtype(targetSeqType, Parameters::DBTYPE_HMM_PROFILE)) {
@@ -186,9 +201,15 @@ Prefiltering::Prefiltering(const std::string &queryDB,
     }
     Debug(Debug::INFO) << "Query database size: " << qdbr->getSize() << " type: " << Parameters::getDbTypeName(querySeqType) << "\n";
 
-    setupSplit(*tdbr, alphabetSize - 1, querySeqType,
-               threads, templateDBIsIndex, memoryLimit, qdbr->getSize(),
+    // the k-mers of a precomputed index are not sampled and its memory is not recorded
+    splitPlanner = new SplitPlanner(*tdbr, targetDB, templateDBIsIndex ? NULL : kmerSubMat, alphabetSize - 1, querySeqType,
+                                    templateDBIsIndex && PrefilteringIndexReader::hasCompressedEntries(tidxdbr), par);
+    setupSplit(*splitPlanner, templateDBIsIndex, memoryLimit, qdbr->getSize(),
                maxResListLen, kmerSize, splits, splitMode);
+    estimatedSplitMemory = 0;
+    if (templateDBIsIndex == false && splits > 0) {
+        estimatedSplitMemory = splitPlanner->estimateUncalibratedMemory((splitMode == Parameters::TARGET_DB_SPLIT) ? splits : 1, kmerSize, maxResListLen);
+    }
 
     if(Parameters::isEqualDbtype(targetSeqType, Parameters::DBTYPE_NUCLEOTIDES) == false){
         const bool isProfileSearch = Parameters::isEqualDbtype(querySeqType, Parameters::DBTYPE_HMM_PROFILE) ||
@@ -226,6 +247,8 @@ Prefiltering::Prefiltering(const std::string &queryDB,
     } else {
         taxonomyHook = NULL;
     }
+    resultQueue = NULL;
+    streamThreads = threads;
 }
 
 Prefiltering::~Prefiltering() {
@@ -246,10 +269,14 @@ Prefiltering::~Prefiltering() {
         delete sequenceLookup;
     }
 
-    tdbr->close();
-    delete tdbr;
+    delete splitPlanner;
+    // the reader of the index is shared, the sequences of the index are always opened here
+    if (templateDBIsIndex == true || sharedTargetReader == false) {
+        tdbr->close();
+        delete tdbr;
+    }
 
-    if (templateDBIsIndex == true) {
+    if (templateDBIsIndex == true && sharedTargetReader == false) {
         tidxdbr->close();
         delete tidxdbr;
     }
@@ -265,12 +292,11 @@ Prefiltering::~Prefiltering() {
     delete kmerSubMat;
 }
 
-void Prefiltering::setupSplit(DBReader<unsigned int>& tdbr, const int alphabetSize, const unsigned int querySeqTyp, const int threads,
-                              const bool templateDBIsIndex, const size_t memoryLimit, const size_t qDbSize,
+void Prefiltering::setupSplit(SplitPlanner &planner, const bool templateDBIsIndex, const size_t memoryLimit, const size_t qDbSize,
                               size_t &maxResListLen, int &kmerSize, int &split, int &splitMode) {
-    size_t memoryNeeded = estimateMemoryConsumption(1, tdbr.getSize(), tdbr.getAminoAcidDBSize(), maxResListLen, alphabetSize,
-                                                    kmerSize == 0 ? // if auto detect kmerSize
-                                                    IndexTable::computeKmerSize(tdbr.getAminoAcidDBSize()) : kmerSize, querySeqTyp, threads);
+    DBReader<unsigned int> &tdbr = planner.getDbReader();
+    size_t memoryNeeded = planner.estimateMemory(1, kmerSize == 0 ? // if auto detect kmerSize
+                                                    IndexTable::computeKmerSize(tdbr.getAminoAcidDBSize()) : kmerSize, maxResListLen);
 
     int optimalSplitMode = Parameters::TARGET_DB_SPLIT;
     if (memoryNeeded > 0.9 * memoryLimit) {
@@ -303,7 +329,7 @@ void Prefiltering::setupSplit(DBReader<unsigned int>& tdbr, const int alphabetSi
     if (memoryNeeded > 0.9 * memoryLimit) {
         // memory is not enough to compute everything at once
         //TODO add PROFILE_STATE (just 6-mers)
-        std::pair<int, int> splitSettings = Prefiltering::optimizeSplit(memoryLimit, &tdbr, alphabetSize, kmerSize, querySeqTyp, threads);
+        std::pair<int, int> splitSettings = planner.optimizeSplit(memoryLimit, kmerSize);
         if (splitSettings.second == -1) {
             Debug(Debug::ERROR) << "Cannot fit databases into " << ByteParser::format(memoryLimit) << ". Please use a computer with more main memory.\n";
             EXIT(EXIT_FAILURE);
@@ -338,6 +364,9 @@ void Prefiltering::setupSplit(DBReader<unsigned int>& tdbr, const int alphabetSi
     // templateDBIsIndex = false when called from indexdb
     if ((static_cast<size_t>(split) < minimalNumSplits) && (templateDBIsIndex)) {
         Debug(Debug::WARNING) << "split was set to " << split << " but at least " << minimalNumSplits << " are required. Please run with default paramerters\n";
+    } else if (sizeOfDbToSplit == 0) {
+        // the split count of an index does not apply to an empty db, an empty result is written
+        split = 0;
     } else if (static_cast<size_t>(split) > sizeOfDbToSplit) {
         Debug(Debug::ERROR) << "split was set to " << split << " but the db to split has only " << sizeOfDbToSplit << " sequences. Please run with default paramerters\n";
         EXIT(EXIT_FAILURE);
@@ -359,8 +388,7 @@ void Prefiltering::setupSplit(DBReader<unsigned int>& tdbr, const int alphabetSi
         Debug(Debug::INFO) << Parameters::getSplitModeName(splitMode) << " split mode. Searching through " << split << " splits\n";
     }
 
-    size_t memoryNeededPerSplit = estimateMemoryConsumption((splitMode == Parameters::TARGET_DB_SPLIT) ? split : 1, tdbr.getSize(),
-                                                            tdbr.getAminoAcidDBSize(), maxResListLen, alphabetSize, kmerSize, querySeqTyp, threads);
+    size_t memoryNeededPerSplit = planner.estimateMemory((splitMode == Parameters::TARGET_DB_SPLIT) ? std::max(split, 1) : 1, kmerSize, maxResListLen);
     Debug(Debug::INFO) << "Estimated memory consumption: " << ByteParser::format(memoryNeededPerSplit) << "\n";
     if (memoryNeededPerSplit > 0.9 * memoryLimit) {
         Debug(Debug::WARNING) << "Process needs more than " << ByteParser::format(memoryLimit) << " main memory.\n" <<
@@ -371,7 +399,50 @@ void Prefiltering::setupSplit(DBReader<unsigned int>& tdbr, const int alphabetSi
     }
 }
 
-void Prefiltering::mergeTargetSplits(const std::string &outDB, const std::string &outDBIndex, const std::vector<std::pair<std::string, std::string>> &fileNames, unsigned int threads) {
+namespace {
+// reads the hits of one query from one target split, the hits after the first are sorted by
+// score and id, only the identity hit may be placed in front of them
+struct SplitHitCursor {
+    SplitHitCursor(char *data, size_t entryLength, bool binary)
+        : text(data), reader(data, binary ? entryLength : 0), binary(binary) {}
+
+    bool next(hit_t &hit) {
+        if (binary) {
+            if (reader.next() == false) {
+                return false;
+            }
+            hit = reader.getHit();
+            return true;
+        }
+        if (text == NULL || *text == '\0') {
+            return false;
+        }
+        hit = QueryMatcher::parsePrefilterHit(text);
+        text = Util::skipLine(text);
+        return true;
+    }
+
+    char *text;
+    BinaryResult::EntryReader reader;
+    bool binary;
+};
+
+struct MergeHead {
+    hit_t hit;
+    // cursors are merged twice, once for their first hit and once for the sorted rest
+    size_t source;
+};
+
+// max heap on the merge order of hit_t::compareHitsByScoreAndId
+struct MergeHeadComparator {
+    bool operator()(const MergeHead &lhs, const MergeHead &rhs) const {
+        return hit_t::compareHitsByScoreAndId(rhs.hit, lhs.hit);
+    }
+};
+}
+
+void Prefiltering::mergeTargetSplits(const std::string &outDB, const std::string &outDBIndex, const std::vector<std::pair<std::string, std::string>> &fileNames,
+                                     unsigned int threads, size_t maxResListLen, int compressed) {
     // we assume that the hits are in the same order
     const size_t splits = fileNames.size();
 
@@ -383,53 +454,28 @@ void Prefiltering::mergeTargetSplits(const std::string &outDB, const std::string
 
     Timer timer;
     Debug(Debug::INFO) << "Merging " << splits << " target splits to " << FileUtil::baseName(outDB) << "\n";
-    DBReader<unsigned int> reader1(fileNames[0].first.c_str(), fileNames[0].second.c_str(), 1, DBReader<unsigned int>::USE_INDEX);
-    reader1.open(DBReader<unsigned int>::NOSORT);
-    DBReader<unsigned int>::Index *index1 = reader1.getIndex();
-
-    size_t totalSize = 0;
-    for (size_t id = 0; id < reader1.getSize(); id++) {
-        totalSize += index1[id].length;
-    }
-    for (size_t i = 1; i < splits; ++i) {
-        DBReader<unsigned int> reader2(fileNames[i].first.c_str(), fileNames[i].second.c_str(), 1, DBReader<unsigned int>::USE_INDEX);
-        reader2.open(DBReader<unsigned int>::NOSORT);
-        DBReader<unsigned int>::Index *index2 = reader2.getIndex();
-        size_t currOffset = 0;
-        for (size_t id = 0; id < reader1.getSize(); id++) {
-            // add length for file1 and file2 and subtract -1 for one null byte
-            size_t seqLen = index1[id].length + index2[id].length - 1;
-            totalSize += index2[id].length - 1;
-            index1[id].length = seqLen;
-            index1[id].offset = currOffset;
-            currOffset += seqLen;
-        }
-        reader2.close();
-    }
-    reader1.setDataSize(totalSize);
-
-    FILE ** files = new FILE*[fileNames.size()];
-    char ** dataFile = new char*[fileNames.size()];
-    size_t * dataFileSize = new size_t[fileNames.size()];
-    size_t globalIdOffset = 0;
+    // entries of all splits are found through their index, binary entries may contain null bytes
+    std::vector<DBReader<unsigned int>*> splitReaders;
     for (size_t i = 0; i < splits; ++i) {
-        files[i] = FileUtil::openFileOrDie(fileNames[i].first.c_str(), "r", true);
-        dataFile[i] = static_cast<char*>(FileUtil::mmapFile(files[i], &dataFileSize[i]));
-#ifdef HAVE_POSIX_MADVISE
-        if (dataFileSize[i] > 0 && posix_madvise (dataFile[i], dataFileSize[i], POSIX_MADV_SEQUENTIAL) != 0){
-            Debug(Debug::ERROR) << "posix_madvise returned an error " << fileNames[i].first << "\n";
+        DBReader<unsigned int> *splitReader = new DBReader<unsigned int>(fileNames[i].first.c_str(), fileNames[i].second.c_str(), threads, DBReader<unsigned int>::USE_INDEX|DBReader<unsigned int>::USE_DATA);
+        splitReader->open(DBReader<unsigned int>::NOSORT);
+        if (i > 0 && splitReader->getSize() != splitReaders[0]->getSize()) {
+            Debug(Debug::ERROR) << "Target split " << fileNames[i].first << " has " << splitReader->getSize() << " entries instead of " << splitReaders[0]->getSize() << "\n";
+            EXIT(EXIT_FAILURE);
         }
-#endif
-
+        splitReaders.push_back(splitReader);
     }
-    Debug(Debug::INFO) << "Preparing offsets for merging: " << timer.lap() << "\n";
-    // merge target splits data files and sort the hits at the same time
-    // TODO: compressed?
-    DBWriter writer(outDB.c_str(), outDBIndex.c_str(), threads, 0, Parameters::DBTYPE_PREFILTER_RES);
+    const size_t querySize = splitReaders[0]->getSize();
+    const int dbtype = splitReaders[0]->getDbtype();
+    const bool binary = BinaryResult::isBinaryDbtype(dbtype);
+
+    DBWriter writer(outDB.c_str(), outDBIndex.c_str(), threads, compressed, dbtype);
     writer.open();
 
-    Debug::Progress progress(reader1.getSize());
-#pragma omp parallel num_threads(threads)
+    // the split results are sorted, so a heap merge only has to read the maxResListLen best hits of every query
+    size_t truncated = 0;
+    Debug::Progress progress(querySize);
+#pragma omp parallel num_threads(threads) reduction(+: truncated)
     {
         unsigned int thread_idx = 0;
 #ifdef OPENMP
@@ -439,53 +485,66 @@ void Prefiltering::mergeTargetSplits(const std::string &outDB, const std::string
         result.reserve(1024);
         std::vector<hit_t> hits;
         hits.reserve(300);
+        std::vector<SplitHitCursor> cursors;
+        cursors.reserve(splits);
+        std::vector<MergeHead> heap;
+        heap.reserve(2 * splits);
+        MergeHeadComparator comparator;
         char buffer[1024];
-        size_t * currentDataFileOffset = new size_t[splits];
-        memset(currentDataFileOffset, 0, sizeof(size_t)*splits);
-        size_t currentId = __sync_fetch_and_add(&(globalIdOffset), 1);
-        size_t prevId = 0;
-        while(currentId < reader1.getSize()){
+
+#pragma omp for schedule(dynamic, 10)
+        for (size_t id = 0; id < querySize; id++) {
             progress.updateProgress();
-            for(size_t file = 0; file < splits; file++){
-                size_t tmpId = prevId;
-                size_t pos;
-                for(pos = currentDataFileOffset[file]; pos < dataFileSize[file] && tmpId != currentId; pos++){
-                    tmpId += (dataFile[file][pos] == '\0');
-                    currentDataFileOffset[file] = pos;
+            for (size_t file = 0; file < splits; file++) {
+                cursors.emplace_back(splitReaders[file]->getData(id, thread_idx), splitReaders[file]->getEntryLen(id), binary);
+                MergeHead head;
+                if (cursors[file].next(head.hit)) {
+                    head.source = 2 * file;
+                    heap.push_back(head);
+                    std::push_heap(heap.begin(), heap.end(), comparator);
+                }
+                if (cursors[file].next(head.hit)) {
+                    head.source = 2 * file + 1;
+                    heap.push_back(head);
+                    std::push_heap(heap.begin(), heap.end(), comparator);
                 }
-                currentDataFileOffset[file] = pos;
-                QueryMatcher::parsePrefilterHits(&dataFile[file][pos], hits);
             }
-            if (hits.size() > 1) {
-                SORT_SERIAL(hits.begin(), hits.end(), hit_t::compareHitsByScoreAndId);
+            while (heap.empty() == false && hits.size() < maxResListLen) {
+                std::pop_heap(heap.begin(), heap.end(), comparator);
+                MergeHead &head = heap.back();
+                hits.push_back(head.hit);
+                // the first hit of a cursor is its own source and is not refilled
+                if ((head.source & 1) == 1 && cursors[head.source / 2].next(head.hit)) {
+                    std::push_heap(heap.begin(), heap.end(), comparator);
+                } else {
+                    heap.pop_back();
+                }
             }
-            for (size_t i = 0; i < hits.size(); ++i) {
-                int len = QueryMatcher::prefilterHitToBuffer(buffer, hits[i]);
-                result.append(buffer, len);
+            truncated += (heap.empty() == false);
+            if (binary) {
+                BinaryResult::appendPrefilterHits(result, hits.data(), hits.size());
+            } else {
+                for (size_t i = 0; i < hits.size(); ++i) {
+                    int len = QueryMatcher::prefilterHitToBuffer(buffer, hits[i]);
+                    result.append(buffer, len);
+                }
             }
-            writer.writeData(result.c_str(), result.size(), reader1.getDbKey(currentId), thread_idx);
+            writer.writeData(result.c_str(), result.size(), splitReaders[0]->getDbKey(id), thread_idx);
             hits.clear();
+            heap.clear();
+            cursors.clear();
             result.clear();
-            prevId = currentId;
-            currentId = __sync_fetch_and_add(&(globalIdOffset), 1);
         }
-
-            delete[] currentDataFileOffset;
     }
     writer.close();
-    reader1.close();
-
     for (size_t i = 0; i < splits; ++i) {
+        splitReaders[i]->close();
+        delete splitReaders[i];
         DBReader<unsigned int>::removeDb(fileNames[i].first);
-        FileUtil::munmapData(dataFile[i], dataFileSize[i]);
-        if (fclose(files[i]) != 0) {
-            Debug(Debug::ERROR) << "Cannot close file " << fileNames[i].first << "\n";
-            EXIT(EXIT_FAILURE);
-        }
     }
-    delete [] dataFile;
-    delete [] dataFileSize;
-    delete [] files;
+    if (truncated > 0) {
+        Debug(Debug::INFO) << truncated << " merged result lists were truncated to " << maxResListLen << " hits\n";
+    }
 
     Debug(Debug::INFO) << "Time for merging target splits: " << timer.lap() << "\n";
 }
@@ -566,28 +625,12 @@ void Prefiltering::runAllSplits(const std::string &resultDB, const std::string &
 
 #ifdef HAVE_MPI
 void Prefiltering::runMpiSplits(const std::string &resultDB, const std::string &resultDBIndex, const std::string &localTmpPath, const int runRandomId) {
-    if(compressed == true && splitMode == Parameters::TARGET_DB_SPLIT){
-            Debug(Debug::WARNING) << "The output of the prefilter cannot be compressed during target split mode. "
-                                     "Prefilter result will not be compressed.\n";
-            compressed = false;
-    }
-
-    // if split size is great than nodes than we have to
-    // distribute all splits equally over all nodes
-    unsigned int * splitCntPerProc = new unsigned int[MMseqsMPI::numProc];
-    memset(splitCntPerProc, 0, sizeof(unsigned int) * MMseqsMPI::numProc);
-    for(int i = 0; i < splits; i++){
-        splitCntPerProc[i % MMseqsMPI::numProc] += 1;
-    }
-
-    size_t fromSplit = 0;
-    for(int i = 0; i < MMseqsMPI::rank; i++){
-        fromSplit += splitCntPerProc[i];
+    // results of target splits are merged right away, only the merged result is compressed
+    const int outputCompressed = compressed;
+    if (splitMode == Parameters::TARGET_DB_SPLIT) {
+        compressed = 0;
     }
 
-    size_t splitCount = splitCntPerProc[MMseqsMPI::rank];
-    delete[] splitCntPerProc;
-
     // setting names in case of localTmp path
     std::string procTmpResultDB = localTmpPath;
     std::string procTmpResultDBIndex = localTmpPath;
@@ -609,32 +652,37 @@ void Prefiltering::runMpiSplits(const std::string &resultDB, const std::string &
         }
     }
 
-    std::pair<std::string, std::string> result = Util::createTmpFileNames(procTmpResultDB, procTmpResultDBIndex, MMseqsMPI::rank + runRandomId);
-    bool merge = (splitMode == Parameters::QUERY_DB_SPLIT);
-
-    int hasResult = runSplits(result.first, result.second, fromSplit, splitCount, merge) == true ? 1 : 0;
-
-    if (localTmpPath != "") {
-        std::pair<std::string, std::string> resultShared = Util::createTmpFileNames(resultDB, resultDBIndex, MMseqsMPI::rank);
-        // moveDb takes care if file doesn't exist
-        DBReader<unsigned int>::moveDb(result.first, resultShared.first);
+    // ranks pull the next split as soon as they are done with their previous one,
+    // so a rank that got slow splits does not hold up the others
+    int *hasResult = new int[splits]();
+    {
+        ChunkScheduler scheduler(ChunkScheduler::MPI, splits, 1);
+        bool merge = (splitMode == Parameters::QUERY_DB_SPLIT);
+        size_t split = 0;
+        size_t count = 0;
+        while (scheduler.next(split, count)) {
+            std::pair<std::string, std::string> result = Util::createTmpFileNames(procTmpResultDB, procTmpResultDBIndex, split + runRandomId);
+            hasResult[split] = runSplit(result.first, result.second, split, merge) ? 1 : 0;
+            if (hasResult[split] == 1 && localTmpPath != "") {
+                std::pair<std::string, std::string> resultShared = Util::createTmpFileNames(resultDB, resultDBIndex, split);
+                DBReader<unsigned int>::moveDb(result.first, resultShared.first);
+            }
+        }
     }
+    compressed = outputCompressed;
 
     int *results = NULL;
     if (MMseqsMPI::isMaster()) {
-        results = new int[MMseqsMPI::numProc]();
+        results = new int[splits]();
     }
-
-    MPI_Gather(&hasResult, 1, MPI_INT, results, 1, MPI_INT, MMseqsMPI::MASTER, MPI_COMM_WORLD);
+    // each split was processed by exactly one rank
+    MPI_Reduce(hasResult, results, splits, MPI_INT, MPI_MAX, MMseqsMPI::MASTER, MPI_COMM_WORLD);
+    delete[] hasResult;
     if (MMseqsMPI::isMaster()) {
-        // gather does not write the result of the master into the array
-        results[MMseqsMPI::MASTER] = hasResult;
-
         std::vector<std::pair<std::string, std::string>> splitFiles;
-        for (int i = 0; i < MMseqsMPI::numProc; ++i) {
+        for (int i = 0; i < splits; ++i) {
             if (results[i] == 1) {
-                std::pair<std::string, std::string> resultOfRanki = Util::createTmpFileNames(resultDB, resultDBIndex, i);
-                splitFiles.push_back(std::make_pair(resultOfRanki.first, resultOfRanki.second));
+                splitFiles.push_back(Util::createTmpFileNames(resultDB, resultDBIndex, i));
             }
         }
 
@@ -642,7 +690,7 @@ void Prefiltering::runMpiSplits(const std::string &resultDB, const std::string &
             // merge output databases
             mergePrefilterSplits(resultDB, resultDBIndex, splitFiles);
         } else {
-            DBWriter writer(resultDB.c_str(), resultDBIndex.c_str(), 1, compressed, Parameters::DBTYPE_PREFILTER_RES);
+            DBWriter writer(resultDB.c_str(), resultDBIndex.c_str(), 1, compressed, resultDbtype);
             writer.open();
             writer.close();
         }
@@ -670,10 +718,10 @@ int Prefiltering::runSplits(const std::string &resultDB, const std::string &resu
 
     bool hasResult = false;
     if (splitProcessCount > 1) {
-        if(compressed == true && splitMode == Parameters::TARGET_DB_SPLIT){
-            Debug(Debug::WARNING) << "The output of the prefilter cannot be compressed during target split mode. "
-                                     "Prefilter result will not be compressed.\n";
-            compressed = false;
+        // results of target splits are merged right away, only the merged result is compressed
+        const int outputCompressed = compressed;
+        if (splitMode == Parameters::TARGET_DB_SPLIT) {
+            compressed = 0;
         }
         // splits template database into x sequence steps
         std::vector<std::pair<std::string, std::string> > splitFiles;
@@ -686,12 +734,13 @@ int Prefiltering::runSplits(const std::string &resultDB, const std::string &resu
         }
         if (splitFiles.size() > 0) {
             mergePrefilterSplits(resultDB, resultDBIndex, splitFiles);
-            if (splitFiles.size() > 1) {
+            compressed = outputCompressed;
+            if (splitFiles.size() > 1 || (compressed != 0 && splitMode == Parameters::TARGET_DB_SPLIT)) {
                 DBReader<unsigned int> resultReader(resultDB.c_str(), resultDBIndex.c_str(), threads, DBReader<unsigned int>::USE_INDEX | DBReader<unsigned int>::USE_DATA);
                 resultReader.open(DBReader<unsigned int>::NOSORT);
                 resultReader.readMmapedDataInMemory();
                 const std::pair<std::string, std::string> tempDb = Util::databaseNames(resultDB + "_tmp");
-                DBWriter resultWriter(tempDb.first.c_str(), tempDb.second.c_str(), threads, compressed, Parameters::DBTYPE_PREFILTER_RES);
+                DBWriter resultWriter(tempDb.first.c_str(), tempDb.second.c_str(), threads, compressed, resultDbtype);
                 resultWriter.open();
                 resultWriter.sortDatafileByIdOrder(resultReader);
                 resultWriter.close(true);
@@ -706,7 +755,7 @@ int Prefiltering::runSplits(const std::string &resultDB, const std::string &resu
             hasResult = true;
         }
     } else if (splitProcessCount == 0) {
-        DBWriter writer(resultDB.c_str(), resultDBIndex.c_str(), 1, compressed, Parameters::DBTYPE_PREFILTER_RES);
+        DBWriter writer(resultDB.c_str(), resultDBIndex.c_str(), 1, compressed, resultDbtype);
         writer.open();
         writer.close();
         hasResult = false;
@@ -715,8 +764,22 @@ int Prefiltering::runSplits(const std::string &resultDB, const std::string &resu
     return hasResult;
 }
 
+void Prefiltering::runStreaming(ResultQueue *queue, unsigned int streamThreads) {
+    if (canStream() == false) {
+        Debug(Debug::ERROR) << "Prefilter results cannot be streamed if the target database is split\n";
+        EXIT(EXIT_FAILURE);
+    }
+    resultQueue = queue;
+    this->streamThreads = std::max(streamThreads, 1u);
+    for (int split = 0; split < splits; split++) {
+        runSplit("", "", split, false);
+    }
+    resultQueue = NULL;
+}
+
 bool Prefiltering::runSplit(const std::string &resultDB, const std::string &resultDBIndex, size_t split, bool merge) {
     Debug(Debug::INFO) << "Process prefiltering step " << (split + 1) << " of " << splits << "\n\n";
+    Util::resetPeakResidentMemory();
 
     size_t dbFrom = 0;
     size_t dbSize = tdbr->getSize();
@@ -762,11 +825,13 @@ bool Prefiltering::runSplit(const std::string &resultDB, const std::string &resu
 
     size_t localThreads = 1;
 #ifdef OPENMP
-    localThreads = std::max(std::min((size_t)threads, querySize), (size_t)1);
+    localThreads = std::max(std::min((size_t)((resultQueue != NULL) ? streamThreads : threads), querySize), (size_t)1);
 #endif
 
-    DBWriter tmpDbw(resultDB.c_str(), resultDBIndex.c_str(), localThreads, compressed, Parameters::DBTYPE_PREFILTER_RES);
-    tmpDbw.open();
+    DBWriter tmpDbw(resultDB.c_str(), resultDBIndex.c_str(), localThreads, compressed, resultDbtype);
+    if (resultQueue == NULL) {
+        tmpDbw.open();
+    }
 
     // init all thread-specific data structures
     char *notEmpty = new char[querySize];
@@ -781,6 +846,7 @@ bool Prefiltering::runSplit(const std::string &resultDB, const std::string &resu
     Debug(Debug::INFO) << "Query db start " << (queryFrom + 1) << " to " << queryFrom + querySize << "\n";
     Debug(Debug::INFO) << "Target db start " << (dbFrom + 1) << " to " << dbFrom + dbSize << "\n";
     Debug::Progress progress(querySize);
+    DBReadahead queryReadahead(qdbr, queryFrom, queryFrom + querySize, readahead);
 
 #pragma omp parallel num_threads(localThreads)
     {
@@ -808,80 +874,117 @@ bool Prefiltering::runSplit(const std::string &resultDB, const std::string &resu
         char buffer[128];
         std::string result;
         result.reserve(1000000);
-
-#pragma omp for schedule(dynamic, 2) reduction (+: kmersPerPos, resSize, dbMatches, doubleMatches, querySeqLenSum, diagonalOverflow, trancatedCounter)
-        for (size_t id = queryFrom; id < queryFrom + querySize; id++) {
-            progress.updateProgress();
-            // get query sequence
-            char *seqData = qdbr->getData(id, thread_idx);
-            unsigned int qKey = qdbr->getDbKey(id);
-            seq.mapSequence(id, qKey, seqData, qdbr->getSeqLen(id));
-            size_t targetSeqId = UINT_MAX;
-            if (sameQTDB || includeIdentical) {
-                targetSeqId = tdbr->getId(seq.getDbKey());
-                // only the corresponding split should include the id (hack for the hack)
-                if (targetSeqId >= dbFrom && targetSeqId < (dbFrom + dbSize) && targetSeqId != UINT_MAX) {
-                    targetSeqId = targetSeqId - dbFrom;
-                    if(targetSeqId > tdbr->getSize()){
-                        Debug(Debug::ERROR) << "targetSeqId: " << targetSeqId << " > target database size: "  << tdbr->getSize() <<  "\n";
-                        EXIT(EXIT_FAILURE);
-                    }
-                }else{
-                    targetSeqId = UINT_MAX;
+        const size_t batchSize = std::max(queryBatchSize, (size_t)1);
+
+#pragma omp for schedule(dynamic, 1) reduction (+: kmersPerPos, resSize, dbMatches, doubleMatches, querySeqLenSum, diagonalOverflow, trancatedCounter)
+        for (size_t batchStart = queryFrom; batchStart < queryFrom + querySize; batchStart += batchSize) {
+            const size_t batchEnd = std::min(batchStart + batchSize, queryFrom + querySize);
+            if (batchSize > 1) {
+                // read each posting list of the index once for all queries of the batch
+                matcher.clearBatch();
+                for (size_t id = batchStart; id < batchEnd; id++) {
+                    char *seqData = qdbr->getData(id, thread_idx);
+                    seq.mapSequence(id, qdbr->getDbKey(id), seqData, qdbr->getSeqLen(id));
+                    matcher.addToBatch(&seq);
                 }
+                matcher.matchBatch();
             }
-            // calculate prefiltering results
-            if (taxonomyHook != NULL) {
-                taxonomyHook->setDbFrom(dbFrom);
-            }
-            std::pair<hit_t *, size_t> prefResults = matcher.matchQuery(&seq, targetSeqId, targetSeqType==Parameters::DBTYPE_NUCLEOTIDES);
-            size_t resultSize = prefResults.second;
-            const float queryLength = static_cast<float>(qdbr->getSeqLen(id));
-            for (size_t i = 0; i < resultSize; i++) {
-                hit_t *res = prefResults.first + i;
-                // correct the 0 indexed sequence id again to its real identifier
-                size_t targetSeqId1 = res->seqId + dbFrom;
-                // replace id with key
-                res->seqId = tdbr->getDbKey(targetSeqId1);
-                if (UNLIKELY(targetSeqId1 >= tdbr->getSize())) {
-                    Debug(Debug::WARNING) << "Wrong prefiltering result for query: " << qdbr->getDbKey(id) << " -> " << targetSeqId1 << "\t" << res->prefScore << "\n";
+            for (size_t id = batchStart; id < batchEnd; id++) {
+                progress.updateProgress();
+                queryReadahead.advance(id);
+                // get query sequence
+                char *seqData = qdbr->getData(id, thread_idx);
+                unsigned int qKey = qdbr->getDbKey(id);
+                seq.mapSequence(id, qKey, seqData, qdbr->getSeqLen(id));
+                size_t targetSeqId = UINT_MAX;
+                if (sameQTDB || includeIdentical) {
+                    targetSeqId = tdbr->getId(seq.getDbKey());
+                    // only the corresponding split should include the id (hack for the hack)
+                    if (targetSeqId >= dbFrom && targetSeqId < (dbFrom + dbSize) && targetSeqId != UINT_MAX) {
+                        targetSeqId = targetSeqId - dbFrom;
+                        if(targetSeqId > tdbr->getSize()){
+                            Debug(Debug::ERROR) << "targetSeqId: " << targetSeqId << " > target database size: "  << tdbr->getSize() <<  "\n";
+                            EXIT(EXIT_FAILURE);
+                        }
+                    }else{
+                        targetSeqId = UINT_MAX;
+                    }
+                }
+                // calculate prefiltering results
+                if (taxonomyHook != NULL) {
+                    taxonomyHook->setDbFrom(dbFrom);
+                }
+                std::pair<hit_t *, size_t> prefResults;
+                if (batchSize > 1) {
+                    prefResults = matcher.matchQueryInBatch(&seq, id - batchStart, targetSeqId, targetSeqType==Parameters::DBTYPE_NUCLEOTIDES);
+                } else {
+                    prefResults = matcher.matchQuery(&seq, targetSeqId, targetSeqType==Parameters::DBTYPE_NUCLEOTIDES);
                 }
+                size_t resultSize = prefResults.second;
+                const float queryLength = static_cast<float>(qdbr->getSeqLen(id));
+                size_t writtenHits = 0;
+                for (size_t i = 0; i < resultSize; i++) {
+                    hit_t *res = prefResults.first + i;
+                    // correct the 0 indexed sequence id again to its real identifier
+                    size_t targetSeqId1 = res->seqId + dbFrom;
+                    // replace id with key
+                    res->seqId = tdbr->getDbKey(targetSeqId1);
+                    if (UNLIKELY(targetSeqId1 >= tdbr->getSize())) {
+                        Debug(Debug::WARNING) << "Wrong prefiltering result for query: " << qdbr->getDbKey(id) << " -> " << targetSeqId1 << "\t" << res->prefScore << "\n";
+                    }
 
-                // TODO: check if this should happen when diagonalScoring == false
-                if (covThr > 0.0 && (covMode == Parameters::COV_MODE_BIDIRECTIONAL
-                                               || covMode == Parameters::COV_MODE_QUERY
-                                               || covMode == Parameters::COV_MODE_LENGTH_SHORTER )) {
-                    const float targetLength = static_cast<float>(tdbr->getSeqLen(targetSeqId1));
-                    if (Util::canBeCovered(covThr, covMode, queryLength, targetLength) == false) {
-                        continue;
+                    // TODO: check if this should happen when diagonalScoring == false
+                    if (covThr > 0.0 && (covMode == Parameters::COV_MODE_BIDIRECTIONAL
+                                                   || covMode == Parameters::COV_MODE_QUERY
+                                                   || covMode == Parameters::COV_MODE_LENGTH_SHORTER )) {
+                        const float targetLength = static_cast<float>(tdbr->getSeqLen(targetSeqId1));
+                        if (Util::canBeCovered(covThr, covMode, queryLength, targetLength) == false) {
+                            continue;
+                        }
                     }
-                }
 
-                // write prefiltering results to a string
-                int len = QueryMatcher::prefilterHitToBuffer(buffer, *res);
-                result.append(buffer, len);
-            }
-            tmpDbw.writeData(result.c_str(), result.length(), qKey, thread_idx);
-            result.clear();
+                    // write prefiltering results to a string
+                    if (BinaryResult::isBinaryDbtype(resultDbtype)) {
+                        prefResults.first[writtenHits++] = *res;
+                    } else {
+                        int len = QueryMatcher::prefilterHitToBuffer(buffer, *res);
+                        result.append(buffer, len);
+                    }
+                }
+                if (BinaryResult::isBinaryDbtype(resultDbtype)) {
+                    BinaryResult::appendPrefilterHits(result, prefResults.first, writtenHits);
+                }
+                if (resultQueue != NULL) {
+                    resultQueue->push(qKey, result);
+                } else {
+                    tmpDbw.writeData(result.c_str(), result.length(), qKey, thread_idx);
+                }
+                result.clear();
 
-            // update statistics counters
-            if (resultSize != 0) {
-                notEmpty[id - queryFrom] = 1;
-            }
+                // update statistics counters
+                if (resultSize != 0) {
+                    notEmpty[id - queryFrom] = 1;
+                }
 
-            if (Debug::debugLevel >= Debug::INFO) {
-                kmersPerPos += matcher.getStatistics()->kmersPerPos;
-                dbMatches += matcher.getStatistics()->dbMatches;
-                doubleMatches += matcher.getStatistics()->doubleMatches;
-                querySeqLenSum += seq.L;
-                diagonalOverflow += matcher.getStatistics()->diagonalOverflow;
-                trancatedCounter += matcher.getStatistics()->truncated;
-                resSize += resultSize;
-                realResSize += std::min(resultSize, maxResListLen);
-                reslens[thread_idx]->emplace_back(resultSize);
+                if (Debug::debugLevel >= Debug::INFO) {
+                    kmersPerPos += matcher.getStatistics()->kmersPerPos;
+                    dbMatches += matcher.getStatistics()->dbMatches;
+                    doubleMatches += matcher.getStatistics()->doubleMatches;
+                    querySeqLenSum += seq.L;
+                    diagonalOverflow += matcher.getStatistics()->diagonalOverflow;
+                    trancatedCounter += matcher.getStatistics()->truncated;
+                    resSize += resultSize;
+                    realResSize += std::min(resultSize, maxResListLen);
+                    reslens[thread_idx]->emplace_back(resultSize);
+                }
             }
         } // step end
     }
+    queryReadahead.stop();
+    // the search is the peak of the split, merging and sorting the results is not part of the estimate
+    // the estimate does not cover the mapped databases, their resident pages are not counted
+    const size_t peakMemory = Util::getPeakResidentMemory();
+    splitPlanner->recordSplit(estimatedSplitMemory, peakMemory - std::min(peakMemory, Util::getResidentFileMemory()));
 
     if (Debug::debugLevel >= Debug::INFO) {
         statistics_t stats(kmersPerPos / static_cast<double>(totalQueryDBSize),
@@ -898,9 +1001,17 @@ bool Prefiltering::runSplit(const std::string &resultDB, const std::string &resu
         }
 
         printStatistics(stats, reslens, localThreads, empty, maxResListLen);
+        // measured after the scan, most pages of the table are resident by now
+        Debug(Debug::INFO) << "Huge page coverage index table: " << static_cast<int>(indexTable->getHugePageCoverage() * 100) << "%";
+        if (sequenceLookup != NULL) {
+            Debug(Debug::INFO) << ", sequence lookup: " << static_cast<int>(sequenceLookup->getHugePageCoverage() * 100) << "%";
+        }
+        Debug(Debug::INFO) << "\n";
     }
 
-    if (splitMode == Parameters::TARGET_DB_SPLIT && splits == 1) {
+    if (resultQueue != NULL) {
+        // nothing was written
+    } else if (splitMode == Parameters::TARGET_DB_SPLIT && splits == 1) {
 #ifdef HAVE_MPI
         // if a mpi rank processed a single split, it must have it merged before all ranks can be united
         tmpDbw.close(true);
@@ -928,7 +1039,7 @@ bool Prefiltering::runSplit(const std::string &resultDB, const std::string &resu
         resultReader.open(DBReader<unsigned int>::NOSORT);
         resultReader.readMmapedDataInMemory();
         const std::pair<std::string, std::string> tempDb = Util::databaseNames((resultDB + "_tmp"));
-        DBWriter resultWriter(tempDb.first.c_str(), tempDb.second.c_str(), localThreads, compressed, Parameters::DBTYPE_PREFILTER_RES);
+        DBWriter resultWriter(tempDb.first.c_str(), tempDb.second.c_str(), localThreads, compressed, resultDbtype);
         resultWriter.open();
         resultWriter.sortDatafileByIdOrder(resultReader);
         resultWriter.close(true);
@@ -994,7 +1105,7 @@ BaseMatrix *Prefiltering::getSubstitutionMatrix(const MultiParam<NuclAA<std::str
 void Prefiltering::mergePrefilterSplits(const std::string &outDB, const std::string &outDBIndex,
                               const std::vector<std::pair<std::string, std::string>> &splitFiles) {
     if (splitMode == Parameters::TARGET_DB_SPLIT) {
-        mergeTargetSplits(outDB, outDBIndex, splitFiles, threads);
+        mergeTargetSplits(outDB, outDBIndex, splitFiles, threads, mergedResListLen, compressed);
     } else if (splitMode == Parameters::QUERY_DB_SPLIT) {
         DBWriter::mergeResults(outDB, outDBIndex, splitFiles);
     }
@@ -1056,78 +1167,9 @@ int Prefiltering::getKmerThreshold(const float sensitivity, const bool isProfile
     return static_cast<int>(kmerThrBest);
 }
 
-size_t Prefiltering::estimateMemoryConsumption(int split, size_t dbSize, size_t resSize,
-                                               size_t maxResListLen,
-                                               int alphabetSize, int kmerSize, unsigned int querySeqType,
-                                               int threads) {
-    // for each residue in the database we need 7 byte
-    size_t dbSizeSplit = (dbSize) / split;
-    size_t residueSize = (resSize / split * 7);
-    // 21^7 * pointer size is needed for the index
-    size_t indexTableSize = static_cast<size_t>(pow(alphabetSize, kmerSize)) * sizeof(size_t);
-    // memory needed for the threads
-    // This memory is an approx. for Countint32Array and QueryTemplateLocalFast
-    size_t threadSize = threads * (
-            (dbSizeSplit * 2 * sizeof(IndexEntryLocal)) // databaseHits in QueryMatcher
-            + (dbSizeSplit * sizeof(CounterResult)) // databaseHits in QueryMatcher
-            + (maxResListLen * sizeof(hit_t))
-            + (dbSizeSplit * 2 * sizeof(CounterResult) * 2) // BINS * binSize, (binSize = dbSize * 2 / BINS)
-              // 2 is a security factor the size can increase during run
-    );
-    size_t dbReaderSize = dbSize * (sizeof(DBReader<unsigned int>::Index) + sizeof(unsigned int)); // DB index size
-
-    // extended matrix
-    size_t extendedMatrix = 0;
-    if(Parameters::isEqualDbtype(querySeqType, Parameters::DBTYPE_AMINO_ACIDS)){
-        extendedMatrix = sizeof(std::pair<short, unsigned int>) * static_cast<size_t>(pow(pow(alphabetSize, 3), 2));
-        extendedMatrix += sizeof(std::pair<short, unsigned int>) * pow(pow(alphabetSize, 2), 2);
-    }
-    // some memory needed to keep the index, ....
-    size_t background = dbSize * 22;
-    // return result in bytes
-    return residueSize + indexTableSize + threadSize + background + extendedMatrix + dbReaderSize;
-}
-
 size_t Prefiltering::estimateHDDMemoryConsumption(size_t dbSize, size_t maxResListLen) {
     // 21 bytes is roughly the size of an entry
     // 2x because the merge doubles the hdd demand
     return 2 * (21 * dbSize * maxResListLen);
 }
 
-std::pair<int, int> Prefiltering::optimizeSplit(size_t totalMemoryInByte, DBReader<unsigned int> *tdbr,
-                                                int alphabetSize, int externalKmerSize, unsigned int querySeqType, unsigned int threads) {
-
-    int startKmerSize = (externalKmerSize == 0) ? 6 : externalKmerSize;
-    int endKmerSize   = (externalKmerSize == 0) ? 7 : externalKmerSize;
-
-    if(Parameters::isEqualDbtype(querySeqType, Parameters::DBTYPE_NUCLEOTIDES)) {
-        startKmerSize = (externalKmerSize == 0) ? 14 : externalKmerSize;
-        endKmerSize   = (externalKmerSize == 0) ? 15 : externalKmerSize;
-    }
-
-    for (int optKmerSize = endKmerSize; optKmerSize >= startKmerSize ; optKmerSize--) {
-        size_t aaUpperBoundForKmerSize = (SIZE_MAX - 1);
-        if(externalKmerSize == 0){
-            if(Parameters::isEqualDbtype(querySeqType, Parameters::DBTYPE_NUCLEOTIDES)) {
-                aaUpperBoundForKmerSize = IndexTable::getUpperBoundNucCountForKmerSize(optKmerSize);
-            }else{
-                aaUpperBoundForKmerSize = IndexTable::getUpperBoundAACountForKmerSize(optKmerSize);
-            }
-        }
-        for (int optSplit = 1; optSplit < 1000; optSplit++) {
-            if ((tdbr->getAminoAcidDBSize() / optSplit) < aaUpperBoundForKmerSize) {
-                size_t neededSize = estimateMemoryConsumption(optSplit, tdbr->getSize(),
-                                                              tdbr->getAminoAcidDBSize(),
-                                                              0, alphabetSize, optKmerSize, querySeqType,
-                                                              threads);
-                if (neededSize < 0.9 * totalMemoryInByte) {
-                    return std::make_pair(optKmerSize, optSplit);
-                }
-            }
-        }
-    }
-
-    return std::make_pair(-1, -1);
-}
-
-
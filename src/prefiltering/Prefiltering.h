@@ -8,6 +8,8 @@
 #include "ScoreMatrix.h"
 #include "PrefilteringIndexReader.h"
 #include "QueryMatcher.h"
+#include "ResultQueue.h"
+#include "SplitPlanner.h"
 
 #include <string>
 #include <list>
@@ -35,6 +37,30 @@ public:
 
     int runSplits(const std::string &resultDB, const std::string &resultDBIndex, size_t fromSplit, size_t splitProcessCount, bool merge);
 
+    // results can be streamed if every query is searched against the whole target database at once
+    bool canStream() const {
+        return splitMode != Parameters::TARGET_DB_SPLIT || splits == 1;
+    }
+
+    // pushes the result of every query into queue instead of writing a result database
+    // with streamThreads threads, the other threads are left to the consumer of the queue
+    void runStreaming(ResultQueue *queue, unsigned int streamThreads);
+
+    // reader of the target sequences that the consumer of a result stream can share, NULL if the
+    // target is an index that was opened without its sequences. It is only remapped while the index
+    // table is built, which happens before the first result is pushed
+    DBReader<unsigned int> *getTargetReader() {
+        return templateDBIsIndex ? NULL : tdbr;
+    }
+
+    size_t getQueryCount() const {
+        return qdbr->getSize();
+    }
+
+    int getResultDbtype() const {
+        return resultDbtype;
+    }
+
     // merge file
     void mergePrefilterSplits(const std::string &outDb, const std::string &outDBIndex,
                     const std::vector<std::pair<std::string, std::string>> &splitFiles);
@@ -42,15 +68,16 @@ public:
     // get substitution matrix
     static BaseMatrix *getSubstitutionMatrix(const MultiParam<NuclAA<std::string>> &scoringMatrixFile, MultiParam<NuclAA<int>> alphabetSize, float bitFactor, bool profileState, bool isNucl);
 
-    static void setupSplit(DBReader<unsigned int>& dbr, const int alphabetSize, const unsigned int querySeqType, const int threads,
-                           const bool templateDBIsIndex, const size_t memoryLimit, const size_t qDbSize,
+    static void setupSplit(SplitPlanner &planner, const bool templateDBIsIndex, const size_t memoryLimit, const size_t qDbSize,
                            size_t& maxResListLen, int& kmerSize, int& split, int& splitMode);
 
     static int getKmerThreshold(const float sensitivity, const bool isProfile, const bool hasContextPseudoCnts,
                                 const SeqProf<int> kmerScore, const int kmerSize);
 
+    // merges the sorted results of target splits and keeps the maxResListLen best hits of each query
     static void mergeTargetSplits(const std::string &outDB, const std::string &outDBIndex,
-                                  const std::vector<std::pair<std::string, std::string>> &fileNames, unsigned int threads);
+                                  const std::vector<std::pair<std::string, std::string>> &fileNames, unsigned int threads,
+                                  size_t maxResListLen, int compressed);
 
 private:
     const std::string queryDB;
@@ -77,6 +104,8 @@ private:
     bool spacedKmer;
     int alphabetSize;
     bool templateDBIsIndex;
+    // the target reader (the index reader for an index) belongs to the WorkflowExecutor
+    bool sharedTargetReader;
     int maskMode;
     int maskLowerCaseMode;
     float maskProb;
@@ -87,6 +116,8 @@ private:
     int targetSeqType;
     bool takeOnlyBestKmer;
     size_t maxResListLen;
+    // result list length after merging, target splits search with a reduced maxResListLen
+    size_t mergedResListLen;
 
     const float sensitivity;
     size_t maxSeqLen;
@@ -99,22 +130,21 @@ private:
     const int covMode;
     const bool includeIdentical;
     int preloadMode;
+    const size_t readahead;
+    const size_t queryBatchSize;
     const unsigned int threads;
     int compressed;
+    const int resultDbtype;
     QueryMatcherTaxonomyHook* taxonomyHook;
+    // receives the results instead of the result database if set
+    ResultQueue *resultQueue;
+    unsigned int streamThreads;
+    SplitPlanner *splitPlanner;
+    // uncalibrated memory estimate of one split, the measured peak memory of every split is recorded for it
+    size_t estimatedSplitMemory;
 
     bool runSplit(const std::string &resultDB, const std::string &resultDBIndex, size_t split, bool merge);
 
-    // compute kmer size and split size for index table
-    static std::pair<int, int> optimizeSplit(size_t totalMemoryInByte, DBReader<unsigned int> *tdbr, int alphabetSize, int kmerSize,
-                                             unsigned int querySeqType, unsigned int threads);
-
-    // estimates memory consumption while runtime
-    static size_t estimateMemoryConsumption(int split, size_t dbSize, size_t resSize,
-                                            size_t maxHitsPerQuery,
-                                            int alphabetSize, int kmerSize, unsigned int querySeqType,
-                                            int threads);
-
     static size_t estimateHDDMemoryConsumption(size_t dbSize, size_t maxResListLen);
 
     ScoreMatrix getScoreMatrix(const BaseMatrix& matrix, const size_t kmerSize);
@@ -3,6 +3,7 @@
 #include "Prefiltering.h"
 #include "ExtendedSubstitutionMatrix.h"
 #include "FileUtil.h"
+#include "HugePageMemory.h"
 #include "IndexBuilder.h"
 #include "Parameters.h"
 
@@ -32,6 +33,7 @@ unsigned int PrefilteringIndexReader::GENERATOR = 22;
 unsigned int PrefilteringIndexReader::SPACEDPATTERN = 23;
 unsigned int PrefilteringIndexReader::ALNINDEX = 24;
 unsigned int PrefilteringIndexReader::ALNDATA = 25;
+unsigned int PrefilteringIndexReader::ENTRIESENCODING = 26;
 
 extern const char* version;
 
@@ -56,7 +58,8 @@ void PrefilteringIndexReader::createIndexFile(const std::string &outDB,
                                               BaseMatrix *subMat, int maxSeqLen,
                                               bool hasSpacedKmer, const std::string &spacedKmerPattern,
                                               bool compBiasCorrection, int alphabetSize, int kmerSize,
-                                              int maskMode, int maskLowerCase, float maskProb, int kmerThr, int splits) {
+                                              int maskMode, int maskLowerCase, float maskProb, int kmerThr, int splits,
+                                              bool compressEntries) {
 
     const int SPLIT_META = splits > 1 ? 0 : 0;
     const int SPLIT_SEQS = splits > 1 ? 1 : 0;
@@ -224,7 +227,6 @@ void PrefilteringIndexReader::createIndexFile(const std::string &outDB,
                                    (maskMode == 1 || maskLowerCase == 1) ? &sequenceLookup : NULL,
                                    (maskMode == 0 && maskLowerCase == 0) ? &sequenceLookup : NULL,
                                    *subMat, &seq, dbr1, dbFrom, dbFrom + dbSize, kmerThr, maskMode, maskLowerCase, maskProb);
-        indexTable.printStatistics(subMat->num2aa);
 
         if (sequenceLookup == NULL) {
             Debug(Debug::ERROR) << "Invalid mask mode. No sequence lookup created!\n";
@@ -233,11 +235,29 @@ void PrefilteringIndexReader::createIndexFile(const std::string &outDB,
 
         // save the entries
         unsigned int keyOffset = 1000 * s;
-        Debug(Debug::INFO) << "Write ENTRIES (" << (keyOffset + ENTRIES) << ")\n";
-        char *entries = (char *) indexTable.getEntries();
-        size_t entriesSize = indexTable.getTableEntriesNum() * indexTable.getSizeOfEntry();
-        writer.writeData(entries, entriesSize, (keyOffset + ENTRIES), SPLIT_INDX + s);
-        writer.alignToPageSize(SPLIT_INDX + s);
+        if (compressEntries) {
+            indexTable.compressEntries();
+        }
+        indexTable.printStatistics(subMat->num2aa);
+        if (compressEntries) {
+
+            Debug(Debug::INFO) << "Write ENTRIESENCODING (" << (keyOffset + ENTRIESENCODING) << ")\n";
+            int encoding = 1;
+            writer.writeData((char *) &encoding, sizeof(int), (keyOffset + ENTRIESENCODING), SPLIT_INDX + s);
+            writer.alignToPageSize(SPLIT_INDX + s);
+
+            // the padding allows the decoder to read past the last list
+            Debug(Debug::INFO) << "Write ENTRIES (" << (keyOffset + ENTRIES) << ")\n";
+            char *entries = (char *) indexTable.getCompressedEntries();
+            writer.writeData(entries, indexTable.getCompressedSize() + PostingListCodec::PADDING, (keyOffset + ENTRIES), SPLIT_INDX + s);
+            writer.alignToPageSize(SPLIT_INDX + s);
+        } else {
+            Debug(Debug::INFO) << "Write ENTRIES (" << (keyOffset + ENTRIES) << ")\n";
+            char *entries = (char *) indexTable.getEntries();
+            size_t entriesSize = indexTable.getTableEntriesNum() * indexTable.getSizeOfEntry();
+            writer.writeData(entries, entriesSize, (keyOffset + ENTRIES), SPLIT_INDX + s);
+            writer.alignToPageSize(SPLIT_INDX + s);
+        }
 
         // save the size
         Debug(Debug::INFO) << "Write ENTRIESOFFSETS (" << (keyOffset + ENTRIESOFFSETS) << ")\n";
@@ -369,6 +389,8 @@ SequenceLookup *PrefilteringIndexReader::getSequenceLookup(unsigned int split, D
         return sequenceLookup;
     }
 
+    HugePageMemory::advise(seqData, dbr->getEntryLen(id));
+    HugePageMemory::advise(seqOffsetsData, dbr->getEntryLen(seqOffsetsId));
     if (preloadMode == Parameters::PRELOAD_MODE_MMAP_TOUCH) {
         dbr->touchData(id);
         dbr->touchData(seqOffsetsId);
@@ -405,12 +427,22 @@ IndexTable *PrefilteringIndexReader::getIndexTable(unsigned int split, DBReader<
         adjustAlphabetSize = data.alphabetSize;
     }
 
+    size_t entriesEncodingId = dbr->getId(splitOffset + ENTRIESENCODING);
+    const bool compressedEntries = entriesEncodingId != UINT_MAX && *((int *)dbr->getDataUncompressed(entriesEncodingId)) == 1;
+
     if (preloadMode == Parameters::PRELOAD_MODE_FREAD) {
         IndexTable* table = new IndexTable(adjustAlphabetSize, data.kmerSize, false);
+        if (compressedEntries) {
+            table->initTableByExternalCompressedDataCopy(sequenceCount, entriesNum, (unsigned char *) entriesData, (size_t *)entriesOffsetsData);
+            return table;
+        }
         table->initTableByExternalDataCopy(sequenceCount, entriesNum, (IndexEntryLocal*) entriesData, (size_t *)entriesOffsetsData);
         return table;
     }
 
+    // only takes effect where the kernel supports huge pages for file mappings
+    HugePageMemory::advise(entriesData, dbr->getEntryLen(entriesDataId));
+    HugePageMemory::advise(entriesOffsetsData, dbr->getEntryLen(entriesOffsetsDataId));
     if (preloadMode == Parameters::PRELOAD_MODE_MMAP_TOUCH) {
         dbr->touchData(entriesNumId);
         dbr->touchData(sequenceCountId);
@@ -419,10 +451,20 @@ IndexTable *PrefilteringIndexReader::getIndexTable(unsigned int split, DBReader<
     }
 
     IndexTable* table = new IndexTable(adjustAlphabetSize, data.kmerSize, true);
+    if (compressedEntries) {
+        table->initTableByExternalCompressedData(sequenceCount, entriesNum, (unsigned char *) entriesData, (size_t *)entriesOffsetsData);
+        return table;
+    }
     table->initTableByExternalData(sequenceCount, entriesNum, (IndexEntryLocal*) entriesData, (size_t *)entriesOffsetsData);
     return table;
 }
 
+bool PrefilteringIndexReader::hasCompressedEntries(DBReader<unsigned int> *dbr) {
+    // all splits are written with the same encoding
+    size_t entriesEncodingId = dbr->getId(ENTRIESENCODING);
+    return entriesEncodingId != UINT_MAX && *((int *)dbr->getDataUncompressed(entriesEncodingId)) == 1;
+}
+
 void PrefilteringIndexReader::printSummary(DBReader<unsigned int> *dbr) {
     Debug(Debug::INFO) << "Index version: " << dbr->getDataByDBKey(VERSION, 0) << "\n";
 
@@ -50,6 +50,7 @@ public:
     static unsigned int SPACEDPATTERN;
     static unsigned int ALNINDEX;
     static unsigned int ALNDATA;
+    static unsigned int ENTRIESENCODING;
 
     static bool checkIfIndexFile(DBReader<unsigned int> *reader);
     static std::string indexName(const std::string &outDB);
@@ -59,7 +60,8 @@ public:
                                 DBReader<unsigned int> *hdbr1, DBReader<unsigned int> *hdbr2,
                                 DBReader<unsigned int> *alndbr,
                                 BaseMatrix *seedSubMat, int maxSeqLen, bool spacedKmer, const std::string &spacedKmerPattern,
-                                bool compBiasCorrection, int alphabetSize, int kmerSize, int maskMode, int maskLowerCase, float maskProb, int kmerThr, int splits);
+                                bool compBiasCorrection, int alphabetSize, int kmerSize, int maskMode, int maskLowerCase, float maskProb, int kmerThr, int splits,
+                                bool compressEntries = false);
 
     static DBReader<unsigned int> *openNewHeaderReader(DBReader<unsigned int>*dbr, unsigned int dataIdx, unsigned int indexIdx, int threads, bool touchIndex, bool touchData);
 
@@ -69,6 +71,9 @@ public:
 
     static IndexTable *getIndexTable(unsigned int split, DBReader<unsigned int> *dbr, int preloadMode);
 
+    // true if the sequence lists were written compressed (createindex --index-compression 1)
+    static bool hasCompressedEntries(DBReader<unsigned int> *dbr);
+
     static void printSummary(DBReader<unsigned int> *dbr);
 
     static PrefilteringIndexData getMetadata(DBReader<unsigned int> *dbr);
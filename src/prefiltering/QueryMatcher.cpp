@@ -2,6 +2,7 @@
 #include "QueryMatcher.h"
 #include "FastSort.h"
 #include "Util.h"
+#include "Instrumentation.h"
 
 #define FE_1(WHAT, X) WHAT(X)
 #define FE_2(WHAT, X, ...) WHAT(X)FE_1(WHAT, __VA_ARGS__)
@@ -29,6 +30,7 @@ QueryMatcher::QueryMatcher(IndexTable *indexTable, SequenceLookup *sequenceLooku
     this->kmerSubMat = kmerSubMat;
     this->ungappedAlignmentSubMat = ungappedAlignmentSubMat;
     this->indexTable = indexTable;
+    this->compressedIndex = indexTable->isCompressed();
     this->kmerSize = kmerSize;
     this->kmerThr = kmerThr;
     this->kmerGenerator = new KmerGenerator(kmerSize, indexTable->getAlphabetSize(), kmerThr);
@@ -65,6 +67,7 @@ QueryMatcher::QueryMatcher(IndexTable *indexTable, SequenceLookup *sequenceLooku
         ungappedAlignment = new UngappedAlignment(maxSeqLen, ungappedAlignmentSubMat, sequenceLookup);
     }
     compositionBias = new float[maxSeqLen];
+    batchHitsSize = 0;
 }
 
 QueryMatcher::~QueryMatcher(){
@@ -82,12 +85,7 @@ QueryMatcher::~QueryMatcher(){
     delete kmerGenerator;
 }
 
-std::pair<hit_t*, size_t> QueryMatcher::matchQuery(Sequence *querySeq, unsigned int identityId, bool isNucleotide) {
-    querySeq->resetCurrPos();
-//    std::cout << "Id: " << querySeq->getId() << std::endl;
-    memset(scoreSizes, 0, SCORE_RANGE * sizeof(unsigned int));
-
-    // bias correction
+void QueryMatcher::computeCompositionBias(Sequence *querySeq) {
     if(aaBiasCorrection == true){
         if(Parameters::isEqualDbtype(querySeq->getSeqType(), Parameters::DBTYPE_AMINO_ACIDS)) {
             SubstitutionMatrix::calcLocalAaBiasCorrection(kmerSubMat, querySeq->numSequence, querySeq->L, compositionBias, scaleBiasCorr);
@@ -97,15 +95,194 @@ std::pair<hit_t*, size_t> QueryMatcher::matchQuery(Sequence *querySeq, unsigned
     } else {
         memset(compositionBias, 0, sizeof(float) * querySeq->L);
     }
+}
+
+std::pair<hit_t*, size_t> QueryMatcher::matchQuery(Sequence *querySeq, unsigned int identityId, bool isNucleotide) {
+    querySeq->resetCurrPos();
+//    std::cout << "Id: " << querySeq->getId() << std::endl;
+    memset(scoreSizes, 0, SCORE_RANGE * sizeof(unsigned int));
+
+    // bias correction
+    computeCompositionBias(querySeq);
 
     size_t resultSize = match(querySeq, compositionBias);
+    return scoreMatches(querySeq, resultSize, identityId, isNucleotide);
+}
+
+void QueryMatcher::clearBatch() {
+    batchQueries.clear();
+    batchRequests.clear();
+    batchPositions.clear();
+    batchHitsSize = 0;
+}
+
+void QueryMatcher::addToBatch(Sequence *seq) {
+    seq->resetCurrPos();
+    computeCompositionBias(seq);
+
+    BatchQuery query;
+    query.hitsStart = 0;
+    query.positionsStart = batchPositions.size();
+    query.requestsStart = batchRequests.size();
+    query.numMatches = 0;
+    query.kmerListLen = 0;
+    query.indexTo = 0;
+    query.overflow = false;
+    batchPositions.resize(query.positionsStart + seq->L + 1, 0);
+
+    // same k-mer enumeration as in match, the posting lists are only read in matchBatch
+    while (seq->hasNextKmer()) {
+        const unsigned char *kmer = seq->nextKmer();
+        const unsigned char *pos = seq->getAAPosInSpacedPattern();
+        const unsigned short current_i = seq->getCurrentPosition();
+
+        float biasCorrection = 0;
+        for (int i = 0; i < kmerSize; i++){
+            biasCorrection += compositionBias[current_i + static_cast<short>(pos[i])];
+        }
+        batchPositions[query.positionsStart + current_i] = batchRequests.size() - query.requestsStart;
+        query.indexTo = current_i;
+        if (seq->kmerContainsX()) {
+            continue;
+        }
+        short bias = static_cast<short>((biasCorrection < 0.0) ? biasCorrection - 0.5: biasCorrection + 0.5);
+        short kmerMatchScore = std::max(kmerThr - bias, 0);
+        kmerGenerator->setThreshold(kmerMatchScore);
+
+        const size_t *index;
+        size_t exactKmer;
+        size_t kmerElementSize;
+        if (takeOnlyBestKmer) {
+            kmerElementSize = 1;
+            exactKmer = idx.int2index(kmer);
+            index = &exactKmer;
+        } else {
+            INSTRUMENT_SCOPE(KMER_GENERATION);
+            std::pair<size_t*, size_t> kmerList = kmerGenerator->generateKmerList(kmer);
+            kmerElementSize = kmerList.second;
+            index = kmerList.first;
+        }
+        query.kmerListLen += kmerElementSize;
+
+        for (unsigned int kmerPos = 0; kmerPos < kmerElementSize; kmerPos++) {
+            BatchRequest request;
+            request.kmer = index[kmerPos];
+            request.size = 0;
+            request.offset = 0;
+            batchRequests.push_back(request);
+        }
+    }
+    query.requestsEnd = batchRequests.size();
+    batchQueries.push_back(query);
+}
+
+void QueryMatcher::matchBatch() {
+    INSTRUMENT_SCOPE(DIAGONAL_MATCHING);
+    // requests for the same k-mer are adjacent, each posting list is located only once per batch
+    batchOrder.resize(batchRequests.size());
+    for (size_t i = 0; i < batchRequests.size(); i++) {
+        batchOrder[i] = std::make_pair(batchRequests[i].kmer, i);
+    }
+    SORT_SERIAL(batchOrder.begin(), batchOrder.end());
+    size_t prevKmer = SIZE_MAX;
+    size_t seqListSize = 0;
+    for (size_t i = 0; i < batchOrder.size(); i++) {
+        if (batchOrder[i].first != prevKmer) {
+            if (compressedIndex) {
+                indexTable->getCompressedDBSeqList(batchOrder[i].first, &seqListSize);
+            } else {
+                indexTable->getDBSeqList(batchOrder[i].first, &seqListSize);
+            }
+            prevKmer = batchOrder[i].first;
+        }
+        batchRequests[batchOrder[i].second].size = seqListSize;
+    }
+
+    // lay out the hits of each query, match would split a query with maxDbMatches hits or more
+    // into several rounds of diagonal matching, such a query is matched on its own
+    batchHitsSize = 0;
+    for (size_t q = 0; q < batchQueries.size(); q++) {
+        BatchQuery &query = batchQueries[q];
+        query.numMatches = 0;
+        for (size_t r = query.requestsStart; r < query.requestsEnd; r++) {
+            query.numMatches += batchRequests[r].size;
+        }
+        query.overflow = query.numMatches >= maxDbMatches;
+        if (query.overflow) {
+            for (size_t r = query.requestsStart; r < query.requestsEnd; r++) {
+                batchRequests[r].size = 0;
+            }
+            query.numMatches = 0;
+            continue;
+        }
+        query.hitsStart = batchHitsSize;
+        size_t offset = batchHitsSize;
+        for (size_t r = query.requestsStart; r < query.requestsEnd; r++) {
+            batchRequests[r].offset = offset;
+            offset += batchRequests[r].size;
+        }
+        size_t *positions = batchPositions.data() + query.positionsStart;
+        for (size_t i = 0; i <= query.indexTo; i++) {
+            const size_t r = query.requestsStart + positions[i];
+            positions[i] = (r < query.requestsEnd) ? batchRequests[r].offset - query.hitsStart : query.numMatches;
+        }
+        batchHitsSize += query.numMatches;
+    }
+    if (batchHits.size() < batchHitsSize) {
+        batchHits.resize(batchHitsSize);
+    }
+
+    // a compressed posting list is decoded for its first request, all other requests copy the decoded hits
+    prevKmer = SIZE_MAX;
+    const IndexEntryLocal *entries = NULL;
+    for (size_t i = 0; i < batchOrder.size(); i++) {
+        const BatchRequest &request = batchRequests[batchOrder[i].second];
+        if (request.size == 0) {
+            continue;
+        }
+        IndexEntryLocal *hits = batchHits.data() + request.offset;
+        if (request.kmer != prevKmer) {
+            if (compressedIndex) {
+                const unsigned char *compressedEntries = indexTable->getCompressedDBSeqList(request.kmer, &seqListSize);
+                PostingListCodec::decode(compressedEntries, seqListSize, hits);
+                entries = hits;
+                prevKmer = request.kmer;
+                continue;
+            }
+            entries = indexTable->getDBSeqList(request.kmer, &seqListSize);
+            prevKmer = request.kmer;
+        }
+        memcpy(hits, entries, sizeof(IndexEntryLocal) * request.size);
+    }
+}
+
+std::pair<hit_t*, size_t> QueryMatcher::matchQueryInBatch(Sequence *querySeq, size_t batchIdx, unsigned int identityId, bool isNucleotide) {
+    querySeq->resetCurrPos();
+    memset(scoreSizes, 0, SCORE_RANGE * sizeof(unsigned int));
+    computeCompositionBias(querySeq);
+
+    const BatchQuery &query = batchQueries[batchIdx];
+    size_t resultSize;
+    if (query.overflow) {
+        resultSize = match(querySeq, compositionBias);
+    } else {
+        resultSize = matchFromBatch(querySeq, query);
+    }
+    return scoreMatches(querySeq, resultSize, identityId, isNucleotide);
+}
+
+std::pair<hit_t*, size_t> QueryMatcher::scoreMatches(Sequence *querySeq, size_t resultSize, unsigned int identityId, bool isNucleotide) {
     if (hook != NULL) {
         resultSize = hook->afterDiagonalMatchingHook(*this, resultSize);
     }
     std::pair<hit_t *, size_t> queryResult;
     if (diagonalScoring) {
         // write diagonal scores in count value
-        ungappedAlignment->processQuery(querySeq, compositionBias, foundDiagonals, resultSize);
+        {
+            INSTRUMENT_SCOPE(UNGAPPED_SCORING);
+            INSTRUMENT_COUNT(UNGAPPED_SCORING, resultSize);
+            ungappedAlignment->processQuery(querySeq, compositionBias, foundDiagonals, resultSize);
+        }
         memset(scoreSizes, 0, SCORE_RANGE * sizeof(unsigned int));
         CounterResult * resultReadPos  = foundDiagonals;
         CounterResult * resultWritePos = foundDiagonals + resultSize;
@@ -239,6 +416,7 @@ size_t QueryMatcher::match(Sequence *seq, float *compositionBias) {
             exactKmer = idx.int2index(kmer);
             index = &exactKmer;
         } else {
+            INSTRUMENT_SCOPE(KMER_GENERATION);
             std::pair<size_t*, size_t> kmerList = kmerGenerator->generateKmerList(kmer);
             kmerElementSize = kmerList.second;
             index = kmerList.first;
@@ -252,7 +430,13 @@ size_t QueryMatcher::match(Sequence *seq, float *compositionBias) {
         kmerListLen += kmerElementSize;
 
         for (unsigned int kmerPos = 0; kmerPos < kmerElementSize; kmerPos++) {
-            const IndexEntryLocal *entries = indexTable->getDBSeqList(index[kmerPos], &seqListSize);
+            const IndexEntryLocal *entries = NULL;
+            const unsigned char *compressedEntries = NULL;
+            if (compressedIndex) {
+                compressedEntries = indexTable->getCompressedDBSeqList(index[kmerPos], &seqListSize);
+            } else {
+                entries = indexTable->getDBSeqList(index[kmerPos], &seqListSize);
+            }
             // DEBUG
             //std::cout << seq->getDbKey() << std::endl;
             //idx.printKmer(index[kmerPos], kmerSize, kmerSubMat->num2aa);
@@ -291,13 +475,20 @@ size_t QueryMatcher::match(Sequence *seq, float *compositionBias) {
                     goto outer;
                 }
             }
-            memcpy(sequenceHits, entries, sizeof(IndexEntryLocal) * seqListSize);
+            if (compressedIndex) {
+                PostingListCodec::decode(compressedEntries, seqListSize, sequenceHits);
+            } else {
+                memcpy(sequenceHits, entries, sizeof(IndexEntryLocal) * seqListSize);
+            }
             sequenceHits += seqListSize;
             numMatches += seqListSize;
         }
         indexTo = current_i;
     }
     outer:
+    INSTRUMENT_COUNT(KMER_GENERATION, kmerListLen);
+    INSTRUMENT_COUNT(DIAGONAL_MATCHING, overflowNumMatches + numMatches);
+    INSTRUMENT_SCOPE(DIAGONAL_MATCHING);
     indexPointer[indexTo + 1] = databaseHits + numMatches;
     // fill the output
     size_t hitCount = findDuplicates(indexPointer, foundDiagonals + overflowHitCount,
@@ -319,6 +510,31 @@ size_t QueryMatcher::match(Sequence *seq, float *compositionBias) {
     return hitCount;
 }
 
+size_t QueryMatcher::matchFromBatch(Sequence *seq, const BatchQuery &query) {
+    INSTRUMENT_SCOPE(DIAGONAL_MATCHING);
+    INSTRUMENT_COUNT(KMER_GENERATION, query.kmerListLen);
+    INSTRUMENT_COUNT(DIAGONAL_MATCHING, query.numMatches);
+    stats->diagonalOverflow = false;
+    IndexEntryLocal *queryHits = batchHits.data() + query.hitsStart;
+    const size_t *positions = batchPositions.data() + query.positionsStart;
+    for (size_t i = 0; i <= query.indexTo; i++) {
+        indexPointer[i] = queryHits + positions[i];
+    }
+    indexPointer[query.indexTo + 1] = queryHits + query.numMatches;
+    size_t hitCount = findDuplicates(indexPointer, foundDiagonals, foundDiagonalsSize, 0, query.indexTo, (diagonalScoring == false));
+    stats->doubleMatches = 0;
+    if (diagonalScoring == false) {
+        // remove double entries
+        updateScoreBins(foundDiagonals, hitCount);
+        stats->doubleMatches = getDoubleDiagonalMatches();
+    }
+    stats->kmersPerPos = ((double)query.kmerListLen/(double)seq->L);
+    stats->querySeqLen = seq->L;
+    stats->dbMatches   = query.numMatches;
+
+    return hitCount;
+}
+
 size_t QueryMatcher::getDoubleDiagonalMatches(){
     size_t retValue = 0;
     for(size_t i = 1; i < SCORE_RANGE; i++){
@@ -393,34 +609,46 @@ std::pair<hit_t*, size_t> QueryMatcher::getResult(CounterResult * results,
     return std::make_pair(resList, currentHits);
 }
 
-void QueryMatcher::initDiagonalMatcher(size_t dbsize, unsigned int maxDbMatches) {
+unsigned int QueryMatcher::getDiagonalMatcherBinSize(size_t dbsize) {
     uint64_t l2CacheSize = Util::getL2CacheSize();
-#define INIT(x) cachedOperation##x = new CacheFriendlyOperations<x>(dbsize, maxDbMatches/x); \
-                activeCounter = x;
-    if(dbsize/2 < l2CacheSize){
-        INIT(2)
-    }else if(dbsize/4 < l2CacheSize){
-        INIT(4)
-    }else if(dbsize/8 < l2CacheSize){
-        INIT(8)
-    }else if(dbsize/16 < l2CacheSize){
-        INIT(16)
-    }else if(dbsize/32 < l2CacheSize){
-        INIT(32)
-    }else if(dbsize/64 < l2CacheSize){
-        INIT(64)
-    }else if(dbsize/128 < l2CacheSize){
-        INIT(128)
-    }else if(dbsize/256 < l2CacheSize){
-        INIT(256)
-    }else if(dbsize/512 < l2CacheSize){
-        INIT(512)
-    }else if(dbsize/1024 < l2CacheSize){
-        INIT(1024)
-    }else {
-        INIT(2048)
-    }
-#undef INIT
+    unsigned int binSize = 2;
+    while (binSize < 2048 && dbsize / binSize >= l2CacheSize) {
+        binSize *= 2;
+    }
+    return binSize;
+}
+
+void QueryMatcher::initDiagonalMatcher(size_t dbsize, unsigned int maxDbMatches) {
+#define INIT_CASE(x) case x: cachedOperation##x = new CacheFriendlyOperations<x>(dbsize, maxDbMatches/x); break;
+    activeCounter = getDiagonalMatcherBinSize(dbsize);
+    switch (activeCounter) {
+        FOR_EACH(INIT_CASE,2,4,8,16,32,64,128,256,512,1024,2048)
+    }
+#undef INIT_CASE
+}
+
+size_t QueryMatcher::getMemoryConsumption(size_t dbSize, unsigned int maxSeqLen, size_t maxHitsPerQuery, size_t queryBatchSize) {
+    // same sizes as in the constructor
+    const size_t foundDiagonalsSize = std::max((size_t)1000000, dbSize);
+    const unsigned int maxDbMatches = std::max((size_t)1000000, dbSize) * 2;
+    size_t diagonalMatcherSize = 0;
+#define MEMORY_CASE(x) case x: diagonalMatcherSize = CacheFriendlyOperations<x>::getMemoryConsumption(dbSize, maxDbMatches/x); break;
+    switch (getDiagonalMatcherBinSize(dbSize)) {
+        FOR_EACH(MEMORY_CASE,2,4,8,16,32,64,128,256,512,1024,2048)
+    }
+#undef MEMORY_CASE
+    size_t size = maxHitsPerQuery * sizeof(hit_t)
+                  + maxDbMatches * sizeof(IndexEntryLocal)
+                  + foundDiagonalsSize * sizeof(CounterResult)
+                  + (maxSeqLen + 1) * sizeof(IndexEntryLocal *)
+                  + SCORE_RANGE * sizeof(unsigned int)
+                  + maxSeqLen * sizeof(float)
+                  + diagonalMatcherSize;
+    if (queryBatchSize > 1) {
+        // every query of a batch has less than maxDbMatches hits in the batch hit buffer
+        size += queryBatchSize * maxDbMatches * sizeof(IndexEntryLocal);
+    }
+    return size;
 }
 
 void QueryMatcher::deleteDiagonalMatcher(unsigned int activeCounter){
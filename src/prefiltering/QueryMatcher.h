@@ -65,6 +65,15 @@ public:
     // identityId is the id of the identitical sequence in the target database if there is any, UINT_MAX otherwise
     std::pair<hit_t*, size_t> matchQuery(Sequence *querySeq, unsigned int identityId,  bool isNucleotide);
 
+    // batched matching: the k-mer lists of all queries in a batch are collected first (addToBatch),
+    // then each posting list of the index table is read once for the whole batch (matchBatch)
+    // and finally every query is scored from its own hit bucket (matchQueryInBatch)
+    void clearBatch();
+    void addToBatch(Sequence *querySeq);
+    void matchBatch();
+    // querySeq has to be mapped to the same sequence as the batchIdx-th call of addToBatch
+    std::pair<hit_t*, size_t> matchQueryInBatch(Sequence *querySeq, size_t batchIdx, unsigned int identityId, bool isNucleotide);
+
     void setQueryMatcherHook(QueryMatcherHook* hook) {
         this->hook = hook;
     }
@@ -117,6 +126,9 @@ public:
         }
     }
 
+    // bytes allocated by one QueryMatcher, queries are matched with addToBatch if queryBatchSize is larger than one
+    static size_t getMemoryConsumption(size_t dbSize, unsigned int maxSeqLen, size_t maxHitsPerQuery, size_t queryBatchSize);
+
     static size_t prefilterHitToBuffer(char *buff1, hit_t &h) {
         char * basePos = buff1;
         char * tmpBuff = Itoa::u32toa_sse2((uint32_t) h.seqId, buff1);
@@ -145,6 +157,8 @@ protected:
     KmerGenerator *kmerGenerator;
     /* contains the sequences for a kmer */
     IndexTable *indexTable;
+    // sequence lists of the index table are stream-vbyte encoded
+    bool compressedIndex;
     // k of the k-mer
     int kmerSize;
     // local amino acid bias correction
@@ -217,9 +231,51 @@ protected:
         return scoreThr;
     }
 
+    struct BatchQuery {
+        // first hit of the query in batchHits
+        size_t hitsStart;
+        // first position of the query in batchPositions
+        size_t positionsStart;
+        // k-mer requests of the query in batchRequests
+        size_t requestsStart;
+        size_t requestsEnd;
+        size_t numMatches;
+        size_t kmerListLen;
+        unsigned short indexTo;
+        // hits do not fit into the diagonal matcher at once, the query is matched on its own
+        bool overflow;
+    };
+
+    struct BatchRequest {
+        size_t kmer;
+        // size of the posting list, zero if the query overflows
+        size_t size;
+        // destination of the posting list in batchHits
+        size_t offset;
+    };
+
+    std::vector<BatchQuery> batchQueries;
+    // requests of all queries in query order
+    std::vector<BatchRequest> batchRequests;
+    // (k-mer, request index) sorted by k-mer, each posting list is read once per batch
+    std::vector<std::pair<size_t, size_t> > batchOrder;
+    // addToBatch stores the number of requests of the query before each position,
+    // matchBatch replaces it by the hit offset relative to the start of the query in batchHits
+    std::vector<size_t> batchPositions;
+    std::vector<IndexEntryLocal> batchHits;
+    size_t batchHitsSize;
+
+    void computeCompositionBias(Sequence *querySeq);
+
     // match sequence against the IndexTable
     size_t match(Sequence *seq, float *compositionBias);
 
+    // collect the hits of a batched query from its bucket
+    size_t matchFromBatch(Sequence *seq, const BatchQuery &query);
+
+    // score the diagonals found by match or matchFromBatch
+    std::pair<hit_t*, size_t> scoreMatches(Sequence *querySeq, size_t resultSize, unsigned int identityId, bool isNucleotide);
+
     // extract result from databaseHits
     template <int TYPE>
     std::pair<hit_t *, size_t> getResult(CounterResult * results,
@@ -252,6 +308,9 @@ protected:
     CacheFriendlyOperations(2048);
 #undef CacheFriendlyOperations
 
+    // bin size of the CacheFriendlyOperations, chosen so that the duplicate bit array fits into the L2 cache
+    static unsigned int getDiagonalMatcherBinSize(size_t dbsize);
+
     void initDiagonalMatcher(size_t dbsize, unsigned int maxDbMatches);
 
     void deleteDiagonalMatcher(unsigned int activeCounter);
@@ -6,14 +6,15 @@
 #include <sys/mman.h>
 #include "Debug.h"
 #include "Util.h"
+#include "HugePageMemory.h"
 #include "SequenceLookup.h"
 
 SequenceLookup::SequenceLookup(size_t sequenceCount, size_t dataSize)
         : sequenceCount(sequenceCount), dataSize(dataSize), currentIndex(0), currentOffset(0), externalData(false) {
-    data = new(std::nothrow) char[dataSize + 1];
+    data = static_cast<char *>(HugePageMemory::allocate(dataSize + 1));
     Util::checkAllocation(data, "Can not allocate data memory in SequenceLookup");
 
-    offsets = new(std::nothrow) size_t[sequenceCount + 1];
+    offsets = static_cast<size_t *>(HugePageMemory::allocate((sequenceCount + 1) * sizeof(size_t)));
     Util::checkAllocation(offsets, "Can not allocate offsets memory in SequenceLookup");
     offsets[sequenceCount] = dataSize;
 }
@@ -24,8 +25,8 @@ SequenceLookup::SequenceLookup(size_t sequenceCount)
 
 SequenceLookup::~SequenceLookup() {
     if(externalData == false){
-        delete[] data;
-        delete[] offsets;
+        HugePageMemory::free(data, dataSize + 1);
+        HugePageMemory::free(offsets, (sequenceCount + 1) * sizeof(size_t));
     }
 }
 
@@ -58,6 +59,12 @@ size_t *SequenceLookup::getOffsets() {
     return offsets;
 }
 
+double SequenceLookup::getHugePageCoverage() {
+    const size_t offsetsSize = (sequenceCount + 1) * sizeof(size_t);
+    const size_t hugeBytes = HugePageMemory::hugePageBytes(data, dataSize + 1) + HugePageMemory::hugePageBytes(offsets, offsetsSize);
+    return static_cast<double>(hugeBytes) / static_cast<double>(dataSize + 1 + offsetsSize);
+}
+
 size_t SequenceLookup::getSequenceCount() {
     return sequenceCount;
 }
@@ -32,6 +32,9 @@ public:
 
     size_t *getOffsets();
 
+    // fraction of data and offsets backed by huge pages
+    double getHugePageCoverage();
+
     void initLookupByExternalData(char *seqData, size_t dataSize, size_t *seqOffsets);
     void initLookupByExternalDataCopy(char *seqData, size_t *seqOffsets);
 
@@ -0,0 +1,167 @@
+#include "SplitPlanner.h"
+#include "Parameters.h"
+#include "BaseMatrix.h"
+#include "Sequence.h"
+#include "Indexer.h"
+#include "IndexTable.h"
+#include "PostingListCodec.h"
+#include "QueryMatcher.h"
+#include "HugePageMemory.h"
+#include "MathUtil.h"
+#include "Debug.h"
+#include "Util.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+SplitPlanner::SplitPlanner(DBReader<unsigned int> &tdbr, const std::string &targetDB, BaseMatrix *subMat,
+                           int alphabetSize, unsigned int querySeqType, bool compressedEntries, const Parameters &par)
+        : tdbr(tdbr), statsFile(statsFileName(targetDB)), subMat(subMat), alphabetSize(alphabetSize),
+          querySeqType(querySeqType), compressedEntries(compressedEntries), threads(par.threads), spacedKmer(par.spacedKmer != 0),
+          spacedKmerPattern(par.spacedKmerPattern), queryBatchSize(std::max(par.queryBatchSize, 1)),
+          recordMemory(par.memoryStats),
+          hugePagePool(HugePageMemory::freePoolBytes()), calibration(1.0) {
+    readCalibration();
+}
+
+void SplitPlanner::readCalibration() {
+    FILE *file = fopen(statsFile.c_str(), "r");
+    if (file == NULL) {
+        return;
+    }
+    std::vector<double> ratios;
+    unsigned long long estimated, measured;
+    while (fscanf(file, "%llu\t%llu\n", &estimated, &measured) == 2) {
+        if (estimated > 0 && measured > 0) {
+            ratios.push_back(static_cast<double>(measured) / static_cast<double>(estimated));
+        }
+    }
+    fclose(file);
+    if (ratios.empty()) {
+        return;
+    }
+    // the most pessimistic of the latest runs, bounded in case a run was not representative
+    const size_t first = ratios.size() > MAX_RECORDS ? ratios.size() - MAX_RECORDS : 0;
+    double maxRatio = *std::max_element(ratios.begin() + first, ratios.end());
+    calibration = std::min(std::max(maxRatio, 0.5), 4.0);
+    Debug(Debug::INFO) << "Memory estimates are scaled by " << calibration << " measured in "
+                       << (ratios.size() - first) << " previous runs\n";
+}
+
+void SplitPlanner::recordSplit(size_t estimatedMemory, size_t measuredMemory) {
+    if (recordMemory == false || estimatedMemory == 0 || measuredMemory == 0) {
+        return;
+    }
+    FILE *file = fopen(statsFile.c_str(), "a");
+    if (file == NULL) {
+        Debug(Debug::INFO) << "Cannot record memory statistics in " << statsFile << "\n";
+        return;
+    }
+    fprintf(file, "%llu\t%llu\n", static_cast<unsigned long long>(estimatedMemory), static_cast<unsigned long long>(measuredMemory));
+    fclose(file);
+}
+
+double SplitPlanner::getKmersPerResidue(int kmerSize) {
+    std::map<int, double>::const_iterator it = kmersPerResidue.find(kmerSize);
+    if (it != kmersPerResidue.end()) {
+        return it->second;
+    }
+
+    // profiles index similar k-mers, without sampling assume one entry per residue
+    double ratio = 1.0;
+    const int targetSeqType = tdbr.getDbtype();
+    if (subMat != NULL && tdbr.getSize() > 0 && Parameters::isEqualDbtype(targetSeqType, Parameters::DBTYPE_HMM_PROFILE) == false) {
+        const size_t maxLen = tdbr.getMaxSeqLen() + 1;
+        Sequence seq(maxLen, targetSeqType, subMat, kmerSize, spacedKmer, false, false, spacedKmerPattern);
+        Indexer idxer(static_cast<unsigned int>(alphabetSize), kmerSize);
+        unsigned int *buffer = static_cast<unsigned int *>(malloc(maxLen * sizeof(unsigned int)));
+        Util::checkAllocation(buffer, "Cannot allocate k-mer buffer in SplitPlanner");
+        const size_t step = std::max(tdbr.getSize() / SAMPLE_SIZE, (size_t) 1);
+        size_t residues = 0;
+        size_t kmers = 0;
+        for (size_t id = 0; id < tdbr.getSize(); id += step) {
+            const unsigned int seqLen = tdbr.getSeqLen(id);
+            seq.mapSequence(id, tdbr.getDbKey(id), tdbr.getData(id, 0), seqLen);
+            // the k-mer threshold is not known yet, without it at least as many k-mers are counted as indexed
+            kmers += IndexTable::countKmers(&seq, &idxer, buffer, 0, NULL, kmerSize, NULL);
+            residues += seqLen;
+        }
+        free(buffer);
+        if (residues > 0) {
+            ratio = static_cast<double>(kmers) / static_cast<double>(residues);
+        }
+        Debug(Debug::INFO) << "Sampled " << ratio << " index entries per residue for k-mer size " << kmerSize << "\n";
+    }
+    kmersPerResidue[kmerSize] = ratio;
+    return ratio;
+}
+
+size_t SplitPlanner::estimateUncalibratedMemory(int split, int kmerSize, size_t maxResListLen) {
+    const size_t dbSizeSplit = tdbr.getSize() / split;
+    const size_t residuesSplit = tdbr.getAminoAcidDBSize() / split;
+
+    // index table and sequence lookup, these are allocated as huge page mappings
+    const size_t entries = static_cast<size_t>(getKmersPerResidue(kmerSize) * residuesSplit);
+    const size_t tableSize = MathUtil::ipow<size_t>(alphabetSize, kmerSize);
+    size_t entriesSize = entries * sizeof(IndexEntryLocal);
+    if (compressedEntries) {
+        entriesSize = PostingListCodec::estimateEncodedSize(entries, tableSize, dbSizeSplit) + PostingListCodec::PADDING;
+    }
+    size_t indexSize = HugePageMemory::mappingSize(entriesSize)
+                       + HugePageMemory::mappingSize((tableSize + 1) * sizeof(size_t))
+                       + HugePageMemory::mappingSize(residuesSplit + 1)
+                       + HugePageMemory::mappingSize((dbSizeSplit + 1) * sizeof(size_t));
+    // explicit huge pages are not part of the available memory
+    indexSize -= std::min(indexSize, hugePagePool);
+
+    const size_t threadSize = threads * QueryMatcher::getMemoryConsumption(dbSizeSplit, tdbr.getMaxSeqLen() + 1, maxResListLen, queryBatchSize);
+    // DB index size
+    const size_t dbReaderSize = tdbr.getSize() * (sizeof(DBReader<unsigned int>::Index) + sizeof(unsigned int));
+
+    // extended matrix
+    size_t extendedMatrix = 0;
+    if (Parameters::isEqualDbtype(querySeqType, Parameters::DBTYPE_AMINO_ACIDS)) {
+        extendedMatrix = sizeof(std::pair<short, unsigned int>) * static_cast<size_t>(pow(pow(alphabetSize, 3), 2));
+        extendedMatrix += sizeof(std::pair<short, unsigned int>) * pow(pow(alphabetSize, 2), 2);
+    }
+    // some memory needed to keep the index, ....
+    const size_t background = tdbr.getSize() * 22;
+    return indexSize + threadSize + dbReaderSize + extendedMatrix + background;
+}
+
+size_t SplitPlanner::estimateMemory(int split, int kmerSize, size_t maxResListLen) {
+    return static_cast<size_t>(estimateUncalibratedMemory(split, kmerSize, maxResListLen) * calibration);
+}
+
+std::pair<int, int> SplitPlanner::optimizeSplit(size_t memoryLimit, int externalKmerSize) {
+    int startKmerSize = (externalKmerSize == 0) ? 6 : externalKmerSize;
+    int endKmerSize   = (externalKmerSize == 0) ? 7 : externalKmerSize;
+
+    if (Parameters::isEqualDbtype(querySeqType, Parameters::DBTYPE_NUCLEOTIDES)) {
+        startKmerSize = (externalKmerSize == 0) ? 14 : externalKmerSize;
+        endKmerSize   = (externalKmerSize == 0) ? 15 : externalKmerSize;
+    }
+
+    for (int optKmerSize = endKmerSize; optKmerSize >= startKmerSize ; optKmerSize--) {
+        size_t aaUpperBoundForKmerSize = (SIZE_MAX - 1);
+        if (externalKmerSize == 0) {
+            if (Parameters::isEqualDbtype(querySeqType, Parameters::DBTYPE_NUCLEOTIDES)) {
+                aaUpperBoundForKmerSize = IndexTable::getUpperBoundNucCountForKmerSize(optKmerSize);
+            } else {
+                aaUpperBoundForKmerSize = IndexTable::getUpperBoundAACountForKmerSize(optKmerSize);
+            }
+        }
+        for (int optSplit = 1; optSplit < 1000; optSplit++) {
+            if ((tdbr.getAminoAcidDBSize() / optSplit) < aaUpperBoundForKmerSize) {
+                size_t neededSize = estimateMemory(optSplit, optKmerSize, 0);
+                if (neededSize < 0.9 * memoryLimit) {
+                    return std::make_pair(optKmerSize, optSplit);
+                }
+            }
+        }
+    }
+
+    return std::make_pair(-1, -1);
+}
@@ -0,0 +1,91 @@
+#ifndef MMSEQS_SPLITPLANNER_H
+#define MMSEQS_SPLITPLANNER_H
+
+// Estimates the memory a prefilter run needs for a number of target splits and a k-mer size.
+//
+// The index table entries are extrapolated from the distinct k-mers of a sample of the target sequences
+// instead of assuming one k-mer per residue. The thread buffers are the allocation sizes of QueryMatcher.
+// Index arrays are rounded to their huge page mappings and may be placed in the free explicit huge page pool,
+// which Util::getTotalSystemMemory does not count as available memory.
+// The sequence lists of a compressed index (createindex --index-compression 1) are estimated by their
+// expected encoded size, createindex encodes one split at a time and holds both layouts of that split.
+//
+// Prefilter runs append their estimate and the measured peak resident memory of every split to
+// <target db>.memstats, unless they are run with --memory-stats 0. The pages of the mapped database
+// files are not part of the estimate and are subtracted from the measurement. Later runs and
+// createindex scale their estimates by the recorded ratio.
+
+#include "DBReader.h"
+
+#include <map>
+#include <string>
+#include <utility>
+
+class BaseMatrix;
+class Parameters;
+
+class SplitPlanner {
+public:
+    // subMat is used to sample the target k-mers, sampling is skipped if it is NULL
+    // compressedEntries: the sequence lists are searched in their compressed layout
+    SplitPlanner(DBReader<unsigned int> &tdbr, const std::string &targetDB, BaseMatrix *subMat,
+                 int alphabetSize, unsigned int querySeqType, bool compressedEntries, const Parameters &par);
+
+    // bytes needed to search one of split target splits, scaled by the recorded measurements
+    size_t estimateMemory(int split, int kmerSize, size_t maxResListLen);
+
+    // same without the scaling, this is the estimate a measurement is recorded for
+    size_t estimateUncalibratedMemory(int split, int kmerSize, size_t maxResListLen);
+
+    // returns the largest k-mer size and the smallest split count that fit into memoryLimit,
+    // (-1, -1) if nothing fits. Only kmerSize is tried if it is not 0.
+    std::pair<int, int> optimizeSplit(size_t memoryLimit, int kmerSize);
+
+    // appends a measurement to the statistics file of the target database
+    void recordSplit(size_t estimatedMemory, size_t measuredMemory);
+
+    double getCalibration() const {
+        return calibration;
+    }
+
+    DBReader<unsigned int> &getDbReader() {
+        return tdbr;
+    }
+
+    unsigned int getQuerySeqType() const {
+        return querySeqType;
+    }
+
+    static std::string statsFileName(const std::string &targetDB) {
+        return targetDB + ".memstats";
+    }
+
+    // number of target sequences that are sampled for the k-mer distribution
+    static const size_t SAMPLE_SIZE = 5000;
+    // only the latest records of the statistics file are used
+    static const size_t MAX_RECORDS = 16;
+
+private:
+    DBReader<unsigned int> &tdbr;
+    const std::string statsFile;
+    BaseMatrix *subMat;
+    const int alphabetSize;
+    const unsigned int querySeqType;
+    const bool compressedEntries;
+    const int threads;
+    const bool spacedKmer;
+    const std::string spacedKmerPattern;
+    const size_t queryBatchSize;
+    const bool recordMemory;
+    // free explicit huge pages in bytes
+    const size_t hugePagePool;
+    double calibration;
+    // sampled index table entries per residue by k-mer size
+    std::map<int, double> kmersPerResidue;
+
+    double getKmersPerResidue(int kmerSize);
+
+    void readCalibration();
+};
+
+#endif
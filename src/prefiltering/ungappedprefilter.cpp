@@ -61,6 +61,14 @@ int doRescorealldiagonal(Parameters &par, DBReader<unsigned int> &qdbr, DBWriter
     }
 
 
+    // bin targets by length so that the lanes of a batch have similar lengths
+    std::vector<std::pair<unsigned int, unsigned int>> targetsByLength(tdbr->getSize());
+    for (size_t tId = 0; tId < tdbr->getSize(); tId++) {
+        targetsByLength[tId] = std::make_pair(tdbr->getSeqLen(tId), static_cast<unsigned int>(tId));
+    }
+    SORT_PARALLEL(targetsByLength.begin(), targetsByLength.end());
+    const int batchSize = VECSIZE_INT * 4;
+
     Debug::Progress progress(dbSize);
 
 #pragma omp parallel
@@ -77,6 +85,13 @@ int doRescorealldiagonal(Parameters &par, DBReader<unsigned int> &qdbr, DBWriter
         SmithWaterman aligner(par.maxSeqLen, subMat->alphabetSize,
                               par.compBiasCorrection, par.compBiasCorrectionScale, targetSeqType);
 
+        // mapped targets of the current batch
+        std::vector<std::vector<unsigned char>> batchSequences(batchSize, std::vector<unsigned char>(par.maxSeqLen + 1));
+        const unsigned char *batchTargets[VECSIZE_INT * 4];
+        int32_t batchLengths[VECSIZE_INT * 4];
+        unsigned int batchIds[VECSIZE_INT * 4];
+        int batchScores[VECSIZE_INT * 4];
+
         std::string resultBuffer;
         resultBuffer.reserve(262144);
 #pragma omp for schedule(dynamic, 1)
@@ -94,30 +109,50 @@ int doRescorealldiagonal(Parameters &par, DBReader<unsigned int> &qdbr, DBWriter
                 aligner.ssw_init(&qSeq, tinySubMat, subMat);
             }
 
-            for (size_t tId = 0; tId < tdbr->getSize(); tId++) {
-                unsigned int targetKey = tdbr->getDbKey(tId);
-                const bool isIdentity = (queryKey == targetKey && (par.includeIdentity || sameDB))? true : false;
+            const bool useBatch = qSeq.L <= SmithWaterman::BATCH_MAX_QUERY_LENGTH;
+            int batchCount = 0;
+            for (size_t i = 0; i < targetsByLength.size(); i++) {
+                const unsigned int tId = targetsByLength[i].second;
                 char * targetSeq = tdbr->getData(tId, thread_idx);
-                unsigned int targetSeqLen = tdbr->getSeqLen(tId);
-                tSeq.mapSequence(tId, targetKey, targetSeq, targetSeqLen);
-//                tSeq.print();
+                unsigned int targetSeqLen = targetsByLength[i].first;
+                tSeq.mapSequence(tId, tdbr->getDbKey(tId), targetSeq, targetSeqLen);
                 float queryLength = qSeq.L;
                 float targetLength = tSeq.L;
-                if(Util::canBeCovered(par.covThr, par.covMode, queryLength, targetLength)==false){
-                    continue;
+                if (Util::canBeCovered(par.covThr, par.covMode, queryLength, targetLength)) {
+                    if (useBatch) {
+                        unsigned char *numSequence = batchSequences[batchCount].data();
+                        memcpy(numSequence, tSeq.numSequence, tSeq.L);
+                        batchIds[batchCount] = tId;
+                        batchTargets[batchCount] = numSequence;
+                        batchLengths[batchCount] = tSeq.L;
+                        batchCount++;
+                    } else {
+                        batchIds[0] = tId;
+                        batchScores[0] = aligner.ungapped_alignment(tSeq.numSequence, tSeq.L);
+                        batchCount = 1;
+                    }
                 }
-
-                int score = aligner.ungapped_alignment(tSeq.numSequence, tSeq.L);
-                bool hasDiagScore = (score > par.minDiagScoreThr);
-                double evalue = evaluer->computeEvalue(score, qSeq.L);
-                bool hasEvalue = (evalue <= par.evalThr);
-                // --filter-hits
-                if (isIdentity || (hasDiagScore && hasEvalue)) {
-                    hit_t hit;
-                    hit.seqId = targetKey;
-                    hit.prefScore = score;
-                    hit.diagonal = 0;
-                    shortResults.emplace_back(hit);
+                if (useBatch && (batchCount == batchSize || (batchCount > 0 && i == targetsByLength.size() - 1))) {
+                    aligner.ungapped_alignment_batch(batchTargets, batchLengths, batchCount, batchScores);
+                }
+                if (batchCount == batchSize || (batchCount > 0 && (useBatch == false || i == targetsByLength.size() - 1))) {
+                    for (int k = 0; k < batchCount; k++) {
+                        unsigned int targetKey = tdbr->getDbKey(batchIds[k]);
+                        const bool isIdentity = (queryKey == targetKey && (par.includeIdentity || sameDB))? true : false;
+                        int score = batchScores[k];
+                        bool hasDiagScore = (score > par.minDiagScoreThr);
+                        double evalue = evaluer->computeEvalue(score, qSeq.L);
+                        bool hasEvalue = (evalue <= par.evalThr);
+                        // --filter-hits
+                        if (isIdentity || (hasDiagScore && hasEvalue)) {
+                            hit_t hit;
+                            hit.seqId = targetKey;
+                            hit.prefScore = score;
+                            hit.diagonal = 0;
+                            shortResults.emplace_back(hit);
+                        }
+                    }
+                    batchCount = 0;
                 }
             }
 
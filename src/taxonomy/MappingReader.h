@@ -1,37 +1,78 @@
 #ifndef MAPPING_READER_H
 #define MAPPING_READER_H
 
+// Maps database keys to taxon identifiers.
+//
+// A binary mapping is the magic followed by packed (dbkey, taxon) pairs sorted by dbkey and is used
+// directly from the memory mapped file. A tabular mapping is parsed and sorted on every open.
+// Lookups first jump to a radix bucket of the top bits of the key, then guess the position inside
+// the bucket by interpolation and only fall back to a binary search within the bucket.
+
 #include "Util.h"
+#include "Debug.h"
 #include "MemoryMapped.h"
 #include <algorithm>
 
 class MappingReader {
 public:
     static std::pair<char *, size_t> serialize(const MappingReader &reader) {
-        size_t serialized_size = reader.magicLen + reader.count * sizeof(Pair);
+        size_t serialized_size = MAGIC_LEN + reader.count * sizeof(Pair);
         char* data = (char*)malloc(serialized_size);
-        memcpy(data, reader.magic, reader.magicLen);
-        memcpy(data + reader.magicLen, reader.entries, reader.count * sizeof(Pair));
+        memcpy(data, magic(), MAGIC_LEN);
+        memcpy(data + MAGIC_LEN, reader.entries, reader.count * sizeof(Pair));
         return std::make_pair(data, serialized_size);
     }
 
-    MappingReader(const std::string &db, const bool dbInput = true) {
-        std::string input = dbInput ? db + "_mapping" : db;
-        file = new MemoryMapped(input, MemoryMapped::WholeFile, MemoryMapped::SequentialScan);
-        if (!file->isValid()) {
-            delete file;
-            file = NULL;
-            Debug(Debug::ERROR) << db << "_mapping does not exist. Please create the taxonomy mapping!\n";
+    // writes a binary mapping, the pairs have to be sorted by dbkey
+    static void writeBinary(const std::string &fileName, const std::vector<std::pair<unsigned int, unsigned int>> &mapping) {
+        FILE* handle = fopen(fileName.c_str(), "w");
+        if (handle == NULL) {
+            Debug(Debug::ERROR) << "Could not open " << fileName << " for writing\n";
             EXIT(EXIT_FAILURE);
         }
-        char *data = (char *) file->getData();
-        size_t dataSize = file->size();
-        if (file->size() > magicLen && memcmp(data, magic, magicLen) == 0) {
-            entries = reinterpret_cast<Pair*>(data + magicLen);
-            count = (dataSize - magicLen) / sizeof(Pair);
-            return;
+        bool ok = fwrite(magic(), MAGIC_LEN, 1, handle) == 1;
+        Pair buffer[4096];
+        for (size_t i = 0; i < mapping.size() && ok; i += 4096) {
+            const size_t n = std::min(mapping.size() - i, (size_t)4096);
+            for (size_t j = 0; j < n; ++j) {
+                buffer[j].dbkey = mapping[i + j].first;
+                buffer[j].taxon = mapping[i + j].second;
+            }
+            ok = fwrite(buffer, sizeof(Pair), n, handle) == n;
+        }
+        if (ok == false) {
+            Debug(Debug::ERROR) << "Could not write to mapping file " << fileName << "\n";
+            EXIT(EXIT_FAILURE);
+        }
+        if (fclose(handle) != 0) {
+            Debug(Debug::ERROR) << "Could not close mapping file " << fileName << "\n";
+            EXIT(EXIT_FAILURE);
+        }
+    }
+
+    static bool isBinary(const char *data, size_t size) {
+        return size >= MAGIC_LEN && memcmp(data, magic(), MAGIC_LEN) == 0;
+    }
+
+    // reads a binary or a tabular mapping file, returns false if a tabular mapping is not sorted by dbkey
+    static bool readMapping(const std::string &fileName, std::vector<std::pair<unsigned int, unsigned int>> &mapping) {
+        MemoryMapped indexData(fileName, MemoryMapped::WholeFile, MemoryMapped::SequentialScan);
+        if (!indexData.isValid()) {
+            Debug(Debug::ERROR) << "Could not open mapping file " << fileName << "\n";
+            EXIT(EXIT_FAILURE);
+        }
+        char *data = (char *) indexData.getData();
+        const size_t dataSize = indexData.size();
+        if (isBinary(data, dataSize)) {
+            const Pair *pairs = reinterpret_cast<const Pair*>(data + MAGIC_LEN);
+            const size_t pairCount = (dataSize - MAGIC_LEN) / sizeof(Pair);
+            mapping.reserve(mapping.size() + pairCount);
+            for (size_t i = 0; i < pairCount; ++i) {
+                mapping.emplace_back(pairs[i].dbkey, pairs[i].taxon);
+            }
+            indexData.close();
+            return true;
         }
-        std::vector<std::pair<unsigned int, unsigned int>> mapping;
         size_t currPos = 0;
         const char *cols[3];
         size_t isSorted = true;
@@ -43,12 +84,35 @@ public:
             unsigned int taxid = Util::fast_atoi<size_t>(cols[1]);
             data = Util::skipLine(data);
             mapping.push_back(std::make_pair(id, taxid));
-            currPos = data - (char *) file->getData();
+            currPos = data - (char *) indexData.getData();
             prevId = id;
         }
+        indexData.close();
+        return isSorted;
+    }
+
+    MappingReader(const std::string &db, const bool dbInput = true) : bucketOffsets(NULL), bucketCount(0), shift(0) {
+        std::string input = dbInput ? db + "_mapping" : db;
+        file = new MemoryMapped(input, MemoryMapped::WholeFile, MemoryMapped::SequentialScan);
+        if (!file->isValid()) {
+            delete file;
+            file = NULL;
+            Debug(Debug::ERROR) << db << "_mapping does not exist. Please create the taxonomy mapping!\n";
+            EXIT(EXIT_FAILURE);
+        }
+        char *data = (char *) file->getData();
+        size_t dataSize = file->size();
+        if (isBinary(data, dataSize)) {
+            entries = reinterpret_cast<Pair*>(data + MAGIC_LEN);
+            count = (dataSize - MAGIC_LEN) / sizeof(Pair);
+            initIndex();
+            return;
+        }
         file->close();
         delete file;
         file = NULL;
+        std::vector<std::pair<unsigned int, unsigned int>> mapping;
+        const bool isSorted = readMapping(input, mapping);
         if (mapping.size() == 0) {
             Debug(Debug::ERROR) << db << "_mapping is empty. Rerun createtaxdb to recreate taxonomy mapping.\n";
             EXIT(EXIT_FAILURE);
@@ -63,6 +127,7 @@ public:
         if (isSorted == false) {
             std::stable_sort(entries, entries + count, compareTaxa);
         }
+        initIndex();
     }
 
     ~MappingReader() {
@@ -72,21 +137,44 @@ public:
         } else {
             delete[] entries;
         }
+        delete[] bucketOffsets;
     }
 
-    unsigned int lookup(unsigned int key) {
-        unsigned int taxon = 0;
+    unsigned int lookup(unsigned int key) const {
         // match dbKey to its taxon based on mapping
+        const size_t bucket = key >> shift;
+        if (bucket >= bucketCount) {
+            return 0;
+        }
+        const size_t lo = bucketOffsets[bucket];
+        const size_t hi = bucketOffsets[bucket + 1];
+        if (lo == hi) {
+            return 0;
+        }
+        // keys of a bucket lie in [bucketKey, bucketKey + 2^shift), dense keys are found by the first guess
+        const size_t bucketKey = bucket << shift;
+        size_t guess = lo + ((key - bucketKey) * (hi - lo) >> shift);
+        guess = std::min(guess, hi - 1);
+        if (entries[guess].dbkey == key && (guess == lo || entries[guess - 1].dbkey != key)) {
+            return entries[guess].taxon;
+        }
         Pair val;
         val.dbkey = key;
-        Pair* end = entries + count;
-        Pair* found = std::upper_bound(entries, end, val, compareTaxa);
+        const Pair* end = entries + hi;
+        const Pair* found = std::lower_bound((const Pair*)entries + lo, end, val, compareTaxa);
         if (found == end || found->dbkey != key) {
-            taxon = 0;
-        } else {
-            taxon = found->taxon;
+            return 0;
+        }
+        return found->taxon;
+    }
+
+    void getMapping(std::vector<std::pair<unsigned int, unsigned int>> &mapping) const {
+        mapping.reserve(mapping.size() + count);
+        for (size_t i = 0; i < count; ++i) {
+            const unsigned int dbkey = entries[i].dbkey;
+            const unsigned int taxon = entries[i].taxon;
+            mapping.emplace_back(dbkey, taxon);
         }
-        return taxon;
     }
 
 private:
@@ -97,11 +185,41 @@ private:
     };
     Pair* entries;
     size_t count;
-    //                    T  A   X   M  Version
-    const char magic[5] = {19, 0, 23, 12, 0};
-    const size_t magicLen = 5;
+
+    // entries with key >> shift == b are in [bucketOffsets[b], bucketOffsets[b + 1])
+    size_t *bucketOffsets;
+    size_t bucketCount;
+    unsigned int shift;
+    static const unsigned int RADIX_BITS = 16;
+
+    static const size_t MAGIC_LEN = 5;
+    static const char *magic() {
+        //                          T  A   X   M  Version
+        static const char data[5] = {19, 0, 23, 12, 0};
+        return data;
+    }
+
     static bool compareTaxa(const Pair &lhs, const Pair &rhs) {
-        return (lhs.dbkey <= rhs.dbkey);
+        return (lhs.dbkey < rhs.dbkey);
+    }
+
+    // the bucket boundaries are found by binary searches, so opening a mapped file does not touch all entries
+    void initIndex() {
+        if (count == 0) {
+            return;
+        }
+        const unsigned int maxKey = entries[count - 1].dbkey;
+        while ((maxKey >> shift) >= (1u << RADIX_BITS)) {
+            shift++;
+        }
+        bucketCount = (maxKey >> shift) + 1;
+        bucketOffsets = new size_t[bucketCount + 1];
+        Pair val;
+        for (size_t b = 0; b < bucketCount; ++b) {
+            val.dbkey = b << shift;
+            bucketOffsets[b] = std::lower_bound(entries, entries + count, val, compareTaxa) - entries;
+        }
+        bucketOffsets[bucketCount] = count;
     }
 };
 
@@ -12,27 +12,20 @@
 #include <fstream>
 #include <algorithm>
 #include <cassert>
+#include <climits>
 
-const int NcbiTaxonomy::SERIALIZATION_VERSION = 2;
+const int NcbiTaxonomy::SERIALIZATION_VERSION = 3;
 
-int **makeMatrix(size_t maxNodes) {
-    size_t dimension = maxNodes * 2;
-    int **M = new int*[dimension];
-    int k = (int)(MathUtil::flog2(dimension)) + 1;
-    M[0] = new int[dimension * k]();
-    for(size_t i = 1; i < dimension; i++) {
-        M[i] = M[i-1] + k;
-    }
-
-    return M;
+static inline int floorLog2(unsigned int x) {
+    return 31 - __builtin_clz(x);
 }
 
-void deleteMatrix(int** M) {
-    delete[] M[0];
-    delete[] M;
+// number of levels of the sparse table over an Euler tour of the given length
+static inline size_t rmqLevels(size_t dimension) {
+    return floorLog2(dimension) + 1;
 }
 
-NcbiTaxonomy::NcbiTaxonomy(const std::string &namesFile, const std::string &nodesFile, const std::string &mergedFile) : externalData(false) {
+NcbiTaxonomy::NcbiTaxonomy(const std::string &namesFile, const std::string &nodesFile, const std::string &mergedFile) : externalData(false), externalMatrix(false) {
     block = new StringBlock<unsigned int>();
     std::vector<TaxonNode> tmpNodes;
     loadNodes(tmpNodes, nodesFile);
@@ -68,7 +61,7 @@ NcbiTaxonomy::NcbiTaxonomy(const std::string &namesFile, const std::string &node
     L = new int[maxNodes * 2];
     std::copy(tmpL.begin(), tmpL.end(), L);
 
-    M = makeMatrix(maxNodes);
+    M = new int[maxNodes * 2 * rmqLevels(maxNodes * 2)]();
     InitRangeMinimumQuery();
 
     mmapData = NULL;
@@ -76,15 +69,15 @@ NcbiTaxonomy::NcbiTaxonomy(const std::string &namesFile, const std::string &node
 }
 
 NcbiTaxonomy::~NcbiTaxonomy() {
-    if (externalData) {
-        delete[] M;
-    } else {
+    if (externalData == false) {
         delete[] taxonNodes;
         delete[] H;
         delete[] D;
         delete[] E;
         delete[] L;
-        deleteMatrix(M);
+    }
+    if (externalMatrix == false) {
+        delete[] M;
     }
     delete block;
     if (mmapData != NULL) {
@@ -206,18 +199,21 @@ void NcbiTaxonomy::elh(std::vector<std::vector<TaxID>> const & children, TaxID t
 void NcbiTaxonomy::InitRangeMinimumQuery() {
     Debug(Debug::INFO) << "Init RMQ ...";
 
-    for (unsigned int i = 0; i < (maxNodes * 2); ++i) {
-        M[i][0] = i;
+    const size_t dimension = maxNodes * 2;
+    for (unsigned int i = 0; i < dimension; ++i) {
+        M[i] = i;
     }
 
-    for (unsigned int j = 1; (1ul << j) <= (maxNodes * 2); ++j) {
-        for (unsigned int i = 0; (i + (1ul << j) - 1) < (maxNodes * 2); ++i) {
-            int A = M[i][j - 1];
-            int B = M[i + (1ul << (j - 1))][j - 1];
+    for (unsigned int j = 1; (1ul << j) <= dimension; ++j) {
+        const int *prev = M + (j - 1) * dimension;
+        int *curr = M + j * dimension;
+        for (unsigned int i = 0; (i + (1ul << j) - 1) < dimension; ++i) {
+            int A = prev[i];
+            int B = prev[i + (1ul << (j - 1))];
             if (L[A] < L[B]) {
-                M[i][j] = A;
+                curr[i] = A;
             } else {
-                M[i][j] = B;
+                curr[i] = B;
             }
         }
     }
@@ -226,9 +222,10 @@ void NcbiTaxonomy::InitRangeMinimumQuery() {
 
 int NcbiTaxonomy::RangeMinimumQuery(int i, int j) const {
     assert(j >= i);
-    int k = (int)MathUtil::flog2(j - i + 1);
-    int A = M[i][k];
-    int B = M[j - MathUtil::ipow<int>(2, k) + 1][k];
+    const int k = floorLog2(j - i + 1);
+    const int *level = M + k * (maxNodes * 2);
+    int A = level[i];
+    int B = level[j - (1 << k) + 1];
     if (L[A] <= L[B]) {
         return A;
     }
@@ -287,27 +284,82 @@ TaxID NcbiTaxonomy::LCA(TaxID taxonA, TaxID taxonB) const {
 }
 
 
+// The LCA of a set is the node with the smallest level in the Euler tour between the first
+// and the last first occurrence of its members, so a single RMQ resolves the whole set.
 TaxonNode const * NcbiTaxonomy::LCA(const std::vector<TaxID>& taxa) const {
-    std::vector<int>::const_iterator it = taxa.begin();
-    while (it != taxa.end() && !nodeExists(*it)) {
-        Debug(Debug::WARNING) << "No node for taxID " << *it << ", ignoring it.\n";
-        ++it;
-    }
-    if (it == taxa.end()) { return NULL; }
-    int red = nodeId(*it++);
-    for (; it != taxa.end(); ++it) {
-        if (nodeExists(*it)) {
-            red = lcaHelper(red, nodeId(*it));
-        } else {
+    int first = INT_MAX;
+    int last = -1;
+    int single = -1;
+    for (std::vector<int>::const_iterator it = taxa.begin(); it != taxa.end(); ++it) {
+        if (!nodeExists(*it)) {
             Debug(Debug::WARNING) << "No node for taxID " << *it << ", ignoring it.\n";
+            continue;
         }
+        const int id = nodeId(*it);
+        single = (last == -1 || single == id) ? id : -2;
+        first = std::min(first, H[id]);
+        last = std::max(last, H[id]);
+    }
+    if (last == -1) {
+        return NULL;
     }
+    // members that share one node need no RMQ
+    const int red = (single >= 0) ? single : E[RangeMinimumQuery(first, last)];
 
     assert(red >= 0 && static_cast<unsigned int>(red) < maxNodes);
 
     return &(taxonNodes[red]);
 }
 
+void NcbiTaxonomy::LCA(const TaxID *taxa, const size_t *offsets, size_t setCount, TaxonNode const **result) const {
+    // sets are resolved in blocks, the RMQ lookups of a block run in one branch free loop
+    const size_t BLOCK_SIZE = 256;
+    int first[BLOCK_SIZE];
+    int last[BLOCK_SIZE];
+    int single[BLOCK_SIZE];
+    int red[BLOCK_SIZE];
+    const size_t dimension = maxNodes * 2;
+    for (size_t start = 0; start < setCount; start += BLOCK_SIZE) {
+        const size_t count = std::min(BLOCK_SIZE, setCount - start);
+        for (size_t i = 0; i < count; i++) {
+            first[i] = INT_MAX;
+            last[i] = -1;
+            single[i] = -1;
+            for (size_t j = offsets[start + i]; j < offsets[start + i + 1]; j++) {
+                if (!nodeExists(taxa[j])) {
+                    Debug(Debug::WARNING) << "No node for taxID " << taxa[j] << ", ignoring it.\n";
+                    continue;
+                }
+                const int id = D[taxa[j]];
+                single[i] = (last[i] == -1 || single[i] == id) ? id : -2;
+                first[i] = std::min(first[i], H[id]);
+                last[i] = std::max(last[i], H[id]);
+            }
+        }
+
+        for (size_t i = 0; i < count; i++) {
+            // empty sets query the valid range [0, 0]
+            const int from = (last[i] == -1) ? 0 : first[i];
+            const int to = (last[i] == -1) ? 0 : last[i];
+            const int k = floorLog2(to - from + 1);
+            const int *level = M + k * dimension;
+            const int A = level[from];
+            const int B = level[to - (1 << k) + 1];
+            red[i] = E[(L[A] <= L[B]) ? A : B];
+        }
+
+        for (size_t i = 0; i < count; i++) {
+            if (last[i] == -1) {
+                result[start + i] = NULL;
+            } else if (single[i] >= 0) {
+                result[start + i] = &(taxonNodes[single[i]]);
+            } else {
+                result[start + i] = &(taxonNodes[red[i]]);
+            }
+        }
+    }
+}
+
 
 // AtRanks returns a slice of slices having the taxons at the specified taxonomic levels
 std::vector<std::string> NcbiTaxonomy::AtRanks(TaxonNode const *node, const std::vector<std::string> &levels) const {
@@ -704,7 +756,7 @@ WeightedTaxResult NcbiTaxonomy::weightedMajorityLCA(const std::vector<WeightedTa
 std::pair<char*, size_t> NcbiTaxonomy::serialize(const NcbiTaxonomy& t) {
     t.block->compact();
     size_t matrixDim = (t.maxNodes * 2);
-    size_t matrixK = (int)(MathUtil::flog2(matrixDim)) + 1;
+    size_t matrixK = rmqLevels(matrixDim);
     size_t matrixSize = matrixDim * matrixK * sizeof(int);
     size_t blockSize = StringBlock<unsigned int>::memorySize(*t.block);
     size_t memSize = sizeof(int) // SERIALIZATION_VERSION
@@ -735,7 +787,7 @@ std::pair<char*, size_t> NcbiTaxonomy::serialize(const NcbiTaxonomy& t) {
     p += (t.maxNodes * 2) * sizeof(int);
     memcpy(p, t.H, t.maxNodes * sizeof(int));
     p += t.maxNodes * sizeof(int);
-    memcpy(p, t.M[0], matrixSize);
+    memcpy(p, t.M, matrixSize);
     p += matrixSize;
     char* blockData = StringBlock<unsigned int>::serialize(*t.block);
     memcpy(p, blockData, blockSize);
@@ -748,7 +800,7 @@ NcbiTaxonomy* NcbiTaxonomy::unserialize(char* mem) {
     const char* p = mem;
     int version = *((int*)p);
     p += sizeof(int);
-    if (version != NcbiTaxonomy::SERIALIZATION_VERSION) {
+    if (version != NcbiTaxonomy::SERIALIZATION_VERSION && version != 2) {
         return NULL;
     }
     size_t maxNodes = *((size_t*)p);
@@ -766,14 +818,22 @@ NcbiTaxonomy* NcbiTaxonomy::unserialize(char* mem) {
     int* H = (int*)p;
     p += maxNodes * sizeof(int);
     size_t matrixDim = (maxNodes * 2);
-    size_t matrixK = (int)(MathUtil::flog2(matrixDim)) + 1;
+    size_t matrixK = rmqLevels(matrixDim);
     size_t matrixSize = matrixDim * matrixK * sizeof(int);
-    int** M = new int*[matrixDim];
-    M[0] = (int*)p;
-    for(size_t i = 1; i < matrixDim; i++) {
-        M[i] = M[i-1] + matrixK;
+    int* M = (int*)p;
+    if (version == 2) {
+        // version 2 stored the sparse table position-major
+        M = new int[matrixDim * matrixK];
+        const int* src = (const int*)p;
+        for (size_t i = 0; i < matrixDim; i++) {
+            for (size_t k = 0; k < matrixK; k++) {
+                M[k * matrixDim + i] = src[i * matrixK + k];
+            }
+        }
     }
     p += matrixSize;
     StringBlock<unsigned int>* block = StringBlock<unsigned int>::unserialize(p);
-    return new NcbiTaxonomy(taxonNodes, maxNodes, maxTaxID, D, E, L, H, M, block);
+    NcbiTaxonomy* t = new NcbiTaxonomy(taxonNodes, maxNodes, maxTaxID, D, E, L, H, M, block);
+    t->externalMatrix = (version != 2);
+    return t;
 }
@@ -100,6 +100,9 @@ public:
 
     TaxonNode const * LCA(const std::vector<TaxID>& taxa) const;
     TaxID LCA(TaxID taxonA, TaxID taxonB) const;
+    // LCA of many sets at once, set i consists of taxa[offsets[i]] to taxa[offsets[i + 1] - 1]
+    // result[i] is NULL if none of the taxa of set i exist
+    void LCA(const TaxID *taxa, const size_t *offsets, size_t setCount, TaxonNode const **result) const;
     std::vector<std::string> AtRanks(TaxonNode const * node, const std::vector<std::string> &levels) const;
     std::map<std::string, std::string> AllRanks(TaxonNode const *node) const;
     std::string taxLineage(TaxonNode const *node, bool infoAsName = true);
@@ -134,17 +137,21 @@ private:
     int RangeMinimumQuery(int i, int j) const;
     int lcaHelper(int i, int j) const;
 
-    NcbiTaxonomy(TaxonNode* taxonNodes, size_t maxNodes, int maxTaxID, int *D, int *E, int *L, int *H, int **M, StringBlock<unsigned int> *block)
-        : taxonNodes(taxonNodes), maxNodes(maxNodes), maxTaxID(maxTaxID), D(D), E(E), L(L), H(H), M(M), block(block), externalData(true), mmapData(NULL), mmapSize(0) {};
+    NcbiTaxonomy(TaxonNode* taxonNodes, size_t maxNodes, int maxTaxID, int *D, int *E, int *L, int *H, int *M, StringBlock<unsigned int> *block)
+        : taxonNodes(taxonNodes), maxNodes(maxNodes), maxTaxID(maxTaxID), D(D), E(E), L(L), H(H), M(M), block(block), externalData(true), externalMatrix(true), mmapData(NULL), mmapSize(0) {};
     int maxTaxID;
     int *D; // maps from taxID to node ID in taxonNodes
     int *E; // for Euler tour sequence (size 2N-1)
     int *L; // Level of nodes in tour sequence (size 2N-1)
-    int *H;
-    int **M;
+    int *H; // first position of a node in the Euler tour
+    // sparse table of the Euler tour positions with the smallest level, level k holds the minimum of
+    // the 2^k positions starting at i in M[k * (maxNodes * 2) + i]
+    int *M;
     StringBlock<unsigned int>* block;
 
     bool externalData;
+    // the sparse table of version 2 files is converted on load
+    bool externalMatrix;
     char* mmapData;
     size_t mmapSize;
 
@@ -7,6 +7,8 @@
 #include "Matcher.h"
 #include "MappingReader.h"
 
+#include <algorithm>
+
 #ifdef OPENMP
 #include <omp.h>
 #endif
@@ -81,6 +83,8 @@ int dolca(int argc, const char **argv, const Command& command, bool majority) {
     size_t taxonNotFound = 0;
     size_t found = 0;
     Debug::Progress progress(reader.getSize());
+    // entries are processed in batches, so the LCAs of a batch are resolved in one call
+    const size_t batchSize = 1024;
     #pragma omp parallel
     {
         const char *entry[255];
@@ -92,105 +96,117 @@ int dolca(int argc, const char **argv, const Command& command, bool majority) {
         thread_idx = (unsigned int) omp_get_thread_num();
 #endif
 
-        #pragma omp for schedule(dynamic, 10) reduction (+:taxonNotFound, found)
-        for (size_t i = 0; i < reader.getSize(); ++i) {
-            progress.updateProgress();
-
-            unsigned int key = reader.getDbKey(i);
-            char *data = reader.getData(i, thread_idx);
-            size_t length = reader.getEntryLen(i);
-
-            std::vector<int> taxa;
-            std::vector<WeightedTaxHit> weightedTaxa;
-            while (*data != '\0') {
-                const size_t columns = Util::getWordsOfLine(data, entry, 255);
-                data = Util::skipLine(data);
-                if (columns == 0) {
-                    Debug(Debug::WARNING) << "Empty entry: " << i << "!";
-                    continue;
-                }
-
-                unsigned int id = Util::fast_atoi<unsigned int>(entry[0]);
-                TaxID taxon = mapping.lookup(id);
-                if (taxon == 0) {
-                    // TODO: Check which taxa were not found
-                    taxonNotFound += 1;
-                    continue;
-                }
-                found++;
+        std::vector<int> taxa;
+        std::vector<size_t> offsets;
+        std::vector<TaxonNode const *> nodes(batchSize);
+        std::vector<bool> hasHits(batchSize);
+        std::vector<WeightedTaxHit> weightedTaxa;
+
+        #pragma omp for schedule(dynamic, 1) reduction (+:taxonNotFound, found)
+        for (size_t batchStart = 0; batchStart < reader.getSize(); batchStart += batchSize) {
+            const size_t batchEnd = std::min(batchStart + batchSize, reader.getSize());
+            taxa.clear();
+            offsets.clear();
+            offsets.emplace_back(0);
+            for (size_t i = batchStart; i < batchEnd; ++i) {
+                progress.updateProgress();
+
+                char *data = reader.getData(i, thread_idx);
+                size_t length = reader.getEntryLen(i);
+
+                weightedTaxa.clear();
+                while (*data != '\0') {
+                    const size_t columns = Util::getWordsOfLine(data, entry, 255);
+                    data = Util::skipLine(data);
+                    if (columns == 0) {
+                        Debug(Debug::WARNING) << "Empty entry: " << i << "!";
+                        continue;
+                    }
 
-                // remove blacklisted taxa
-                bool isBlacklisted = false;
-                for (size_t j = 0; j < blacklist.size(); ++j) {
-                    if (blacklist[j] == 0) {
+                    unsigned int id = Util::fast_atoi<unsigned int>(entry[0]);
+                    TaxID taxon = mapping.lookup(id);
+                    if (taxon == 0) {
+                        // TODO: Check which taxa were not found
+                        taxonNotFound += 1;
                         continue;
                     }
-                    if (t->IsAncestor(blacklist[j], taxon)) {
-                        isBlacklisted = true;
-                        break;
+                    found++;
+
+                    // remove blacklisted taxa
+                    bool isBlacklisted = false;
+                    for (size_t j = 0; j < blacklist.size(); ++j) {
+                        if (blacklist[j] == 0) {
+                            continue;
+                        }
+                        if (t->IsAncestor(blacklist[j], taxon)) {
+                            isBlacklisted = true;
+                            break;
+                        }
                     }
-                }
 
-                if (isBlacklisted == false) {
-                    if (majority) {
-                        float weight = FLT_MAX;
-                        if (par.voteMode == Parameters::AGG_TAX_MINUS_LOG_EVAL) {
-                            if (columns <= 3) {
-                                Debug(Debug::ERROR) << "No alignment result for taxon " << taxon << " found\n";
-                                EXIT(EXIT_FAILURE);
+                    if (isBlacklisted == false) {
+                        if (majority) {
+                            float weight = FLT_MAX;
+                            if (par.voteMode == Parameters::AGG_TAX_MINUS_LOG_EVAL) {
+                                if (columns <= 3) {
+                                    Debug(Debug::ERROR) << "No alignment result for taxon " << taxon << " found\n";
+                                    EXIT(EXIT_FAILURE);
+                                }
+                                weight = strtod(entry[3], NULL);
+                            } else if (par.voteMode == Parameters::AGG_TAX_SCORE) {
+                                if (columns <= 1) {
+                                    Debug(Debug::ERROR) << "No alignment result for taxon " << taxon << " found\n";
+                                    EXIT(EXIT_FAILURE);
+                                }
+                                weight = strtod(entry[1], NULL);
                             }
-                            weight = strtod(entry[3], NULL);
-                        } else if (par.voteMode == Parameters::AGG_TAX_SCORE) {
-                            if (columns <= 1) {
-                                Debug(Debug::ERROR) << "No alignment result for taxon " << taxon << " found\n";
-                                EXIT(EXIT_FAILURE);
-                            }
-                            weight = strtod(entry[1], NULL);
+                            weightedTaxa.emplace_back(taxon, weight, par.voteMode);
+                        } else {
+                            taxa.emplace_back(taxon);
                         }
-                        weightedTaxa.emplace_back(taxon, weight, par.voteMode);
-                    } else {
-                        taxa.emplace_back(taxon);
                     }
                 }
-            }
+                offsets.emplace_back(taxa.size());
 
-            if (length == 1) {
-                writer.writeData(noTaxResult.c_str(), noTaxResult.size(), key, thread_idx);
-                continue;
+                hasHits[i - batchStart] = (length != 1);
+                if (majority && length != 1) {
+                    WeightedTaxResult result = t->weightedMajorityLCA(weightedTaxa, par.majorityThr);
+                    nodes[i - batchStart] = t->taxonNode(result.taxon, false);
+                }
             }
-
-            TaxonNode const * node = NULL;
-            if (majority) {
-                WeightedTaxResult result = t->weightedMajorityLCA(weightedTaxa, par.majorityThr);
-                node = t->taxonNode(result.taxon, false);
-            } else {
-                node = t->LCA(taxa);
-            }
-            if (node == NULL) {
-                writer.writeData(noTaxResult.c_str(), noTaxResult.size(), key, thread_idx);
-                continue;
+            if (majority == false) {
+                t->LCA(taxa.data(), offsets.data(), batchEnd - batchStart, nodes.data());
             }
 
-            result.append(SSTR(node->taxId));
-            result.append(1, '\t');
-            result.append(t->getString(node->rankIdx));
-            result.append(1, '\t');
-            result.append(t->getString(node->nameIdx));
-            if (!ranks.empty()) {
-                result.append(1, '\t');
-                result.append(Util::implode(t->AtRanks(node, ranks), ';'));
-            }
-            if (par.showTaxLineage == 1) {
+            for (size_t i = batchStart; i < batchEnd; ++i) {
+                unsigned int key = reader.getDbKey(i);
+                TaxonNode const * node = nodes[i - batchStart];
+                if (hasHits[i - batchStart] == false || node == NULL) {
+                    writer.writeData(noTaxResult.c_str(), noTaxResult.size(), key, thread_idx);
+                    continue;
+                }
+
+                result.append(SSTR(node->taxId));
                 result.append(1, '\t');
-                result.append(t->taxLineage(node, true));
-            }
-            if (par.showTaxLineage == 2) {
+                result.append(t->getString(node->rankIdx));
                 result.append(1, '\t');
-                result.append(t->taxLineage(node, false));
+                result.append(t->getString(node->nameIdx));
+                if (!ranks.empty()) {
+                    result.append(1, '\t');
+                    result.append(Util::implode(t->AtRanks(node, ranks), ';'));
+                }
+                if (par.showTaxLineage == 1) {
+                    result.append(1, '\t');
+                    result.append(t->taxLineage(node, true));
+                }
+                if (par.showTaxLineage == 2) {
+                    result.append(1, '\t');
+                    result.append(t->taxLineage(node, false));
+                }
+                result.append(1, '\n');
+                writer.writeData(result.c_str(), result.size(), key, thread_idx);
+                result.clear();
             }
-            result.append(1, '\n');
-            writer.writeData(result.c_str(), result.size(), key, thread_idx);
-            result.clear();
         }
     }
     Debug(Debug::INFO) << "Taxonomy for " << taxonNotFound << " out of " << taxonNotFound+found << " entries not found\n";
@@ -0,0 +1,110 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cfloat>
+#include <climits>
+#include <cstdlib>
+
+#include "Matcher.h"
+#include "Sequence.h"
+#include "SubstitutionMatrix.h"
+#include "EvalueComputation.h"
+#include "StripedSmithWaterman.h"
+#include "Parameters.h"
+
+const char* binary_name = "test_alignmentscorebatch";
+
+static const char aminoAcids[] = "ACDEFGHIKLMNPQRSTVWY";
+
+static std::string randomSequence(size_t length) {
+    std::string seq(length, ' ');
+    for (size_t i = 0; i < length; i++) {
+        seq[i] = aminoAcids[rand() % (sizeof(aminoAcids) - 1)];
+    }
+    return seq;
+}
+
+// copy of seq with substitutions, insertions and deletions
+static std::string mutate(const std::string &seq) {
+    std::string out;
+    for (size_t i = 0; i < seq.size(); i++) {
+        const int r = rand() % 100;
+        if (r < 5) {
+            continue;
+        } else if (r < 10) {
+            out.append(randomSequence(1 + rand() % 4));
+        }
+        out.push_back((r < 35) ? aminoAcids[rand() % (sizeof(aminoAcids) - 1)] : seq[i]);
+    }
+    return out.empty() ? seq : out;
+}
+
+// align only skips hits by the batch score if that score cannot reach the e-value threshold,
+// so the e-value of the batch score must never be larger than the e-value of the full alignment
+int main (int, const char**) {
+    Parameters& par = Parameters::getInstance();
+    par.initMatrices();
+    srand(1);
+
+    const int maxSeqLen = 1024;
+    SubstitutionMatrix subMat(par.scoringMatrixFile.values.aminoacid().c_str(), 2.0, 0.0);
+    EvalueComputation evaluer(100000000, &subMat, par.gapOpen.values.aminoacid(), par.gapExtend.values.aminoacid());
+    for (int compBias = 0; compBias < 2; compBias++) {
+        Matcher matcher(Parameters::DBTYPE_AMINO_ACIDS, Parameters::DBTYPE_AMINO_ACIDS, maxSeqLen, &subMat, &evaluer,
+                        compBias, 1.0, par.gapOpen.values.aminoacid(), par.gapExtend.values.aminoacid(), 0.0, 40);
+        Sequence qSeq(maxSeqLen, Parameters::DBTYPE_AMINO_ACIDS, &subMat, 0, false, compBias);
+        Sequence dbSeq(maxSeqLen, Parameters::DBTYPE_AMINO_ACIDS, &subMat, 0, false, compBias);
+
+        const int batchSize = VECSIZE_INT * 4;
+        std::vector<std::string> targets(batchSize);
+        std::vector<std::vector<unsigned char> > residues(batchSize);
+        const unsigned char *batchTargets[VECSIZE_INT * 4];
+        int32_t batchLengths[VECSIZE_INT * 4];
+        int batchScores[VECSIZE_INT * 4];
+
+        size_t compared = 0;
+        size_t bounded = 0;
+        const size_t queryLengths[] = {10, 50, 120, 200, SmithWaterman::BATCH_MAX_QUERY_LENGTH};
+        for (size_t q = 0; q < sizeof(queryLengths) / sizeof(queryLengths[0]); q++) {
+            const std::string query = randomSequence(queryLengths[q]);
+            qSeq.mapSequence(0, 0, query.c_str(), query.size());
+            matcher.initQuery(&qSeq);
+            for (int round = 0; round < 4; round++) {
+                for (int k = 0; k < batchSize; k++) {
+                    // homologs of the query, homologs embedded in random flanks and unrelated targets
+                    if (k % 3 == 0) {
+                        targets[k] = mutate(query);
+                    } else if (k % 3 == 1) {
+                        targets[k] = randomSequence(rand() % 100) + mutate(query.substr(rand() % query.size())) + randomSequence(rand() % 100);
+                    } else {
+                        targets[k] = randomSequence(1 + rand() % 400);
+                    }
+                    dbSeq.mapSequence(k + 1, k + 1, targets[k].c_str(), targets[k].size());
+                    residues[k].assign(dbSeq.numSequence, dbSeq.numSequence + dbSeq.L);
+                    batchTargets[k] = residues[k].data();
+                    batchLengths[k] = dbSeq.L;
+                }
+                matcher.getSWScoreBatch(batchTargets, batchLengths, batchSize, batchScores);
+                for (int k = 0; k < batchSize; k++) {
+                    dbSeq.mapSequence(k + 1, k + 1, targets[k].c_str(), targets[k].size());
+                    Matcher::result_t res = matcher.getSWResult(&dbSeq, INT_MAX, false, 0, 0.0, FLT_MAX, Matcher::SCORE_COV_SEQID, 0, false);
+                    compared++;
+                    // 255 marks an overflow, align does not skip these hits
+                    if (batchScores[k] >= 255) {
+                        continue;
+                    }
+                    bounded++;
+                    const double batchEvalue = evaluer.computeEvalue(batchScores[k], qSeq.L);
+                    if (batchEvalue > res.eval * (1.0 + 1e-9)) {
+                        std::cout << "Query length " << qSeq.L << " target length " << dbSeq.L << ": batch score "
+                                  << batchScores[k] << " e-value " << batchEvalue << " > alignment e-value " << res.eval << std::endl;
+                        return EXIT_FAILURE;
+                    }
+                }
+            }
+        }
+        std::cout << "Composition bias " << compBias << ": " << bounded << " of " << compared
+                  << " batch scores bound the alignment score" << std::endl;
+    }
+    return EXIT_SUCCESS;
+}
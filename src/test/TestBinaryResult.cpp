@@ -0,0 +1,93 @@
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "BinaryResult.h"
+#include "DBReader.h"
+#include "DBWriter.h"
+#include "Parameters.h"
+
+const char* binary_name = "test_binaryresult";
+
+int main (int, const char**) {
+    const int dbtype = BinaryResult::setBinaryDbtype(Parameters::DBTYPE_ALIGNMENT_RES, true);
+    DBWriter writer("dataBinary", "dataBinary.index", 1, Parameters::WRITER_COMPRESSED_MODE, dbtype);
+    writer.open();
+
+    std::vector<Matcher::result_t> results;
+    results.emplace_back(2, 120, 0.9f, 0.8f, 0.75f, 1e-20, 100, 0, 99, 110, 5, 104, 125, std::string(100, 'M'));
+    results.emplace_back(7, 45, 0.5f, 0.4f, 0.3f, 1e-3, 60, 10, 69, 110, 0, 62, 150, std::string(30, 'M') + "II" + std::string(28, 'M') + "DD");
+    std::string entry;
+    BinaryResult::appendAlignmentResults(entry, results.data(), results.size(), true);
+    writer.writeData(entry.c_str(), entry.size(), 1, 0);
+    writer.writeData("", 0, 2, 0);
+
+    std::vector<hit_t> hits(2);
+    hits[0].seqId = 3; hits[0].prefScore = 80; hits[0].diagonal = 12;
+    hits[1].seqId = 9; hits[1].prefScore = -20; hits[1].diagonal = static_cast<unsigned short>(-5);
+    entry.clear();
+    BinaryResult::appendPrefilterHits(entry, hits.data(), hits.size());
+    writer.writeData(entry.c_str(), entry.size(), 3, 0);
+    writer.close();
+
+    DBReader<unsigned int> reader("dataBinary", "dataBinary.index", 1, DBReader<unsigned int>::USE_DATA|DBReader<unsigned int>::USE_INDEX);
+    reader.open(DBReader<unsigned int>::NOSORT);
+    std::cout << "Binary: " << BinaryResult::isBinaryDbtype(reader.getDbtype()) << std::endl;
+    if (BinaryResult::isBinaryDbtype(reader.getDbtype()) == false) {
+        std::cout << "Binary dbtype was not kept" << std::endl;
+        return EXIT_FAILURE;
+    }
+    for (size_t i = 0; i < reader.getSize(); i++) {
+        char *data = reader.getData(i, 0);
+        size_t length = reader.getEntryLen(i);
+        std::cout << reader.getDbKey(i) << " records: " << BinaryResult::countRecords(data, length) << std::endl;
+        std::string text;
+        BinaryResult::toText(data, length, text);
+        std::cout << text;
+
+        if (reader.getDbKey(i) == 1) {
+            std::vector<Matcher::result_t> parsed;
+            BinaryResult::readAlignmentResults(data, length, parsed);
+            if (parsed.size() != results.size() || BinaryResult::countRecords(data, length) != results.size()) {
+                std::cout << "Expected " << results.size() << " alignment records, got " << parsed.size() << std::endl;
+                return EXIT_FAILURE;
+            }
+            for (size_t j = 0; j < parsed.size(); j++) {
+                const Matcher::result_t &a = parsed[j];
+                const Matcher::result_t &b = results[j];
+                if (a.dbKey != b.dbKey || a.score != b.score || a.eval != b.eval || a.seqId != b.seqId
+                    || a.qStartPos != b.qStartPos || a.qEndPos != b.qEndPos || a.qLen != b.qLen
+                    || a.dbStartPos != b.dbStartPos || a.dbEndPos != b.dbEndPos || a.dbLen != b.dbLen
+                    || a.backtrace != b.backtrace) {
+                    std::cout << "Roundtrip failed for alignment record " << j << std::endl;
+                    return EXIT_FAILURE;
+                }
+            }
+        } else if (reader.getDbKey(i) == 2) {
+            if (*data != '\0' || BinaryResult::countRecords(data, length) != 0) {
+                std::cout << "Expected an empty entry" << std::endl;
+                return EXIT_FAILURE;
+            }
+        } else if (reader.getDbKey(i) == 3) {
+            std::vector<hit_t> parsed;
+            BinaryResult::readPrefilterHits(data, length, parsed);
+            if (parsed.size() != hits.size()) {
+                std::cout << "Expected " << hits.size() << " prefilter records, got " << parsed.size() << std::endl;
+                return EXIT_FAILURE;
+            }
+            for (size_t j = 0; j < parsed.size(); j++) {
+                if (parsed[j].seqId != hits[j].seqId || parsed[j].prefScore != hits[j].prefScore
+                    || parsed[j].diagonal != hits[j].diagonal) {
+                    std::cout << "Roundtrip failed for prefilter record " << j << std::endl;
+                    return EXIT_FAILURE;
+                }
+            }
+        }
+    }
+    if (reader.getSize() != 3) {
+        std::cout << "Expected 3 entries, got " << reader.getSize() << std::endl;
+        return EXIT_FAILURE;
+    }
+    reader.close();
+    return EXIT_SUCCESS;
+}
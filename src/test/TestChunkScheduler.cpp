@@ -0,0 +1,109 @@
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <cstdlib>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "ChunkScheduler.h"
+#include "FileUtil.h"
+#include "Util.h"
+
+const char* binary_name = "test_chunkscheduler";
+
+// Several processes pull chunks from one work queue file, each entry has to be handed out exactly
+// once and exactly one process has to be told to merge.
+// Usage: test_chunkscheduler [entries] [processes] [tmp path prefix]
+int runWorker(const std::string &queueFile, size_t total, const std::string &outFile) {
+    ChunkScheduler chunks(ChunkScheduler::SHARED_FILE, total, total, queueFile);
+    std::ofstream out(outFile.c_str());
+    size_t from, size;
+    while (chunks.next(from, size)) {
+        out << from << "\t" << size << "\n";
+        usleep(rand() % 200);
+    }
+    out.close();
+    return chunks.finish() ? 1 : 0;
+}
+
+bool checkCoverage(const std::vector<size_t> &covered) {
+    for (size_t i = 0; i < covered.size(); i++) {
+        if (covered[i] != 1) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int main (int argc, const char** argv) {
+    const size_t total = (argc > 1) ? strtoull(argv[1], NULL, 10) : 100000;
+    const size_t processes = (argc > 2) ? strtoull(argv[2], NULL, 10) : 4;
+    const std::string prefix = (argc > 3) ? argv[3] : "/tmp/test_chunkscheduler";
+    const std::string queueFile = prefix + "_queue";
+    if (FileUtil::fileExists(queueFile.c_str())) {
+        FileUtil::remove(queueFile.c_str());
+    }
+
+    std::vector<size_t> covered(total, 0);
+    ChunkScheduler local(ChunkScheduler::LOCAL, total, 1000);
+    size_t from, size;
+    while (local.next(from, size)) {
+        for (size_t i = from; i < from + size; i++) {
+            covered[i]++;
+        }
+    }
+    const bool localOk = checkCoverage(covered) && local.finish();
+    std::cout << "Local chunks: " << (localOk ? "ok" : "FAILED") << "\n";
+
+    std::cout.flush();
+    std::vector<pid_t> pids;
+    for (size_t i = 0; i < processes; i++) {
+        pid_t pid = fork();
+        if (pid == 0) {
+            srand(i + 1);
+            exit(runWorker(queueFile, total, prefix + "_" + SSTR(i)));
+        }
+        pids.push_back(pid);
+    }
+    size_t mergers = 0;
+    bool exited = true;
+    for (size_t i = 0; i < pids.size(); i++) {
+        int status;
+        waitpid(pids[i], &status, 0);
+        exited = exited && WIFEXITED(status);
+        mergers += WIFEXITED(status) && WEXITSTATUS(status) == 1;
+    }
+
+    std::fill(covered.begin(), covered.end(), 0);
+    for (size_t i = 0; i < processes; i++) {
+        const std::string outFile = prefix + "_" + SSTR(i);
+        std::ifstream in(outFile.c_str());
+        while (in >> from >> size) {
+            for (size_t j = from; j < from + size && j < total; j++) {
+                covered[j]++;
+            }
+        }
+        in.close();
+        // a worker that joins a finished queue fails before it writes any output
+        if (FileUtil::fileExists(outFile.c_str())) {
+            FileUtil::remove(outFile.c_str());
+        }
+    }
+    const bool queueOk = exited && mergers == 1 && checkCoverage(covered);
+    std::cout << "Shared queue chunks: " << (queueOk ? "ok" : "FAILED") << "\n";
+
+    // the results of the queue are merged already, a new worker must not silently succeed
+    std::cout.flush();
+    pid_t latePid = fork();
+    if (latePid == 0) {
+        exit(runWorker(queueFile, total, prefix + "_late"));
+    }
+    int lateStatus;
+    waitpid(latePid, &lateStatus, 0);
+    const bool lateOk = WIFEXITED(lateStatus) && WEXITSTATUS(lateStatus) == EXIT_FAILURE;
+    std::cout << "Worker after finished queue fails: " << (lateOk ? "ok" : "FAILED") << "\n";
+    FileUtil::remove(queueFile.c_str());
+
+    return (localOk && queueOk && lateOk) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
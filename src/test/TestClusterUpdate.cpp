@@ -0,0 +1,151 @@
+#include <iostream>
+#include <fstream>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <unistd.h>
+
+#include "DBReader.h"
+#include "FileUtil.h"
+#include "Util.h"
+
+const char* binary_name = "test_clusterupdate";
+
+// Updates a clustering twice with clusterupdate, once with and once without the representative index
+// (--rep-index), and compares the clusterings. The workflows run in the mmseqs binary.
+// Usage: test_clusterupdate [mmseqs binary] [tmp path]
+static const char aminoAcids[] = "ACDEFGHIKLMNPQRSTVWY";
+
+static std::string randomSequence(size_t length) {
+    std::string seq(length, ' ');
+    for (size_t i = 0; i < length; i++) {
+        seq[i] = aminoAcids[rand() % (sizeof(aminoAcids) - 1)];
+    }
+    return seq;
+}
+
+static std::string mutate(const std::string &seq, int rate) {
+    std::string homolog = seq;
+    for (size_t i = 0; i < homolog.size(); i++) {
+        if (rand() % rate == 0) {
+            homolog[i] = aminoAcids[rand() % (sizeof(aminoAcids) - 1)];
+        }
+    }
+    return homolog;
+}
+
+// adds families of homologs with ids starting at firstId
+static void addFamilies(std::vector<std::pair<std::string, std::string> > &sequences, size_t families, size_t firstId) {
+    for (size_t family = 0; family < families; family++) {
+        const std::string seq = randomSequence(80 + rand() % 300);
+        const size_t members = 1 + rand() % 6;
+        for (size_t member = 0; member < members; member++) {
+            sequences.push_back(std::make_pair("s" + SSTR(firstId + sequences.size()), mutate(seq, 3 + rand() % 20)));
+        }
+    }
+}
+
+static void writeFasta(const std::string &file, const std::vector<std::pair<std::string, std::string> > &sequences) {
+    std::ofstream out(file.c_str());
+    for (size_t i = 0; i < sequences.size(); i++) {
+        out << ">" << sequences[i].first << "\n" << sequences[i].second << "\n";
+    }
+}
+
+static void run(const std::string &command) {
+    std::cout.flush();
+    if (std::system(command.c_str()) != EXIT_SUCCESS) {
+        std::cout << "Command failed: " << command << std::endl;
+        EXIT(EXIT_FAILURE);
+    }
+}
+
+static std::vector<std::pair<unsigned int, std::string> > readEntries(const std::string &db) {
+    DBReader<unsigned int> reader(db.c_str(), (db + ".index").c_str(), 1, DBReader<unsigned int>::USE_INDEX|DBReader<unsigned int>::USE_DATA);
+    reader.open(DBReader<unsigned int>::SORT_BY_ID);
+    std::vector<std::pair<unsigned int, std::string> > entries;
+    for (size_t i = 0; i < reader.getSize(); i++) {
+        entries.push_back(std::make_pair(reader.getDbKey(i), std::string(reader.getData(i, 0), reader.getEntryLen(i) - 1)));
+    }
+    reader.close();
+    return entries;
+}
+
+static bool check(bool ok, const std::string &what) {
+    std::cout << what << ": " << (ok ? "ok" : "FAILED") << std::endl;
+    return ok;
+}
+
+int main (int argc, const char** argv) {
+    std::string mmseqs;
+    if (argc > 1) {
+        mmseqs = argv[1];
+    } else {
+        // the mmseqs binary of the build tree
+        char path[4096];
+        const ssize_t length = readlink("/proc/self/exe", path, sizeof(path) - 1);
+        if (length <= 0) {
+            std::cout << "Usage: test_clusterupdate [mmseqs binary] [tmp path]" << std::endl;
+            return EXIT_FAILURE;
+        }
+        path[length] = '\0';
+        mmseqs = FileUtil::dirName(FileUtil::dirName(path)) + "/mmseqs";
+    }
+    const std::string base = (argc > 2) ? argv[2] : "/tmp/test_clusterupdate";
+    if (FileUtil::directoryExists(base.c_str())) {
+        std::cout << base << " exists already" << std::endl;
+        return EXIT_FAILURE;
+    }
+    FileUtil::makeDir(base.c_str());
+    const std::string common = " --threads 4 -v 1";
+
+    // the first update removes and adds sequences, the second one only adds sequences
+    srand(1);
+    std::vector<std::pair<std::string, std::string> > sequences;
+    addFamilies(sequences, 300, 0);
+    writeFasta(base + "/old.fasta", sequences);
+    std::vector<std::pair<std::string, std::string> > update;
+    for (size_t i = 0; i < sequences.size(); i++) {
+        if (i % 40 != 0) {
+            update.push_back(sequences[i]);
+        }
+    }
+    for (size_t i = 0; i < 200; i++) {
+        // new members of the old families
+        const std::pair<std::string, std::string> &member = sequences[rand() % sequences.size()];
+        update.push_back(std::make_pair("n" + SSTR(i), mutate(member.second, 5)));
+    }
+    addFamilies(update, 50, sequences.size());
+    writeFasta(base + "/new1.fasta", update);
+    addFamilies(update, 50, 2 * sequences.size());
+    writeFasta(base + "/new2.fasta", update);
+
+    const char *dbs[] = { "old", "new1", "new2" };
+    for (size_t i = 0; i < sizeof(dbs) / sizeof(dbs[0]); i++) {
+        run(mmseqs + " createdb " + base + "/" + dbs[i] + ".fasta " + base + "/" + dbs[i] + " -v 1");
+    }
+    run(mmseqs + " cluster " + base + "/old " + base + "/old_clu " + base + "/tmp" + common);
+
+    const char *modes[] = { "plain", "index" };
+    for (size_t i = 0; i < 2; i++) {
+        const std::string dir = base + "/" + modes[i];
+        const std::string parameters = common + (i == 1 ? " --rep-index 1" : "");
+        FileUtil::makeDir(dir.c_str());
+        run(mmseqs + " clusterupdate " + base + "/old " + base + "/new1 " + base + "/old_clu " + dir + "/new1 " + dir + "/clu1 " + dir + "/tmp1" + parameters);
+        // the index of the first update is reused
+        run(mmseqs + " clusterupdate " + dir + "/new1 " + base + "/new2 " + dir + "/clu1 " + dir + "/new2 " + dir + "/clu2 " + dir + "/tmp2" + parameters);
+    }
+
+    bool ok = true;
+    ok &= check(FileUtil::directoryExists((base + "/index/clu2_repindex").c_str()), "Representative index is kept");
+    const std::vector<std::pair<unsigned int, std::string> > plain1 = readEntries(base + "/plain/clu1");
+    ok &= check(plain1.size() > 0 && plain1 == readEntries(base + "/index/clu1"), "First update with representative index");
+    const std::vector<std::pair<unsigned int, std::string> > plain2 = readEntries(base + "/plain/clu2");
+    ok &= check(plain2.size() > plain1.size() && plain2 == readEntries(base + "/index/clu2"), "Second update with representative index");
+
+    // the directory did not exist before, the files of a failed run are kept
+    if (ok) {
+        run("rm -rf " + base);
+    }
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,120 @@
+#include <iostream>
+#include <set>
+#include <vector>
+#include <cstdlib>
+
+#include "ClusteringAlgorithms.h"
+#include "BinaryResult.h"
+#include "DBReader.h"
+#include "DBWriter.h"
+#include "FileUtil.h"
+#include "Parameters.h"
+#include "Util.h"
+#include "itoa.h"
+
+const char* binary_name = "test_clusteringbinary";
+
+// Clusters the same alignment graph stored as text and as binary result and compares the clusterings
+// of all clustering modes.
+// Usage: test_clusteringbinary [sequences] [tmp path prefix]
+std::vector<std::pair<unsigned int, unsigned int> > runClustering(const std::string &seqDb, const std::string &alnDb, int mode) {
+    DBReader<unsigned int> seqDbr(seqDb.c_str(), (seqDb + ".index").c_str(), 1, DBReader<unsigned int>::USE_INDEX);
+    seqDbr.open(DBReader<unsigned int>::SORT_BY_LENGTH);
+    DBReader<unsigned int> alnDbr(alnDb.c_str(), (alnDb + ".index").c_str(), 1, DBReader<unsigned int>::USE_DATA|DBReader<unsigned int>::USE_INDEX);
+    alnDbr.open(DBReader<unsigned int>::NOSORT);
+
+    ClusteringAlgorithms algorithm(&seqDbr, &alnDbr, 1, Parameters::APC_SEQID, 1000);
+    std::pair<unsigned int, unsigned int> *ret = algorithm.execute(mode);
+    std::vector<std::pair<unsigned int, unsigned int> > assignment(ret, ret + seqDbr.getSize());
+    delete[] ret;
+    alnDbr.close();
+    seqDbr.close();
+    return assignment;
+}
+
+void removeDb(const std::string &db) {
+    FileUtil::remove(db.c_str());
+    FileUtil::remove((db + ".index").c_str());
+    FileUtil::remove((db + ".dbtype").c_str());
+}
+
+int main (int argc, const char** argv) {
+    const unsigned int n = (argc > 1) ? strtoul(argv[1], NULL, 10) : 5000;
+    const std::string prefix = (argc > 2) ? argv[2] : "/tmp/test_clusteringbinary";
+    const std::string seqDb = prefix + "_seq";
+    const std::string textDb = prefix + "_text";
+    const std::string binaryDb = prefix + "_binary";
+
+    // families of related sequences and a few hits between unrelated sequences
+    srand(1);
+    std::vector<std::set<unsigned int> > edges(n);
+    for (unsigned int i = 0; i < n; i++) {
+        edges[i].insert(i);
+        const unsigned int familyStart = i - i % 20;
+        for (unsigned int j = familyStart; j < std::min(familyStart + 20, n); j++) {
+            if (rand() % 3 == 0) {
+                edges[i].insert(j);
+                edges[j].insert(i);
+            }
+        }
+        if (rand() % 10 == 0) {
+            const unsigned int other = rand() % n;
+            edges[i].insert(other);
+            edges[other].insert(i);
+        }
+    }
+
+    DBWriter seqWriter(seqDb.c_str(), (seqDb + ".index").c_str(), 1, Parameters::WRITER_ASCII_MODE, Parameters::DBTYPE_AMINO_ACIDS);
+    seqWriter.open();
+    DBWriter textWriter(textDb.c_str(), (textDb + ".index").c_str(), 1, Parameters::WRITER_ASCII_MODE, Parameters::DBTYPE_PREFILTER_RES);
+    textWriter.open();
+    DBWriter binaryWriter(binaryDb.c_str(), (binaryDb + ".index").c_str(), 1, Parameters::WRITER_ASCII_MODE,
+                          BinaryResult::setBinaryDbtype(Parameters::DBTYPE_PREFILTER_RES, true));
+    binaryWriter.open();
+    std::string buffer;
+    std::string binaryBuffer;
+    std::vector<hit_t> hits;
+    char keyBuffer[255];
+    for (unsigned int i = 0; i < n; i++) {
+        buffer.assign(50 + rand() % 500, 'A');
+        buffer.push_back('\n');
+        seqWriter.writeData(buffer.c_str(), buffer.size(), i);
+        buffer.clear();
+        hits.clear();
+        for (std::set<unsigned int>::const_iterator it = edges[i].begin(); it != edges[i].end(); ++it) {
+            hit_t hit;
+            hit.seqId = *it;
+            hit.prefScore = (*it == i) ? 100 : 30 + rand() % 70;
+            hit.diagonal = 0;
+            hits.push_back(hit);
+            char *end = Itoa::u32toa_sse2(hit.seqId, keyBuffer);
+            buffer.append(keyBuffer, end - keyBuffer - 1);
+            buffer.append("\t");
+            buffer.append(SSTR(hit.prefScore));
+            buffer.append("\t0\n");
+        }
+        textWriter.writeData(buffer.c_str(), buffer.size(), i);
+        binaryBuffer.clear();
+        BinaryResult::appendPrefilterHits(binaryBuffer, hits.data(), hits.size());
+        binaryWriter.writeData(binaryBuffer.c_str(), binaryBuffer.size(), i);
+    }
+    seqWriter.close(true);
+    textWriter.close(true);
+    binaryWriter.close(true);
+
+    bool ok = true;
+    // set cover, connected component, greedy and union-find connected component
+    const int modes[] = { 1, 3, 4, 5 };
+    for (size_t i = 0; i < sizeof(modes) / sizeof(modes[0]); i++) {
+        const std::vector<std::pair<unsigned int, unsigned int> > text = runClustering(seqDb, textDb, modes[i]);
+        const std::vector<std::pair<unsigned int, unsigned int> > binary = runClustering(seqDb, binaryDb, modes[i]);
+        const bool same = text == binary;
+        std::cout << "Mode " << modes[i] << ": " << (same ? "ok" : "FAILED") << "\n";
+        ok &= same;
+    }
+
+    removeDb(seqDb);
+    removeDb(textDb);
+    removeDb(binaryDb);
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
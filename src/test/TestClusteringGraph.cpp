@@ -0,0 +1,169 @@
+#include <iostream>
+#include <algorithm>
+#include <climits>
+#include <cstdlib>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ClusteringGraph.h"
+#include "DBReader.h"
+#include "DBWriter.h"
+#include "FileUtil.h"
+#include "Parameters.h"
+#include "Util.h"
+
+const char* binary_name = "test_clusteringgraph";
+
+// Builds the graph of a small alignment result, compares it with the expected adjacency lists,
+// saves it as graph cache and checks that the cache is only used for the same input.
+typedef std::vector<std::vector<std::pair<unsigned int, unsigned short> > > Adjacency;
+
+static unsigned int keyOf(unsigned int seq) {
+    // keys are not the ids of the length sorted reader
+    return 3 * seq + 1;
+}
+
+static void writeAlignments(const std::string &alnDb, const std::vector<std::vector<std::pair<unsigned int, unsigned short> > > &hits) {
+    DBWriter writer(alnDb.c_str(), (alnDb + ".index").c_str(), 1, Parameters::WRITER_ASCII_MODE, Parameters::DBTYPE_ALIGNMENT_RES);
+    writer.open();
+    std::string buffer;
+    for (unsigned int i = 0; i < hits.size(); i++) {
+        buffer.clear();
+        for (size_t j = 0; j < hits[i].size(); j++) {
+            buffer.append(SSTR(keyOf(hits[i][j].first)) + "\t" + SSTR(hits[i][j].second) + "\t0.500\t1E-10\t0\t9\t10\t0\t9\t10\n");
+        }
+        writer.writeData(buffer.c_str(), buffer.size(), keyOf(i));
+    }
+    writer.close(true);
+}
+
+// the hits of a set in result order followed by the hits that only exist in the other direction
+static Adjacency expectedGraph(DBReader<unsigned int> &seqDbr, const std::vector<std::vector<std::pair<unsigned int, unsigned short> > > &hits) {
+    const size_t n = seqDbr.getSize();
+    Adjacency forward(n);
+    for (unsigned int seq = 0; seq < hits.size(); seq++) {
+        const unsigned int set = static_cast<unsigned int>(seqDbr.getId(keyOf(seq)));
+        if (hits[seq].empty()) {
+            forward[set].push_back(std::make_pair(set, static_cast<unsigned short>(USHRT_MAX)));
+        }
+        for (size_t j = 0; j < hits[seq].size(); j++) {
+            forward[set].push_back(std::make_pair(static_cast<unsigned int>(seqDbr.getId(keyOf(hits[seq][j].first))), hits[seq][j].second));
+        }
+    }
+    Adjacency graph(forward);
+    for (unsigned int set = 0; set < n; set++) {
+        for (size_t j = 0; j < forward[set].size(); j++) {
+            const unsigned int other = forward[set][j].first;
+            bool found = false;
+            for (size_t k = 0; k < forward[other].size(); k++) {
+                found |= forward[other][k].first == set;
+            }
+            if (found == false) {
+                graph[other].push_back(std::make_pair(set, forward[set][j].second));
+            }
+        }
+    }
+    return graph;
+}
+
+static Adjacency toAdjacency(const ClusteringGraph &graph) {
+    Adjacency adjacency(graph.setCount);
+    for (size_t set = 0; set < graph.setCount; set++) {
+        for (size_t pos = graph.offsets[set]; pos < graph.offsets[set + 1]; pos++) {
+            adjacency[set].push_back(std::make_pair(graph.elements[pos], graph.scores[pos]));
+        }
+    }
+    return adjacency;
+}
+
+static bool check(bool ok, const std::string &what) {
+    std::cout << what << ": " << (ok ? "ok" : "FAILED") << std::endl;
+    return ok;
+}
+
+int main (int, const char**) {
+    const std::string prefix = "/tmp/test_clusteringgraph";
+    const std::string seqDb = prefix + "_seq";
+    const std::string alnDb = prefix + "_aln";
+    const std::string cache = prefix + "_graph";
+    const unsigned int n = 500;
+
+    srand(1);
+    DBWriter seqWriter(seqDb.c_str(), (seqDb + ".index").c_str(), 1, Parameters::WRITER_ASCII_MODE, Parameters::DBTYPE_AMINO_ACIDS);
+    seqWriter.open();
+    std::vector<std::vector<std::pair<unsigned int, unsigned short> > > hits(n);
+    for (unsigned int i = 0; i < n; i++) {
+        const std::string seq = std::string(20 + rand() % 300, 'A') + "\n";
+        seqWriter.writeData(seq.c_str(), seq.size(), keyOf(i));
+        // a few sequences without any hit
+        if (i % 50 == 7) {
+            continue;
+        }
+        hits[i].push_back(std::make_pair(i, static_cast<unsigned short>(1000)));
+        // hits within a family, only some are found in both directions
+        const unsigned int familyStart = i - i % 10;
+        for (unsigned int j = familyStart; j < std::min(familyStart + 10, n); j++) {
+            if (j != i && j % 50 != 7 && rand() % 3 == 0) {
+                hits[i].push_back(std::make_pair(j, static_cast<unsigned short>(20 + rand() % 500)));
+            }
+        }
+    }
+    seqWriter.close(true);
+    writeAlignments(alnDb, hits);
+    if (FileUtil::fileExists(cache.c_str())) {
+        FileUtil::remove(cache.c_str());
+    }
+
+    bool ok = true;
+    {
+        DBReader<unsigned int> seqDbr(seqDb.c_str(), (seqDb + ".index").c_str(), 1, DBReader<unsigned int>::USE_INDEX);
+        seqDbr.open(DBReader<unsigned int>::SORT_BY_LENGTH);
+        DBReader<unsigned int> alnDbr(alnDb.c_str(), (alnDb + ".index").c_str(), 4, DBReader<unsigned int>::USE_DATA|DBReader<unsigned int>::USE_INDEX);
+        alnDbr.open(DBReader<unsigned int>::NOSORT);
+
+        const Adjacency expected = expectedGraph(seqDbr, hits);
+        ClusteringGraph single;
+        single.build(&seqDbr, &alnDbr, Parameters::APC_ALIGNMENTSCORE, 1);
+        ok &= check(toAdjacency(single) == expected, "Graph built with one thread");
+        ClusteringGraph parallel;
+        parallel.build(&seqDbr, &alnDbr, Parameters::APC_ALIGNMENTSCORE, 4);
+        ok &= check(toAdjacency(parallel) == expected, "Graph built with four threads");
+
+        ok &= check(single.load(cache, &seqDbr, &alnDbr, Parameters::APC_ALIGNMENTSCORE) == false, "Missing graph cache is not used");
+        parallel.save(cache, &seqDbr, &alnDbr, Parameters::APC_ALIGNMENTSCORE);
+        ClusteringGraph cached;
+        ok &= check(cached.load(cache, &seqDbr, &alnDbr, Parameters::APC_ALIGNMENTSCORE) && toAdjacency(cached) == expected,
+                    "Graph read from the cache");
+        ClusteringGraph otherScore;
+        ok &= check(otherScore.load(cache, &seqDbr, &alnDbr, Parameters::APC_SEQID) == false, "Cache of another score type is not used");
+        alnDbr.close();
+        seqDbr.close();
+    }
+
+    // the same sequences with a changed result, drop the last hit of the first set that has more than one
+    for (unsigned int i = 0; i < n; i++) {
+        if (hits[i].size() > 1) {
+            hits[i].pop_back();
+            break;
+        }
+    }
+    writeAlignments(alnDb, hits);
+    {
+        DBReader<unsigned int> seqDbr(seqDb.c_str(), (seqDb + ".index").c_str(), 1, DBReader<unsigned int>::USE_INDEX);
+        seqDbr.open(DBReader<unsigned int>::SORT_BY_LENGTH);
+        DBReader<unsigned int> alnDbr(alnDb.c_str(), (alnDb + ".index").c_str(), 4, DBReader<unsigned int>::USE_DATA|DBReader<unsigned int>::USE_INDEX);
+        alnDbr.open(DBReader<unsigned int>::NOSORT);
+        ClusteringGraph graph;
+        ok &= check(graph.load(cache, &seqDbr, &alnDbr, Parameters::APC_ALIGNMENTSCORE) == false, "Cache of a changed result is not used");
+        graph.build(&seqDbr, &alnDbr, Parameters::APC_ALIGNMENTSCORE, 4);
+        ok &= check(toAdjacency(graph) == expectedGraph(seqDbr, hits), "Graph of the changed result");
+        alnDbr.close();
+        seqDbr.close();
+    }
+
+    DBReader<unsigned int>::removeDb(seqDb);
+    DBReader<unsigned int>::removeDb(alnDb);
+    FileUtil::remove(cache.c_str());
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,132 @@
+#include <iostream>
+#include <fstream>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <unistd.h>
+
+#include "Command.h"
+#include "DBReader.h"
+#include "DBWriter.h"
+#include "Debug.h"
+#include "DownloadDatabase.h"
+#include "FileUtil.h"
+#include "Parameters.h"
+#include "Util.h"
+#include "WorkflowExecutor.h"
+
+const char* binary_name = "test_kmerclust";
+// the base commands of the binary are linked in as well
+extern const char* MMSEQS_CURRENT_INDEX_VERSION;
+const char* index_version_compatible = MMSEQS_CURRENT_INDEX_VERSION;
+std::vector<DatabaseDownload> externalDownloads = {};
+bool hide_base_downloads = false;
+std::vector<Command> commands = {};
+
+// Runs the pre-clustering of the linclust workflow once as separate kmermatcher, rescorediagonal,
+// clust, createsubdb and filterdb steps and once fused with kmerclust (linclust --fused-preclust)
+// and compares the pre-clustering and the remaining k-mer matches.
+static const char aminoAcids[] = "ACDEFGHIKLMNPQRSTVWY";
+
+static void writeSequences(const std::string &db, const std::vector<std::string> &sequences) {
+    DBWriter writer(db.c_str(), (db + ".index").c_str(), 1, Parameters::WRITER_ASCII_MODE, Parameters::DBTYPE_AMINO_ACIDS);
+    writer.open();
+    DBWriter headers((db + "_h").c_str(), (db + "_h.index").c_str(), 1, Parameters::WRITER_ASCII_MODE, Parameters::DBTYPE_GENERIC_DB);
+    headers.open();
+    for (size_t i = 0; i < sequences.size(); i++) {
+        const std::string entry = sequences[i] + "\n";
+        writer.writeData(entry.c_str(), entry.size(), static_cast<unsigned int>(i), 0);
+        const std::string header = "seq" + SSTR(i) + "\n";
+        headers.writeData(header.c_str(), header.size(), static_cast<unsigned int>(i), 0);
+    }
+    writer.close(true);
+    headers.close(true);
+}
+
+// entries of a database by key, the order of the data file depends on the threads
+static std::vector<std::pair<unsigned int, std::string> > readEntries(const std::string &db) {
+    DBReader<unsigned int> reader(db.c_str(), (db + ".index").c_str(), 1, DBReader<unsigned int>::USE_INDEX|DBReader<unsigned int>::USE_DATA);
+    reader.open(DBReader<unsigned int>::NOSORT);
+    std::vector<std::pair<unsigned int, std::string> > entries;
+    for (size_t i = 0; i < reader.getSize(); i++) {
+        entries.push_back(std::make_pair(reader.getDbKey(i), std::string(reader.getData(i, 0), reader.getEntryLen(i) - 1)));
+    }
+    reader.close();
+    return entries;
+}
+
+static bool check(bool ok, const std::string &what) {
+    std::cout << what << ": " << (ok ? "ok" : "FAILED") << std::endl;
+    return ok;
+}
+
+int main (int, const char**) {
+    srand(1);
+    const std::string base = "/tmp/test_kmerclust";
+    FileUtil::makeDir(base.c_str());
+    const std::string seqDb = base + "/seq";
+
+    // families of close homologs, which the hamming distance pre-clustering merges
+    std::vector<std::string> sequences;
+    for (size_t family = 0; family < 200; family++) {
+        std::string seq(100 + rand() % 300, ' ');
+        for (size_t i = 0; i < seq.size(); i++) {
+            seq[i] = aminoAcids[rand() % (sizeof(aminoAcids) - 1)];
+        }
+        const size_t members = 1 + rand() % 10;
+        for (size_t member = 0; member < members; member++) {
+            std::string homolog = seq;
+            for (size_t i = 0; i < homolog.size(); i++) {
+                if (rand() % (member % 3 == 0 ? 50 : 4) == 0) {
+                    homolog[i] = aminoAcids[rand() % (sizeof(aminoAcids) - 1)];
+                }
+            }
+            sequences.push_back(homolog);
+        }
+    }
+    writeSequences(seqDb, sequences);
+
+    // parameters as the linclust workflow passes them
+    const std::string common = "--threads 2 -v 1";
+    const std::string kmerPar = common + " --min-seq-id 0 -c 0.8";
+    WorkflowExecutor executor;
+    executor.runModule("kmermatcher", WorkflowExecutor::makeArguments({seqDb, base + "/pref"}, kmerPar));
+    executor.runModule("rescorediagonal", WorkflowExecutor::makeArguments({seqDb, seqDb, base + "/pref", base + "/pref_rescore1"},
+                                                                          common + " --rescore-mode 0 --filter-hits 0 --min-seq-id 0.5 -c 0.8"));
+    executor.runModule("clust", WorkflowExecutor::makeArguments({seqDb, base + "/pref_rescore1", base + "/pre_clust"}, common));
+    const std::vector<std::pair<unsigned int, std::string> > preClust = readEntries(base + "/pre_clust");
+    const std::string order = base + "/order_redundancy";
+    {
+        std::ofstream out(order.c_str());
+        for (size_t i = 0; i < preClust.size(); i++) {
+            out << preClust[i].first << "\n";
+        }
+    }
+    executor.runModule("createsubdb", WorkflowExecutor::makeArguments({order, base + "/pref", base + "/pref_filter1"}, "-v 1 --subdb-mode 1"));
+    executor.runModule("filterdb", WorkflowExecutor::makeArguments({base + "/pref_filter1", base + "/pref_filter2"}, common + " --filter-file " + order));
+
+    executor.runModule("kmerclust", WorkflowExecutor::makeArguments({seqDb, base + "/fused_pre_clust", base + "/fused_pref_filter2"}, kmerPar));
+
+    bool ok = true;
+    ok &= check(preClust.size() < sequences.size(), "Pre-clustering merges sequences");
+    ok &= check(readEntries(base + "/fused_pre_clust") == preClust, "Fused pre-clustering");
+    const std::vector<std::pair<unsigned int, std::string> > prefFilter = readEntries(base + "/pref_filter2");
+    size_t matches = 0;
+    for (size_t i = 0; i < prefFilter.size(); i++) {
+        matches += prefFilter[i].second.empty() ? 0 : 1;
+    }
+    ok &= check(readEntries(base + "/fused_pref_filter2") == prefFilter && matches > 0, "Fused k-mer matches between representatives");
+
+    std::cout << preClust.size() << " representatives of " << sequences.size() << " sequences" << std::endl;
+
+    // pref_filter1 links to the data of pref
+    const char *dbs[] = { "pref_filter1", "pref", "pref_rescore1", "pre_clust", "pref_filter2", "fused_pre_clust", "fused_pref_filter2" };
+    for (size_t i = 0; i < sizeof(dbs) / sizeof(dbs[0]); i++) {
+        DBReader<unsigned int>::removeDb(base + "/" + dbs[i]);
+    }
+    FileUtil::remove(order.c_str());
+    DBReader<unsigned int>::removeDb(seqDb);
+    DBReader<unsigned int>::removeDb(seqDb + "_h");
+    rmdir(base.c_str());
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,72 @@
+#include <iostream>
+#include <vector>
+#include <cstdlib>
+
+#include "kmermatcher.h"
+#include "FastSort.h"
+#include "RadixSort.h"
+#include "Timer.h"
+
+const char* binary_name = "test_kmerpositionsort";
+
+// Compares RadixSort against SORT_PARALLEL on both sorts of the kmermatcher
+// and reports the time of each. Usage: test_kmerpositionsort [elements]
+template <typename Key, typename Compare>
+bool benchmark(const char *name, const std::vector<KmerPosition<short> > &input, Key key, Compare comp) {
+    std::vector<KmerPosition<short> > expected(input);
+    Timer timer;
+    SORT_PARALLEL(expected.begin(), expected.end(), comp);
+    const std::string comparisonTime = timer.lap();
+
+    std::vector<KmerPosition<short> > result(input);
+    timer.reset();
+    RadixSort::sort(result.data(), result.data() + result.size(), key, comp);
+    const std::string radixTime = timer.lap();
+
+    // the reverse comparators ignore the strand bit, so only equivalence can be expected
+    bool equal = true;
+    for (size_t i = 0; equal && i < expected.size(); i++) {
+        equal = comp(expected[i], result[i]) == false && comp(result[i], expected[i]) == false;
+    }
+    std::cout << name << ": SORT_PARALLEL " << comparisonTime << ", RadixSort " << radixTime
+              << ": " << (equal ? "ok" : "FAILED") << std::endl;
+    return equal;
+}
+
+int main (int argc, const char** argv) {
+    const size_t n = (argc > 1) ? strtoull(argv[1], NULL, 10) : 10000000;
+    srand(1);
+    const unsigned int sequences = static_cast<unsigned int>(n / 100 + 1);
+    std::vector<KmerPosition<short> > kmers(n);
+    for (size_t i = 0; i < n; i++) {
+        // k-mers shared by a few sequences, as after the k-mer selection
+        kmers[i].kmer = (static_cast<size_t>(rand()) << 8 | (rand() & 0xFF)) % (n / 4 + 1);
+        if (rand() % 2) {
+            kmers[i].kmer = BIT_SET(kmers[i].kmer, 63);
+        }
+        kmers[i].id = rand() % sequences;
+        kmers[i].seqLen = static_cast<short>(rand() % 2000);
+        kmers[i].pos = static_cast<short>(rand() % 2000 - 1000);
+    }
+
+    bool ok = true;
+    ok &= benchmark("Sort kmer", kmers, KmerPosition<short>::KmerKey(),
+                    KmerPosition<short>::compareRepSequenceAndIdAndPos);
+    ok &= benchmark("Sort kmer reverse", kmers, KmerPosition<short>::KmerKeyReverse(),
+                    KmerPosition<short>::compareRepSequenceAndIdAndPosReverse);
+
+    for (size_t i = 0; i < n; i++) {
+        // rep. sequence id and strand, as after the grouping
+        const size_t repId = rand() % sequences;
+        kmers[i].kmer = (rand() % 2) ? BIT_SET(repId, 63) : repId;
+    }
+    ok &= benchmark("Sort by rep. sequence reverse", kmers, KmerPosition<short>::RepSequenceAndIdKey(),
+                    KmerPosition<short>::compareRepSequenceAndIdAndDiagReverse);
+    for (size_t i = 0; i < n; i++) {
+        kmers[i].kmer = BIT_CLEAR(kmers[i].kmer, 63);
+    }
+    ok &= benchmark("Sort by rep. sequence", kmers, KmerPosition<short>::RepSequenceAndIdKey(),
+                    KmerPosition<short>::compareRepSequenceAndIdAndDiag);
+
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,114 @@
+#include <iostream>
+#include <algorithm>
+#include <climits>
+#include <cstdlib>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "KmerSplitFile.h"
+#include "FileUtil.h"
+#include "Util.h"
+
+const char* binary_name = "test_kmersplitfile";
+
+// orders like the merger: rep. sequence, target id, diagonal and file
+static bool compareMergeOrder(const FileKmerPosition &first, const FileKmerPosition &second) {
+    if (first.repSeq != second.repSeq) {
+        return first.repSeq < second.repSeq;
+    }
+    if (first.id != second.id) {
+        return first.id < second.id;
+    }
+    if (first.pos != second.pos) {
+        return first.pos < second.pos;
+    }
+    return first.file < second.file;
+}
+
+static bool compareInFile(const FileKmerPosition &first, const FileKmerPosition &second) {
+    if (first.id != second.id) {
+        return first.id < second.id;
+    }
+    return first.pos < second.pos;
+}
+
+int main (int, const char**) {
+    srand(1);
+    const size_t splits = 6;
+    // splits 1 and 4 stay empty, split 4 starts sets without entries
+    std::vector<std::map<size_t, std::vector<FileKmerPosition> > > sets(splits);
+    std::vector<FileKmerPosition> expected;
+    const size_t used[] = {0, 2, 3, 5};
+    for (size_t i = 0; i < 5000; i++) {
+        const size_t k = rand() % 4;
+        const size_t file = used[k];
+        // large rep. sequence and target ids exercise the multi byte varints
+        const size_t repSeq = (i % 3 == 0) ? (rand() % 50) : (rand() % 2000000);
+        const unsigned int id = (i % 5 == 0) ? (rand() % 10) : (rand() % 3000000);
+        const short diagonal = static_cast<short>(rand() % 20000 - 10000);
+        const FileKmerPosition entry(repSeq, id, diagonal, static_cast<unsigned char>(rand() % 256), static_cast<char>(rand() % 2), static_cast<unsigned int>(file));
+        sets[file][repSeq].push_back(entry);
+        expected.push_back(entry);
+        if (i % 10 == 0) {
+            // the same k-mer match in another split
+            const size_t other = used[(k + 1) % 4];
+            const FileKmerPosition copy(repSeq, id, diagonal, entry.score, entry.reverse, static_cast<unsigned int>(other));
+            sets[other][repSeq].push_back(copy);
+            expected.push_back(copy);
+        }
+    }
+
+    const std::string base = "/tmp/test_kmersplitfile";
+    std::vector<std::string> files;
+    KmerSplitWriter writer;
+    for (size_t file = 0; file < splits; file++) {
+        if (file == 4) {
+            writer.startSet(7);
+            writer.startSet(8);
+        }
+        for (std::map<size_t, std::vector<FileKmerPosition> >::iterator it = sets[file].begin(); it != sets[file].end(); ++it) {
+            std::vector<FileKmerPosition> &entries = it->second;
+            std::stable_sort(entries.begin(), entries.end(), compareInFile);
+            writer.startSet(static_cast<unsigned int>(it->first));
+            for (size_t i = 0; i < entries.size(); i++) {
+                writer.addEntry(entries[i].id, entries[i].pos, entries[i].score, entries[i].reverse != 0);
+            }
+            // every set of a file ends with an entry with id UINT_MAX in the merged stream
+            expected.push_back(FileKmerPosition(it->first, UINT_MAX, 0, 0, static_cast<unsigned int>(file)));
+        }
+        files.push_back(base + "_" + SSTR(file));
+        writer.write(files.back());
+    }
+    writer.finish();
+    std::stable_sort(expected.begin(), expected.end(), compareMergeOrder);
+
+    bool ok = true;
+    size_t merged = 0;
+    {
+        KmerSplitMerger merger(files);
+        for (; merger.empty() == false && merged < expected.size(); merged++) {
+            const FileKmerPosition &top = merger.top();
+            const FileKmerPosition &exp = expected[merged];
+            bool equal = top.repSeq == exp.repSeq && top.id == exp.id && top.file == exp.file;
+            if (exp.id != UINT_MAX) {
+                equal = equal && top.pos == exp.pos && top.score == exp.score && top.reverse == exp.reverse;
+            }
+            if (equal == false) {
+                std::cout << "Entry " << merged << " differs: " << top.repSeq << " " << top.id << " " << top.pos << " file " << top.file
+                          << ", expected " << exp.repSeq << " " << exp.id << " " << exp.pos << " file " << exp.file << std::endl;
+                ok = false;
+                break;
+            }
+            merger.pop();
+        }
+        ok = ok && merger.empty() && merged == expected.size();
+    }
+    std::cout << merged << " of " << expected.size() << " merged entries: " << (ok ? "ok" : "FAILED") << std::endl;
+
+    for (size_t i = 0; i < files.size(); i++) {
+        FileUtil::remove(files[i].c_str());
+        FileUtil::remove((files[i] + ".done").c_str());
+    }
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,139 @@
+#include <iostream>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "Parameters.h"
+#include "MsaFilter.h"
+#include "PSSMCalculator.h"
+#include "Sequence.h"
+#include "SubstitutionMatrix.h"
+#include "MultipleAlignment.h"
+#include "Timer.h"
+#include "PSSMFixtures.h"
+
+const char* binary_name = "test_pssmperformance";
+
+// Times the profile building steps of result2profile on the test_pssm MSA.
+// The checksum of the profiles has to match the one of the reference implementation.
+// Usage: test_pssmperformance [iterations]
+const unsigned int EXPECTED_CHECKSUM = 0xcc940196;
+
+unsigned int checksum(unsigned int hash, const char *data, size_t length) {
+    for (size_t i = 0; i < length; i++) {
+        hash = hash * 31 + static_cast<unsigned char>(data[i]);
+    }
+    return hash;
+}
+
+int main (int argc, const char** argv) {
+    const int iterations = (argc > 1) ? atoi(argv[1]) : 200;
+    Parameters& par = Parameters::getInstance();
+    par.initMatrices();
+    SubstitutionMatrix subMat(par.scoringMatrixFile.values.aminoacid().c_str(), 2.0, 0.0);
+
+    const char *seqs[PSSM_FIXTURE_MAX_SIZE];
+    const int counter = loadPSSMFixtures(seqs);
+    const size_t L = PSSM_FIXTURE_LENGTH;
+    char **fixture = MultipleAlignment::initX(L, counter);
+    char **msa = MultipleAlignment::initX(L, counter);
+    for (int k = 0; k < counter; ++k) {
+        for (size_t pos = 0; pos < L; ++pos) {
+            fixture[k][pos] = (seqs[k][pos] == '-') ? MultipleAlignment::GAP : static_cast<int>(subMat.aa2num[(int) seqs[k][pos]]);
+        }
+    }
+    // initX allocates all rows in one block
+    char *msaBacking = msa[0];
+    const size_t msaBytes = msa[1] - msa[0];
+
+    MsaFilter filter(L + 1, counter, &subMat, par.gapOpen.values.aminoacid(), par.gapExtend.values.aminoacid());
+    PSSMCalculator calculator(&subMat, L, counter, par.pcmode, par.pca, par.pcb, par.gapOpen.values.aminoacid(), par.gapPseudoCount);
+    std::vector<Matcher::result_t> empty;
+    std::vector<int> qid;
+    qid.push_back(0);
+    std::vector<int> qidBuckets;
+    for (int i = 0; i <= 100; i += 20) {
+        qidBuckets.push_back(i);
+    }
+
+    double pruneTime = 0.0;
+    double filterTime = 0.0;
+    double bucketFilterTime = 0.0;
+    double pssmTime = 0.0;
+    double pssmWgTime = 0.0;
+    double pssmAllTime = 0.0;
+    size_t filteredSetSize = 0;
+    unsigned int hash = 0;
+    for (int i = 0; i < iterations; i++) {
+        memcpy(msaBacking, fixture[0], msaBytes * counter);
+        for (int k = 0; k < counter; ++k) {
+            msa[k] = msaBacking + k * msaBytes;
+        }
+        MultipleAlignment::MSAResult res(L, L, counter, msa);
+
+        // profile of all sequences, as with --filter-msa 0
+        Timer timer;
+        PSSMCalculator::Profile profile = calculator.computePSSMFromMSA(counter, L, (const char **) res.msaSequence, false);
+        pssmAllTime += timer.getTimediff();
+        if (i == 0) {
+            hash = checksum(hash, profile.pssm, L * Sequence::PROFILE_AA_SIZE);
+            hash = checksum(hash, (const char *) profile.prob, L * Sequence::PROFILE_AA_SIZE * sizeof(float));
+        }
+
+        timer.reset();
+        filter.pruneAlignment(res.msaSequence, res.setSize, res.centerLength);
+        pruneTime += timer.getTimediff();
+
+        timer.reset();
+        const size_t bucketSetSize = filter.filter(counter, L, 0, qidBuckets, -20.0, 90, 100, 0, (const char **) res.msaSequence, false);
+        bucketFilterTime += timer.getTimediff();
+
+        timer.reset();
+        filteredSetSize = filter.filter(res, empty, 0, qid, -20.0, 90, 100, 0);
+        filterTime += timer.getTimediff();
+        if (i == 0) {
+            hash = checksum(hash, (const char *) &bucketSetSize, sizeof(size_t));
+            for (size_t k = 0; k < filteredSetSize; k++) {
+                hash = checksum(hash, res.msaSequence[k], L);
+            }
+        }
+
+        timer.reset();
+        profile = calculator.computePSSMFromMSA(filteredSetSize, L, (const char **) res.msaSequence, false);
+        pssmTime += timer.getTimediff();
+        if (i == 0) {
+            hash = checksum(hash, profile.pssm, L * Sequence::PROFILE_AA_SIZE);
+            hash = checksum(hash, (const char *) profile.prob, L * Sequence::PROFILE_AA_SIZE * sizeof(float));
+            hash = checksum(hash, (const char *) profile.neffM, L * sizeof(float));
+        }
+
+        timer.reset();
+        profile = calculator.computePSSMFromMSA(filteredSetSize, L, (const char **) res.msaSequence, true);
+        pssmWgTime += timer.getTimediff();
+        if (i == 0) {
+            hash = checksum(hash, profile.pssm, L * Sequence::PROFILE_AA_SIZE);
+            hash = checksum(hash, (const char *) profile.prob, L * Sequence::PROFILE_AA_SIZE * sizeof(float));
+            hash = checksum(hash, (const char *) profile.gDel, L);
+            hash = checksum(hash, (const char *) profile.gIns, L);
+        }
+    }
+
+    printf("Sequences: %d filtered: %zu columns: %zu iterations: %d\n", counter, filteredSetSize, L, iterations);
+    printf("pruneAlignment:               %8.3f ms\n", 1000.0 * pruneTime / iterations);
+    printf("filter (qid buckets):         %8.3f ms\n", 1000.0 * bucketFilterTime / iterations);
+    printf("filter:                       %8.3f ms\n", 1000.0 * filterTime / iterations);
+    printf("computePSSMFromMSA:           %8.3f ms\n", 1000.0 * pssmTime / iterations);
+    printf("computePSSMFromMSA (wg):      %8.3f ms\n", 1000.0 * pssmWgTime / iterations);
+    printf("computePSSMFromMSA (all seqs):%8.3f ms\n", 1000.0 * pssmAllTime / iterations);
+    printf("Profile checksum: %08x\n", hash);
+
+    free(fixture[0]);
+    delete[] fixture;
+    free(msaBacking);
+    delete[] msa;
+    if (hash != EXPECTED_CHECKSUM) {
+        printf("Profile checksum differs from expected checksum %08x\n", EXPECTED_CHECKSUM);
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,46 @@
+#include <iostream>
+#include <vector>
+#include <cstdlib>
+
+#include "IndexTable.h"
+#include "PostingListCodec.h"
+
+const char* binary_name = "test_postinglistcodec";
+
+int main (int, const char**) {
+    const size_t sizes[] = {0, 1, 3, 4, 5, 17, 1000};
+    srand(1);
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        const size_t n = sizes[s];
+        std::vector<IndexEntryLocal> entries(n);
+        unsigned int seqId = 0;
+        for (size_t i = 0; i < n; i++) {
+            // mix small and large gaps to exercise all delta lengths
+            const unsigned int gap = (i % 7 == 0) ? (rand() % 3) : (rand() % (1u << (8 * (i % 4) + 1)));
+            seqId += gap;
+            entries[i].seqId = seqId;
+            entries[i].position_j = static_cast<unsigned short>(rand());
+        }
+
+        const size_t size = PostingListCodec::encodedSize(entries.data(), n);
+        std::vector<unsigned char> buffer(size + PostingListCodec::PADDING, 0);
+        const size_t written = PostingListCodec::encode(entries.data(), n, buffer.data());
+
+        size_t count = 0;
+        std::vector<IndexEntryLocal> decoded(n);
+        if (n > 0) {
+            const unsigned char *payload = PostingListCodec::decodeCount(buffer.data(), &count);
+            PostingListCodec::decode(payload, count, decoded.data());
+        }
+
+        bool equal = (written == size) && (count == n);
+        for (size_t i = 0; equal && i < n; i++) {
+            equal = entries[i].seqId == decoded[i].seqId && entries[i].position_j == decoded[i].position_j;
+        }
+        std::cout << n << " entries, " << size << " bytes: " << (equal ? "ok" : "FAILED") << std::endl;
+        if (equal == false) {
+            return EXIT_FAILURE;
+        }
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,151 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cfloat>
+#include <climits>
+#include <cstdlib>
+
+#include "DBReader.h"
+#include "DBWriter.h"
+#include "FileUtil.h"
+#include "Matcher.h"
+#include "ProfileLookup.h"
+#include "Sequence.h"
+#include "SubstitutionMatrix.h"
+#include "EvalueComputation.h"
+#include "Parameters.h"
+
+const char* binary_name = "test_profilelookup";
+
+static const char aminoAcids[] = "ACDEFGHIKLMNPQRSTVWY";
+
+static std::string randomSequence(size_t length) {
+    std::string seq(length, ' ');
+    for (size_t i = 0; i < length; i++) {
+        seq[i] = aminoAcids[rand() % (sizeof(aminoAcids) - 1)];
+    }
+    return seq;
+}
+
+// profile columns in the layout that Sequence::mapProfile reads, the query residue scores highest
+static std::string randomProfile(const std::string &query) {
+    std::string profile;
+    for (size_t i = 0; i < query.size(); i++) {
+        char column[Sequence::PROFILE_READIN_SIZE];
+        const int residue = static_cast<int>(std::string(aminoAcids).find(query[i]));
+        for (size_t aa = 0; aa < Sequence::PROFILE_AA_SIZE; aa++) {
+            column[aa] = static_cast<char>((static_cast<int>(aa) == residue) ? 20 + rand() % 20 : -20 + rand() % 24);
+        }
+        column[Sequence::PROFILE_AA_SIZE] = static_cast<char>(residue);
+        column[Sequence::PROFILE_CONSENSUS] = static_cast<char>(residue);
+        column[Sequence::PROFILE_NEFF] = static_cast<char>(1 + rand() % 100);
+        // the same gap penalties at every position, deletion open and close share the gap open penalty
+        column[Sequence::PROFILE_GAP_DEL] = static_cast<char>(5 | (5 << 4));
+        column[Sequence::PROFILE_GAP_INS] = 10;
+        profile.append(column, Sequence::PROFILE_READIN_SIZE);
+    }
+    return profile;
+}
+
+// copy of seq with substitutions, insertions and deletions
+static std::string mutate(const std::string &seq) {
+    std::string out;
+    for (size_t i = 0; i < seq.size(); i++) {
+        const int r = rand() % 100;
+        if (r < 5) {
+            continue;
+        } else if (r < 10) {
+            out.append(randomSequence(1 + rand() % 4));
+        }
+        out.push_back((r < 35) ? aminoAcids[rand() % (sizeof(aminoAcids) - 1)] : seq[i]);
+    }
+    return out.empty() ? seq : out;
+}
+
+static bool sameResult(const Matcher::result_t &a, const Matcher::result_t &b) {
+    return a.score == b.score && a.eval == b.eval && a.seqId == b.seqId
+           && a.qStartPos == b.qStartPos && a.qEndPos == b.qEndPos
+           && a.dbStartPos == b.dbStartPos && a.dbEndPos == b.dbEndPos && a.backtrace == b.backtrace;
+}
+
+// profiles aligned from the decoded profile lookup give the same alignments as profiles decoded from the database
+int main (int, const char**) {
+    Parameters& par = Parameters::getInstance();
+    par.initMatrices();
+    srand(1);
+
+    const std::string profileDb = "/tmp/test_profilelookup";
+    const size_t profileCount = 60;
+    std::vector<std::string> consensus(profileCount);
+    DBWriter writer(profileDb.c_str(), (profileDb + ".index").c_str(), 1, Parameters::WRITER_ASCII_MODE, Parameters::DBTYPE_HMM_PROFILE);
+    writer.open();
+    for (size_t i = 0; i < profileCount; i++) {
+        consensus[i] = randomSequence(20 + rand() % 500);
+        const std::string profile = randomProfile(consensus[i]);
+        // keys are not in the order of the entries
+        writer.writeData(profile.c_str(), profile.size(), static_cast<unsigned int>((i * 7) % profileCount), 0);
+    }
+    writer.close(true);
+
+    DBReader<unsigned int> dbr(profileDb.c_str(), (profileDb + ".index").c_str(), 1, DBReader<unsigned int>::USE_INDEX | DBReader<unsigned int>::USE_DATA);
+    dbr.open(DBReader<unsigned int>::NOSORT);
+    SubstitutionMatrix subMat(par.scoringMatrixFile.values.aminoacid().c_str(), 2.0, 0.0);
+    ProfileLookup::write(profileDb, dbr, &subMat, 1);
+    bool ok = FileUtil::getFileSize(ProfileLookup::fileName(profileDb)) == ProfileLookup::fileSize(dbr, subMat.alphabetSize);
+    std::cout << "Profile lookup size: " << (ok ? "ok" : "FAILED") << std::endl;
+
+    ProfileLookup lookup;
+    ok &= lookup.open(profileDb, subMat.alphabetSize) && lookup.getSize() == profileCount;
+
+    const int maxSeqLen = 1024;
+    EvalueComputation evaluer(100000000, &subMat, par.gapOpen.values.aminoacid(), par.gapExtend.values.aminoacid());
+    for (int compBias = 0; compBias < 2 && ok; compBias++) {
+        Matcher matcher(Parameters::DBTYPE_HMM_PROFILE, Parameters::DBTYPE_AMINO_ACIDS, maxSeqLen, &subMat, &evaluer,
+                        compBias, 1.0, par.gapOpen.values.aminoacid(), par.gapExtend.values.aminoacid(), 0.0, 40);
+        Sequence decoded(maxSeqLen, Parameters::DBTYPE_HMM_PROFILE, &subMat, 0, false, compBias);
+        Sequence mapped(maxSeqLen, Parameters::DBTYPE_HMM_PROFILE, &subMat, 0, false, compBias);
+        Sequence dbSeq(maxSeqLen, Parameters::DBTYPE_AMINO_ACIDS, &subMat, 0, false, compBias);
+        size_t compared = 0;
+        for (size_t id = 0; id < dbr.getSize() && ok; id++) {
+            const unsigned int key = dbr.getDbKey(id);
+            decoded.mapSequence(id, key, dbr.getData(id, 0), dbr.getSeqLen(id));
+            if (lookup.mapProfile(mapped, id, key, dbr.getSeqLen(id)) == false) {
+                std::cout << "Profile " << key << " is missing in the lookup" << std::endl;
+                ok = false;
+                break;
+            }
+            // homologs of the profile consensus and unrelated targets
+            std::vector<std::string> targets;
+            for (size_t j = 0; j < 4; j++) {
+                const std::string &source = consensus[(j % 2 == 0) ? (id * 7) % profileCount : rand() % profileCount];
+                targets.push_back((j < 3) ? mutate(source) : randomSequence(1 + rand() % 400));
+            }
+            std::vector<Matcher::result_t> expected;
+            matcher.initQuery(&decoded);
+            for (size_t j = 0; j < targets.size(); j++) {
+                dbSeq.mapSequence(j, j, targets[j].c_str(), targets[j].size());
+                expected.push_back(matcher.getSWResult(&dbSeq, INT_MAX, false, 0, 0.0, FLT_MAX, Matcher::SCORE_COV_SEQID, 0, false));
+            }
+            matcher.initQuery(&mapped);
+            for (size_t j = 0; j < targets.size(); j++) {
+                dbSeq.mapSequence(j, j, targets[j].c_str(), targets[j].size());
+                Matcher::result_t res = matcher.getSWResult(&dbSeq, INT_MAX, false, 0, 0.0, FLT_MAX, Matcher::SCORE_COV_SEQID, 0, false);
+                if (sameResult(res, expected[j]) == false) {
+                    std::cout << "Profile " << key << " target " << j << ": score " << res.score
+                              << " from the lookup != " << expected[j].score << std::endl;
+                    ok = false;
+                    break;
+                }
+                compared++;
+            }
+        }
+        std::cout << "Composition bias " << compBias << ": " << compared << " alignments " << (ok ? "identical" : "FAILED") << std::endl;
+    }
+
+    dbr.close();
+    FileUtil::remove(ProfileLookup::fileName(profileDb).c_str());
+    FileUtil::remove(profileDb.c_str());
+    FileUtil::remove((profileDb + ".index").c_str());
+    FileUtil::remove((profileDb + ".dbtype").c_str());
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
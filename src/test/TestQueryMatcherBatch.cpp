@@ -0,0 +1,145 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cstdlib>
+
+#include "DBReader.h"
+#include "DBWriter.h"
+#include "IndexTable.h"
+#include "IndexBuilder.h"
+#include "QueryMatcher.h"
+#include "SequenceLookup.h"
+#include "SubstitutionMatrix.h"
+#include "ExtendedSubstitutionMatrix.h"
+#include "Parameters.h"
+
+const char* binary_name = "test_querymatcherbatch";
+
+static const char aminoAcids[] = "ACDEFGHIKLMNPQRSTVWY";
+
+static std::string randomSequence(size_t length) {
+    std::string seq(length, ' ');
+    for (size_t i = 0; i < length; i++) {
+        seq[i] = aminoAcids[rand() % (sizeof(aminoAcids) - 1)];
+    }
+    return seq;
+}
+
+static std::string mutate(const std::string &seq) {
+    std::string out(seq);
+    for (size_t i = 0; i < out.size(); i++) {
+        if (rand() % 100 < 20) {
+            out[i] = aminoAcids[rand() % (sizeof(aminoAcids) - 1)];
+        }
+    }
+    return out;
+}
+
+// matches every query on its own and in batches of different sizes and compares the hit lists
+static bool compareBatches(IndexTable *indexTable, SequenceLookup *lookup, SubstitutionMatrix &kmerSubMat,
+                           SubstitutionMatrix &ungappedSubMat, ScoreMatrix &three, ScoreMatrix &two,
+                           const std::vector<std::string> &queries, short kmerThr, int kmerSize, size_t dbSize, bool diagonalScoring) {
+    const unsigned int maxSeqLen = 1024;
+    Sequence seq(maxSeqLen, Parameters::DBTYPE_AMINO_ACIDS, &kmerSubMat, kmerSize, false, true);
+    QueryMatcher matcher(indexTable, lookup, &kmerSubMat, &ungappedSubMat, kmerThr, kmerSize, dbSize, maxSeqLen,
+                         300, true, 1.0, diagonalScoring, 0, false, false);
+    matcher.setSubstitutionMatrix(&three, &two);
+
+    std::vector<std::vector<hit_t> > expected(queries.size());
+    for (size_t i = 0; i < queries.size(); i++) {
+        seq.mapSequence(i, i, queries[i].c_str(), queries[i].size());
+        std::pair<hit_t *, size_t> result = matcher.matchQuery(&seq, UINT_MAX, false);
+        expected[i].assign(result.first, result.first + result.second);
+    }
+
+    const size_t batchSizes[] = {1, 3, 16, 64};
+    size_t hits = 0;
+    for (size_t b = 0; b < sizeof(batchSizes) / sizeof(batchSizes[0]); b++) {
+        for (size_t start = 0; start < queries.size(); start += batchSizes[b]) {
+            const size_t end = std::min(start + batchSizes[b], queries.size());
+            matcher.clearBatch();
+            for (size_t i = start; i < end; i++) {
+                seq.mapSequence(i, i, queries[i].c_str(), queries[i].size());
+                matcher.addToBatch(&seq);
+            }
+            matcher.matchBatch();
+            for (size_t i = start; i < end; i++) {
+                seq.mapSequence(i, i, queries[i].c_str(), queries[i].size());
+                std::pair<hit_t *, size_t> result = matcher.matchQueryInBatch(&seq, i - start, UINT_MAX, false);
+                bool same = result.second == expected[i].size();
+                for (size_t j = 0; same && j < result.second; j++) {
+                    same = result.first[j].seqId == expected[i][j].seqId
+                           && result.first[j].prefScore == expected[i][j].prefScore
+                           && result.first[j].diagonal == expected[i][j].diagonal;
+                }
+                if (same == false) {
+                    std::cout << "Query " << i << " in batch of " << batchSizes[b] << ": " << result.second
+                              << " hits differ from " << expected[i].size() << " unbatched hits" << std::endl;
+                    return false;
+                }
+                hits += result.second;
+            }
+        }
+    }
+    std::cout << hits << " hits identical" << std::endl;
+    return true;
+}
+
+int main (int, const char**) {
+    Parameters &par = Parameters::getInstance();
+    par.initMatrices();
+    srand(1);
+
+    // targets are families of homologs, queries are further homologs and unrelated sequences
+    std::vector<std::string> families;
+    for (size_t i = 0; i < 40; i++) {
+        families.push_back(randomSequence(50 + rand() % 400));
+    }
+    DBWriter writer("dataQueryMatcherBatch", "dataQueryMatcherBatch.index", 1, Parameters::WRITER_ASCII_MODE, Parameters::DBTYPE_AMINO_ACIDS);
+    writer.open();
+    for (unsigned int i = 0; i < 400; i++) {
+        const std::string target = ((i % 4 == 3) ? randomSequence(20 + rand() % 500) : mutate(families[i % families.size()])) + "\n";
+        writer.writeData(target.c_str(), target.size(), i, 0);
+    }
+    writer.close();
+    std::vector<std::string> queries;
+    for (size_t i = 0; i < 100; i++) {
+        queries.push_back((i % 5 == 4) ? randomSequence(10 + rand() % 600) : mutate(families[rand() % families.size()]));
+    }
+
+    DBReader<unsigned int> dbr("dataQueryMatcherBatch", "dataQueryMatcherBatch.index", 1, DBReader<unsigned int>::USE_INDEX | DBReader<unsigned int>::USE_DATA);
+    dbr.open(DBReader<unsigned int>::NOSORT);
+
+    const int kmerSize = 5;
+    SubstitutionMatrix kmerSubMat(par.scoringMatrixFile.values.aminoacid().c_str(), 8.0, -0.2f);
+    SubstitutionMatrix ungappedSubMat(par.scoringMatrixFile.values.aminoacid().c_str(), 2.0, -0.2f);
+    kmerSubMat.alphabetSize = kmerSubMat.alphabetSize - 1;
+    ScoreMatrix two = ExtendedSubstitutionMatrix::calcScoreMatrix(kmerSubMat, 2);
+    ScoreMatrix three = ExtendedSubstitutionMatrix::calcScoreMatrix(kmerSubMat, 3);
+    kmerSubMat.alphabetSize = kmerSubMat.alphabetSize + 1;
+    // prefilter k-mer threshold of sequence searches with k-mer size 5 at sensitivity 4
+    const short kmerThr = 109;
+
+    Sequence tseq(dbr.getMaxSeqLen(), Parameters::DBTYPE_AMINO_ACIDS, &kmerSubMat, kmerSize, false, true);
+    IndexTable indexTable(kmerSubMat.alphabetSize - 1, kmerSize, false);
+    SequenceLookup *lookup = NULL;
+    IndexBuilder::fillDatabase(&indexTable, NULL, &lookup, kmerSubMat, &tseq, &dbr, 0, dbr.getSize(), 0, false, false, 0.9);
+
+    bool success = true;
+    for (int compressed = 0; compressed < 2 && success; compressed++) {
+        if (compressed == 1) {
+            indexTable.compressEntries();
+        }
+        for (int diagonalScoring = 0; diagonalScoring < 2 && success; diagonalScoring++) {
+            std::cout << "Compressed " << compressed << ", diagonal scoring " << diagonalScoring << ": ";
+            success = compareBatches(&indexTable, lookup, kmerSubMat, ungappedSubMat, three, two,
+                                     queries, kmerThr, kmerSize, dbr.getSize(), diagonalScoring);
+        }
+    }
+
+    ExtendedSubstitutionMatrix::freeScoreMatrix(three);
+    ExtendedSubstitutionMatrix::freeScoreMatrix(two);
+    delete lookup;
+    dbr.close();
+    return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
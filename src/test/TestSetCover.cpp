@@ -0,0 +1,146 @@
+#include <iostream>
+#include <set>
+#include <vector>
+#include <cstdlib>
+
+#include "ClusteringAlgorithms.h"
+#include "DBReader.h"
+#include "DBWriter.h"
+#include "FileUtil.h"
+#include "Parameters.h"
+#include "Util.h"
+#include "itoa.h"
+
+#ifdef OPENMP
+#include <omp.h>
+#endif
+
+const char* binary_name = "test_setcover";
+
+// Compares the parallel set cover against the serial one on a random graph of sequence families.
+// Usage: test_setcover [sequences] [tmp path prefix]
+struct SetCoverResult {
+    size_t clusters;
+    std::vector<std::pair<unsigned int, unsigned int> > assignment;
+};
+
+SetCoverResult runSetCover(const std::string &seqDb, const std::string &alnDb, bool parallel, bool deterministic, int threads) {
+#ifdef OPENMP
+    omp_set_num_threads(threads);
+#endif
+    DBReader<unsigned int> seqDbr(seqDb.c_str(), (seqDb + ".index").c_str(), threads, DBReader<unsigned int>::USE_INDEX);
+    seqDbr.open(DBReader<unsigned int>::SORT_BY_LENGTH);
+    DBReader<unsigned int> alnDbr(alnDb.c_str(), (alnDb + ".index").c_str(), threads, DBReader<unsigned int>::USE_DATA|DBReader<unsigned int>::USE_INDEX);
+    alnDbr.open(DBReader<unsigned int>::NOSORT);
+
+    ClusteringAlgorithms algorithm(&seqDbr, &alnDbr, threads, Parameters::APC_SEQID, 1000, parallel, deterministic);
+    std::pair<unsigned int, unsigned int> *ret = algorithm.execute(1);
+    SetCoverResult result;
+    result.clusters = 0;
+    result.assignment.assign(ret, ret + seqDbr.getSize());
+    for (size_t i = 0; i < result.assignment.size(); i++) {
+        result.clusters += (result.assignment[i].first == result.assignment[i].second);
+    }
+    delete[] ret;
+    alnDbr.close();
+    seqDbr.close();
+    return result;
+}
+
+bool isValid(const SetCoverResult &result, const std::vector<std::set<unsigned int> > &edges) {
+    for (size_t i = 0; i < result.assignment.size(); i++) {
+        const unsigned int rep = result.assignment[i].first;
+        const unsigned int member = result.assignment[i].second;
+        if (rep != member && edges[rep].find(member) == edges[rep].end()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int main (int argc, const char** argv) {
+    const unsigned int n = (argc > 1) ? strtoul(argv[1], NULL, 10) : 20000;
+    const std::string prefix = (argc > 2) ? argv[2] : "/tmp/test_setcover";
+    const std::string seqDb = prefix + "_seq";
+    const std::string alnDb = prefix + "_aln";
+
+    // families of related sequences, members hit each other with some probability,
+    // a few hits connect unrelated sequences
+    srand(1);
+    std::vector<unsigned int> family(n);
+    unsigned int families = 0;
+    for (unsigned int i = 0; i < n; families++) {
+        const unsigned int size = 1 + rand() % 30;
+        for (unsigned int j = 0; j < size && i < n; j++, i++) {
+            family[i] = families;
+        }
+    }
+    std::vector<std::set<unsigned int> > edges(n);
+    for (unsigned int i = 0; i < n; i++) {
+        edges[i].insert(i);
+        for (unsigned int j = i + 1; j < n && family[j] == family[i]; j++) {
+            if (rand() % 3 != 0) {
+                edges[i].insert(j);
+                edges[j].insert(i);
+            }
+        }
+        if (rand() % 10 == 0) {
+            const unsigned int other = rand() % n;
+            edges[i].insert(other);
+            edges[other].insert(i);
+        }
+    }
+
+    DBWriter seqWriter(seqDb.c_str(), (seqDb + ".index").c_str(), 1, Parameters::WRITER_ASCII_MODE, Parameters::DBTYPE_AMINO_ACIDS);
+    seqWriter.open();
+    DBWriter alnWriter(alnDb.c_str(), (alnDb + ".index").c_str(), 1, Parameters::WRITER_ASCII_MODE, Parameters::DBTYPE_PREFILTER_RES);
+    alnWriter.open();
+    std::string buffer;
+    char keyBuffer[255];
+    for (unsigned int i = 0; i < n; i++) {
+        buffer.assign(50 + rand() % 500, 'A');
+        buffer.push_back('\n');
+        seqWriter.writeData(buffer.c_str(), buffer.size(), i);
+        buffer.clear();
+        for (std::set<unsigned int>::const_iterator it = edges[i].begin(); it != edges[i].end(); ++it) {
+            char *end = Itoa::u32toa_sse2(*it, keyBuffer);
+            buffer.append(keyBuffer, end - keyBuffer - 1);
+            buffer.append("\t");
+            buffer.append(SSTR(*it == i ? 100 : 30 + rand() % 70));
+            buffer.append("\t0\n");
+        }
+        alnWriter.writeData(buffer.c_str(), buffer.size(), i);
+    }
+    seqWriter.close(true);
+    alnWriter.close(true);
+
+    const SetCoverResult serial = runSetCover(seqDb, alnDb, false, true, 1);
+    const SetCoverResult deterministic1 = runSetCover(seqDb, alnDb, true, true, 1);
+    const SetCoverResult deterministic4 = runSetCover(seqDb, alnDb, true, true, 4);
+    const SetCoverResult fast = runSetCover(seqDb, alnDb, true, false, 4);
+
+    bool ok = true;
+    const double tolerance = 0.05;
+    std::cout << "Serial set cover: " << serial.clusters << " clusters\n";
+    const SetCoverResult *results[] = { &deterministic1, &deterministic4, &fast };
+    const char *names[] = { "Parallel deterministic 1 thread", "Parallel deterministic 4 threads", "Parallel non-deterministic 4 threads" };
+    for (size_t i = 0; i < 3; i++) {
+        const double ratio = static_cast<double>(results[i]->clusters) / static_cast<double>(serial.clusters);
+        const bool valid = isValid(*results[i], edges);
+        const bool close = ratio > 1.0 - tolerance && ratio < 1.0 + tolerance;
+        std::cout << names[i] << ": " << results[i]->clusters << " clusters, ratio " << ratio
+                  << (valid ? "" : ", INVALID ASSIGNMENT") << (close ? "" : ", CLUSTER COUNT DIFFERS") << "\n";
+        ok &= valid && close;
+    }
+    const bool sameResult = deterministic1.assignment == deterministic4.assignment;
+    std::cout << "Deterministic result independent of threads: " << (sameResult ? "ok" : "FAILED") << "\n";
+    ok &= sameResult;
+
+    FileUtil::remove(seqDb.c_str());
+    FileUtil::remove((seqDb + ".index").c_str());
+    FileUtil::remove((seqDb + ".dbtype").c_str());
+    FileUtil::remove(alnDb.c_str());
+    FileUtil::remove((alnDb + ".index").c_str());
+    FileUtil::remove((alnDb + ".dbtype").c_str());
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
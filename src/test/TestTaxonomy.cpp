@@ -1,16 +1,110 @@
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <algorithm>
+#include <cstdlib>
+
 #include "NcbiTaxonomy.h"
+#include "FileUtil.h"
 #include "Debug.h"
 
 const char* binary_name = "test_taxonomy";
 
-int main (int, const char**) {
-    NcbiTaxonomy t("/Users/mirdita/tmp/taxonomy/names.dmp",
-                   "/Users/mirdita/tmp/taxonomy/nodes.dmp",
-                   "/Users/mirdita/tmp/taxonomy/merged.dmp");
-                   //"/Users/mirdita/tmp/taxonomy/delnodes.dmp");
-    std::vector<int> taxa;
-    taxa.push_back(9);
-    taxa.push_back(7);
-    TaxonNode const * node = t.LCA(taxa);
-    Debug(Debug::INFO) << t.getString(node->nameIdx) << "\n";
+// Compares the batched and the set LCA against walking up the lineages on a random taxonomy,
+// before and after a serialization roundtrip.
+// Usage: test_taxonomy [nodes] [tmp path prefix]
+TaxID naiveLCA(const NcbiTaxonomy &t, const std::vector<TaxID> &taxa) {
+    std::vector<TaxID> lineage;
+    for (TaxID id = taxa[0]; ; id = t.taxonNode(id)->parentTaxId) {
+        lineage.push_back(id);
+        if (id == 1) {
+            break;
+        }
+    }
+    size_t red = 0;
+    for (size_t i = 1; i < taxa.size(); i++) {
+        TaxID id = taxa[i];
+        while (std::find(lineage.begin() + red, lineage.end(), id) == lineage.end()) {
+            id = t.taxonNode(id)->parentTaxId;
+        }
+        red = std::find(lineage.begin() + red, lineage.end(), id) - lineage.begin();
+    }
+    return lineage[red];
+}
+
+bool checkTaxonomy(const NcbiTaxonomy &t, const std::vector<TaxID> &taxa, const std::vector<size_t> &offsets) {
+    const size_t setCount = offsets.size() - 1;
+    std::vector<TaxonNode const *> batched(setCount);
+    t.LCA(taxa.data(), offsets.data(), setCount, batched.data());
+
+    size_t mismatches = 0;
+    for (size_t i = 0; i < setCount; i++) {
+        std::vector<TaxID> set(taxa.begin() + offsets[i], taxa.begin() + offsets[i + 1]);
+        TaxonNode const *node = t.LCA(set);
+        if (set.empty()) {
+            mismatches += (node != NULL || batched[i] != NULL);
+            continue;
+        }
+        const TaxID expected = naiveLCA(t, set);
+        mismatches += (node == NULL || node->taxId != expected);
+        mismatches += (batched[i] == NULL || batched[i]->taxId != expected);
+    }
+    return mismatches == 0;
+}
+
+int main (int argc, const char** argv) {
+    const unsigned int n = (argc > 1) ? strtoul(argv[1], NULL, 10) : 20000;
+    const std::string prefix = (argc > 2) ? argv[2] : "/tmp/test_taxonomy";
+    const std::string namesFile = prefix + "_names.dmp";
+    const std::string nodesFile = prefix + "_nodes.dmp";
+    const std::string mergedFile = prefix + "_merged.dmp";
+
+    // random tree with sparse taxon ids, node 1 is the root and is written last,
+    // so it is not the first node of the taxonomy
+    srand(1);
+    std::vector<TaxID> ids;
+    ids.push_back(1);
+    {
+        std::ofstream nodes(nodesFile.c_str());
+        std::ofstream names(namesFile.c_str());
+        for (unsigned int i = 1; i < n; i++) {
+            const TaxID id = ids.back() + 1 + rand() % 5;
+            // prefer recent parents to get deep lineages
+            const TaxID parent = (rand() % 4 == 0) ? ids[rand() % ids.size()] : ids[ids.size() - 1 - rand() % std::min<size_t>(ids.size(), 10)];
+            ids.push_back(id);
+            nodes << id << "\t|\t" << parent << "\t|\tspecies\t|\n";
+            names << id << "\t|\ttaxon " << id << "\t|\t\t|\tscientific name\t|\n";
+        }
+        nodes << "1\t|\t1\t|\tno rank\t|\n";
+        names << "1\t|\troot\t|\t\t|\tscientific name\t|\n";
+        std::ofstream merged(mergedFile.c_str());
+    }
+
+    std::vector<TaxID> taxa;
+    std::vector<size_t> offsets;
+    offsets.push_back(0);
+    for (size_t i = 0; i < 5000; i++) {
+        const size_t size = (i % 100 == 0) ? 0 : 1 + rand() % 20;
+        for (size_t j = 0; j < size; j++) {
+            // some sets contain the root
+            taxa.push_back((i % 10 == 1 && j == size / 2) ? 1 : ids[rand() % ids.size()]);
+        }
+        offsets.push_back(taxa.size());
+    }
+
+    NcbiTaxonomy t(namesFile, nodesFile, mergedFile);
+    const bool ok = checkTaxonomy(t, taxa, offsets);
+    std::cout << "LCA of sets: " << (ok ? "ok" : "FAILED") << "\n";
+
+    std::pair<char*, size_t> serialized = NcbiTaxonomy::serialize(t);
+    NcbiTaxonomy *loaded = NcbiTaxonomy::unserialize(serialized.first);
+    const bool loadedOk = checkTaxonomy(*loaded, taxa, offsets);
+    std::cout << "LCA of sets after serialization: " << (loadedOk ? "ok" : "FAILED") << "\n";
+    delete loaded;
+    free(serialized.first);
+
+    FileUtil::remove(namesFile.c_str());
+    FileUtil::remove(nodesFile.c_str());
+    FileUtil::remove(mergedFile.c_str());
+    return (ok && loadedOk) ? EXIT_SUCCESS : EXIT_FAILURE;
 }
@@ -0,0 +1,101 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cstdlib>
+
+#include "StripedSmithWaterman.h"
+#include "Sequence.h"
+#include "SubstitutionMatrix.h"
+#include "NucleotideMatrix.h"
+#include "Parameters.h"
+
+const char* binary_name = "test_ungappedalignmentbatch";
+
+static std::string randomSequence(const char *letters, size_t letterCount, size_t length) {
+    std::string seq(length, ' ');
+    for (size_t i = 0; i < length; i++) {
+        seq[i] = letters[rand() % letterCount];
+    }
+    return seq;
+}
+
+// compares ungapped_alignment_batch against ungapped_alignment for queries up to BATCH_MAX_QUERY_LENGTH
+static bool compareScores(BaseMatrix *subMat, int seqType, const char *letters, size_t letterCount, bool compBias) {
+    const int maxSeqLen = 1024;
+    int8_t *tinySubMat = new int8_t[subMat->alphabetSize * subMat->alphabetSize];
+    for (int i = 0; i < subMat->alphabetSize; i++) {
+        for (int j = 0; j < subMat->alphabetSize; j++) {
+            tinySubMat[i * subMat->alphabetSize + j] = subMat->subMatrix[i][j];
+        }
+    }
+    Sequence qSeq(maxSeqLen, seqType, subMat, 0, false, compBias);
+    Sequence tSeq(maxSeqLen, seqType, subMat, 0, false, compBias);
+    SmithWaterman aligner(maxSeqLen, subMat->alphabetSize, compBias, 1.0, seqType);
+
+    const int batchSize = VECSIZE_INT * 4;
+    std::vector<std::vector<unsigned char> > targets(batchSize);
+    const unsigned char *batchTargets[VECSIZE_INT * 4];
+    int32_t batchLengths[VECSIZE_INT * 4];
+    int batchScores[VECSIZE_INT * 4];
+
+    const size_t queryLengths[] = {1, 7, 31, 100, 255, SmithWaterman::BATCH_MAX_QUERY_LENGTH};
+    size_t compared = 0;
+    for (size_t q = 0; q < sizeof(queryLengths) / sizeof(queryLengths[0]); q++) {
+        const std::string query = randomSequence(letters, letterCount, queryLengths[q]);
+        qSeq.mapSequence(0, 0, query.c_str(), query.size());
+        aligner.ssw_init(&qSeq, tinySubMat, subMat);
+        // full and partial batches, mixed target lengths and targets similar to the query
+        const int counts[] = {batchSize, 1, batchSize - 1};
+        for (size_t c = 0; c < sizeof(counts) / sizeof(counts[0]); c++) {
+            for (int k = 0; k < counts[c]; k++) {
+                std::string target;
+                if (k % 3 == 0) {
+                    target = query.substr(rand() % query.size()) + randomSequence(letters, letterCount, rand() % 50);
+                } else {
+                    target = randomSequence(letters, letterCount, 1 + rand() % 600);
+                }
+                tSeq.mapSequence(k + 1, k + 1, target.c_str(), target.size());
+                targets[k].assign(tSeq.numSequence, tSeq.numSequence + tSeq.L);
+                batchTargets[k] = targets[k].data();
+                batchLengths[k] = tSeq.L;
+            }
+            aligner.ungapped_alignment_batch(batchTargets, batchLengths, counts[c], batchScores);
+            for (int k = 0; k < counts[c]; k++) {
+                const int score = aligner.ungapped_alignment(batchTargets[k], batchLengths[k]);
+                if (score != batchScores[k]) {
+                    std::cout << "Query length " << query.size() << " target length " << batchLengths[k]
+                              << ": batch score " << batchScores[k] << " != " << score << std::endl;
+                    delete[] tinySubMat;
+                    return false;
+                }
+                compared++;
+            }
+        }
+    }
+    std::cout << compared << " scores identical" << std::endl;
+    delete[] tinySubMat;
+    return true;
+}
+
+int main (int, const char**) {
+    Parameters& par = Parameters::getInstance();
+    par.initMatrices();
+    srand(1);
+
+    const char aminoAcids[] = "ACDEFGHIKLMNPQRSTVWYX";
+    SubstitutionMatrix subMat(par.scoringMatrixFile.values.aminoacid().c_str(), 2.0, 0.0);
+    for (int compBias = 0; compBias < 2; compBias++) {
+        std::cout << "Amino acids, composition bias " << compBias << ": ";
+        if (compareScores(&subMat, Parameters::DBTYPE_AMINO_ACIDS, aminoAcids, sizeof(aminoAcids) - 1, compBias) == false) {
+            return EXIT_FAILURE;
+        }
+    }
+
+    const char nucleotides[] = "ACGTN";
+    NucleotideMatrix nuclMat(par.scoringMatrixFile.values.nucleotide().c_str(), 1.0, 0.0);
+    std::cout << "Nucleotides: ";
+    if (compareScores(&nuclMat, Parameters::DBTYPE_NUCLEOTIDES, nucleotides, sizeof(nucleotides) - 1, false) == false) {
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,219 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <unistd.h>
+
+#include "Command.h"
+#include "DBReader.h"
+#include "DBWriter.h"
+#include "Debug.h"
+#include "DownloadDatabase.h"
+#include "FileUtil.h"
+#include "Instrumentation.h"
+#include "Parameters.h"
+#include "Util.h"
+#include "WorkflowExecutor.h"
+
+const char* binary_name = "test_workflowexecutor";
+// the base commands of the binary are linked in as well
+extern const char* MMSEQS_CURRENT_INDEX_VERSION;
+const char* index_version_compatible = MMSEQS_CURRENT_INDEX_VERSION;
+std::vector<DatabaseDownload> externalDownloads = {};
+bool hide_base_downloads = false;
+
+// what the last run of the record module saw
+struct ModuleState {
+    int threads;
+    double evalThr;
+    float sensitivity;
+    std::string db1;
+    DBReader<unsigned int> *sharedReader;
+    DBReader<unsigned int> *sharedSequences;
+};
+static ModuleState seen;
+
+static int record(int argc, const char **argv, const Command &command) {
+    Parameters &par = Parameters::getInstance();
+    par.parseParameters(argc, argv, command, false, 0, 0);
+    seen.threads = par.threads;
+    seen.evalThr = par.evalThr;
+    seen.sensitivity = par.sensitivity;
+    seen.db1 = par.db1;
+    seen.sharedReader = WorkflowExecutor::getSharedReader(par.db1);
+    seen.sharedSequences = WorkflowExecutor::getSharedSequenceReader(par.db1);
+    return EXIT_SUCCESS;
+}
+
+static std::vector<MMseqsParameter*> recordParameters = {
+        &Parameters::getInstance().PARAM_THREADS, &Parameters::getInstance().PARAM_E, &Parameters::getInstance().PARAM_V
+};
+
+std::vector<Command> commands = {
+        {"record", record, &recordParameters, COMMAND_HIDDEN, "Records the parameters it was called with", NULL, "", "<i:db>", 0,
+                {{"db", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA, &DbValidator::allDb}}}
+};
+
+static const char aminoAcids[] = "ACDEFGHIKLMNPQRSTVWY";
+
+static std::string randomSequence(size_t length) {
+    std::string seq(length, ' ');
+    for (size_t i = 0; i < length; i++) {
+        seq[i] = aminoAcids[rand() % (sizeof(aminoAcids) - 1)];
+    }
+    return seq;
+}
+
+static void writeSequences(const std::string &db, const std::vector<std::string> &sequences) {
+    DBWriter writer(db.c_str(), (db + ".index").c_str(), 1, Parameters::WRITER_ASCII_MODE, Parameters::DBTYPE_AMINO_ACIDS);
+    writer.open();
+    for (size_t i = 0; i < sequences.size(); i++) {
+        const std::string entry = sequences[i] + "\n";
+        writer.writeData(entry.c_str(), entry.size(), static_cast<unsigned int>(i), 0);
+    }
+    writer.close(true);
+
+    DBWriter headers((db + "_h").c_str(), (db + "_h.index").c_str(), 1, Parameters::WRITER_ASCII_MODE, Parameters::DBTYPE_GENERIC_DB);
+    headers.open();
+    for (size_t i = 0; i < sequences.size(); i++) {
+        const std::string header = "seq" + SSTR(i) + "\n";
+        headers.writeData(header.c_str(), header.size(), static_cast<unsigned int>(i), 0);
+    }
+    headers.close(true);
+}
+
+static std::string readFile(const std::string &file) {
+    std::ifstream in(file.c_str(), std::ios::binary);
+    std::stringstream ss;
+    ss << in.rdbuf();
+    return ss.str();
+}
+
+static bool check(bool ok, const std::string &what) {
+    std::cout << what << ": " << (ok ? "ok" : "FAILED") << std::endl;
+    return ok;
+}
+
+// runs prefilter and align for each query as the multi-step search does, returns the alignment result
+static std::string searchSteps(const std::string &query, const std::string &target, const std::string &out, bool share) {
+    WorkflowExecutor executor;
+    if (share) {
+        executor.shareDatabase(target, 1);
+    }
+    const std::string common = "--threads 1 -v 1";
+    executor.runModule("prefilter", WorkflowExecutor::makeArguments({query, target, out + "_pref"}, common + " -s 5"));
+    executor.runModule("align", WorkflowExecutor::makeArguments({query, target, out + "_pref", out}, common + " -e 10"));
+    const std::string result = readFile(out + ".index") + readFile(out);
+    executor.runModule("rmdb", WorkflowExecutor::makeArguments({out + "_pref"}, "-v 1"));
+    executor.runModule("rmdb", WorkflowExecutor::makeArguments({out}, "-v 1"));
+    return result;
+}
+
+int main (int, const char**) {
+    Parameters &par = Parameters::getInstance();
+    srand(1);
+    bool ok = true;
+
+    const std::string base = "/tmp/test_workflowexecutor";
+    FileUtil::makeDir(base.c_str());
+    const std::string targetDb = base + "/target";
+    const std::string queryDb = base + "/query";
+    std::vector<std::string> targets;
+    std::vector<std::string> queries;
+    for (size_t i = 0; i < 300; i++) {
+        targets.push_back(randomSequence(50 + rand() % 300));
+        if (i % 5 == 0) {
+            // homologs with a few substitutions
+            std::string query = targets.back();
+            for (size_t j = 0; j < query.size(); j += 4 + rand() % 6) {
+                query[j] = aminoAcids[rand() % (sizeof(aminoAcids) - 1)];
+            }
+            queries.push_back(query);
+        }
+    }
+    writeSequences(targetDb, targets);
+    writeSequences(queryDb, queries);
+
+    // the caller keeps its parameters, the module starts from the defaults
+    par.threads = 3;
+    par.evalThr = 0.5;
+    par.sensitivity = 7.5;
+    par.db1 = "caller";
+    par.PARAM_E.wasSet = true;
+    {
+        WorkflowExecutor executor;
+        executor.runModule("record", WorkflowExecutor::makeArguments({targetDb}, "--threads 2 -e 0.01 -v 1"));
+        ok &= check(seen.threads == 2 && seen.evalThr == 0.01 && seen.sensitivity == 4.0f,
+                    "Module sees its arguments and the defaults");
+        ok &= check(seen.db1 == targetDb && seen.sharedReader == NULL && seen.sharedSequences == NULL, "Unshared database is opened by the module");
+        ok &= check(par.threads == 3 && par.evalThr == 0.5 && par.sensitivity == 7.5f && par.db1 == "caller" && par.PARAM_E.wasSet,
+                    "Caller parameters are restored");
+
+        // a step with an existing output does not run again
+        executor.runStep("record", WorkflowExecutor::makeArguments({queryDb}, "-v 1"), targetDb);
+        ok &= check(executor.getExecutedSteps() == 1 && seen.db1 == targetDb, "Step with existing output is skipped");
+    }
+
+    // a shared database is the same open reader in every step and closed with the executor
+    {
+        WorkflowExecutor executor;
+        executor.shareDatabase(targetDb, 1);
+        executor.runModule("record", WorkflowExecutor::makeArguments({targetDb}, "-v 1"));
+        DBReader<unsigned int> *first = seen.sharedReader;
+        executor.runModule("record", WorkflowExecutor::makeArguments({targetDb}, "-v 1"));
+        ok &= check(first != NULL && seen.sharedReader == first && seen.sharedSequences == first && first->getSize() == targets.size(),
+                    "Shared database is kept open between steps");
+    }
+    ok &= check(WorkflowExecutor::getSharedReader(targetDb) == NULL, "Shared database is closed with the executor");
+
+    // prefilter and align give the same results with the shared target database and its index
+    const std::string expected = searchSteps(queryDb, targetDb, base + "/aln_plain", false);
+    ok &= check(expected.empty() == false && expected == searchSteps(queryDb, targetDb, base + "/aln_shared", true),
+                "Search with shared target database");
+    const std::string indexDb = targetDb + ".idx";
+    {
+        WorkflowExecutor executor;
+        // indexdb writes the index next to the database, like createindex does
+        executor.runModule("indexdb", WorkflowExecutor::makeArguments({targetDb, targetDb}, "--threads 1 -v 1"));
+    }
+    const std::string expectedIndex = searchSteps(queryDb, indexDb, base + "/aln_index", false);
+    ok &= check(expectedIndex == expected && expectedIndex == searchSteps(queryDb, indexDb, base + "/aln_index_shared", true),
+                "Search with shared target index");
+
+#ifdef HAVE_INSTRUMENTATION
+    // modules run by a traced workflow write their own traces
+    const std::string traceDir = base + "/trace";
+    FileUtil::makeDir(traceDir.c_str());
+    setenv("MMSEQS_TRACE", traceDir.c_str(), 1);
+    Instrumentation::start(binary_name);
+    {
+        WorkflowExecutor executor;
+        executor.runModule("record", WorkflowExecutor::makeArguments({targetDb}, "-v 1"));
+        executor.runModule("record", WorkflowExecutor::makeArguments({targetDb}, "-v 1"));
+    }
+    const bool workflowTraced = Instrumentation::enabled;
+    Instrumentation::finish();
+    unsetenv("MMSEQS_TRACE");
+    const std::string pid = SSTR(getpid());
+    std::vector<std::string> traceFiles;
+    traceFiles.push_back(traceDir + "/" + binary_name + "_" + pid + ".json");
+    traceFiles.push_back(traceDir + "/record_" + pid + "_2.json");
+    traceFiles.push_back(traceDir + "/record_" + pid + "_3.json");
+    bool traced = workflowTraced;
+    for (size_t i = 0; i < traceFiles.size(); i++) {
+        traced &= readFile(traceFiles[i]).find("\"stageTotals\"") != std::string::npos;
+        FileUtil::remove(traceFiles[i].c_str());
+    }
+    ok &= check(traced, "Modules are traced separately");
+    rmdir(traceDir.c_str());
+#endif
+
+    DBReader<unsigned int>::removeDb(indexDb);
+    DBReader<unsigned int>::removeDb(queryDb);
+    DBReader<unsigned int>::removeDb(queryDb + "_h");
+    DBReader<unsigned int>::removeDb(targetDb);
+    DBReader<unsigned int>::removeDb(targetDb + "_h");
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
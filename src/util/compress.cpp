@@ -25,6 +25,9 @@ int doCompression(int argc, const char **argv, const Command& command, bool shou
     int dbtype = reader.getDbtype();
     dbtype = shouldCompress ? dbtype | (1 << 31) : dbtype & ~(1 << 31);
     DBWriter writer(par.db2.c_str(), par.db2Index.c_str(), par.threads, shouldCompress, dbtype);
+    if (shouldCompress == true && par.compressionDictSize > 0) {
+        writer.setCompressionDictionary(DBWriter::trainCompressionDictionary(reader, par.compressionDictSize));
+    }
     writer.open();
     Debug::Progress progress(reader.getSize());
 
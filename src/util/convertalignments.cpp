@@ -12,6 +12,7 @@
 #include "MemoryMapped.h"
 #include "NcbiTaxonomy.h"
 #include "MappingReader.h"
+#include "BinaryResult.h"
 
 #define ZSTD_STATIC_LINKING_ONLY
 #include <zstd.h>
@@ -252,6 +253,7 @@ int convertalignments(int argc, const char **argv, const Command &command) {
 
     DBReader<unsigned int> alnDbr(par.db3.c_str(), par.db3Index.c_str(), par.threads, DBReader<unsigned int>::USE_INDEX|DBReader<unsigned int>::USE_DATA);
     alnDbr.open(DBReader<unsigned int>::LINEAR_ACCCESS);
+    const bool binary = BinaryResult::isBinaryDbtype(alnDbr.getDbtype());
 
     size_t localThreads = 1;
 #ifdef OPENMP
@@ -277,10 +279,17 @@ int convertalignments(int argc, const char **argv, const Command &command) {
 
         for (size_t i = 0; i < alnDbr.getSize(); i++) {
             char *data = alnDbr.getData(i, 0);
-            while (*data != '\0') {
-                char dbKeyBuffer[255 + 1];
-                Util::parseKey(data, dbKeyBuffer);
-                const unsigned int dbKey = (unsigned int) strtoul(dbKeyBuffer, NULL, 10);
+            BinaryResult::EntryReader binaryReader(data, binary ? alnDbr.getEntryLen(i) : 0);
+            while (binary ? binaryReader.next() : (*data != '\0')) {
+                unsigned int dbKey;
+                if (binary) {
+                    dbKey = binaryReader.getDbKey();
+                } else {
+                    char dbKeyBuffer[255 + 1];
+                    Util::parseKey(data, dbKeyBuffer);
+                    dbKey = (unsigned int) strtoul(dbKeyBuffer, NULL, 10);
+                    data = Util::skipLine(data);
+                }
                 if (headerWritten[dbKey] == false) {
                     headerWritten[dbKey] = true;
                     unsigned int tId = tDbr->sequenceReader->getId(dbKey);
@@ -297,7 +306,6 @@ int convertalignments(int argc, const char **argv, const Command &command) {
                     resultWriter.writeAdd(buffer, count, 0);
                 }
                 resultWriter.writeEnd(0, 0, false, 0);
-                data = Util::skipLine(data);
             }
         }
         delete[] headerWritten;
@@ -397,9 +405,12 @@ int convertalignments(int argc, const char **argv, const Command &command) {
             }
 
             char *data = alnDbr.getData(i, thread_idx);
-            while (*data != '\0') {
-                Matcher::result_t res = Matcher::parseAlignmentRecord(data, true);
-                data = Util::skipLine(data);
+            BinaryResult::EntryReader binaryReader(data, binary ? alnDbr.getEntryLen(i) : 0);
+            while (binary ? binaryReader.next() : (*data != '\0')) {
+                Matcher::result_t res = binary ? binaryReader.getAlignmentResult(true) : Matcher::parseAlignmentRecord(data, true);
+                if (binary == false) {
+                    data = Util::skipLine(data);
+                }
 
                 if (res.backtrace.empty() && needBacktrace == true) {
                     Debug(Debug::ERROR) << "Backtrace cigar is missing in the alignment result. Please recompute the alignment with the -a flag.\n"
@@ -6,12 +6,46 @@
  */
 
 #include "FileUtil.h"
+#include "DBReader.h"
 #include "DBWriter.h"
 #include "Debug.h"
 #include "Util.h"
 #include "KSeqWrapper.h"
 #include "itoa.h"
 
+#include <algorithm>
+
+#ifdef OPENMP
+#include <omp.h>
+#endif
+
+// rewrites a database compressed with a zstd dictionary trained on its own entries
+static void compressWithDictionary(const std::string &dataFile, unsigned int threads, size_t dictSize) {
+    std::string indexFile = dataFile + ".index";
+    DBReader<unsigned int> reader(dataFile.c_str(), indexFile.c_str(), threads, DBReader<unsigned int>::USE_INDEX|DBReader<unsigned int>::USE_DATA);
+    reader.open(DBReader<unsigned int>::LINEAR_ACCCESS);
+
+    std::string tmpDataFile = dataFile + "_zdict_tmp";
+    std::string tmpIndexFile = tmpDataFile + ".index";
+    DBWriter writer(tmpDataFile.c_str(), tmpIndexFile.c_str(), threads, Parameters::WRITER_COMPRESSED_MODE, reader.getDbtype());
+    writer.setCompressionDictionary(DBWriter::trainCompressionDictionary(reader, dictSize));
+    writer.open();
+#pragma omp parallel num_threads(threads)
+    {
+        unsigned int thread_idx = 0;
+#ifdef OPENMP
+        thread_idx = (unsigned int) omp_get_thread_num();
+#endif
+#pragma omp for schedule(static)
+        for (size_t i = 0; i < reader.getSize(); ++i) {
+            writer.writeData(reader.getData(i, thread_idx), std::max(reader.getEntryLen(i), (size_t) 1) - 1, reader.getDbKey(i), thread_idx);
+        }
+    }
+    writer.close(true);
+    reader.close();
+    DBReader<unsigned int>::moveDb(tmpDataFile, dataFile);
+}
+
 int createdb(int argc, const char **argv, const Command& command) {
     Parameters &par = Parameters::getInstance();
     par.parseParameters(argc, argv, command, true, Parameters::PARSE_VARIADIC, 0);
@@ -64,6 +98,10 @@ int createdb(int argc, const char **argv, const Command& command) {
         par.compressed = 0;
     }
 
+    // entries are compressed after all of them are known, the dictionary is trained on them
+    const bool trainDictionary = par.compressed && par.compressionDictSize > 0;
+    const int compressed = trainDictionary ? 0 : par.compressed;
+
     std::string hdrDataFile = dataFile + "_h";
     std::string hdrIndexFile = dataFile + "_h.index";
 
@@ -89,9 +127,9 @@ int createdb(int argc, const char **argv, const Command& command) {
         Debug(Debug::ERROR) << "Cannot open " << sourceFile << " for writing\n";
         EXIT(EXIT_FAILURE);
     }
-    DBWriter hdrWriter(hdrDataFile.c_str(), hdrIndexFile.c_str(), shuffleSplits, par.compressed, Parameters::DBTYPE_GENERIC_DB);
+    DBWriter hdrWriter(hdrDataFile.c_str(), hdrIndexFile.c_str(), shuffleSplits, compressed, Parameters::DBTYPE_GENERIC_DB);
     hdrWriter.open();
-    DBWriter seqWriter(dataFile.c_str(), indexFile.c_str(), shuffleSplits, par.compressed, (dbType == -1) ? Parameters::DBTYPE_OMIT_FILE : dbType );
+    DBWriter seqWriter(dataFile.c_str(), indexFile.c_str(), shuffleSplits, compressed, (dbType == -1) ? Parameters::DBTYPE_OMIT_FILE : dbType );
     seqWriter.open();
     size_t headerFileOffset = 0;
     size_t seqFileOffset = 0;
@@ -254,7 +292,7 @@ int createdb(int argc, const char **argv, const Command& command) {
         } else {
             dbType = Parameters::DBTYPE_AMINO_ACIDS;
         }
-        seqWriter.writeDbtypeFile(seqWriter.getDataFileName(), dbType ,par.compressed);
+        seqWriter.writeDbtypeFile(seqWriter.getDataFileName(), dbType ,compressed);
     }
     Debug(Debug::INFO) << "Database type: " << Parameters::getDbTypeName(dbType) << "\n";
     if (dbInput == true) {
@@ -276,6 +314,10 @@ int createdb(int argc, const char **argv, const Command& command) {
         DBWriter::createRenumberedDB(dataFile, indexFile, "", "", DBReader<unsigned int>::LINEAR_ACCCESS);
         DBWriter::createRenumberedDB(hdrDataFile, hdrIndexFile, "", "", DBReader<unsigned int>::LINEAR_ACCCESS);
     }
+    if (trainDictionary) {
+        compressWithDictionary(dataFile, par.threads, par.compressionDictSize);
+        compressWithDictionary(hdrDataFile, par.threads, par.compressionDictSize);
+    }
     if (par.createdbMode == Parameters::SEQUENCE_SPLIT_MODE_SOFT) {
         if (filenames.size() == 1) {
             FileUtil::symlinkAbs(filenames[0], dataFile);
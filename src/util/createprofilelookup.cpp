@@ -0,0 +1,20 @@
+#include "Parameters.h"
+#include "DBReader.h"
+#include "Debug.h"
+#include "ProfileLookup.h"
+#include "SubstitutionMatrix.h"
+
+int createprofilelookup(int argc, const char **argv, const Command &command) {
+    Parameters &par = Parameters::getInstance();
+    par.parseParameters(argc, argv, command, true, 0, MMseqsParameter::COMMAND_PROFILE);
+
+    DBReader<unsigned int> reader(par.db1.c_str(), par.db1Index.c_str(), par.threads, DBReader<unsigned int>::USE_INDEX | DBReader<unsigned int>::USE_DATA);
+    reader.open(DBReader<unsigned int>::LINEAR_ACCCESS);
+
+    // the same matrix as in align, the alignment profiles depend on its alphabet size
+    SubstitutionMatrix subMat(par.scoringMatrixFile.values.aminoacid().c_str(), 2.0f, 0.0);
+    ProfileLookup::write(par.db1, reader, &subMat, par.threads);
+    reader.close();
+
+    return EXIT_SUCCESS;
+}
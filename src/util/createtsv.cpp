@@ -5,6 +5,7 @@
 #include "Util.h"
 #include "IndexReader.h"
 #include "FileUtil.h"
+#include "BinaryResult.h"
 
 #ifdef OPENMP
 #include <omp.h>
@@ -67,6 +68,7 @@ int createtsv(int argc, const char **argv, const Command &command) {
     writer.open();
 
     const size_t targetColumn = (par.targetTsvColumn == 0) ? SIZE_T_MAX :  par.targetTsvColumn - 1;
+    const bool binary = BinaryResult::isBinaryDbtype(reader->getDbtype());
 #pragma omp parallel
     {
         unsigned int thread_idx = 0;
@@ -79,6 +81,7 @@ int createtsv(int argc, const char **argv, const Command &command) {
 
         std::string outputBuffer;
         outputBuffer.reserve(10 * 1024);
+        std::string binaryText;
 
 #pragma omp for schedule(dynamic, 1000)
         for (size_t i = 0; i < reader->getSize(); ++i) {
@@ -103,6 +106,11 @@ int createtsv(int argc, const char **argv, const Command &command) {
             size_t entryIndex = 0;
 
             char *data = reader->getData(i, thread_idx);
+            if (binary) {
+                binaryText.clear();
+                BinaryResult::toText(data, reader->getEntryLen(i), binaryText);
+                data = (char *) binaryText.c_str();
+            }
             while (*data != '\0') {
                 if(targetColumn != SIZE_T_MAX){
                     size_t foundElements = Util::getWordsOfLine(data, columnPointer, 255);
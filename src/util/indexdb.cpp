@@ -41,6 +41,8 @@ std::string findIncompatibleParameter(DBReader<unsigned int>& index, const Param
         return "seedScoringMatrixFile";
     if (par.spacedKmerPattern != PrefilteringIndexReader::getSpacedPattern(&index))
         return "spacedKmerPattern";
+    if (PrefilteringIndexReader::hasCompressedEntries(&index) != par.indexCompression)
+        return "indexCompression";
     return "";
 }
 
@@ -78,7 +80,9 @@ int indexdb(int argc, const char **argv, const Command &command) {
 
     int splitMode = Parameters::TARGET_DB_SPLIT;
     par.maxResListLen = std::min(dbr.getSize(), par.maxResListLen);
-    Prefiltering::setupSplit(dbr, seedSubMat->alphabetSize - 1, dbr.getDbtype(), par.threads, false, memoryLimit, 1, par.maxResListLen, par.kmerSize, par.split, splitMode);
+    // uses the memory measured by earlier prefilter runs against this database
+    SplitPlanner planner(dbr, par.db1, seedSubMat, seedSubMat->alphabetSize - 1, dbr.getDbtype(), par.indexCompression, par);
+    Prefiltering::setupSplit(planner, false, memoryLimit, 1, par.maxResListLen, par.kmerSize, par.split, splitMode);
 
     bool kScoreSet = false;
     for (size_t i = 0; i < par.indexdb.size(); i++) {
@@ -155,7 +159,7 @@ int indexdb(int argc, const char **argv, const Command &command) {
         PrefilteringIndexReader::createIndexFile(indexDB, &dbr, dbr2, &hdbr1, hdbr2, alndbr, seedSubMat, par.maxSeqLen,
                                                  par.spacedKmer, par.spacedKmerPattern, par.compBiasCorrection,
                                                  seedSubMat->alphabetSize, par.kmerSize, par.maskMode, par.maskLowerCaseMode,
-                                                 par.maskProb, kmerScore, par.split);
+                                                 par.maskProb, kmerScore, par.split, par.indexCompression);
 
         if (hdbr2 != NULL) {
             hdbr2->close();
@@ -4,6 +4,7 @@
 #include "Debug.h"
 #include "Parameters.h"
 #include "Util.h"
+#include "BinaryResult.h"
 
 int mergedbs(int argc, const char **argv, const Command& command) {
     Parameters& par = Parameters::getInstance();
@@ -28,6 +29,19 @@ int mergedbs(int argc, const char **argv, const Command& command) {
         filesToMerge[i]->open(DBReader<unsigned int>::NOSORT);
     }
 
+    // binary result entries can be concatenated as they are, but cannot carry text prefixes
+    const bool binary = BinaryResult::isBinaryDbtype(filesToMerge[0]->getDbtype());
+    for (size_t i = 1; i < fileCount; i++) {
+        if (BinaryResult::isBinaryDbtype(filesToMerge[i]->getDbtype()) != binary) {
+            Debug(Debug::ERROR) << "Cannot merge binary and text result databases\n";
+            EXIT(EXIT_FAILURE);
+        }
+    }
+    if (binary && prefices.empty() == false) {
+        Debug(Debug::ERROR) << "Prefixes cannot be added to binary result databases\n";
+        EXIT(EXIT_FAILURE);
+    }
+
     DBWriter writer(par.db2.c_str(), par.db2Index.c_str(), 1, par.compressed, filesToMerge[0]->getDbtype());
     writer.open();
 
@@ -6,6 +6,7 @@
 #include "NcbiTaxonomy.h"
 #include "FastSort.h"
 #include "MemoryMapped.h"
+#include "MappingReader.h"
 
 #ifdef HAVE_ZLIB
 #include "gzstream.h"
@@ -20,8 +21,8 @@ static bool compareToFirstString(const std::pair<std::string, TaxID>& lhs, const
     return (lhs.first <= rhs.first);
 }
 
-static bool sortMappingByDbKey(const std::pair<unsigned int, TaxID>& lhs, const std::pair<unsigned int, TaxID>& rhs){
-    return (lhs.first <= rhs.first);
+static bool sortMappingByDbKey(const std::pair<unsigned int, unsigned int>& lhs, const std::pair<unsigned int, unsigned int>& rhs){
+    return (lhs.first < rhs.first);
 }
 
 static bool sortByFirstString(const std::pair<std::string, TaxID>& lhs, const std::pair<std::string, TaxID>& rhs){
@@ -226,14 +227,14 @@ int nrtotaxmapping(int argc, const char **argv, const Command& command) {
     accessionMapping.clear();
     delete taxonomy;
 
-    // rewrite mapping to be sorted to avoid future on-the-fly sorting
+    // rewrite mapping as sorted binary mapping to avoid future on-the-fly parsing and sorting
     MemoryMapped mappingUnsorted(resultDbData, MemoryMapped::WholeFile, MemoryMapped::SequentialScan);
     if (!mappingUnsorted.isValid()){
         Debug(Debug::ERROR) << "Could not open mapping file " << resultDbData << "\n";
         EXIT(EXIT_FAILURE);
     }
     char* data = (char *) mappingUnsorted.getData();
-    std::vector<std::pair<unsigned int, TaxID>> mapping;
+    std::vector<std::pair<unsigned int, unsigned int>> mapping;
     mapping.reserve(processed);
     const char *entry[255];
     progress.reset(processed);
@@ -251,33 +252,7 @@ int nrtotaxmapping(int argc, const char **argv, const Command& command) {
     }
     mappingUnsorted.close();
     SORT_PARALLEL(mapping.begin(), mapping.end(), sortMappingByDbKey);
-    FILE* handle = FileUtil::openFileOrDie(resultDbData.c_str(), "w", true);
-    if (handle == NULL) {
-        Debug(Debug::ERROR) << "Could not write to mapping file " << resultDbData << "\n";
-        EXIT(EXIT_FAILURE);
-    }
-
-    std::string result;
-    result.reserve(128);
-    progress.reset(processed);
-    for (size_t i = 0; i < mapping.size(); ++i) {
-        progress.updateProgress();
-        result.append(SSTR(mapping[i].first));
-        result.append(1, '\t');
-        result.append(SSTR(mapping[i].second));
-        result.append(1, '\n');
-        int written = fwrite(result.c_str(), sizeof(char), result.size(), handle);
-        if (written != (int) result.size()) {
-            Debug(Debug::ERROR) << "Could not write to mapping file " << resultDbData << "\n";
-            EXIT(EXIT_FAILURE);
-        }
-        result.clear();
-    }
-
-    if (fclose(handle) != 0) {
-        Debug(Debug::ERROR) << "Could not close mapping file " << resultDbData << "\n";
-        EXIT(EXIT_FAILURE);
-    }
+    MappingReader::writeBinary(resultDbData, mapping);
 
     return EXIT_SUCCESS;
 }
@@ -5,6 +5,7 @@
 #include "Debug.h"
 #include "Util.h"
 #include "FastSort.h"
+#include "MappingReader.h"
 
 #include <climits>
 
@@ -65,7 +66,7 @@ int renamedbkeys(int argc, const char **argv, const Command &command) {
     if (FileUtil::fileExists((par.db2 + "_mapping").c_str())) {
         mapping.reserve(reader.getSize());
         newMapping.reserve(reader.getSize());
-        bool isSorted = Util::readMapping(par.db2 + "_mapping", mapping);
+        bool isSorted = MappingReader::readMapping(par.db2 + "_mapping", mapping);
         if (isSorted == false) {
             std::stable_sort(mapping.begin(), mapping.end(), compareToFirst);
         }
@@ -173,9 +174,9 @@ int renamedbkeys(int argc, const char **argv, const Command &command) {
         }
     }
     if (par.subDbMode == Parameters::SUBDB_MODE_SOFT) {
-        DBReader<unsigned int>::softlinkDb(par.db2, par.db3, (DBFiles::Files) (DBFiles::SOURCE | DBFiles::TAX_MERGED | DBFiles::TAX_NAMES | DBFiles::TAX_NODES | DBFiles::TAX_BINARY));
+        DBReader<unsigned int>::softlinkDb(par.db2, par.db3, (DBFiles::Files) (DBFiles::SOURCE | DBFiles::TAX_MERGED | DBFiles::TAX_NAMES | DBFiles::TAX_NODES | DBFiles::TAX_BINARY | DBFiles::DATA_ZDICT | DBFiles::HEADER_ZDICT));
     } else {
-        DBReader<unsigned int>::copyDb(par.db2, par.db3, (DBFiles::Files) (DBFiles::SOURCE | DBFiles::TAX_MERGED | DBFiles::TAX_NAMES | DBFiles::TAX_NODES | DBFiles::TAX_BINARY));
+        DBReader<unsigned int>::copyDb(par.db2, par.db3, (DBFiles::Files) (DBFiles::SOURCE | DBFiles::TAX_MERGED | DBFiles::TAX_NAMES | DBFiles::TAX_NODES | DBFiles::TAX_BINARY | DBFiles::DATA_ZDICT | DBFiles::HEADER_ZDICT));
     }
 
     free(line);
@@ -9,6 +9,7 @@
 #include "FileUtil.h"
 #include "tantan.h"
 #include "IndexReader.h"
+#include "ChunkScheduler.h"
 
 #ifdef OPENMP
 #include <omp.h>
@@ -43,16 +44,17 @@ int result2profile(int argc, const char **argv, const Command &command, bool ret
 
     DBReader<unsigned int> resultReader(par.db3.c_str(), par.db3Index.c_str(), par.threads, DBReader<unsigned int>::USE_DATA | DBReader<unsigned int>::USE_INDEX);
     resultReader.open(DBReader<unsigned int>::LINEAR_ACCCESS);
-    size_t dbFrom = 0;
-    size_t dbSize = 0;
+    const size_t dbSize = resultReader.getSize();
 #ifdef HAVE_MPI
-    resultReader.decomposeDomainByAminoAcid(MMseqsMPI::rank, MMseqsMPI::numProc, &dbFrom, &dbSize);
-    Debug(Debug::INFO) << "Compute split from " << dbFrom << " to " << dbFrom + dbSize << "\n";
-    std::pair<std::string, std::string> tmpOutput = Util::createTmpFileNames(par.db4, par.db4Index, MMseqsMPI::rank);
+    ChunkScheduler chunks(ChunkScheduler::MPI, dbSize, dbSize);
 #else
-    dbSize = resultReader.getSize();
-    std::pair<std::string, std::string> tmpOutput = std::make_pair(par.db4, par.db4Index);
+    ChunkScheduler chunks(par.workQueue.empty() ? ChunkScheduler::LOCAL : ChunkScheduler::SHARED_FILE, dbSize, dbSize, par.workQueue);
 #endif
+    std::pair<std::string, std::string> tmpOutput = std::make_pair(par.db4, par.db4Index);
+    if (chunks.isDistributed()) {
+        Debug(Debug::INFO) << "Compute chunks of " << chunks.getChunkSize() << " entries as worker " << chunks.getWorkerId() << "\n";
+        tmpOutput = Util::createTmpFileNames(par.db4, par.db4Index, chunks.getWorkerId());
+    }
 
     size_t localThreads = 1;
 #ifdef OPENMP
@@ -136,7 +138,11 @@ int result2profile(int argc, const char **argv, const Command &command, bool ret
     Debug(Debug::INFO) << "Target database size: " << tDbr->getSize() << " type: " << Parameters::getDbTypeName(targetSeqType) << "\n";
 
     const bool isFiltering = par.filterMsa != 0 || returnAlnRes;
-    Debug::Progress progress(dbSize - dbFrom);
+    Debug::Progress progress(dbSize);
+    // the threads of a worker process the chunks one after another
+    size_t chunkFrom = 0;
+    size_t chunkSize = 0;
+    bool hasChunk = false;
 #pragma omp parallel num_threads(localThreads)
     {
         unsigned int thread_idx = 0;
@@ -169,106 +175,113 @@ int result2profile(int argc, const char **argv, const Command &command, bool ret
         std::string result;
         result.reserve((maxSequenceLength + 1) * Sequence::PROFILE_READIN_SIZE);
 
-#pragma omp for schedule(dynamic, 10)
-        for (size_t id = dbFrom; id < (dbFrom + dbSize); id++) {
-            progress.updateProgress();
-
-            unsigned int queryKey = resultReader.getDbKey(id);
-            size_t queryId = qDbr->getId(queryKey);
-            if (queryId == UINT_MAX) {
-                Debug(Debug::WARNING) << "Invalid query sequence " << queryKey << "\n";
-                continue;
+        while (true) {
+#pragma omp single
+            hasChunk = chunks.next(chunkFrom, chunkSize);
+            if (hasChunk == false) {
+                break;
             }
-            centerSequence.mapSequence(queryId, queryKey, qDbr->getData(queryId, thread_idx), qDbr->getSeqLen(queryId));
-
-            bool isQueryInit = false;
-            char *data = resultReader.getData(id, thread_idx);
-            while (*data != '\0') {
-                Util::parseKey(data, dbKey);
-                const unsigned int key = (unsigned int) strtoul(dbKey, NULL, 10);
-                // in the same database case, we have the query repeated
-                if (key == queryKey && sameDatabase == true) {
-                    if(returnAlnRes && par.includeIdentity){
-                        Matcher::result_t res = Matcher::parseAlignmentRecord(data);
-                        size_t len = Matcher::resultToBuffer(buffer, res, true);
-                        result.append(buffer, len);
-                    }
+#pragma omp for schedule(dynamic, 10)
+            for (size_t id = chunkFrom; id < (chunkFrom + chunkSize); id++) {
+                progress.updateProgress();
 
-                    data = Util::skipLine(data);
+                unsigned int queryKey = resultReader.getDbKey(id);
+                size_t queryId = qDbr->getId(queryKey);
+                if (queryId == UINT_MAX) {
+                    Debug(Debug::WARNING) << "Invalid query sequence " << queryKey << "\n";
                     continue;
                 }
+                centerSequence.mapSequence(queryId, queryKey, qDbr->getData(queryId, thread_idx), qDbr->getSeqLen(queryId));
+
+                bool isQueryInit = false;
+                char *data = resultReader.getData(id, thread_idx);
+                while (*data != '\0') {
+                    Util::parseKey(data, dbKey);
+                    const unsigned int key = (unsigned int) strtoul(dbKey, NULL, 10);
+                    // in the same database case, we have the query repeated
+                    if (key == queryKey && sameDatabase == true) {
+                        if(returnAlnRes && par.includeIdentity){
+                            Matcher::result_t res = Matcher::parseAlignmentRecord(data);
+                            size_t len = Matcher::resultToBuffer(buffer, res, true);
+                            result.append(buffer, len);
+                        }
 
-                const size_t columns = Util::getWordsOfLine(data, entry, 255);
-                float evalue = 0.0;
-                if (returnAlnRes == false && columns >= 4) {
-                    evalue = strtod(entry[3], NULL);
-                }
+                        data = Util::skipLine(data);
+                        continue;
+                    }
 
-                if (returnAlnRes == true || evalue < par.evalProfile) {
-                    const size_t edgeId = tDbr->getId(key);
-                    if (edgeId == UINT_MAX) {
-                        Debug(Debug::ERROR) << "Sequence " << key << " does not exist in target sequence database\n";
-                        EXIT(EXIT_FAILURE);
+                    const size_t columns = Util::getWordsOfLine(data, entry, 255);
+                    float evalue = 0.0;
+                    if (returnAlnRes == false && columns >= 4) {
+                        evalue = strtod(entry[3], NULL);
                     }
-                    edgeSequence.mapSequence(edgeId, key, tDbr->getData(edgeId, thread_idx), tDbr->getSeqLen(edgeId));
-                    seqSet.emplace_back(std::vector<unsigned char>(edgeSequence.numSequence, edgeSequence.numSequence + edgeSequence.L));
-
-                    if (columns > Matcher::ALN_RES_WITHOUT_BT_COL_CNT) {
-                        alnResults.emplace_back(Matcher::parseAlignmentRecord(data));
-                    } else {
-                        // Recompute if not all the backtraces are present
-                        if (isQueryInit == false) {
-                            matcher.initQuery(&centerSequence);
-                            isQueryInit = true;
+
+                    if (returnAlnRes == true || evalue < par.evalProfile) {
+                        const size_t edgeId = tDbr->getId(key);
+                        if (edgeId == UINT_MAX) {
+                            Debug(Debug::ERROR) << "Sequence " << key << " does not exist in target sequence database\n";
+                            EXIT(EXIT_FAILURE);
+                        }
+                        edgeSequence.mapSequence(edgeId, key, tDbr->getData(edgeId, thread_idx), tDbr->getSeqLen(edgeId));
+                        seqSet.emplace_back(std::vector<unsigned char>(edgeSequence.numSequence, edgeSequence.numSequence + edgeSequence.L));
+
+                        if (columns > Matcher::ALN_RES_WITHOUT_BT_COL_CNT) {
+                            alnResults.emplace_back(Matcher::parseAlignmentRecord(data));
+                        } else {
+                            // Recompute if not all the backtraces are present
+                            if (isQueryInit == false) {
+                                matcher.initQuery(&centerSequence);
+                                isQueryInit = true;
+                            }
+                            alnResults.emplace_back(matcher.getSWResult(&edgeSequence, INT_MAX, false, 0, 0.0, FLT_MAX, Matcher::SCORE_COV_SEQID, 0, false));
                         }
-                        alnResults.emplace_back(matcher.getSWResult(&edgeSequence, INT_MAX, false, 0, 0.0, FLT_MAX, Matcher::SCORE_COV_SEQID, 0, false));
                     }
+                    data = Util::skipLine(data);
                 }
-                data = Util::skipLine(data);
-            }
 
-            // Recompute if not all the backtraces are present
-            MultipleAlignment::MSAResult res = aligner.computeMSA(&centerSequence, seqSet, alnResults, true);
+                // Recompute if not all the backtraces are present
+                MultipleAlignment::MSAResult res = aligner.computeMSA(&centerSequence, seqSet, alnResults, true);
 
-            // do not count query
-            size_t filteredSetSize = (isFiltering == true)  ?
-                                     filter.filter(res, alnResults, (int)(par.covMSAThr * 100), qid_vec, par.qsc, (int)(par.filterMaxSeqId * 100), par.Ndiff, par.filterMinEnable)
-                                     :
-                                     res.setSize;
-             //MultipleAlignment::print(res, &subMat);
+                // do not count query
+                size_t filteredSetSize = (isFiltering == true)  ?
+                                         filter.filter(res, alnResults, (int)(par.covMSAThr * 100), qid_vec, par.qsc, (int)(par.filterMaxSeqId * 100), par.Ndiff, par.filterMinEnable)
+                                         :
+                                         res.setSize;
+                 //MultipleAlignment::print(res, &subMat);
 
-            if (returnAlnRes) {
-                for (size_t i = 0; i < (filteredSetSize - 1); ++i) {
-                    size_t len = Matcher::resultToBuffer(buffer, alnResults[i], true);
-                    result.append(buffer, len);
-                }
-            } else {
-                for (size_t pos = 0; pos < res.centerLength; pos++) {
-                    if (res.msaSequence[0][pos] == MultipleAlignment::GAP) {
-                        Debug(Debug::ERROR) << "Error in computePSSMFromMSA. First sequence of MSA is not allowed to contain gaps.\n";
-                        EXIT(EXIT_FAILURE);
+                if (returnAlnRes) {
+                    for (size_t i = 0; i < (filteredSetSize - 1); ++i) {
+                        size_t len = Matcher::resultToBuffer(buffer, alnResults[i], true);
+                        result.append(buffer, len);
+                    }
+                } else {
+                    for (size_t pos = 0; pos < res.centerLength; pos++) {
+                        if (res.msaSequence[0][pos] == MultipleAlignment::GAP) {
+                            Debug(Debug::ERROR) << "Error in computePSSMFromMSA. First sequence of MSA is not allowed to contain gaps.\n";
+                            EXIT(EXIT_FAILURE);
+                        }
                     }
-                }
 
-                PSSMCalculator::Profile pssmRes = calculator.computePSSMFromMSA(filteredSetSize, res.centerLength,
-                                                                                (const char **) res.msaSequence, alnResults, par.wg);
-                if (par.compBiasCorrection == true){
-                    SubstitutionMatrix::calcGlobalAaBiasCorrection(&subMat, pssmRes.pssm, pNullBuffer,
-                                                                   Sequence::PROFILE_AA_SIZE,
-                                                                   res.centerLength);
-                }
+                    PSSMCalculator::Profile pssmRes = calculator.computePSSMFromMSA(filteredSetSize, res.centerLength,
+                                                                                    (const char **) res.msaSequence, alnResults, par.wg);
+                    if (par.compBiasCorrection == true){
+                        SubstitutionMatrix::calcGlobalAaBiasCorrection(&subMat, pssmRes.pssm, pNullBuffer,
+                                                                       Sequence::PROFILE_AA_SIZE,
+                                                                       res.centerLength);
+                    }
 
-                if (par.maskProfile == true) {
-                    masker.mask(centerSequence, par.maskProb, pssmRes);
+                    if (par.maskProfile == true) {
+                        masker.mask(centerSequence, par.maskProb, pssmRes);
+                    }
+                    pssmRes.toBuffer(centerSequence, subMat, result);
                 }
-                pssmRes.toBuffer(centerSequence, subMat, result);
-            }
-            resultWriter.writeData(result.c_str(), result.length(), queryKey, thread_idx);
-            result.clear();
-            alnResults.clear();
+                resultWriter.writeData(result.c_str(), result.length(), queryKey, thread_idx);
+                result.clear();
+                alnResults.clear();
 
-            MultipleAlignment::deleteMSA(&res);
-            seqSet.clear();
+                MultipleAlignment::deleteMSA(&res);
+                seqSet.clear();
+            }
         }
         delete[] pNullBuffer;
     }
@@ -286,21 +299,19 @@ int result2profile(int argc, const char **argv, const Command &command, bool ret
         delete tDbrIdx;
     }
 
-#ifdef HAVE_MPI
-    MPI_Barrier(MPI_COMM_WORLD);
-    // master reduces results
-    if (MMseqsMPI::isMaster()) {
+    // one worker merges the results of all workers
+    const bool isMerger = chunks.finish();
+    if (chunks.isDistributed() && isMerger) {
         std::vector<std::pair<std::string, std::string>> splitFiles;
-        for (int procs = 0; procs < MMseqsMPI::numProc; procs++) {
-            std::pair<std::string, std::string> tmpFile = Util::createTmpFileNames(par.db4, par.db4Index, procs);
+        for (size_t worker = 0; worker < chunks.getWorkerCount(); worker++) {
+            std::pair<std::string, std::string> tmpFile = Util::createTmpFileNames(par.db4, par.db4Index, worker);
             splitFiles.push_back(std::make_pair(tmpFile.first, tmpFile.second));
 
         }
         DBWriter::mergeResults(par.db4, par.db4Index, splitFiles);
     }
-#endif
 
-    if (MMseqsMPI::isMaster() && returnAlnRes == false) {
+    if (isMerger && returnAlnRes == false) {
         DBReader<unsigned int>::softlinkDb(par.db1, par.db4, DBFiles::SEQUENCE_ANCILLARY);
     }
 
@@ -10,6 +10,7 @@
 #include "PrefilteringIndexReader.h"
 #include "IndexReader.h"
 #include "FastSort.h"
+#include "BinaryResult.h"
 
 #ifdef OPENMP
 #include <omp.h>
@@ -103,6 +104,8 @@ int doswap(Parameters& par, bool isGeneralMode) {
     resultDbr.open(DBReader<unsigned int>::SORT_BY_OFFSET);
 
     const size_t resultSize = resultDbr.getSize();
+    // binary results are swapped record by record, each record is stored as a block of its own
+    const bool binary = BinaryResult::isBinaryDbtype(resultDbr.getDbtype());
     Debug(Debug::INFO) << "Computing offsets.\n";
     size_t *targetElementSize = new size_t[maxTargetId + 2]; // extra element for offset + 1 index id
     memset(targetElementSize, 0, sizeof(size_t) * (maxTargetId + 2));
@@ -124,6 +127,13 @@ int doswap(Parameters& par, bool isGeneralMode) {
                 *(tmpBuff) = '\0';
                 size_t queryKeyLen = strlen(queryKeyStr);
                 char *data = resultDbr.getData(i, thread_idx);
+                if (binary) {
+                    BinaryResult::EntryReader reader(data, resultDbr.getEntryLen(i));
+                    while (reader.next()) {
+                        __sync_fetch_and_add(&(targetElementSize[reader.getDbKey()]), reader.getRecordBlockSize());
+                    }
+                    continue;
+                }
                 char dbKeyBuffer[255 + 1];
                 while (*data != '\0') {
                     Util::parseKey(data, dbKeyBuffer);
@@ -183,6 +193,17 @@ int doswap(Parameters& par, bool isGeneralMode) {
                 progress.updateProgress();
                 char *data = resultDbr.getData(i, thread_idx);
                 unsigned int queryKey = resultDbr.getDbKey(i);
+                if (binary) {
+                    BinaryResult::EntryReader reader(data, resultDbr.getEntryLen(i));
+                    while (reader.next()) {
+                        const unsigned int dbKey = reader.getDbKey();
+                        size_t offset = __sync_fetch_and_add(&(targetElementSize[dbKey]), reader.getRecordBlockSize()) - prevBytesToWrite;
+                        if (dbKey >= prevDbKeyToWrite && dbKey <= dbKeyToWrite) {
+                            reader.copyRecordAsBlock(&tmpData[offset], queryKey);
+                        }
+                    }
+                    continue;
+                }
                 char queryKeyStr[1024];
                 char *tmpBuff = Itoa::u32toa_sse2((uint32_t) queryKey, queryKeyStr);
                 *(tmpBuff) = '\0';
@@ -222,6 +243,14 @@ int doswap(Parameters& par, bool isGeneralMode) {
             if (*data == '\0'){
                 continue;
             }
+            if (binary) {
+                BinaryResult::EntryReader reader(data, resultDbr.getEntryLen(i));
+                if (reader.next()) {
+                    isAlignmentResult = reader.isAlignment();
+                    hasBacktrace = (reader.getFlags() & BinaryResult::FLAG_BACKTRACE) != 0;
+                }
+                break;
+            }
             const size_t columns = Util::getWordsOfLine(data, entry, 255);
             isAlignmentResult = columns >= Matcher::ALN_RES_WITHOUT_BT_COL_CNT;
             hasBacktrace = columns >= Matcher::ALN_RES_WITH_BT_COL_CNT;
@@ -247,6 +276,7 @@ int doswap(Parameters& par, bool isGeneralMode) {
             // and alnLength for diagonal because its the first int value after
             std::vector<Matcher::result_t> curRes;
             curRes.reserve(300);
+            std::vector<hit_t> binaryHits;
 
             char buffer[1024 + 32768*4];
             std::string ss;
@@ -267,7 +297,23 @@ int doswap(Parameters& par, bool isGeneralMode) {
                 }
 
                 bool evalBreak = false;
-                while (dataSize > 0) {
+                BinaryResult::EntryReader reader(data, binary ? dataSize : 0);
+                while (binary && reader.next()) {
+                    if (isAlignmentResult) {
+                        Matcher::result_t res = reader.getAlignmentResult(true);
+                        Matcher::result_t::swapResult(res, *evaluer, hasBacktrace);
+                        if (res.eval > par.evalThr) {
+                            evalBreak = true;
+                        } else {
+                            curRes.emplace_back(res);
+                        }
+                    } else {
+                        hit_t hit = reader.getHit();
+                        hit.diagonal = static_cast<unsigned short>(static_cast<short>(hit.diagonal) * -1);
+                        curRes.emplace_back(hit.seqId, hit.prefScore, 0, 0, 0, -static_cast<float>(hit.prefScore), hit.diagonal, 0, 0, 0, 0, 0, 0, "");
+                    }
+                }
+                while (binary == false && dataSize > 0) {
                     if (isAlignmentResult) {
                         Matcher::result_t res = Matcher::parseAlignmentRecord(data, true);
                         Matcher::result_t::swapResult(res, *evaluer, hasBacktrace);
@@ -292,7 +338,20 @@ int doswap(Parameters& par, bool isGeneralMode) {
                         SORT_SERIAL(curRes.begin(), curRes.end(), Matcher::compareHits);
                     }
 
-                    for (size_t j = 0; j < curRes.size(); j++) {
+                    if (binary && isAlignmentResult) {
+                        BinaryResult::appendAlignmentResults(ss, curRes.data(), curRes.size(), hasBacktrace, false);
+                    } else if (binary) {
+                        for (size_t j = 0; j < curRes.size(); j++) {
+                            hit_t hit;
+                            hit.seqId = curRes[j].dbKey;
+                            hit.prefScore = curRes[j].score;
+                            hit.diagonal = curRes[j].alnLength;
+                            binaryHits.emplace_back(hit);
+                        }
+                        BinaryResult::appendPrefilterHits(ss, binaryHits.data(), binaryHits.size());
+                        binaryHits.clear();
+                    }
+                    for (size_t j = 0; binary == false && j < curRes.size(); j++) {
                         const Matcher::result_t &res = curRes[j];
                         if (isAlignmentResult) {
                             size_t len = Matcher::resultToBuffer(buffer, res, hasBacktrace, false);
@@ -2,6 +2,7 @@
 #include "IndexReader.h"
 #include "Debug.h"
 #include "Util.h"
+#include "BinaryResult.h"
 
 int view(int argc, const char **argv, const Command& command) {
     Parameters& par = Parameters::getInstance();
@@ -49,6 +50,12 @@ int view(int argc, const char **argv, const Command& command) {
         }
         char* data = reader.sequenceReader->getData(id, 0);
         size_t size = reader.sequenceReader->getEntryLen(id) - 1;
+        if (BinaryResult::isBinaryDbtype(reader.sequenceReader->getDbtype())) {
+            std::string text;
+            BinaryResult::toText(data, size, text);
+            fwrite(text.c_str(), sizeof(char), text.size(), stdout);
+            continue;
+        }
         fwrite(data, sizeof(char), size, stdout);
     }
     EXIT(EXIT_SUCCESS);
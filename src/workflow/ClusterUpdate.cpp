@@ -55,12 +55,14 @@ int clusterupdate(int argc, const char **argv, const Command& command) {
     CommandCaller cmd;
     cmd.addVariable("REMOVE_TMP", par.removeTmpFiles ? "TRUE" : NULL);
     cmd.addVariable("RECOVER_DELETED", par.recoverDeleted ? "TRUE" : NULL);
+    cmd.addVariable("REP_INDEX", par.repIndex ? "TRUE" : NULL);
 
     cmd.addVariable("RUNNER", par.runner.c_str());
     cmd.addVariable("DIFF_PAR", par.createParameterString(par.diff).c_str());
     cmd.addVariable("VERBOSITY", par.createParameterString(par.onlyverbosity).c_str());
     cmd.addVariable("THREADS_PAR", par.createParameterString(par.onlythreads).c_str());
     cmd.addVariable("RESULT2REPSEQ_PAR", par.createParameterString(par.result2repseq).c_str());
+    cmd.addVariable("CREATEINDEX_PAR", par.createParameterString(par.createindex).c_str());
 
     cmd.addVariable("CLUST_PAR", par.createParameterString(par.clusterworkflow, true).c_str());
 
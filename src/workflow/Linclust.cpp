@@ -94,6 +94,14 @@ int linclust(int argc, const char **argv, const Command& command) {
     // filter by diagonal in case of AA (do not filter for nucl, profiles, ...)
     cmd.addVariable("FILTER", Parameters::isEqualDbtype(dbType, Parameters::DBTYPE_AMINO_ACIDS) ? "1" : NULL);
     cmd.addVariable("KMERMATCHER_PAR", par.createParameterString(par.kmermatcher).c_str());
+    // kmerclust derives the hamming thresholds itself and takes the k-mer settings from above
+    bool fusedPreclust = par.fusedPreclust;
+    if (fusedPreclust && par.runner.empty() == false) {
+        Debug(Debug::WARNING) << "--fused-preclust cannot be used together with --mpi-runner. Running separate steps.\n";
+        fusedPreclust = false;
+    }
+    cmd.addVariable("FUSED_PRECLUST", fusedPreclust ? "TRUE" : NULL);
+    cmd.addVariable("KMERCLUST_PAR", par.createParameterString(par.kmerclust).c_str());
     cmd.addVariable("VERBOSITY", par.createParameterString(par.onlyverbosity).c_str());
     cmd.addVariable("VERBOSITYANDCOMPRESS", par.createParameterString(par.threadsandcompression).c_str());
 
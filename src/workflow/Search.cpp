@@ -4,6 +4,8 @@
 #include "FileUtil.h"
 #include "Debug.h"
 #include "PrefilteringIndexReader.h"
+#include "ProfileLookup.h"
+#include "SubstitutionMatrix.h"
 #include "searchtargetprofile.sh.h"
 #include "searchslicedtargetprofile.sh.h"
 #include "blastpgp.sh.h"
@@ -12,10 +14,12 @@
 #include "blastn.sh.h"
 #include "iterativepp.sh.h"
 #include "Parameters.h"
+#include "WorkflowExecutor.h"
 
 #include <iomanip>
 #include <climits>
 #include <cassert>
+#include <cstring>
 
 
 void setSearchDefaults(Parameters *p) {
@@ -199,6 +203,117 @@ void setNuclSearchDefaults(Parameters *p) {
 }
 
 
+// runs the steps of blastp.sh in this process
+// files are <queryDB> <targetDB> <outDB> <tmpDir> as passed to the script
+static int searchInProcess(const std::vector<std::string> &files, const std::vector<std::string> &sensitivities,
+                           const std::string &prefilterPar, const char *alignModule, const std::string &alignmentPar,
+                           const std::string &prefilterAlignPar, const std::string &verbCompPar, const std::string &verbosityPar, bool removeTmp) {
+    const std::string queryDB = files[0];
+    const std::string targetDB = files[1];
+    const std::string outDB = files[2];
+    const std::string tmpDir = files[3];
+    const size_t steps = sensitivities.size();
+
+    WorkflowExecutor executor;
+    // every step searches the same target database
+    executor.shareDatabase(targetDB, Parameters::getInstance().threads);
+    std::string input = queryDB;
+    std::string alnResMerge = tmpDir + "/aln_0";
+    // a single gapped step streams the prefilter results directly into the alignment
+    if (steps == 1 && strcmp(alignModule, "align") == 0) {
+        executor.runStep("prefilteralign", WorkflowExecutor::makeArguments({input, targetDB, outDB}, prefilterAlignPar + " -s " + sensitivities[0]), outDB);
+        if (removeTmp) {
+            const std::string script = tmpDir + "/blastp.sh";
+            if (FileUtil::fileExists(script.c_str())) {
+                FileUtil::remove(script.c_str());
+            }
+        }
+        return EXIT_SUCCESS;
+    }
+
+    for (size_t step = 0; step < steps; step++) {
+        const std::string pref = tmpDir + "/pref_" + SSTR(step);
+        executor.runStep("prefilter", WorkflowExecutor::makeArguments({input, targetDB, pref}, prefilterPar + " -s " + sensitivities[step]), pref);
+
+        if (steps == 1) {
+            executor.runStep(alignModule, WorkflowExecutor::makeArguments({input, targetDB, pref, outDB}, alignmentPar), outDB);
+            break;
+        }
+        const std::string aln = tmpDir + "/aln_" + SSTR(step);
+        executor.runStep(alignModule, WorkflowExecutor::makeArguments({input, targetDB, pref, aln}, alignmentPar), aln);
+
+        // only merge results after first step
+        if (step > 0) {
+            const std::string mergedFlag = aln + ".hasmerged";
+            if (FileUtil::fileExists(mergedFlag.c_str()) == false) {
+                if (step < steps - 1) {
+                    executor.runModule("mergedbs", WorkflowExecutor::makeArguments({queryDB, tmpDir + "/aln_merge_new", alnResMerge, aln}, verbCompPar));
+                    executor.runModule("rmdb", WorkflowExecutor::makeArguments({tmpDir + "/aln_merge"}, verbosityPar));
+                    executor.runModule("mvdb", WorkflowExecutor::makeArguments({tmpDir + "/aln_merge_new", tmpDir + "/aln_merge"}, verbosityPar));
+                } else {
+                    executor.runModule("mergedbs", WorkflowExecutor::makeArguments({queryDB, outDB, alnResMerge, aln}, verbCompPar));
+                    break;
+                }
+                FileUtil::writeFile(mergedFlag, (const unsigned char *) "", 0);
+            }
+            alnResMerge = tmpDir + "/aln_merge";
+        }
+
+        // do not create subdb at last step
+        const std::string nextInput = tmpDir + "/input_" + SSTR(step);
+        if (step < steps - 1) {
+            // queries without any accepted hit are searched again with the next sensitivity
+            const std::string order = tmpDir + "/order_" + SSTR(step);
+            size_t orderCount = 0;
+            {
+                DBReader<unsigned int> reader(aln.c_str(), (aln + ".index").c_str(), 1, DBReader<unsigned int>::USE_INDEX);
+                reader.open(DBReader<unsigned int>::NOSORT);
+                FILE *orderFile = FileUtil::openAndDelete(order.c_str(), "w");
+                for (size_t i = 0; i < reader.getSize(); i++) {
+                    if (reader.getEntryLen(i) < 2) {
+                        fprintf(orderFile, "%u\n", reader.getDbKey(i));
+                        orderCount++;
+                    }
+                }
+                if (fclose(orderFile) != 0) {
+                    Debug(Debug::ERROR) << "Cannot close file " << order << "\n";
+                    EXIT(EXIT_FAILURE);
+                }
+                reader.close();
+            }
+            if (orderCount == 0) {
+                executor.runModule("mvdb", WorkflowExecutor::makeArguments({alnResMerge, outDB}, verbosityPar));
+                break;
+            }
+            executor.runStep("createsubdb", WorkflowExecutor::makeArguments({order, input, nextInput}, verbosityPar + " --subdb-mode 1"), nextInput);
+        }
+        input = nextInput;
+    }
+
+    if (removeTmp) {
+        for (size_t step = 0; step < steps; step++) {
+            const std::string dbs[] = { tmpDir + "/pref_" + SSTR(step), tmpDir + "/aln_" + SSTR(step), tmpDir + "/input_" + SSTR(step) };
+            for (size_t i = 0; i < 3; i++) {
+                if (WorkflowExecutor::dbExists(dbs[i])) {
+                    executor.runModule("rmdb", WorkflowExecutor::makeArguments({dbs[i]}, verbosityPar));
+                }
+            }
+            const std::string order = tmpDir + "/order_" + SSTR(step);
+            if (FileUtil::fileExists(order.c_str())) {
+                FileUtil::remove(order.c_str());
+            }
+        }
+        if (WorkflowExecutor::dbExists(tmpDir + "/aln_merge")) {
+            executor.runModule("rmdb", WorkflowExecutor::makeArguments({tmpDir + "/aln_merge"}, verbosityPar));
+        }
+        const std::string script = tmpDir + "/blastp.sh";
+        if (FileUtil::fileExists(script.c_str())) {
+            FileUtil::remove(script.c_str());
+        }
+    }
+    return EXIT_SUCCESS;
+}
+
 int search(int argc, const char **argv, const Command& command) {
     Parameters &par = Parameters::getInstance();
     setSearchDefaults(&par);
@@ -305,6 +420,11 @@ int search(int argc, const char **argv, const Command& command) {
     par.filenames.push_back(tmpDir);
 
     const int originalRescoreMode = par.rescoreMode;
+    // blastp.sh steps, kept for running the search in process
+    std::vector<std::string> sensitivities;
+    std::string prefilterPar;
+    std::string alignmentPar;
+    std::string prefilterAlignPar;
     CommandCaller cmd;
     cmd.addVariable("VERBOSITY", par.createParameterString(par.onlyverbosity).c_str());
     cmd.addVariable("THREADS_COMP_PAR", par.createParameterString(par.threadsandcompression).c_str());
@@ -342,6 +462,15 @@ int search(int argc, const char **argv, const Command& command) {
         par.evalThr = originalEvalThr;
         cmd.addVariable("FILTER_PAR", par.createParameterString(par.filterresult).c_str());
         cmd.addVariable("FILTER_RESULT", par.exhaustiveFilterMsa == 1 ? "1" : "0");
+        cmd.addVariable("PROFILELOOKUP_PAR", par.createParameterString(par.createprofilelookup).c_str());
+        // the workflow only writes the profile lookup if it fits into the disk space
+        if (Parameters::isEqualDbtype(FileUtil::parseDbType(targetDB.c_str()), Parameters::DBTYPE_HMM_PROFILE)) {
+            DBReader<unsigned int> dbr(targetDB.c_str(), (targetDB + ".index").c_str(), 1, DBReader<unsigned int>::USE_INDEX);
+            dbr.open(DBReader<unsigned int>::NOSORT);
+            SubstitutionMatrix subMat(par.scoringMatrixFile.values.aminoacid().c_str(), 2.0f, 0.0);
+            cmd.addVariable("PROFILELOOKUP_SIZE", SSTR(ProfileLookup::fileSize(dbr, subMat.alphabetSize)).c_str());
+            dbr.close();
+        }
         if (isUngappedMode) {
             par.rescoreMode = Parameters::RESCORE_MODE_ALIGNMENT;
             cmd.addVariable("ALIGNMENT_PAR", par.createParameterString(par.rescorediagonal).c_str());
@@ -463,6 +592,7 @@ int search(int argc, const char **argv, const Command& command) {
                 EXIT(EXIT_FAILURE);
             }
             cmd.addVariable("SENSE_0", SSTR(par.startSens).c_str());
+            sensitivities.push_back(SSTR(par.startSens));
             float sensStepSize = (par.sensitivity - par.startSens) / (static_cast<float>(par.sensSteps) - 1);
             for (int step = 1; step < par.sensSteps; step++) {
                 std::string stepKey = "SENSE_" + SSTR(step);
@@ -471,6 +601,7 @@ int search(int argc, const char **argv, const Command& command) {
                 stream << std::fixed << std::setprecision(1) << stepSense;
                 std::string value = stream.str();
                 cmd.addVariable(stepKey.c_str(), value.c_str());
+                sensitivities.push_back(value);
             }
             cmd.addVariable("STEPS", SSTR((int) par.sensSteps).c_str());
         } else {
@@ -479,6 +610,7 @@ int search(int argc, const char **argv, const Command& command) {
             std::string sens = stream.str();
             cmd.addVariable("SENSE_0", sens.c_str());
             cmd.addVariable("STEPS", SSTR(1).c_str());
+            sensitivities.push_back(sens);
         }
 
         std::vector<MMseqsParameter*> prefilterWithoutS;
@@ -487,14 +619,23 @@ int search(int argc, const char **argv, const Command& command) {
                 prefilterWithoutS.push_back(par.prefilter[i]);
             }
         }
-        cmd.addVariable("PREFILTER_PAR", par.createParameterString(prefilterWithoutS).c_str());
+        prefilterPar = par.createParameterString(prefilterWithoutS);
+        std::vector<MMseqsParameter*> prefilterAlignWithoutS;
+        for (size_t i = 0; i < par.prefilteralign.size(); i++) {
+            if (par.prefilteralign[i]->uniqid != par.PARAM_S.uniqid) {
+                prefilterAlignWithoutS.push_back(par.prefilteralign[i]);
+            }
+        }
+        prefilterAlignPar = par.createParameterString(prefilterAlignWithoutS);
+        cmd.addVariable("PREFILTER_PAR", prefilterPar.c_str());
         if (isUngappedMode) {
             par.rescoreMode = Parameters::RESCORE_MODE_ALIGNMENT;
-            cmd.addVariable("ALIGNMENT_PAR", par.createParameterString(par.rescorediagonal).c_str());
+            alignmentPar = par.createParameterString(par.rescorediagonal);
             par.rescoreMode = originalRescoreMode;
         } else {
-            cmd.addVariable("ALIGNMENT_PAR", par.createParameterString(par.align).c_str());
+            alignmentPar = par.createParameterString(par.align);
         }
+        cmd.addVariable("ALIGNMENT_PAR", alignmentPar.c_str());
         FileUtil::writeFile(tmpDir + "/blastp.sh", blastp_sh, blastp_sh_len);
         program = std::string(tmpDir + "/blastp.sh");
     }
@@ -543,6 +684,16 @@ int search(int argc, const char **argv, const Command& command) {
         program = std::string(tmpDir + "/blastn.sh");
 
     }
+    if (par.inProcess && program == tmpDir + "/blastp.sh") {
+        if (par.runner.empty() == false) {
+            Debug(Debug::WARNING) << "--in-process cannot be used together with --mpi-runner. Running workflow script.\n";
+        } else {
+            const char *alignModule = isUngappedMode ? "rescorediagonal" : (par.lcaSearch ? "lcaalign" : "align");
+            return searchInProcess(par.filenames, sensitivities, prefilterPar, alignModule, alignmentPar, prefilterAlignPar,
+                                   par.createParameterString(par.verbandcompression),
+                                   par.createParameterString(par.onlyverbosity), par.removeTmpFiles);
+        }
+    }
     cmd.execProgram(program.c_str(), par.filenames);
 
     // Should never get here